@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+#
+# Compares two sets of results from dali-adaptor-internal-benchmark, e.g. of
+# the release branch and of a change to it, and lists the stages which got
+# slower or used more memory.
+#
+# Usage: compare-benchmark.py [--threshold PERCENT] baseline.json current.json
+#
+# Exits with 1 if any stage is slower than the baseline by more than the
+# threshold, so it can gate a release build.
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        results = json.load(f)
+    keyed = {}
+    for result in results["results"]:
+        key = (result["stage"], result["format"], result["width"], result["height"])
+        keyed[key] = result
+    return results, keyed
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare two image pipeline benchmark runs.")
+    parser.add_argument("--threshold", type=float, default=5.0,
+                        help="percentage slowdown reported as a regression (default 5)")
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    args = parser.parse_args()
+
+    baseline, baselineResults = load(args.baseline)
+    current, currentResults = load(args.current)
+
+    for field in ("corpus_version", "corpus_seed", "iterations", "buffer_pool_limit", "hardware_concurrency"):
+        if baseline.get(field) != current.get(field):
+            print("Warning: %s differs (%s and %s), the results may not be comparable" %
+                  (field, baseline.get(field), current.get(field)))
+
+    print("%-10s %-9s %-11s %12s %12s %8s %12s" %
+          ("stage", "format", "size", baseline.get("label") or "baseline", current.get("label") or "current", "change", "peak rss"))
+
+    regressions = 0
+    for key in sorted(currentResults):
+        if key not in baselineResults:
+            continue
+        before = baselineResults[key]
+        after = currentResults[key]
+        change = (after["median_ms"] - before["median_ms"]) * 100.0 / before["median_ms"] if before["median_ms"] > 0 else 0.0
+        rssChange = after["peak_rss_kb"] - before["peak_rss_kb"]
+        flag = ""
+        if change > args.threshold:
+            flag = "  SLOWER"
+            regressions += 1
+        elif change < -args.threshold:
+            flag = "  faster"
+        print("%-10s %-9s %-11s %10.3fms %10.3fms %+7.1f%% %+10dkB%s" %
+              (key[0], key[1], "%dx%d" % (key[2], key[3]), before["median_ms"], after["median_ms"], change, rssChange, flag))
+
+    missing = sorted(set(baselineResults) - set(currentResults))
+    for key in missing:
+        print("Missing from current run: %s %s %dx%d" % key)
+
+    return 1 if regressions > 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,656 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "benchmark-corpus.h"
+
+// EXTERNAL INCLUDES
+#include <cstdio>
+#include <cstring>
+#include <sys/stat.h>
+#include <dali/public-api/common/dali-vector.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/imaging/common/loader-jpeg.h>
+#include <dali/internal/imaging/common/loader-png.h>
+
+namespace Benchmark
+{
+
+namespace
+{
+
+const char* const CORPUS_STAMP_FILE = "corpus.txt";
+
+const unsigned int JPEG_QUALITY = 90u;
+
+/**
+ * @brief The size of the maker note of the camera photos.
+ *
+ * Phone cameras write tens of kilobytes of vendor data into the EXIF block.
+ */
+const uint32_t EXIF_MAKER_NOTE_SIZE = 40000u;
+
+/**
+ * @brief LZW codes of the uncompressed GIF stream between clear codes.
+ *
+ * Each literal adds an entry to the decoder's table. Clearing before it holds
+ * 512 codes keeps every code 9 bits wide, for decoders which grow the code a
+ * step early as well as for those which follow the specification.
+ */
+const unsigned int GIF_LITERALS_PER_CLEAR = 254u;
+
+/**
+ * @brief A small, portable pseudo-random number generator, so the corpus is the same everywhere.
+ */
+class Random
+{
+public:
+  explicit Random( uint32_t seed )
+  : mState( seed )
+  {
+  }
+
+  uint32_t Next()
+  {
+    mState = mState * 1103515245u + 12345u;
+    return mState >> 8u;
+  }
+
+private:
+  uint32_t mState;
+};
+
+uint8_t Clamp( int value )
+{
+  return static_cast< uint8_t >( value < 0 ? 0 : ( value > 255 ? 255 : value ) );
+}
+
+void WriteLittleEndian16( std::vector< uint8_t >& out, uint32_t value )
+{
+  out.push_back( static_cast< uint8_t >( value ) );
+  out.push_back( static_cast< uint8_t >( value >> 8u ) );
+}
+
+void WriteLittleEndian32( std::vector< uint8_t >& out, uint32_t value )
+{
+  WriteLittleEndian16( out, value & 0xFFFFu );
+  WriteLittleEndian16( out, value >> 16u );
+}
+
+void WriteBigEndian16( std::vector< uint8_t >& out, uint32_t value )
+{
+  out.push_back( static_cast< uint8_t >( value >> 8u ) );
+  out.push_back( static_cast< uint8_t >( value ) );
+}
+
+void WriteBigEndian32( std::vector< uint8_t >& out, uint32_t value )
+{
+  WriteBigEndian16( out, value >> 16u );
+  WriteBigEndian16( out, value & 0xFFFFu );
+}
+
+void AppendRandomBytes( std::vector< uint8_t >& out, std::size_t count, uint32_t seed )
+{
+  Random random( seed );
+  for( std::size_t i = 0; i < count; ++i )
+  {
+    out.push_back( static_cast< uint8_t >( random.Next() ) );
+  }
+}
+
+bool WriteFile( const std::string& path, const uint8_t* data, std::size_t size )
+{
+  FILE* const file = fopen( path.c_str(), "wb" );
+  if( !file )
+  {
+    return false;
+  }
+  const bool written = fwrite( data, 1u, size, file ) == size;
+  return ( fclose( file ) == 0 ) && written;
+}
+
+bool EncodePng( unsigned int width, unsigned int height, std::vector< uint8_t >& encoded )
+{
+  std::vector< uint8_t > pixels;
+  GenerateTestPixels( width, height, Dali::Pixel::RGBA8888, pixels );
+  Dali::Vector< unsigned char > png;
+  if( !Dali::TizenPlatform::EncodeToPng( &pixels[0], png, width, height, Dali::Pixel::RGBA8888 ) )
+  {
+    return false;
+  }
+  encoded.assign( png.Begin(), png.End() );
+  return true;
+}
+
+bool EncodeJpeg( unsigned int width, unsigned int height, std::vector< uint8_t >& encoded )
+{
+  std::vector< uint8_t > pixels;
+  GenerateTestPixels( width, height, Dali::Pixel::RGB888, pixels );
+  Dali::Vector< unsigned char > jpeg;
+  if( !Dali::TizenPlatform::EncodeToJpeg( &pixels[0], jpeg, width, height, Dali::Pixel::RGB888, JPEG_QUALITY ) )
+  {
+    return false;
+  }
+  encoded.assign( jpeg.Begin(), jpeg.End() );
+  return true;
+}
+
+/**
+ * @brief A field of an EXIF image file directory, with its value in big-endian order.
+ */
+struct ExifField
+{
+  uint16_t tag;
+  uint16_t type;
+  uint32_t count;
+  std::vector< uint8_t > value;
+};
+
+ExifField ExifAscii( uint16_t tag, const char* text )
+{
+  const std::size_t length = strlen( text ) + 1u;
+  return ExifField{ tag, 2u, static_cast< uint32_t >( length ), std::vector< uint8_t >( text, text + length ) };
+}
+
+ExifField ExifShort( uint16_t tag, uint32_t value )
+{
+  ExifField field{ tag, 3u, 1u, std::vector< uint8_t >() };
+  WriteBigEndian16( field.value, value );
+  return field;
+}
+
+ExifField ExifLong( uint16_t tag, uint32_t value )
+{
+  ExifField field{ tag, 4u, 1u, std::vector< uint8_t >() };
+  WriteBigEndian32( field.value, value );
+  return field;
+}
+
+ExifField ExifRational( uint16_t tag, uint32_t numerator, uint32_t denominator )
+{
+  ExifField field{ tag, 5u, 1u, std::vector< uint8_t >() };
+  WriteBigEndian32( field.value, numerator );
+  WriteBigEndian32( field.value, denominator );
+  return field;
+}
+
+ExifField ExifUndefined( uint16_t tag, const std::vector< uint8_t >& value )
+{
+  return ExifField{ tag, 7u, static_cast< uint32_t >( value.size() ), value };
+}
+
+uint32_t GetIfdSize( const std::vector< ExifField >& fields )
+{
+  return 2u + static_cast< uint32_t >( fields.size() ) * 12u + 4u;
+}
+
+/**
+ * @brief Write an image file directory, putting the values which don't fit in a field into the data area.
+ * @param[in,out] out The TIFF structure, which the directory is appended to.
+ * @param[in] fields The fields, in order of tag.
+ * @param[in,out] data The data area, which starts at dataOffset in the TIFF structure.
+ * @param[in] dataOffset The offset of the data area.
+ */
+void WriteIfd( std::vector< uint8_t >& out, const std::vector< ExifField >& fields, std::vector< uint8_t >& data, uint32_t dataOffset )
+{
+  WriteBigEndian16( out, static_cast< uint32_t >( fields.size() ) );
+  for( auto&& field : fields )
+  {
+    WriteBigEndian16( out, field.tag );
+    WriteBigEndian16( out, field.type );
+    WriteBigEndian32( out, field.count );
+    if( field.value.size() <= 4u )
+    {
+      out.insert( out.end(), field.value.begin(), field.value.end() );
+      out.insert( out.end(), 4u - field.value.size(), 0u );
+    }
+    else
+    {
+      WriteBigEndian32( out, dataOffset + static_cast< uint32_t >( data.size() ) );
+      data.insert( data.end(), field.value.begin(), field.value.end() );
+      if( data.size() & 1u )
+      {
+        data.push_back( 0u ); // Values start on a word boundary
+      }
+    }
+  }
+  WriteBigEndian32( out, 0u ); // No next directory
+}
+
+/**
+ * @brief An EXIF block as a phone camera writes it, with a large maker note.
+ */
+void MakeCameraExif( unsigned int width, unsigned int height, std::vector< uint8_t >& exif )
+{
+  std::vector< uint8_t > makerNote;
+  AppendRandomBytes( makerNote, EXIF_MAKER_NOTE_SIZE, CORPUS_SEED + width * height );
+
+  const uint8_t version[] = { '0', '2', '3', '0' };
+  const uint8_t flashpixVersion[] = { '0', '1', '0', '0' };
+  const char comment[] = "ASCII\0\0\0Generated for the dali-adaptor image pipeline benchmark";
+
+  // Tags in increasing order, as readers may expect:
+  std::vector< ExifField > exifFields;
+  exifFields.push_back( ExifRational( 0x829Au, 1u, 125u ) );   // ExposureTime
+  exifFields.push_back( ExifRational( 0x829Du, 18u, 10u ) );   // FNumber
+  exifFields.push_back( ExifShort( 0x8822u, 2u ) );            // ExposureProgram
+  exifFields.push_back( ExifShort( 0x8827u, 100u ) );          // ISOSpeedRatings
+  exifFields.push_back( ExifUndefined( 0x9000u, std::vector< uint8_t >( version, version + sizeof( version ) ) ) );
+  exifFields.push_back( ExifAscii( 0x9003u, "2020:06:01 12:00:00" ) ); // DateTimeOriginal
+  exifFields.push_back( ExifAscii( 0x9004u, "2020:06:01 12:00:00" ) ); // DateTimeDigitized
+  exifFields.push_back( ExifRational( 0x9202u, 169u, 100u ) ); // ApertureValue
+  exifFields.push_back( ExifShort( 0x9207u, 5u ) );            // MeteringMode
+  exifFields.push_back( ExifShort( 0x9209u, 16u ) );           // Flash
+  exifFields.push_back( ExifRational( 0x920Au, 430u, 100u ) ); // FocalLength
+  exifFields.push_back( ExifUndefined( 0x927Cu, makerNote ) ); // MakerNote
+  exifFields.push_back( ExifUndefined( 0x9286u, std::vector< uint8_t >( comment, comment + sizeof( comment ) - 1u ) ) ); // UserComment
+  exifFields.push_back( ExifUndefined( 0xA000u, std::vector< uint8_t >( flashpixVersion, flashpixVersion + sizeof( flashpixVersion ) ) ) );
+  exifFields.push_back( ExifShort( 0xA001u, 1u ) );            // ColorSpace
+  exifFields.push_back( ExifLong( 0xA002u, width ) );          // PixelXDimension
+  exifFields.push_back( ExifLong( 0xA003u, height ) );         // PixelYDimension
+  exifFields.push_back( ExifShort( 0xA402u, 0u ) );            // ExposureMode
+  exifFields.push_back( ExifShort( 0xA403u, 0u ) );            // WhiteBalance
+  exifFields.push_back( ExifShort( 0xA405u, 26u ) );           // FocalLengthIn35mmFilm
+  exifFields.push_back( ExifShort( 0xA406u, 0u ) );            // SceneCaptureType
+
+  std::vector< ExifField > imageFields;
+  imageFields.push_back( ExifAscii( 0x010Fu, "DALi" ) );              // Make
+  imageFields.push_back( ExifAscii( 0x0110u, "Benchmark Camera" ) );  // Model
+  imageFields.push_back( ExifShort( 0x0112u, 1u ) );                  // Orientation
+  imageFields.push_back( ExifRational( 0x011Au, 72u, 1u ) );          // XResolution
+  imageFields.push_back( ExifRational( 0x011Bu, 72u, 1u ) );          // YResolution
+  imageFields.push_back( ExifShort( 0x0128u, 2u ) );                  // ResolutionUnit
+  imageFields.push_back( ExifAscii( 0x0131u, "dali-adaptor-internal-benchmark" ) ); // Software
+  imageFields.push_back( ExifAscii( 0x0132u, "2020:06:01 12:00:00" ) );            // DateTime
+
+  // The TIFF header, the two directories and then the data area:
+  const uint32_t imageIfdOffset = 8u;
+  const uint32_t exifIfdOffset = imageIfdOffset + GetIfdSize( imageFields ) + 12u;
+  const uint32_t dataOffset = exifIfdOffset + GetIfdSize( exifFields );
+  imageFields.push_back( ExifLong( 0x8769u, exifIfdOffset ) );        // ExifIfdPointer
+
+  const uint8_t header[] = { 'E', 'x', 'i', 'f', 0u, 0u, 'M', 'M', 0u, 42u };
+  exif.assign( header, header + sizeof( header ) );
+  WriteBigEndian32( exif, imageIfdOffset );
+
+  std::vector< uint8_t > tiff;
+  std::vector< uint8_t > data;
+  WriteIfd( tiff, imageFields, data, dataOffset );
+  WriteIfd( tiff, exifFields, data, dataOffset );
+  exif.insert( exif.end(), tiff.begin(), tiff.end() );
+  exif.insert( exif.end(), data.begin(), data.end() );
+}
+
+/**
+ * @brief A camera photo: a JPEG with a large EXIF block in an APP1 segment straight after the start of image.
+ */
+bool EncodeJpegExif( unsigned int width, unsigned int height, std::vector< uint8_t >& encoded )
+{
+  std::vector< uint8_t > jpeg;
+  if( !EncodeJpeg( width, height, jpeg ) )
+  {
+    return false;
+  }
+
+  std::vector< uint8_t > exif;
+  MakeCameraExif( width, height, exif );
+
+  encoded.assign( jpeg.begin(), jpeg.begin() + 2u ); // SOI
+  encoded.push_back( 0xFFu );
+  encoded.push_back( 0xE1u );
+  WriteBigEndian16( encoded, static_cast< uint32_t >( exif.size() ) + 2u );
+  encoded.insert( encoded.end(), exif.begin(), exif.end() );
+  encoded.insert( encoded.end(), jpeg.begin() + 2u, jpeg.end() );
+  return true;
+}
+
+/**
+ * @brief A 24 bit, bottom-up, uncompressed BMP.
+ */
+bool EncodeBmp( unsigned int width, unsigned int height, std::vector< uint8_t >& encoded )
+{
+  std::vector< uint8_t > pixels;
+  GenerateTestPixels( width, height, Dali::Pixel::RGB888, pixels );
+
+  const unsigned int rowStride = ( width * 3u + 3u ) & ~3u;
+  const unsigned int headerSize = 14u + 40u;
+  const unsigned int imageSize = rowStride * height;
+
+  encoded.clear();
+  encoded.reserve( headerSize + imageSize );
+  encoded.push_back( 'B' );
+  encoded.push_back( 'M' );
+  WriteLittleEndian32( encoded, headerSize + imageSize );
+  WriteLittleEndian32( encoded, 0u );
+  WriteLittleEndian32( encoded, headerSize );
+  WriteLittleEndian32( encoded, 40u );     // Info header size
+  WriteLittleEndian32( encoded, width );
+  WriteLittleEndian32( encoded, height );
+  WriteLittleEndian16( encoded, 1u );      // Planes
+  WriteLittleEndian16( encoded, 24u );     // Bits per pixel
+  WriteLittleEndian32( encoded, 0u );      // No compression
+  WriteLittleEndian32( encoded, imageSize );
+  WriteLittleEndian32( encoded, 2835u );   // 72 DPI
+  WriteLittleEndian32( encoded, 2835u );
+  WriteLittleEndian32( encoded, 0u );
+  WriteLittleEndian32( encoded, 0u );
+
+  for( unsigned int y = height; y-- > 0u; )
+  {
+    const uint8_t* pixel = &pixels[y * width * 3u];
+    for( unsigned int x = 0; x < width; ++x, pixel += 3u )
+    {
+      encoded.push_back( pixel[2] );
+      encoded.push_back( pixel[1] );
+      encoded.push_back( pixel[0] );
+    }
+    encoded.resize( encoded.size() + rowStride - width * 3u, 0u );
+  }
+  return true;
+}
+
+/**
+ * @brief Packs variable width codes into the data sub-blocks of a GIF image.
+ */
+class GifCodeWriter
+{
+public:
+  explicit GifCodeWriter( std::vector< uint8_t >& out )
+  : mOut( out ),
+    mBlock(),
+    mBits( 0u ),
+    mNumBits( 0u )
+  {
+  }
+
+  void Write( uint32_t code, unsigned int codeSize )
+  {
+    mBits |= code << mNumBits;
+    mNumBits += codeSize;
+    while( mNumBits >= 8u )
+    {
+      PutByte( static_cast< uint8_t >( mBits ) );
+      mBits >>= 8u;
+      mNumBits -= 8u;
+    }
+  }
+
+  void Finish()
+  {
+    if( mNumBits > 0u )
+    {
+      PutByte( static_cast< uint8_t >( mBits ) );
+    }
+    FlushBlock();
+    mOut.push_back( 0u ); // Block terminator
+  }
+
+private:
+  void PutByte( uint8_t byte )
+  {
+    mBlock.push_back( byte );
+    if( mBlock.size() == 255u )
+    {
+      FlushBlock();
+    }
+  }
+
+  void FlushBlock()
+  {
+    if( !mBlock.empty() )
+    {
+      mOut.push_back( static_cast< uint8_t >( mBlock.size() ) );
+      mOut.insert( mOut.end(), mBlock.begin(), mBlock.end() );
+      mBlock.clear();
+    }
+  }
+
+  std::vector< uint8_t >& mOut;
+  std::vector< uint8_t >  mBlock;
+  uint32_t                mBits;
+  unsigned int            mNumBits;
+};
+
+/**
+ * @brief A GIF with a 3-3-2 bit RGB palette.
+ *
+ * There is no GIF encoder to hand, so the pixels are written as LZW literals
+ * without any compression. Decoding such a stream costs about the same as a
+ * compressed one, as the decoder still walks every code.
+ */
+bool EncodeGif( unsigned int width, unsigned int height, std::vector< uint8_t >& encoded )
+{
+  std::vector< uint8_t > pixels;
+  GenerateTestPixels( width, height, Dali::Pixel::RGB888, pixels );
+
+  encoded.clear();
+  const char* const signature = "GIF89a";
+  encoded.insert( encoded.end(), signature, signature + 6 );
+  WriteLittleEndian16( encoded, width );
+  WriteLittleEndian16( encoded, height );
+  encoded.push_back( 0xF7u ); // Global color table of 256 entries
+  encoded.push_back( 0u );    // Background color
+  encoded.push_back( 0u );    // Aspect ratio
+  for( unsigned int i = 0; i < 256u; ++i )
+  {
+    encoded.push_back( static_cast< uint8_t >( ( ( i >> 5u ) & 7u ) * 255u / 7u ) );
+    encoded.push_back( static_cast< uint8_t >( ( ( i >> 2u ) & 7u ) * 255u / 7u ) );
+    encoded.push_back( static_cast< uint8_t >( ( i & 3u ) * 255u / 3u ) );
+  }
+
+  encoded.push_back( 0x2Cu ); // Image descriptor
+  WriteLittleEndian16( encoded, 0u );
+  WriteLittleEndian16( encoded, 0u );
+  WriteLittleEndian16( encoded, width );
+  WriteLittleEndian16( encoded, height );
+  encoded.push_back( 0u );    // No local color table, not interlaced
+
+  const unsigned int minimumCodeSize = 8u;
+  const uint32_t clearCode = 1u << minimumCodeSize;
+  const uint32_t endCode = clearCode + 1u;
+  const unsigned int codeSize = minimumCodeSize + 1u;
+  encoded.push_back( minimumCodeSize );
+
+  GifCodeWriter writer( encoded );
+  const unsigned int numPixels = width * height;
+  for( unsigned int i = 0; i < numPixels; ++i )
+  {
+    if( i % GIF_LITERALS_PER_CLEAR == 0u )
+    {
+      writer.Write( clearCode, codeSize );
+    }
+    const uint8_t* const pixel = &pixels[i * 3u];
+    writer.Write( ( pixel[0] & 0xE0u ) | ( ( pixel[1] & 0xE0u ) >> 3u ) | ( pixel[2] >> 6u ), codeSize );
+  }
+  writer.Write( endCode, codeSize );
+  writer.Finish();
+
+  encoded.push_back( 0x3Bu ); // Trailer
+  return true;
+}
+
+/**
+ * @brief An ETC1 texture in a KTX container.
+ */
+bool EncodeKtx( unsigned int width, unsigned int height, std::vector< uint8_t >& encoded )
+{
+  const uint8_t identifier[] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+  const uint32_t imageSize = ( ( width + 3u ) / 4u ) * ( ( height + 3u ) / 4u ) * 8u;
+
+  encoded.assign( identifier, identifier + sizeof( identifier ) );
+  WriteLittleEndian32( encoded, 0x04030201u ); // Endianness
+  WriteLittleEndian32( encoded, 0u );          // glType: compressed
+  WriteLittleEndian32( encoded, 1u );          // glTypeSize
+  WriteLittleEndian32( encoded, 0u );          // glFormat: compressed
+  WriteLittleEndian32( encoded, 0x8D64u );     // glInternalFormat: GL_ETC1_RGB8_OES
+  WriteLittleEndian32( encoded, 0x1907u );     // glBaseInternalFormat: GL_RGB
+  WriteLittleEndian32( encoded, width );
+  WriteLittleEndian32( encoded, height );
+  WriteLittleEndian32( encoded, 0u );          // Depth
+  WriteLittleEndian32( encoded, 0u );          // Array elements
+  WriteLittleEndian32( encoded, 1u );          // Faces
+  WriteLittleEndian32( encoded, 1u );          // Mipmap levels
+  WriteLittleEndian32( encoded, 0u );          // Key/value data
+  WriteLittleEndian32( encoded, imageSize );
+  AppendRandomBytes( encoded, imageSize, CORPUS_SEED + width * height );
+  return true;
+}
+
+/**
+ * @brief An ASTC file of 4x4 blocks.
+ */
+bool EncodeAstc( unsigned int width, unsigned int height, std::vector< uint8_t >& encoded )
+{
+  const uint8_t header[] =
+  {
+    0x13, 0xAB, 0xA1, 0x5C, 4u, 4u, 1u,
+    static_cast< uint8_t >( width ), static_cast< uint8_t >( width >> 8u ), static_cast< uint8_t >( width >> 16u ),
+    static_cast< uint8_t >( height ), static_cast< uint8_t >( height >> 8u ), static_cast< uint8_t >( height >> 16u ),
+    1u, 0u, 0u
+  };
+  encoded.assign( header, header + sizeof( header ) );
+  AppendRandomBytes( encoded, ( ( width + 3u ) / 4u ) * ( ( height + 3u ) / 4u ) * 16u, CORPUS_SEED + width * height );
+  return true;
+}
+
+struct CorpusFormat
+{
+  const char* name;
+  const char* extension;
+  bool scalable;
+  bool (*encode)( unsigned int width, unsigned int height, std::vector< uint8_t >& encoded );
+};
+
+const CorpusFormat CORPUS_FORMATS[] =
+{
+  { "png",       "png",      true,  EncodePng },
+  { "jpeg",      "jpg",      true,  EncodeJpeg },
+  { "jpeg-exif", "exif.jpg", true,  EncodeJpegExif },
+  { "bmp",       "bmp",      true,  EncodeBmp },
+  { "gif",       "gif",      true,  EncodeGif },
+  { "ktx",       "ktx",      false, EncodeKtx },
+  { "astc",      "astc",     false, EncodeAstc },
+};
+
+std::string GetStamp()
+{
+  char stamp[64];
+  snprintf( stamp, sizeof( stamp ), "version %u seed %u\n", CORPUS_VERSION, CORPUS_SEED );
+  return stamp;
+}
+
+bool IsCorpusCurrent( const std::string& directory )
+{
+  FILE* const file = fopen( ( directory + "/" + CORPUS_STAMP_FILE ).c_str(), "rb" );
+  if( !file )
+  {
+    return false;
+  }
+  char stamp[64] = { 0 };
+  const std::size_t length = fread( stamp, 1u, sizeof( stamp ) - 1u, file );
+  fclose( file );
+  return GetStamp() == std::string( stamp, length );
+}
+
+} // unnamed namespace
+
+void GenerateTestPixels( unsigned int width, unsigned int height, Dali::Pixel::Format pixelFormat, std::vector< uint8_t >& pixels )
+{
+  const unsigned int bytesPerPixel = Dali::Pixel::GetBytesPerPixel( pixelFormat );
+  pixels.resize( width * height * bytesPerPixel );
+
+  Random random( CORPUS_SEED );
+  const int halfWidth = static_cast< int >( width / 2u ) + 1;
+  const int halfHeight = static_cast< int >( height / 2u ) + 1;
+  uint8_t* pixel = &pixels[0];
+  for( unsigned int y = 0; y < height; ++y )
+  {
+    for( unsigned int x = 0; x < width; ++x, pixel += bytesPerPixel )
+    {
+      const int noise = static_cast< int >( random.Next() % 17u ) - 8;
+      const int checker = ( ( ( x >> 4u ) ^ ( y >> 4u ) ) & 1u ) ? 48 : -48;
+      const int red = static_cast< int >( x * 255u / width ) + noise;
+      const int green = static_cast< int >( y * 255u / height ) + noise;
+      const int blue = 128 + checker + noise;
+
+      if( pixelFormat == Dali::Pixel::L8 )
+      {
+        pixel[0] = Clamp( ( red * 77 + green * 150 + blue * 29 ) >> 8 );
+        continue;
+      }
+      pixel[0] = Clamp( red );
+      pixel[1] = Clamp( green );
+      pixel[2] = Clamp( blue );
+      if( bytesPerPixel == 4u )
+      {
+        const int dx = ( static_cast< int >( x ) - halfWidth ) * 256 / halfWidth;
+        const int dy = ( static_cast< int >( y ) - halfHeight ) * 256 / halfHeight;
+        pixel[3] = Clamp( 255 - ( dx * dx + dy * dy ) / 512 );
+      }
+    }
+  }
+}
+
+bool GenerateCorpus( const std::string& directory, const std::vector< Dali::ImageDimensions >& sizes, bool regenerate, std::vector< CorpusImage >& images )
+{
+  const bool current = !regenerate && IsCorpusCurrent( directory );
+
+  images.clear();
+  std::vector< uint8_t > encoded;
+  for( auto&& size : sizes )
+  {
+    for( auto&& format : CORPUS_FORMATS )
+    {
+      CorpusImage image;
+      image.format = format.name;
+      image.scalable = format.scalable;
+      image.width = size.GetWidth();
+      image.height = size.GetHeight();
+
+      char name[64];
+      snprintf( name, sizeof( name ), "/%ux%u.%s", image.width, image.height, format.extension );
+      image.path = directory + name;
+
+      struct stat fileStat;
+      if( !current || stat( image.path.c_str(), &fileStat ) != 0 )
+      {
+        if( !format.encode( image.width, image.height, encoded ) ||
+            !WriteFile( image.path, &encoded[0], encoded.size() ) )
+        {
+          fprintf( stderr, "Failed to write %s\n", image.path.c_str() );
+          return false;
+        }
+        image.fileSize = encoded.size();
+      }
+      else
+      {
+        image.fileSize = static_cast< std::size_t >( fileStat.st_size );
+      }
+      images.push_back( image );
+    }
+  }
+
+  if( !current )
+  {
+    const std::string stamp = GetStamp();
+    return WriteFile( directory + "/" + CORPUS_STAMP_FILE, reinterpret_cast< const uint8_t* >( stamp.c_str() ), stamp.size() );
+  }
+  return true;
+}
+
+} // namespace Benchmark
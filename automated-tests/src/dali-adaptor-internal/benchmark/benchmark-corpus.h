@@ -0,0 +1,90 @@
+#ifndef DALI_ADAPTOR_BENCHMARK_CORPUS_H
+#define DALI_ADAPTOR_BENCHMARK_CORPUS_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <dali/public-api/images/image-operations.h>
+#include <dali/public-api/images/pixel.h>
+
+namespace Benchmark
+{
+
+/**
+ * @brief The version of the generated corpus.
+ *
+ * Bump this whenever the generated images change, so that results are only
+ * compared between runs over the same corpus.
+ */
+const unsigned int CORPUS_VERSION = 2u;
+
+/**
+ * @brief The seed of the pseudo-random noise in the generated images.
+ */
+const uint32_t CORPUS_SEED = 0x0DA11u;
+
+/**
+ * @brief An image file of the corpus.
+ */
+struct CorpusImage
+{
+  std::string path;      ///< The path of the file.
+  std::string format;    ///< The name of the file format, e.g. "jpeg".
+  bool        scalable;  ///< Whether the loader can fit the image to a requested size. Compressed textures can't be.
+  unsigned int width;    ///< The width of the image in pixels.
+  unsigned int height;   ///< The height of the image in pixels.
+  std::size_t fileSize;  ///< The size of the file in bytes.
+};
+
+/**
+ * @brief Fill a buffer with the test image of the corpus.
+ *
+ * The image is a gradient with a checker pattern, low amplitude noise and a
+ * radial alpha, so that it compresses roughly as a photo or an icon would.
+ * The same dimensions always give the same pixels.
+ * @param[in] width The width of the image
+ * @param[in] height The height of the image
+ * @param[in] pixelFormat L8, RGB888 or RGBA8888
+ * @param[out] pixels The pixels, width * height * bytes per pixel of the format
+ */
+void GenerateTestPixels( unsigned int width, unsigned int height, Dali::Pixel::Format pixelFormat, std::vector< uint8_t >& pixels );
+
+/**
+ * @brief Write the corpus, a PNG, JPEG, BMP, GIF, KTX and ASTC file of each size, to a directory.
+ *
+ * There is also a JPEG with the EXIF block a phone camera writes, including
+ * tens of kilobytes of maker note, of each size.
+ * Files already written by the same version of the corpus are kept, unless
+ * asked to regenerate them.
+ * The KTX and ASTC files hold pseudo-random ETC1 and ASTC 4x4 blocks, as the
+ * loaders pass compressed textures through without decoding them.
+ * @param[in] directory The directory to write to. It must exist.
+ * @param[in] sizes The image sizes to write.
+ * @param[in] regenerate Whether to write the files even if they are up to date.
+ * @param[out] images The files of the corpus.
+ * @return false if a file couldn't be written.
+ */
+bool GenerateCorpus( const std::string& directory, const std::vector< Dali::ImageDimensions >& sizes, bool regenerate, std::vector< CorpusImage >& images );
+
+} // namespace Benchmark
+
+#endif // DALI_ADAPTOR_BENCHMARK_CORPUS_H
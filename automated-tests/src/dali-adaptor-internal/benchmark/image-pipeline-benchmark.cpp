@@ -0,0 +1,627 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+#include <getopt.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <dali/devel-api/adaptor-framework/image-loading.h>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/public-api/object/property-map.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/imaging/common/buffer-pool.h>
+#include <dali/internal/imaging/common/image-operations.h>
+#include "benchmark-corpus.h"
+
+/**
+ * Measures the throughput of the image pipeline: decoding each format,
+ * fitting to a size while decoding, reading the metadata of JPEG files,
+ * masking and premultiplying while loading or after it, downscaling, resampling with and without the cache of Lanczos contributor
+ * lists, masking, and blurring exactly and approximately at small and large
+ * radii. The images are generated, so every run over the same version of
+ * the corpus measures the same work, and the results of two commits can be
+ * compared with scripts/compare-benchmark.py.
+ *
+ * Each measurement is repeated and the median time reported, along with the
+ * peak resident memory while it ran, as JSON.
+ */
+
+namespace
+{
+
+const char* const DEFAULT_CORPUS_DIRECTORY = "/tmp/dali-adaptor-benchmark-corpus";
+const unsigned int DEFAULT_ITERATIONS = 5u;
+const unsigned int WARM_UP_ITERATIONS = 1u;
+
+const char* const ALL_STAGES[] = { "load", "load-fit", "metadata", "load-mask", "load-mask-separate", "downscale", "resample", "resample-uncached", "mask",
+                                   "blur", "blur-20", "blur-40", "blur-approximate-20", "blur-approximate-40" };
+
+struct BlurStage
+{
+  const char* name;
+  float radius;
+  bool approximate;  ///< Whether the stage runs ApplyApproximateGaussianBlur() rather than ApplyGaussianBlur().
+};
+
+// A small blur, then the radii of soft shadows, blurred exactly and approximately:
+const BlurStage BLUR_STAGES[] =
+{
+  { "blur", 4.0f, false },
+  { "blur-20", 20.0f, false },
+  { "blur-40", 40.0f, false },
+  { "blur-approximate-20", 20.0f, true },
+  { "blur-approximate-40", 40.0f, true }
+};
+
+const Dali::ImageDimensions DEFAULT_SIZES[] =
+{
+  Dali::ImageDimensions( 256u, 256u ),
+  Dali::ImageDimensions( 1280u, 720u ),
+  Dali::ImageDimensions( 1920u, 1080u ),
+  Dali::ImageDimensions( 4000u, 3000u )
+};
+
+struct Options
+{
+  std::string corpusDirectory;
+  std::string outputFile;
+  std::string label;
+  unsigned int iterations;
+  std::size_t bufferPoolLimit;
+  bool regenerate;
+  std::vector< Dali::ImageDimensions > sizes;
+  std::vector< std::string > stages;
+};
+
+struct Result
+{
+  std::string stage;
+  std::string format;
+  unsigned int width;
+  unsigned int height;
+  std::size_t inputBytes;  ///< The size of the file decoded, or zero.
+  double medianSeconds;
+  double minimumSeconds;
+  long peakRssKb;
+};
+
+void Usage( const char* program )
+{
+  fprintf( stderr,
+           "Usage: %s [options]\n"
+           "  -c <directory>  Where to generate the corpus (default %s)\n"
+           "  -r              Regenerate the corpus even if it is up to date\n"
+           "  -s <WxH,...>    Image sizes (default 256x256,1280x720,1920x1080,4000x3000)\n"
+           "  -t <stage,...>  Stages to run: load, load-fit, metadata, load-mask, load-mask-separate, downscale, resample,\n"
+           "                  resample-uncached, mask, blur, blur-20, blur-40, blur-approximate-20,\n"
+           "                  blur-approximate-40 (default all)\n"
+           "  -i <count>      Timed iterations of each measurement (default %u)\n"
+           "  -p <bytes>      Enable the image buffer pool with this memory limit\n"
+           "  -l <label>      Label for the results, e.g. the commit measured\n"
+           "  -o <file>       Write the JSON results to a file instead of stdout\n",
+           program, DEFAULT_CORPUS_DIRECTORY, DEFAULT_ITERATIONS );
+}
+
+std::vector< std::string > Split( const std::string& list )
+{
+  std::vector< std::string > items;
+  std::string::size_type start = 0;
+  while( start <= list.size() )
+  {
+    const std::string::size_type end = std::min( list.find( ',', start ), list.size() );
+    if( end > start )
+    {
+      items.push_back( list.substr( start, end - start ) );
+    }
+    start = end + 1u;
+  }
+  return items;
+}
+
+bool ParseOptions( int argc, char* const argv[], Options& options )
+{
+  options.corpusDirectory = DEFAULT_CORPUS_DIRECTORY;
+  options.iterations = DEFAULT_ITERATIONS;
+  options.bufferPoolLimit = 0u;
+  options.regenerate = false;
+  options.sizes.assign( DEFAULT_SIZES, DEFAULT_SIZES + sizeof( DEFAULT_SIZES ) / sizeof( DEFAULT_SIZES[0] ) );
+  options.stages.assign( ALL_STAGES, ALL_STAGES + sizeof( ALL_STAGES ) / sizeof( ALL_STAGES[0] ) );
+
+  int nextOpt;
+  while( ( nextOpt = getopt( argc, argv, "c:rs:t:i:p:l:o:h" ) ) != -1 )
+  {
+    switch( nextOpt )
+    {
+      case 'c':
+      {
+        options.corpusDirectory = optarg;
+        break;
+      }
+      case 'r':
+      {
+        options.regenerate = true;
+        break;
+      }
+      case 's':
+      {
+        options.sizes.clear();
+        for( auto&& size : Split( optarg ) )
+        {
+          unsigned int width = 0u;
+          unsigned int height = 0u;
+          if( sscanf( size.c_str(), "%ux%u", &width, &height ) != 2 || width == 0u || height == 0u || width > 4096u || height > 4096u )
+          {
+            fprintf( stderr, "Invalid size %s: sizes are WxH, up to the 4096 texture limit of the KTX loader\n", size.c_str() );
+            return false;
+          }
+          options.sizes.push_back( Dali::ImageDimensions( width, height ) );
+        }
+        break;
+      }
+      case 't':
+      {
+        options.stages = Split( optarg );
+        for( auto&& stage : options.stages )
+        {
+          if( std::find_if( std::begin( ALL_STAGES ), std::end( ALL_STAGES ), [&stage]( const char* name ) { return stage == name; } ) == std::end( ALL_STAGES ) )
+          {
+            fprintf( stderr, "Unknown stage %s\n", stage.c_str() );
+            return false;
+          }
+        }
+        break;
+      }
+      case 'i':
+      {
+        options.iterations = static_cast< unsigned int >( std::max( 1, atoi( optarg ) ) );
+        break;
+      }
+      case 'p':
+      {
+        options.bufferPoolLimit = static_cast< std::size_t >( strtoull( optarg, nullptr, 10 ) );
+        break;
+      }
+      case 'l':
+      {
+        options.label = optarg;
+        break;
+      }
+      case 'o':
+      {
+        options.outputFile = optarg;
+        break;
+      }
+      default:
+      {
+        return false;
+      }
+    }
+  }
+  return optind == argc;
+}
+
+bool HasStage( const Options& options, const char* stage )
+{
+  return std::find( options.stages.begin(), options.stages.end(), stage ) != options.stages.end();
+}
+
+/**
+ * @brief Reset the peak resident memory of the process to what it uses now.
+ *
+ * Needs Linux 4.0 or later. On older kernels the peak only ever grows, so the
+ * peak of a stage includes the stages before it.
+ */
+void ResetPeakRss()
+{
+  FILE* const file = fopen( "/proc/self/clear_refs", "w" );
+  if( file )
+  {
+    fputs( "5", file );
+    fclose( file );
+  }
+}
+
+/**
+ * @brief Get the peak resident memory of the process since the last ResetPeakRss().
+ * @return The peak in KiB.
+ */
+long GetPeakRssKb()
+{
+  long peak = 0;
+  FILE* const file = fopen( "/proc/self/status", "r" );
+  if( file )
+  {
+    char line[256];
+    while( fgets( line, sizeof( line ), file ) )
+    {
+      if( sscanf( line, "VmHWM: %ld", &peak ) == 1 )
+      {
+        break;
+      }
+    }
+    fclose( file );
+  }
+  if( peak == 0 )
+  {
+    struct rusage usage;
+    getrusage( RUSAGE_SELF, &usage );
+    peak = usage.ru_maxrss;
+  }
+  return peak;
+}
+
+/**
+ * @brief Time a stage.
+ *
+ * @param[in] prepare Called before each run, outside the timing, e.g. to copy the input which the stage modifies.
+ * @param[in] run The stage. Returns false if it failed.
+ * @param[in] iterations The number of timed runs.
+ * @param[out] result The median and minimum time, and the peak memory.
+ * @return false if the stage failed.
+ */
+bool Measure( const std::function< void() >& prepare, const std::function< bool() >& run, unsigned int iterations, Result& result )
+{
+  std::vector< double > seconds;
+  ResetPeakRss();
+  for( unsigned int i = 0; i < WARM_UP_ITERATIONS + iterations; ++i )
+  {
+    prepare();
+    const auto start = std::chrono::steady_clock::now();
+    if( !run() )
+    {
+      return false;
+    }
+    const auto end = std::chrono::steady_clock::now();
+    if( i >= WARM_UP_ITERATIONS )
+    {
+      seconds.push_back( std::chrono::duration< double >( end - start ).count() );
+    }
+  }
+  result.peakRssKb = GetPeakRssKb();
+
+  std::sort( seconds.begin(), seconds.end() );
+  const std::size_t middle = seconds.size() / 2u;
+  result.medianSeconds = ( seconds.size() % 2u ) ? seconds[middle] : ( seconds[middle - 1u] + seconds[middle] ) / 2.0;
+  result.minimumSeconds = seconds.front();
+  return true;
+}
+
+Dali::Devel::PixelBuffer CreateTestPixelBuffer( unsigned int width, unsigned int height, Dali::Pixel::Format pixelFormat )
+{
+  std::vector< uint8_t > pixels;
+  Benchmark::GenerateTestPixels( width, height, pixelFormat, pixels );
+  Dali::Devel::PixelBuffer pixelBuffer = Dali::Devel::PixelBuffer::New( width, height, pixelFormat );
+  memcpy( pixelBuffer.GetBuffer(), &pixels[0], pixels.size() );
+  return pixelBuffer;
+}
+
+Dali::Devel::PixelBuffer CopyPixelBuffer( const Dali::Devel::PixelBuffer& source )
+{
+  Dali::Devel::PixelBuffer copy = Dali::Devel::PixelBuffer::New( source.GetWidth(), source.GetHeight(), source.GetPixelFormat() );
+  memcpy( copy.GetBuffer(), source.GetBuffer(), source.GetWidth() * source.GetHeight() * Dali::Pixel::GetBytesPerPixel( source.GetPixelFormat() ) );
+  return copy;
+}
+
+void ReportFailure( const Result& result )
+{
+  fprintf( stderr, "%s of %s %ux%u failed\n", result.stage.c_str(), result.format.c_str(), result.width, result.height );
+}
+
+void RunLoadStages( const Options& options, const std::vector< Benchmark::CorpusImage >& images, std::vector< Result >& results )
+{
+  for( auto&& image : images )
+  {
+    Result result = { "load", image.format, image.width, image.height, image.fileSize, 0.0, 0.0, 0 };
+    const std::string path = image.path;
+
+    if( HasStage( options, "load" ) )
+    {
+      if( Measure( [](){},
+                   [&path]() { return bool( Dali::LoadImageFromFile( path, Dali::ImageDimensions(), Dali::FittingMode::DEFAULT, Dali::SamplingMode::BOX_THEN_LINEAR, false ) ); },
+                   options.iterations, result ) )
+      {
+        results.push_back( result );
+      }
+      else
+      {
+        ReportFailure( result );
+      }
+    }
+
+    // Thumbnails, a quarter of the size in each direction:
+    if( HasStage( options, "load-fit" ) && image.scalable )
+    {
+      result.stage = "load-fit";
+      const Dali::ImageDimensions size( std::max( image.width / 4u, 1u ), std::max( image.height / 4u, 1u ) );
+      if( Measure( [](){},
+                   [&path, size]() { return bool( Dali::LoadImageFromFile( path, size, Dali::FittingMode::SHRINK_TO_FIT, Dali::SamplingMode::BOX_THEN_LINEAR, false ) ); },
+                   options.iterations, result ) )
+      {
+        results.push_back( result );
+      }
+      else
+      {
+        ReportFailure( result );
+      }
+    }
+
+    // Loading the file and reading all of its EXIF fields:
+    if( HasStage( options, "metadata" ) && image.format.compare( 0u, 4u, "jpeg" ) == 0 )
+    {
+      result.stage = "metadata";
+      if( Measure( [](){},
+                   [&path]()
+                   {
+                     Dali::Devel::PixelBuffer pixelBuffer = Dali::LoadImageFromFile( path, Dali::ImageDimensions(), Dali::FittingMode::DEFAULT, Dali::SamplingMode::BOX_THEN_LINEAR, false );
+                     Dali::Property::Map metadata;
+                     return pixelBuffer && pixelBuffer.GetMetadata( metadata );
+                   },
+                   options.iterations, result ) )
+      {
+        results.push_back( result );
+      }
+      else
+      {
+        ReportFailure( result );
+      }
+    }
+
+    // Masking and premultiplying in the same traversal as the load, or as two more traversals after it:
+    if( ( HasStage( options, "load-mask" ) || HasStage( options, "load-mask-separate" ) ) && image.scalable )
+    {
+      const Dali::Devel::PixelBuffer mask = CreateTestPixelBuffer( image.width, image.height, Dali::Pixel::L8 );
+
+      if( HasStage( options, "load-mask" ) )
+      {
+        result.stage = "load-mask";
+        if( Measure( [](){},
+                     [&path, &mask]()
+                     {
+                       return bool( Dali::LoadImageFromFile( path, Dali::ImageDimensions(), Dali::FittingMode::DEFAULT, Dali::SamplingMode::BOX_THEN_LINEAR, false,
+                                                             mask, true, Dali::Pixel::INVALID ) );
+                     },
+                     options.iterations, result ) )
+        {
+          results.push_back( result );
+        }
+        else
+        {
+          ReportFailure( result );
+        }
+      }
+
+      if( HasStage( options, "load-mask-separate" ) )
+      {
+        result.stage = "load-mask-separate";
+        if( Measure( [](){},
+                     [&path, &mask]()
+                     {
+                       Dali::Devel::PixelBuffer pixelBuffer = Dali::LoadImageFromFile( path, Dali::ImageDimensions(), Dali::FittingMode::DEFAULT, Dali::SamplingMode::BOX_THEN_LINEAR, false );
+                       if( !pixelBuffer )
+                       {
+                         return false;
+                       }
+                       pixelBuffer.ApplyMask( mask, 1.0f, false );
+                       pixelBuffer.MultiplyColorByAlpha();
+                       return true;
+                     },
+                     options.iterations, result ) )
+        {
+          results.push_back( result );
+        }
+        else
+        {
+          ReportFailure( result );
+        }
+      }
+    }
+  }
+}
+
+void RunProcessingStages( const Options& options, std::vector< Result >& results )
+{
+  using namespace Dali::Internal::Platform;
+
+  const Dali::Pixel::Format formats[] = { Dali::Pixel::RGBA8888, Dali::Pixel::RGB888 };
+  const char* const formatNames[] = { "rgba8888", "rgb888" };
+
+  for( auto&& size : options.sizes )
+  {
+    const unsigned int width = size.GetWidth();
+    const unsigned int height = size.GetHeight();
+    Dali::Devel::PixelBuffer mask = CreateTestPixelBuffer( width, height, Dali::Pixel::L8 );
+
+    for( unsigned int formatIndex = 0; formatIndex < sizeof( formats ) / sizeof( formats[0] ); ++formatIndex )
+    {
+      const Dali::Pixel::Format pixelFormat = formats[formatIndex];
+      const Dali::Devel::PixelBuffer source = CreateTestPixelBuffer( width, height, pixelFormat );
+      Dali::Devel::PixelBuffer input;
+      const auto copyInput = [&input, &source]() { input = CopyPixelBuffer( source ); };
+
+      Result result = { "", formatNames[formatIndex], width, height, 0u, 0.0, 0.0, 0 };
+      std::vector< std::pair< const char*, std::function< bool() > > > stages;
+
+      // The downscale a gallery makes to a third of the size, box filtered then linearly sampled:
+      stages.push_back( std::make_pair( "downscale", std::function< bool() >( [&input, width, height]()
+      {
+        const Dali::ImageDimensions desired( std::max( width / 3u, 1u ), std::max( height / 3u, 1u ) );
+        return bool( DownscaleBitmap( input, desired, Dali::FittingMode::SHRINK_TO_FIT, Dali::SamplingMode::BOX_THEN_LINEAR ) );
+      } ) ) );
+
+      // Lanczos resampling to half the size, repeated as a gallery making thumbnails of the same size would:
+      std::vector< uint8_t > resampled;
+      const std::function< bool() > resample( [&source, &resampled, width, height, pixelFormat]()
+      {
+        const Dali::ImageDimensions desired( std::max( width / 2u, 1u ), std::max( height / 2u, 1u ) );
+        const int numChannels = static_cast< int >( Dali::Pixel::GetBytesPerPixel( pixelFormat ) );
+        resampled.resize( desired.GetWidth() * desired.GetHeight() * numChannels );
+        Resample( source.GetBuffer(), Dali::ImageDimensions( width, height ), &resampled[0], desired, Resampler::LANCZOS3, numChannels, Dali::Pixel::HasAlpha( pixelFormat ) );
+        return true;
+      } );
+      stages.push_back( std::make_pair( "resample", resample ) );
+
+      // The same, working out the contributor lists for every image:
+      stages.push_back( std::make_pair( "resample-uncached", std::function< bool() >( [&resample]()
+      {
+        SetResampleCacheMemoryLimit( 0u );
+        const bool result = resample();
+        SetResampleCacheMemoryLimit( DEFAULT_RESAMPLE_CACHE_MEMORY_LIMIT );
+        return result;
+      } ) ) );
+
+      stages.push_back( std::make_pair( "mask", std::function< bool() >( [&input, &mask]()
+      {
+        input.ApplyMask( mask, 1.0f, false );
+        return true;
+      } ) ) );
+
+      // Only RGBA8888 can be blurred:
+      if( pixelFormat == Dali::Pixel::RGBA8888 )
+      {
+        for( auto&& blur : BLUR_STAGES )
+        {
+          stages.push_back( std::make_pair( blur.name, std::function< bool() >( [&input, &blur]()
+          {
+            if( blur.approximate )
+            {
+              input.ApplyApproximateGaussianBlur( blur.radius );
+            }
+            else
+            {
+              input.ApplyGaussianBlur( blur.radius );
+            }
+            return true;
+          } ) ) );
+        }
+      }
+
+      for( auto&& stage : stages )
+      {
+        if( HasStage( options, stage.first ) )
+        {
+          result.stage = stage.first;
+          if( Measure( copyInput, stage.second, options.iterations, result ) )
+          {
+            results.push_back( result );
+          }
+          else
+          {
+            ReportFailure( result );
+          }
+        }
+      }
+    }
+  }
+}
+
+std::string EscapeJson( const std::string& text )
+{
+  std::string escaped;
+  for( auto&& character : text )
+  {
+    if( character == '"' || character == '\\' )
+    {
+      escaped += '\\';
+    }
+    if( static_cast< unsigned char >( character ) >= 0x20u )
+    {
+      escaped += character;
+    }
+  }
+  return escaped;
+}
+
+void WriteJson( FILE* out, const Options& options, const std::vector< Result >& results )
+{
+  fprintf( out, "{\n" );
+  fprintf( out, "  \"benchmark\": \"dali-adaptor-image-pipeline\",\n" );
+  fprintf( out, "  \"label\": \"%s\",\n", EscapeJson( options.label ).c_str() );
+  fprintf( out, "  \"corpus_version\": %u,\n", Benchmark::CORPUS_VERSION );
+  fprintf( out, "  \"corpus_seed\": %u,\n", Benchmark::CORPUS_SEED );
+  fprintf( out, "  \"iterations\": %u,\n", options.iterations );
+  fprintf( out, "  \"buffer_pool_limit\": %zu,\n", options.bufferPoolLimit );
+  fprintf( out, "  \"hardware_concurrency\": %u,\n", std::thread::hardware_concurrency() );
+  fprintf( out, "  \"results\": [\n" );
+  for( std::size_t i = 0; i < results.size(); ++i )
+  {
+    const Result& result = results[i];
+    const double megapixels = static_cast< double >( result.width ) * result.height / 1.0e6;
+    fprintf( out, "    { \"stage\": \"%s\", \"format\": \"%s\", \"width\": %u, \"height\": %u, "
+                  "\"median_ms\": %.3f, \"min_ms\": %.3f, \"megapixels_per_second\": %.2f, ",
+             result.stage.c_str(), result.format.c_str(), result.width, result.height,
+             result.medianSeconds * 1.0e3, result.minimumSeconds * 1.0e3, megapixels / result.medianSeconds );
+    if( result.inputBytes > 0u )
+    {
+      fprintf( out, "\"input_bytes\": %zu, \"input_megabytes_per_second\": %.2f, ",
+               result.inputBytes, static_cast< double >( result.inputBytes ) / 1.0e6 / result.medianSeconds );
+    }
+    fprintf( out, "\"peak_rss_kb\": %ld }%s\n", result.peakRssKb, ( i + 1u < results.size() ) ? "," : "" );
+  }
+  fprintf( out, "  ]\n" );
+  fprintf( out, "}\n" );
+}
+
+} // unnamed namespace
+
+int main( int argc, char* const argv[] )
+{
+  Options options;
+  if( !ParseOptions( argc, argv, options ) )
+  {
+    Usage( argv[0] );
+    return EXIT_FAILURE;
+  }
+
+  mkdir( options.corpusDirectory.c_str(), 0755 );
+  std::vector< Benchmark::CorpusImage > images;
+  if( !Benchmark::GenerateCorpus( options.corpusDirectory, options.sizes, options.regenerate, images ) )
+  {
+    return EXIT_FAILURE;
+  }
+
+  if( options.bufferPoolLimit > 0u )
+  {
+    Dali::Internal::Platform::BufferPool::Get().SetMemoryLimit( options.bufferPoolLimit );
+  }
+
+  std::vector< Result > results;
+  RunLoadStages( options, images, results );
+  RunProcessingStages( options, results );
+
+  FILE* const out = options.outputFile.empty() ? stdout : fopen( options.outputFile.c_str(), "w" );
+  if( !out )
+  {
+    fprintf( stderr, "Could not open %s\n", options.outputFile.c_str() );
+    return EXIT_FAILURE;
+  }
+  WriteJson( out, options, results );
+  if( out != stdout )
+  {
+    fclose( out );
+  }
+  return EXIT_SUCCESS;
+}
@@ -15,8 +15,10 @@
  *
  */
 
+#include <cstdio>
 #include <iostream>
 #include <stdlib.h>
+#include <vector>
 #include <dali-test-suite-utils.h>
 
 #include <dali/internal/imaging/common/loader-bmp.h>
@@ -29,6 +31,57 @@ namespace
 
 static const LoadFunctions BmpLoaders( TizenPlatform::LoadBmpHeader, TizenPlatform::LoadBitmapFromBmp );
 
+void AppendLittleEndian( std::vector<unsigned char>& file, unsigned int value, unsigned int numBytes )
+{
+  for( unsigned int i = 0u; i < numBytes; ++i )
+  {
+    file.push_back( static_cast<unsigned char>( value >> ( i * 8u ) ) );
+  }
+}
+
+/**
+ * Build a BI_RGB BMP file in memory, with a BITMAPINFOHEADER and an optional colour table.
+ */
+std::vector<unsigned char> MakeBmpFile( unsigned int width, int height, unsigned int bitsPerPixel,
+                                        const std::vector<unsigned char>& colorTable, const std::vector<unsigned char>& pixelArray )
+{
+  const unsigned int offset = 14u + 40u + colorTable.size();
+  std::vector<unsigned char> file;
+  AppendLittleEndian( file, 0x4D42u, 2u );
+  AppendLittleEndian( file, offset + pixelArray.size(), 4u );
+  AppendLittleEndian( file, 0u, 4u );
+  AppendLittleEndian( file, offset, 4u );
+  AppendLittleEndian( file, 40u, 4u );
+  AppendLittleEndian( file, width, 4u );
+  AppendLittleEndian( file, static_cast<unsigned int>( height ), 4u );
+  AppendLittleEndian( file, 1u, 2u );
+  AppendLittleEndian( file, bitsPerPixel, 2u );
+  AppendLittleEndian( file, 0u, 4u ); // BI_RGB
+  AppendLittleEndian( file, pixelArray.size(), 4u );
+  AppendLittleEndian( file, 0u, 16u );
+  file.insert( file.end(), colorTable.begin(), colorTable.end() );
+  file.insert( file.end(), pixelArray.begin(), pixelArray.end() );
+  return file;
+}
+
+/**
+ * Decode a BMP file held in memory, as a downloaded image would be.
+ */
+bool LoadBmpFromMemory( std::vector<unsigned char>& file, Devel::PixelBuffer& bitmap )
+{
+  FILE* const fp = fmemopen( file.data(), file.size(), "rb" );
+  AutoCloseFile autoClose( fp );
+  return fp && TizenPlatform::LoadBitmapFromBmp( ImageLoader::Input( fp ), bitmap );
+}
+
+void CheckPixel( const Devel::PixelBuffer& bitmap, unsigned int x, unsigned int y, unsigned char red, unsigned char green, unsigned char blue )
+{
+  const unsigned char* const pixel = bitmap.GetBuffer() + ( y * bitmap.GetWidth() + x ) * 3u;
+  DALI_TEST_EQUALS( static_cast<unsigned int>( pixel[0] ), static_cast<unsigned int>( red ), TEST_LOCATION );
+  DALI_TEST_EQUALS( static_cast<unsigned int>( pixel[1] ), static_cast<unsigned int>( green ), TEST_LOCATION );
+  DALI_TEST_EQUALS( static_cast<unsigned int>( pixel[2] ), static_cast<unsigned int>( blue ), TEST_LOCATION );
+}
+
 } // Unnamed namespace.
 
 int UtcDaliBmp24bpp(void)
@@ -40,3 +93,70 @@ int UtcDaliBmp24bpp(void)
   END_TEST;
 }
 
+
+int UtcDaliBmp8bppColorTable(void)
+{
+  // A colour table of BGRX entries, using indices over 127:
+  std::vector<unsigned char> colorTable( 1024u, 0u );
+  const unsigned char colors[][3] = { { 10, 20, 30 }, { 200, 100, 50 }, { 1, 2, 3 } };
+  const unsigned int indices[] = { 0u, 129u, 255u };
+  for( unsigned int i = 0u; i < 3u; ++i )
+  {
+    colorTable[indices[i] * 4u]      = colors[i][2];
+    colorTable[indices[i] * 4u + 1u] = colors[i][1];
+    colorTable[indices[i] * 4u + 2u] = colors[i][0];
+  }
+
+  // Two rows of three pixels, padded to four bytes, stored bottom up:
+  const std::vector<unsigned char> pixelArray = { 255u, 0u, 129u, 0u,
+                                                  0u, 129u, 255u, 0u };
+  std::vector<unsigned char> file = MakeBmpFile( 3u, 2, 8u, colorTable, pixelArray );
+
+  Devel::PixelBuffer bitmap;
+  DALI_TEST_CHECK( LoadBmpFromMemory( file, bitmap ) );
+  DALI_TEST_EQUALS( bitmap.GetPixelFormat(), Pixel::RGB888, TEST_LOCATION );
+  DALI_TEST_EQUALS( bitmap.GetHeight(), 2u, TEST_LOCATION );
+
+  CheckPixel( bitmap, 0u, 0u, 10, 20, 30 );
+  CheckPixel( bitmap, 1u, 0u, 200, 100, 50 );
+  CheckPixel( bitmap, 2u, 0u, 1, 2, 3 );
+  CheckPixel( bitmap, 0u, 1u, 1, 2, 3 );
+  CheckPixel( bitmap, 1u, 1u, 10, 20, 30 );
+  CheckPixel( bitmap, 2u, 1u, 200, 100, 50 );
+
+  END_TEST;
+}
+
+int UtcDaliBmp16bppRGB555(void)
+{
+  // One row of X1R5G5B5 pixels, stored top down:
+  const std::vector<unsigned char> pixelArray = { 0x00, 0x7C,   // red
+                                                  0xE0, 0x83,   // green, with the unused top bit set
+                                                  0x1F, 0x00,   // blue
+                                                  0x21, 0x04 }; // one step of each
+  std::vector<unsigned char> file = MakeBmpFile( 4u, -1, 16u, std::vector<unsigned char>(), pixelArray );
+
+  Devel::PixelBuffer bitmap;
+  DALI_TEST_CHECK( LoadBmpFromMemory( file, bitmap ) );
+  DALI_TEST_EQUALS( bitmap.GetPixelFormat(), Pixel::RGB888, TEST_LOCATION );
+  DALI_TEST_EQUALS( bitmap.GetWidth(), 4u, TEST_LOCATION );
+
+  CheckPixel( bitmap, 0u, 0u, 255, 0, 0 );
+  CheckPixel( bitmap, 1u, 0u, 0, 255, 0 );
+  CheckPixel( bitmap, 2u, 0u, 0, 0, 255 );
+  CheckPixel( bitmap, 3u, 0u, 8, 8, 8 );
+
+  END_TEST;
+}
+
+int UtcDaliBmpTruncatedColorIndicesN(void)
+{
+  const std::vector<unsigned char> colorTable( 1024u, 0u );
+  const std::vector<unsigned char> pixelArray( 4u, 0u );
+  std::vector<unsigned char> file = MakeBmpFile( 4u, 2, 8u, colorTable, pixelArray );
+
+  Devel::PixelBuffer bitmap;
+  DALI_TEST_CHECK( !LoadBmpFromMemory( file, bitmap ) );
+
+  END_TEST;
+}
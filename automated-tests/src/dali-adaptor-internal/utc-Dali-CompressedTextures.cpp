@@ -16,12 +16,15 @@
  */
 
 // EXTERNAL INCLUDES
+#include <cstring>
 #include <iostream>
 #include <stdlib.h>
+#include <unistd.h>
 #include <vector>
 #include <dali-test-suite-utils.h>
 #include <dali/internal/imaging/common/loader-ktx.h>
 #include <dali/internal/imaging/common/loader-astc.h>
+#include <dali/internal/imaging/common/pixel-buffer-impl.h>
 
 // INTERNAL INCLUDES
 #include "image-loaders.h"
@@ -32,6 +35,80 @@ using namespace Dali;
 static const LoadFunctions KtxLoaders(  TizenPlatform::LoadKtxHeader,  TizenPlatform::LoadBitmapFromKtx  );
 static const LoadFunctions AstcLoaders( TizenPlatform::LoadAstcHeader, TizenPlatform::LoadBitmapFromAstc );
 
+namespace
+{
+
+/**
+ * Reads the whole of a file.
+ */
+std::vector<uint8_t> ReadFile( const char* filename )
+{
+  std::vector<uint8_t> contents;
+  FILE* const file = fopen( filename, "rb" );
+  AutoCloseFile autoClose( file );
+  if( file )
+  {
+    fseek( file, 0, SEEK_END );
+    contents.resize( ftell( file ) );
+    rewind( file );
+    contents.resize( fread( contents.data(), 1, contents.size(), file ) );
+  }
+  return contents;
+}
+
+/**
+ * Loads a compressed texture from a stream over a copy of the file, which can't be mapped.
+ */
+Dali::Devel::PixelBuffer LoadFromMemory( std::vector<uint8_t> contents, const LoadFunctions& loadFunctions )
+{
+  Dali::Devel::PixelBuffer bitmap;
+  FILE* const file = fmemopen( contents.data(), contents.size(), "rb" );
+  AutoCloseFile autoClose( file );
+  if( file )
+  {
+    loadFunctions.loader( Dali::ImageLoader::Input( file ), bitmap );
+  }
+  return bitmap;
+}
+
+/**
+ * Writes a KTX file of ETC2 compressed 8x8 images with 3 mipmap levels and 2 array layers.
+ * The bytes of each image are the number of the image, counting from 1. It is deleted when closed.
+ */
+FILE* OpenKtxLevelsFile()
+{
+  const uint32_t header[] = { 0x58544BABu, 0xBB313120u, 0x0A1A0A0Du, // Identifier
+                              0x04030201u,                           // Endianness
+                              0u, 1u, 0u, 0x9274u, 0x1907u,          // glType, glTypeSize, glFormat, glInternalFormat (RGB8_ETC2), glBaseInternalFormat
+                              8u, 8u, 0u,                            // Width, height and depth
+                              2u, 1u, 3u,                            // Array elements, faces and mipmap levels
+                              0u };                                  // Bytes of key value data
+  FILE* const file = tmpfile();
+  if( file )
+  {
+    fwrite( header, 1, sizeof( header ), file );
+
+    // Every level is at least one 4x4 block, of 8 bytes:
+    const uint32_t layerSizes[] = { 32u, 8u, 8u };
+    uint8_t image = 1u;
+    for( uint32_t layerSize : layerSizes )
+    {
+      const uint32_t imageSize = layerSize * 2u;
+      fwrite( &imageSize, 1, 4, file );
+      for( int layer = 0; layer < 2; ++layer, ++image )
+      {
+        std::vector<uint8_t> pixels( layerSize, image );
+        fwrite( pixels.data(), 1, pixels.size(), file );
+      }
+    }
+    fflush( file );
+    rewind( file );
+  }
+  return file;
+}
+
+} // unnamed namespace
+
 /**
  * This class encapsulates knowledge of testing compressed files.
  * It requires a few input parameters per test to confirm if the file was read and understood.
@@ -195,3 +272,137 @@ int UtcDaliAstcLoader(void)
   END_TEST;
 }
 
+int UtcDaliKtxLoaderMapped(void)
+{
+  const char* const filename = TEST_IMAGE_DIR "/fractal-compressed-RGB8_ETC2-45x80.ktx";
+  FILE* const file = fopen( filename, "rb" );
+  AutoCloseFile autoClose( file );
+  DALI_TEST_CHECK( file );
+
+  Dali::Devel::PixelBuffer bitmap;
+  DALI_TEST_CHECK( TizenPlatform::LoadBitmapFromKtx( Dali::ImageLoader::Input( file ), bitmap ) );
+  DALI_TEST_CHECK( bitmap );
+  DALI_TEST_EQUALS( bitmap.GetWidth(), 45u, TEST_LOCATION );
+  DALI_TEST_EQUALS( bitmap.GetHeight(), 80u, TEST_LOCATION );
+
+  // The data is the same as read from a stream which can't be mapped:
+  Dali::Devel::PixelBuffer readBitmap = LoadFromMemory( ReadFile( filename ), KtxLoaders );
+  DALI_TEST_CHECK( readBitmap );
+  auto& impl = GetImplementation( bitmap );
+  auto& readImpl = GetImplementation( readBitmap );
+  DALI_TEST_EQUALS( impl.GetBufferSize(), readImpl.GetBufferSize(), TEST_LOCATION );
+  DALI_TEST_CHECK( memcmp( impl.GetConstBuffer(), readImpl.GetConstBuffer(), impl.GetBufferSize() ) == 0 );
+
+  // A PixelData gets a copy, as it owns its buffer:
+  Dali::PixelData pixelData = bitmap.CreatePixelData();
+  DALI_TEST_EQUALS( pixelData.GetWidth(), 45u, TEST_LOCATION );
+  DALI_TEST_EQUALS( pixelData.GetHeight(), 80u, TEST_LOCATION );
+
+  // The mapping isn't written to:
+  const unsigned char* const mappedPixels = impl.GetConstBuffer();
+  unsigned char* const pixels = bitmap.GetBuffer();
+  DALI_TEST_CHECK( pixels != mappedPixels );
+  DALI_TEST_CHECK( memcmp( pixels, readImpl.GetConstBuffer(), impl.GetBufferSize() ) == 0 );
+
+  END_TEST;
+}
+
+int UtcDaliKtxLoaderLevels(void)
+{
+  FILE* const file = OpenKtxLevelsFile();
+  AutoCloseFile autoClose( file );
+  DALI_TEST_CHECK( file );
+
+  std::vector<Dali::Devel::PixelBuffer> bitmaps;
+  unsigned int numberOfLayers = 0u;
+  DALI_TEST_CHECK( TizenPlatform::LoadLevelsFromKtx( Dali::ImageLoader::Input( file ), bitmaps, numberOfLayers ) );
+  DALI_TEST_EQUALS( numberOfLayers, 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( bitmaps.size(), 6u, TEST_LOCATION );
+
+  const unsigned int sizes[] = { 8u, 4u, 2u };
+  for( unsigned int image = 0u; image < bitmaps.size(); ++image )
+  {
+    Dali::Devel::PixelBuffer& bitmap = bitmaps[image];
+    DALI_TEST_EQUALS( bitmap.GetWidth(), sizes[image / 2u], TEST_LOCATION );
+    DALI_TEST_EQUALS( bitmap.GetHeight(), sizes[image / 2u], TEST_LOCATION );
+    DALI_TEST_EQUALS( bitmap.GetPixelFormat(), Pixel::COMPRESSED_RGB8_ETC2, TEST_LOCATION );
+
+    auto& impl = GetImplementation( bitmap );
+    DALI_TEST_EQUALS( impl.GetBufferSize(), image < 2u ? 32u : 8u, TEST_LOCATION );
+    std::vector<uint8_t> expected( impl.GetBufferSize(), static_cast<uint8_t>( image + 1u ) );
+    DALI_TEST_CHECK( memcmp( impl.GetConstBuffer(), expected.data(), expected.size() ) == 0 );
+  }
+
+  // The images outlive the file:
+  bitmaps.resize( 1u );
+  fclose( autoClose.filePtr );
+  autoClose.filePtr = NULL;
+  auto& impl = GetImplementation( bitmaps[0] );
+  std::vector<uint8_t> expected( impl.GetBufferSize(), 1u );
+  DALI_TEST_CHECK( memcmp( impl.GetConstBuffer(), expected.data(), expected.size() ) == 0 );
+
+  END_TEST;
+}
+
+int UtcDaliKtxLoaderLevelsFirstImage(void)
+{
+  FILE* const file = OpenKtxLevelsFile();
+  AutoCloseFile autoClose( file );
+  DALI_TEST_CHECK( file );
+
+  // Only the full size image of the first layer is loaded as a bitmap:
+  Dali::Devel::PixelBuffer bitmap;
+  DALI_TEST_CHECK( TizenPlatform::LoadBitmapFromKtx( Dali::ImageLoader::Input( file ), bitmap ) );
+  DALI_TEST_EQUALS( bitmap.GetWidth(), 8u, TEST_LOCATION );
+  DALI_TEST_EQUALS( bitmap.GetHeight(), 8u, TEST_LOCATION );
+
+  auto& impl = GetImplementation( bitmap );
+  std::vector<uint8_t> expected( 32u, 1u );
+  DALI_TEST_EQUALS( impl.GetBufferSize(), 32u, TEST_LOCATION );
+  DALI_TEST_CHECK( memcmp( impl.GetConstBuffer(), expected.data(), expected.size() ) == 0 );
+
+  END_TEST;
+}
+
+int UtcDaliKtxLoaderLevelsTruncated(void)
+{
+  FILE* const file = OpenKtxLevelsFile();
+  AutoCloseFile autoClose( file );
+  DALI_TEST_CHECK( file );
+
+  // Cut the last level short:
+  fseek( file, 0, SEEK_END );
+  DALI_TEST_EQUALS( ftruncate( fileno( file ), ftell( file ) - 4 ), 0, TEST_LOCATION );
+  rewind( file );
+
+  std::vector<Dali::Devel::PixelBuffer> bitmaps;
+  unsigned int numberOfLayers = 0u;
+  DALI_TEST_CHECK( !TizenPlatform::LoadLevelsFromKtx( Dali::ImageLoader::Input( file ), bitmaps, numberOfLayers ) );
+  DALI_TEST_CHECK( bitmaps.empty() );
+
+  END_TEST;
+}
+
+int UtcDaliAstcLoaderMapped(void)
+{
+  const char* const filename = TEST_IMAGE_DIR "/fractal-compressed-RGBA_ASTC_4x4_KHR-32x64.astc";
+  FILE* const file = fopen( filename, "rb" );
+  AutoCloseFile autoClose( file );
+  DALI_TEST_CHECK( file );
+
+  Dali::Devel::PixelBuffer bitmap;
+  DALI_TEST_CHECK( TizenPlatform::LoadBitmapFromAstc( Dali::ImageLoader::Input( file ), bitmap ) );
+  DALI_TEST_CHECK( bitmap );
+  DALI_TEST_EQUALS( bitmap.GetWidth(), 32u, TEST_LOCATION );
+  DALI_TEST_EQUALS( bitmap.GetHeight(), 64u, TEST_LOCATION );
+
+  // The data is the same as read from a stream which can't be mapped:
+  Dali::Devel::PixelBuffer readBitmap = LoadFromMemory( ReadFile( filename ), AstcLoaders );
+  DALI_TEST_CHECK( readBitmap );
+  auto& impl = GetImplementation( bitmap );
+  auto& readImpl = GetImplementation( readBitmap );
+  DALI_TEST_EQUALS( impl.GetBufferSize(), readImpl.GetBufferSize(), TEST_LOCATION );
+  DALI_TEST_CHECK( memcmp( impl.GetConstBuffer(), readImpl.GetConstBuffer(), impl.GetBufferSize() ) == 0 );
+
+  END_TEST;
+}
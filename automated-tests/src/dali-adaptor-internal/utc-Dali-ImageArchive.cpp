@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+#include <dali-test-suite-utils.h>
+#include <dali/internal/imaging/common/image-archive.h>
+#include <dali/internal/imaging/common/loader-dpk.h>
+#include <dali/internal/imaging/common/mapped-file.h>
+#include <dali/internal/imaging/common/pixel-buffer-impl.h>
+
+using namespace Dali;
+using Dali::Internal::Platform::ImageArchive;
+
+namespace
+{
+
+typedef std::vector<std::pair<std::string, Devel::PixelBuffer>> Images;
+
+/**
+ * @brief Create an image whose bytes count up from a seed.
+ */
+Devel::PixelBuffer CreateImage( unsigned int width, unsigned int height, Pixel::Format pixelFormat, uint8_t seed )
+{
+  Devel::PixelBuffer image = Devel::PixelBuffer::New( width, height, pixelFormat );
+  uint8_t* const buffer = image.GetBuffer();
+  const unsigned int size = width * height * Pixel::GetBytesPerPixel( pixelFormat );
+  for( unsigned int i = 0u; i < size; ++i )
+  {
+    buffer[i] = static_cast<uint8_t>( seed + i );
+  }
+  return image;
+}
+
+/**
+ * @brief Some images to pack, out of order.
+ */
+Images CreateImages()
+{
+  Images images;
+  images.push_back( std::make_pair( std::string( "icons/menu.png" ), CreateImage( 5u, 3u, Pixel::RGBA8888, 1u ) ) );
+  images.push_back( std::make_pair( std::string( "back.png" ), CreateImage( 7u, 2u, Pixel::RGB888, 50u ) ) );
+  images.push_back( std::make_pair( std::string( "icons/home.png" ), CreateImage( 1u, 1u, Pixel::L8, 100u ) ) );
+  return images;
+}
+
+/**
+ * @brief Write bytes to a temporary file and open it for reading. It is deleted when closed.
+ */
+FILE* OpenTemporaryFile( const Dali::Vector<uint8_t>& contents )
+{
+  FILE* const file = tmpfile();
+  if( file )
+  {
+    fwrite( contents.Begin(), 1u, contents.Count(), file );
+    fflush( file );
+    rewind( file );
+  }
+  return file;
+}
+
+} // unnamed namespace
+
+int UtcDaliImageArchiveUrl(void)
+{
+  char archiveFilePath[] = "/tmp/utc-Dali-ImageArchive-XXXXXX.dpk";
+  const int fileDescriptor = mkstemps( archiveFilePath, 4 );
+  DALI_TEST_CHECK( fileDescriptor >= 0 );
+  close( fileDescriptor );
+  const std::string archive( archiveFilePath );
+
+  const ImageArchive::Url url( archive + "#icons/home.png" );
+  DALI_TEST_CHECK( url.IsInArchive() );
+  DALI_TEST_EQUALS( url.filePath, archive, TEST_LOCATION );
+  DALI_TEST_EQUALS( url.entryName, std::string( "icons/home.png" ), TEST_LOCATION );
+
+  // Only the first archive in the url is opened:
+  const ImageArchive::Url nestedUrl( archive + "#icons.dpk#home.png" );
+  DALI_TEST_CHECK( nestedUrl.IsInArchive() );
+  DALI_TEST_EQUALS( nestedUrl.filePath, archive, TEST_LOCATION );
+  DALI_TEST_EQUALS( nestedUrl.entryName, std::string( "icons.dpk#home.png" ), TEST_LOCATION );
+
+  // Urls of anything else are left as they are:
+  const std::string plainUrls[] = { archive, archive + "#", "/usr/share/home.png", "home.png" };
+  for( const std::string& plainUrl : plainUrls )
+  {
+    const ImageArchive::Url plain( plainUrl );
+    DALI_TEST_CHECK( !plain.IsInArchive() );
+    DALI_TEST_EQUALS( plain.filePath, plainUrl, TEST_LOCATION );
+    DALI_TEST_CHECK( plain.entryName.empty() );
+  }
+
+  // Including plain images with ".dpk#" in their paths, where no archive file is:
+  DALI_TEST_CHECK( !ImageArchive::Url( "/non-exist/icons.dpk#home.png" ).IsInArchive() );
+  DALI_TEST_EQUALS( ImageArchive::Url( "icons.dpk#home.png" ).filePath, std::string( "icons.dpk#home.png" ), TEST_LOCATION );
+  const std::string directory = archive + ".directory.dpk";
+  DALI_TEST_CHECK( mkdir( directory.c_str(), 0700 ) == 0 );
+  DALI_TEST_CHECK( !ImageArchive::Url( directory + "#home.png" ).IsInArchive() );
+  rmdir( directory.c_str() );
+
+  unlink( archiveFilePath );
+
+  END_TEST;
+}
+
+int UtcDaliImageArchiveGetFromUrl(void)
+{
+  char archiveFilePath[] = "/tmp/utc-Dali-ImageArchive-XXXXXX.dpk";
+  const int fileDescriptor = mkstemps( archiveFilePath, 4 );
+  DALI_TEST_CHECK( fileDescriptor >= 0 );
+  Dali::Vector<uint8_t> contents;
+  DALI_TEST_CHECK( ImageArchive::Write( CreateImages(), contents ) );
+  DALI_TEST_CHECK( write( fileDescriptor, contents.Begin(), contents.Count() ) == static_cast<ssize_t>( contents.Count() ) );
+  close( fileDescriptor );
+
+  // The archive is found in the cache with the status read while splitting the url:
+  const ImageArchive::Url url( std::string( archiveFilePath ) + "#back.png" );
+  std::shared_ptr<const ImageArchive> archive = ImageArchive::Get( url );
+  DALI_TEST_CHECK( archive );
+  DALI_TEST_CHECK( ImageArchive::Get( url ) == archive );
+  DALI_TEST_CHECK( ImageArchive::Get( ImageArchive::Url( std::string( archiveFilePath ) + "#icons/menu.png" ) ) == archive );
+
+  ImageArchive::Entry entry;
+  DALI_TEST_CHECK( archive->Find( url.entryName, entry ) );
+  DALI_TEST_EQUALS( static_cast<unsigned int>( entry.width ), 7u, TEST_LOCATION );
+  DALI_TEST_EQUALS( static_cast<unsigned int>( entry.height ), 2u, TEST_LOCATION );
+
+  unlink( archiveFilePath );
+
+  END_TEST;
+}
+
+int UtcDaliImageArchiveWriteAndFind(void)
+{
+  const Images images = CreateImages();
+
+  Dali::Vector<uint8_t> contents;
+  DALI_TEST_CHECK( ImageArchive::Write( images, contents ) );
+
+  FILE* const file = OpenTemporaryFile( contents );
+  DALI_TEST_CHECK( file );
+  DALI_TEST_CHECK( ImageArchive::ReadHeader( file ) );
+
+  std::shared_ptr<const ImageArchive> archive = ImageArchive::Get( file );
+  fclose( file );
+  DALI_TEST_CHECK( archive );
+
+  // Every image is found, with its pixels in place in the mapping:
+  for( const auto& image : images )
+  {
+    ImageArchive::Entry entry;
+    DALI_TEST_CHECK( archive->Find( image.first, entry ) );
+    DALI_TEST_EQUALS( static_cast<unsigned int>( entry.width ), image.second.GetWidth(), TEST_LOCATION );
+    DALI_TEST_EQUALS( static_cast<unsigned int>( entry.height ), image.second.GetHeight(), TEST_LOCATION );
+    DALI_TEST_EQUALS( entry.pixelFormat, image.second.GetPixelFormat(), TEST_LOCATION );
+    DALI_TEST_EQUALS( entry.offset % 16u, 0u, TEST_LOCATION );
+
+    const Internal::Adaptor::PixelBuffer& pixelBuffer = GetImplementation( image.second );
+    DALI_TEST_EQUALS( entry.size, pixelBuffer.GetBufferSize(), TEST_LOCATION );
+    DALI_TEST_CHECK( memcmp( archive->GetMappedFile()->GetData() + entry.offset, pixelBuffer.GetConstBuffer(), entry.size ) == 0 );
+  }
+
+  ImageArchive::Entry entry;
+  DALI_TEST_CHECK( !archive->Find( "icons", entry ) );
+  DALI_TEST_CHECK( !archive->Find( "icons/home.png2", entry ) );
+  DALI_TEST_CHECK( !archive->Find( "", entry ) );
+
+  END_TEST;
+}
+
+int UtcDaliImageArchiveWriteRepeatedName(void)
+{
+  Images images = CreateImages();
+  images.push_back( std::make_pair( std::string( "back.png" ), CreateImage( 2u, 2u, Pixel::RGB888, 0u ) ) );
+
+  Dali::Vector<uint8_t> contents;
+  DALI_TEST_CHECK( !ImageArchive::Write( images, contents ) );
+
+  images.pop_back();
+  images.push_back( std::make_pair( std::string( "empty.png" ), Devel::PixelBuffer() ) );
+  DALI_TEST_CHECK( !ImageArchive::Write( images, contents ) );
+
+  END_TEST;
+}
+
+int UtcDaliImageArchiveInvalid(void)
+{
+  Dali::Vector<uint8_t> contents;
+  DALI_TEST_CHECK( ImageArchive::Write( CreateImages(), contents ) );
+
+  // The names in the index out of order:
+  {
+    Dali::Vector<uint8_t> unsorted = contents;
+    unsorted[12u + 24u] = 20u;
+    FILE* const file = OpenTemporaryFile( unsorted );
+    DALI_TEST_CHECK( !ImageArchive::Get( file ) );
+    fclose( file );
+  }
+
+  // The pixels of the last image cut short:
+  {
+    Dali::Vector<uint8_t> truncated = contents;
+    truncated.Resize( contents.Count() - 1u );
+    FILE* const file = OpenTemporaryFile( truncated );
+    DALI_TEST_CHECK( ImageArchive::ReadHeader( file ) );
+    DALI_TEST_CHECK( !ImageArchive::Get( file ) );
+    fclose( file );
+  }
+
+  // The pixels of the first image off the 16 byte boundary, though still within the file:
+  {
+    Dali::Vector<uint8_t> misaligned = contents;
+    uint32_t firstEntry = 0u;
+    uint32_t firstOffset = 0xffffffff;
+    for( uint32_t entryIndex = 0u; entryIndex < 3u; ++entryIndex )
+    {
+      const uint8_t* const offset = &misaligned[12u + entryIndex * 24u + 8u];
+      const uint32_t pixelOffset = offset[0] | ( offset[1] << 8 ) | ( offset[2] << 16 ) | ( offset[3] << 24 );
+      if( pixelOffset < firstOffset )
+      {
+        firstEntry = entryIndex;
+        firstOffset = pixelOffset;
+      }
+    }
+    misaligned[12u + firstEntry * 24u + 8u] += 1u;
+    FILE* const file = OpenTemporaryFile( misaligned );
+    DALI_TEST_CHECK( ImageArchive::ReadHeader( file ) );
+    DALI_TEST_CHECK( !ImageArchive::Get( file ) );
+    fclose( file );
+  }
+
+  // Some other file:
+  {
+    Dali::Vector<uint8_t> other = contents;
+    other[0u] = 0x89;
+    FILE* const file = OpenTemporaryFile( other );
+    DALI_TEST_CHECK( !ImageArchive::ReadHeader( file ) );
+    DALI_TEST_CHECK( !ImageArchive::Get( file ) );
+    fclose( file );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliDpkLoader(void)
+{
+  const Images images = CreateImages();
+
+  Dali::Vector<uint8_t> contents;
+  DALI_TEST_CHECK( ImageArchive::Write( images, contents ) );
+
+  FILE* const file = OpenTemporaryFile( contents );
+  DALI_TEST_CHECK( file );
+
+  // Without the name of an image, only the file is checked:
+  unsigned int width = 1u;
+  unsigned int height = 1u;
+  DALI_TEST_CHECK( TizenPlatform::LoadDpkHeader( ImageLoader::Input( file ), width, height ) );
+  DALI_TEST_EQUALS( width, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( height, 0u, TEST_LOCATION );
+
+  const ImageLoader::Input input( file, ImageLoader::ScalingParameters(), true, false, "icons/menu.png" );
+  DALI_TEST_CHECK( TizenPlatform::LoadDpkHeader( input, width, height ) );
+  DALI_TEST_EQUALS( width, 5u, TEST_LOCATION );
+  DALI_TEST_EQUALS( height, 3u, TEST_LOCATION );
+
+  Devel::PixelBuffer bitmap;
+  DALI_TEST_CHECK( TizenPlatform::LoadBitmapFromDpk( input, bitmap ) );
+  DALI_TEST_CHECK( bitmap );
+  DALI_TEST_EQUALS( bitmap.GetWidth(), 5u, TEST_LOCATION );
+  DALI_TEST_EQUALS( bitmap.GetHeight(), 3u, TEST_LOCATION );
+  DALI_TEST_EQUALS( bitmap.GetPixelFormat(), Pixel::RGBA8888, TEST_LOCATION );
+
+  // The pixels aren't copied out of the mapping:
+  std::shared_ptr<const ImageArchive> archive = ImageArchive::Get( file );
+  ImageArchive::Entry entry;
+  DALI_TEST_CHECK( archive && archive->Find( "icons/menu.png", entry ) );
+  const Internal::Adaptor::PixelBuffer& pixelBuffer = GetImplementation( bitmap );
+  DALI_TEST_CHECK( pixelBuffer.GetConstBuffer() == archive->GetMappedFile()->GetData() + entry.offset );
+  DALI_TEST_CHECK( memcmp( pixelBuffer.GetConstBuffer(), GetImplementation( images[0].second ).GetConstBuffer(), pixelBuffer.GetBufferSize() ) == 0 );
+
+  Devel::PixelBuffer missing;
+  const ImageLoader::Input missingInput( file, ImageLoader::ScalingParameters(), true, false, "missing.png" );
+  DALI_TEST_CHECK( !TizenPlatform::LoadDpkHeader( missingInput, width, height ) );
+  DALI_TEST_CHECK( !TizenPlatform::LoadBitmapFromDpk( missingInput, missing ) );
+  DALI_TEST_CHECK( !missing );
+
+  fclose( file );
+
+  // The bitmap keeps the archive mapped:
+  archive.reset();
+  DALI_TEST_CHECK( memcmp( pixelBuffer.GetConstBuffer(), GetImplementation( images[0].second ).GetConstBuffer(), pixelBuffer.GetBufferSize() ) == 0 );
+
+  END_TEST;
+}
@@ -17,8 +17,12 @@
 
 #include <dali-test-suite-utils.h>
 #include <dali/internal/imaging/common/image-operations.h>
+#include <dali/internal/imaging/common/buffer-pool.h>
+#include <dali/internal/imaging/common/cpu-features.h>
 #include <dali/devel-api/common/ref-counted-dali-vector.h>
 
+#include <cstring>
+#include <vector>
 #include <sys/mman.h>
 #include <unistd.h>
 
@@ -1092,6 +1096,229 @@ int UtcDaliImageOperationsAverageScanlinesRGB565(void)
 namespace
 {
 
+typedef void (*HalveScanlineFunction)( unsigned char * pixels, unsigned int width );
+typedef void (*AverageScanlinesFunction)( const unsigned char * scanline1, const unsigned char * scanline2, unsigned char* outputScanline, unsigned int width );
+
+/** The CPU feature sets the vectorised functions are checked under, ending with the default of everything available. */
+const unsigned int VECTORISED_TEST_FEATURE_MASKS[] =
+{
+  CPU_FEATURE_NONE,
+  CPU_FEATURE_SSE2,
+  CPU_FEATURE_SSE2 | CPU_FEATURE_SSSE3,
+  CPU_FEATURE_ALL
+};
+const unsigned int NUM_VECTORISED_TEST_FEATURE_MASKS = sizeof( VECTORISED_TEST_FEATURE_MASKS ) / sizeof( VECTORISED_TEST_FEATURE_MASKS[0] );
+
+void FillRandomBytes( Dali::Vector<uint8_t>& buffer )
+{
+  for( size_t i = 0; i < buffer.Count(); ++i )
+  {
+    buffer[i] = RandomComponent8();
+  }
+}
+
+/**
+ * @brief Check a vectorised scanline halving function matches its scalar reference for a range of widths.
+ *
+ * The widths cover scanlines shorter than, equal to and not a multiple of the vector block sizes,
+ * so the kernels and the scalar tails are both exercised.
+ * @return The number of scanlines which did not match.
+ */
+unsigned int CompareHalveScanlineFunctions( HalveScanlineFunction reference, HalveScanlineFunction vectorised, unsigned int bytesPerPixel )
+{
+  unsigned int numMismatches = 0u;
+  Dali::Vector<uint8_t> expected;
+  Dali::Vector<uint8_t> actual;
+  for( unsigned int width = 2u; width < 300u; ++width )
+  {
+    expected.Resize( width * bytesPerPixel );
+    FillRandomBytes( expected );
+    actual = expected;
+
+    reference( &expected[0], width );
+    vectorised( &actual[0], width );
+
+    if( memcmp( &expected[0], &actual[0], ( width / 2u ) * bytesPerPixel ) != 0 )
+    {
+      ++numMismatches;
+    }
+  }
+  return numMismatches;
+}
+
+/**
+ * @brief Check a vectorised scanline averaging function matches its scalar reference for a range of widths.
+ *
+ * Also checks the vectorised function when its output aliases the first input scanline.
+ * @return The number of scanlines which did not match.
+ */
+unsigned int CompareAverageScanlinesFunctions( AverageScanlinesFunction reference, AverageScanlinesFunction vectorised, unsigned int bytesPerPixel )
+{
+  unsigned int numMismatches = 0u;
+  Dali::Vector<uint8_t> buffer;
+  for( unsigned int width = 1u; width < 300u; ++width )
+  {
+    // Keep the scanlines in one allocation, in order, so they are laid out the way the debug aliasing checks expect:
+    const unsigned int numBytes = width * bytesPerPixel;
+    buffer.Resize( numBytes * 4u );
+    FillRandomBytes( buffer );
+    uint8_t* const scanline1 = &buffer[0];
+    uint8_t* const scanline2 = scanline1 + numBytes;
+    uint8_t* const expected = scanline2 + numBytes;
+    uint8_t* const actual = expected + numBytes;
+
+    reference( scanline1, scanline2, expected, width );
+    vectorised( scanline1, scanline2, actual, width );
+    if( memcmp( expected, actual, numBytes ) != 0 )
+    {
+      ++numMismatches;
+    }
+
+    vectorised( scanline1, scanline2, scanline1, width );
+    if( memcmp( expected, scanline1, numBytes ) != 0 )
+    {
+      ++numMismatches;
+    }
+  }
+  return numMismatches;
+}
+
+} // unnamed namespace
+
+/**
+ * @brief Test the vectorised scanline halving functions are bit-exact with the scalar ones for every instruction set.
+ */
+int UtcDaliImageOperationsHalveScanlineInPlaceVectorised(void)
+{
+  srand48( 53 * 47 * 23 * 19 );
+
+  for( unsigned int i = 0; i < NUM_VECTORISED_TEST_FEATURE_MASKS; ++i )
+  {
+    SetCpuFeatureMask( VECTORISED_TEST_FEATURE_MASKS[i] );
+
+    DALI_TEST_EQUALS( CompareHalveScanlineFunctions( HalveScanlineInPlaceRGB888, HalveScanlineInPlaceRGB888Vectorised, 3u ), 0u, TEST_LOCATION );
+    DALI_TEST_EQUALS( CompareHalveScanlineFunctions( HalveScanlineInPlaceRGBA8888, HalveScanlineInPlaceRGBA8888Vectorised, 4u ), 0u, TEST_LOCATION );
+    DALI_TEST_EQUALS( CompareHalveScanlineFunctions( HalveScanlineInPlaceRGB565, HalveScanlineInPlaceRGB565Vectorised, 2u ), 0u, TEST_LOCATION );
+    DALI_TEST_EQUALS( CompareHalveScanlineFunctions( HalveScanlineInPlace2Bytes, HalveScanlineInPlace2BytesVectorised, 2u ), 0u, TEST_LOCATION );
+    DALI_TEST_EQUALS( CompareHalveScanlineFunctions( HalveScanlineInPlace1Byte, HalveScanlineInPlace1ByteVectorised, 1u ), 0u, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+/**
+ * @brief Test the vectorised scanline averaging functions are bit-exact with the scalar ones for every instruction set.
+ */
+int UtcDaliImageOperationsAverageScanlinesVectorised(void)
+{
+  srand48( 19 * 23 * 47 * 53 );
+
+  for( unsigned int i = 0; i < NUM_VECTORISED_TEST_FEATURE_MASKS; ++i )
+  {
+    SetCpuFeatureMask( VECTORISED_TEST_FEATURE_MASKS[i] );
+
+    DALI_TEST_EQUALS( CompareAverageScanlinesFunctions( AverageScanlines1, AverageScanlines1Vectorised, 1u ), 0u, TEST_LOCATION );
+    DALI_TEST_EQUALS( CompareAverageScanlinesFunctions( AverageScanlines2, AverageScanlines2Vectorised, 2u ), 0u, TEST_LOCATION );
+    DALI_TEST_EQUALS( CompareAverageScanlinesFunctions( AverageScanlines3, AverageScanlines3Vectorised, 3u ), 0u, TEST_LOCATION );
+    DALI_TEST_EQUALS( CompareAverageScanlinesFunctions( AverageScanlinesRGBA8888, AverageScanlinesRGBA8888Vectorised, 4u ), 0u, TEST_LOCATION );
+    DALI_TEST_EQUALS( CompareAverageScanlinesFunctions( AverageScanlinesRGB565, AverageScanlinesRGB565Vectorised, 2u ), 0u, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+/**
+ * @brief Test that whole-image box filter downscaling gives the same pixels whether or not the vectorised kernels are used.
+ */
+int UtcDaliImageOperationsDownscaleInPlacePow2Vectorised(void)
+{
+  const Dali::Pixel::Format formats[] = { Dali::Pixel::RGB888, Dali::Pixel::RGBA8888, Dali::Pixel::RGB565, Dali::Pixel::LA88, Dali::Pixel::L8 };
+  const unsigned int inputWidth = 517u;
+  const unsigned int inputHeight = 263u;
+
+  srand48( 23 * 19 * 53 * 47 );
+
+  for( unsigned int i = 0; i < sizeof( formats ) / sizeof( formats[0] ); ++i )
+  {
+    Dali::Vector<uint8_t> scalarImage;
+    scalarImage.Resize( inputWidth * inputHeight * Dali::Pixel::GetBytesPerPixel( formats[i] ) );
+    FillRandomBytes( scalarImage );
+    Dali::Vector<uint8_t> vectorisedImage = scalarImage;
+
+    unsigned int scalarWidth = 0u, scalarHeight = 0u;
+    SetCpuFeatureMask( CPU_FEATURE_NONE );
+    DownscaleInPlacePow2( &scalarImage[0], formats[i], inputWidth, inputHeight, 31u, 15u, Dali::FittingMode::SHRINK_TO_FIT, Dali::SamplingMode::BOX, scalarWidth, scalarHeight );
+
+    unsigned int vectorisedWidth = 0u, vectorisedHeight = 0u;
+    SetCpuFeatureMask( CPU_FEATURE_ALL );
+    DownscaleInPlacePow2( &vectorisedImage[0], formats[i], inputWidth, inputHeight, 31u, 15u, Dali::FittingMode::SHRINK_TO_FIT, Dali::SamplingMode::BOX, vectorisedWidth, vectorisedHeight );
+
+    DALI_TEST_EQUALS( vectorisedWidth, scalarWidth, TEST_LOCATION );
+    DALI_TEST_EQUALS( vectorisedHeight, scalarHeight, TEST_LOCATION );
+    DALI_TEST_EQUALS( memcmp( &scalarImage[0], &vectorisedImage[0], scalarWidth * scalarHeight * Dali::Pixel::GetBytesPerPixel( formats[i] ) ), 0, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+/**
+ * @brief Test that downscaling an image a scanline at a time gives the same pixels as downscaling it whole.
+ */
+int UtcDaliImageOperationsPow2ScanlineDownscaler(void)
+{
+  const Dali::Pixel::Format formats[] = { Dali::Pixel::RGB888, Dali::Pixel::RGBA8888, Dali::Pixel::RGB565, Dali::Pixel::LA88, Dali::Pixel::L8 };
+  const Dali::FittingMode::Type fittingModes[] = { Dali::FittingMode::SHRINK_TO_FIT, Dali::FittingMode::SCALE_TO_FILL, Dali::FittingMode::FIT_WIDTH, Dali::FittingMode::FIT_HEIGHT };
+  const unsigned int inputWidth = 517u;
+  const unsigned int inputHeight = 263u;
+
+  srand48( 47 * 53 * 19 * 23 );
+
+  for( unsigned int i = 0; i < sizeof( formats ) / sizeof( formats[0] ); ++i )
+  {
+    const unsigned int bytesPerPixel = Dali::Pixel::GetBytesPerPixel( formats[i] );
+    Dali::Vector<uint8_t> image;
+    image.Resize( inputWidth * inputHeight * bytesPerPixel );
+    FillRandomBytes( image );
+
+    for( unsigned int j = 0; j < sizeof( fittingModes ) / sizeof( fittingModes[0] ); ++j )
+    {
+      Dali::Vector<uint8_t> wholeImage = image;
+      unsigned int wholeWidth = 0u, wholeHeight = 0u;
+      DownscaleInPlacePow2( &wholeImage[0], formats[i], inputWidth, inputHeight, 31u, 15u, fittingModes[j], Dali::SamplingMode::BOX_THEN_LINEAR, wholeWidth, wholeHeight );
+
+      unsigned int streamedWidth = 0u, streamedHeight = 0u;
+      const unsigned int halvings = CalculatePow2Downscale( formats[i], inputWidth, inputHeight, 31u, 15u, fittingModes[j], Dali::SamplingMode::BOX_THEN_LINEAR, streamedWidth, streamedHeight );
+      DALI_TEST_EQUALS( streamedWidth, wholeWidth, TEST_LOCATION );
+      DALI_TEST_EQUALS( streamedHeight, wholeHeight, TEST_LOCATION );
+      DALI_TEST_CHECK( halvings > 0u );
+
+      Dali::Vector<uint8_t> streamedImage;
+      streamedImage.Resize( streamedWidth * streamedHeight * bytesPerPixel );
+      Pow2ScanlineDownscaler downscaler( formats[i], inputWidth, inputHeight, halvings, &streamedImage[0] );
+      Dali::Vector<uint8_t> scanline;
+      scanline.Resize( inputWidth * bytesPerPixel );
+      for( unsigned int y = 0; y < inputHeight; ++y )
+      {
+        memcpy( &scanline[0], &image[y * inputWidth * bytesPerPixel], inputWidth * bytesPerPixel );
+        downscaler.PushScanline( &scanline[0] );
+      }
+
+      DALI_TEST_EQUALS( memcmp( &wholeImage[0], &streamedImage[0], streamedWidth * streamedHeight * bytesPerPixel ), 0, TEST_LOCATION );
+    }
+  }
+
+  // Sampling modes without a box filter aren't downscaled:
+  unsigned int width = 0u, height = 0u;
+  DALI_TEST_EQUALS( CalculatePow2Downscale( Dali::Pixel::RGBA8888, inputWidth, inputHeight, 31u, 15u, Dali::FittingMode::SHRINK_TO_FIT, Dali::SamplingMode::LINEAR, width, height ), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( width, inputWidth, TEST_LOCATION );
+  DALI_TEST_EQUALS( height, inputHeight, TEST_LOCATION );
+
+  END_TEST;
+}
+
+namespace
+{
+
 void MakeSingleColorImageRGBA8888( unsigned int width, unsigned int height, uint32_t *inputImage )
 {
   const uint32_t inPixel = PixelRGBA8888( 255, 192, 128, 64 );
@@ -1424,3 +1651,413 @@ int UtcDaliImageOperationsBilinearFilter1BPP(void)
 
   END_TEST;
 }
+
+namespace
+{
+
+/**
+ * @brief The resampling functions which can be split across threads.
+ */
+enum ResampleFunction
+{
+  RESAMPLE_POINT,
+  RESAMPLE_LINEAR,
+  RESAMPLE_LANCZOS
+};
+
+/**
+ * @brief Resample a random image once on the calling thread and once split across the worker pool.
+ * @return Whether the two outputs are identical.
+ */
+bool ParallelResampleMatchesSerial( Dali::Pixel::Format pixelFormat, ResampleFunction resampleFunction, ImageDimensions inputDimensions, ImageDimensions outputDimensions )
+{
+  const unsigned int bytesPerPixel = Dali::Pixel::GetBytesPerPixel( pixelFormat );
+  Dali::Vector<uint8_t> input;
+  input.Resize( inputDimensions.GetWidth() * inputDimensions.GetHeight() * bytesPerPixel );
+  FillRandomBytes( input );
+
+  Dali::Vector<uint8_t> serialOutput;
+  serialOutput.Resize( outputDimensions.GetWidth() * outputDimensions.GetHeight() * bytesPerPixel );
+  Dali::Vector<uint8_t> parallelOutput;
+  parallelOutput.Resize( serialOutput.Count() );
+
+  Dali::Vector<uint8_t>* outputs[] = { &serialOutput, &parallelOutput };
+  for( unsigned int i = 0; i < 2u; ++i )
+  {
+    SetParallelResamplingEnabled( i == 1u );
+    unsigned char* const outPixels = &( *outputs[i] )[0];
+    if( resampleFunction == RESAMPLE_POINT )
+    {
+      PointSample( &input[0], inputDimensions.GetWidth(), inputDimensions.GetHeight(), pixelFormat, outPixels, outputDimensions.GetWidth(), outputDimensions.GetHeight() );
+    }
+    else if( resampleFunction == RESAMPLE_LINEAR )
+    {
+      LinearSample( &input[0], inputDimensions, pixelFormat, outPixels, outputDimensions );
+    }
+    else if( bytesPerPixel == 4u )
+    {
+      LanczosSample4BPP( &input[0], inputDimensions, outPixels, outputDimensions );
+    }
+    else
+    {
+      LanczosSample1BPP( &input[0], inputDimensions, outPixels, outputDimensions );
+    }
+  }
+
+  return memcmp( &serialOutput[0], &parallelOutput[0], serialOutput.Count() ) == 0;
+}
+
+} // unnamed namespace
+
+/**
+ * @brief Test that splitting point, linear and Lanczos resampling across threads doesn't change their output.
+ */
+int UtcDaliImageOperationsParallelResamplingMatchesSerial(void)
+{
+  const Dali::Pixel::Format formats[] = { Dali::Pixel::RGB888, Dali::Pixel::RGBA8888, Dali::Pixel::RGB565, Dali::Pixel::LA88, Dali::Pixel::L8 };
+  const ImageDimensions inputDimensions( 613u, 457u );
+  const ImageDimensions outputDimensions( 301u, 173u );
+
+  srand48( 47 * 53 * 19 * 23 );
+
+  // Go parallel for any size of image so small test images exercise the banding:
+  SetParallelResamplingMinimumPixels( 0u );
+
+  for( unsigned int i = 0; i < sizeof( formats ) / sizeof( formats[0] ); ++i )
+  {
+    DALI_TEST_CHECK( ParallelResampleMatchesSerial( formats[i], RESAMPLE_POINT, inputDimensions, outputDimensions ) );
+    DALI_TEST_CHECK( ParallelResampleMatchesSerial( formats[i], RESAMPLE_LINEAR, inputDimensions, outputDimensions ) );
+  }
+  DALI_TEST_CHECK( ParallelResampleMatchesSerial( Dali::Pixel::RGBA8888, RESAMPLE_LANCZOS, inputDimensions, outputDimensions ) );
+  DALI_TEST_CHECK( ParallelResampleMatchesSerial( Dali::Pixel::L8, RESAMPLE_LANCZOS, inputDimensions, outputDimensions ) );
+
+  // Output scanlines fewer than the number of bands:
+  DALI_TEST_CHECK( ParallelResampleMatchesSerial( Dali::Pixel::RGBA8888, RESAMPLE_POINT, inputDimensions, ImageDimensions( 97u, 3u ) ) );
+  DALI_TEST_CHECK( ParallelResampleMatchesSerial( Dali::Pixel::RGB888, RESAMPLE_LINEAR, inputDimensions, ImageDimensions( 97u, 1u ) ) );
+
+  SetParallelResamplingEnabled( true );
+  SetParallelResamplingMinimumPixels( DEFAULT_PARALLEL_RESAMPLING_MINIMUM_PIXELS );
+
+  END_TEST;
+}
+
+int UtcDaliImageOperationsResampleContributorCache(void)
+{
+  // Repeatedly shrink an image to a thumbnail, the case the cache is for:
+  const ImageDimensions inputDimensions( 400u, 300u );
+  const ImageDimensions outputDimensions( 64u, 48u );
+
+  std::vector<unsigned char> inputImage( inputDimensions.GetWidth() * inputDimensions.GetHeight() );
+  srand48( 61 * 67 );
+  for( unsigned int i = 0; i < inputImage.size(); ++i )
+  {
+    inputImage[i] = static_cast<unsigned char>( RandomInRange( 255u ) );
+  }
+
+  std::vector<unsigned char> uncached( outputDimensions.GetWidth() * outputDimensions.GetHeight() );
+  std::vector<unsigned char> cached( uncached.size() );
+
+  SetResampleCacheMemoryLimit( 0u );
+  DALI_TEST_EQUALS( GetResampleCacheMemoryUsage(), 0u, TEST_LOCATION );
+
+  LanczosSample1BPP( &inputImage[0], inputDimensions, &uncached[0], outputDimensions );
+  DALI_TEST_EQUALS( GetResampleCacheMemoryUsage(), 0u, TEST_LOCATION );
+
+  // The lists are cached by the first resample and reused by the second:
+  SetResampleCacheMemoryLimit( DEFAULT_RESAMPLE_CACHE_MEMORY_LIMIT );
+  for( unsigned int i = 0; i < 2u; ++i )
+  {
+    std::fill( cached.begin(), cached.end(), 0u );
+    LanczosSample1BPP( &inputImage[0], inputDimensions, &cached[0], outputDimensions );
+    DALI_TEST_CHECK( cached == uncached );
+  }
+
+  // Both axes' lists are cached and within the limit:
+  const std::size_t memoryUsage = GetResampleCacheMemoryUsage();
+  DALI_TEST_CHECK( memoryUsage > 0u );
+  DALI_TEST_CHECK( memoryUsage <= DEFAULT_RESAMPLE_CACHE_MEMORY_LIMIT );
+
+  // Lowering the limit evicts lists until the cache fits:
+  SetResampleCacheMemoryLimit( memoryUsage - 1u );
+  DALI_TEST_CHECK( GetResampleCacheMemoryUsage() < memoryUsage );
+  SetResampleCacheMemoryLimit( 0u );
+  DALI_TEST_EQUALS( GetResampleCacheMemoryUsage(), 0u, TEST_LOCATION );
+
+  SetResampleCacheMemoryLimit( DEFAULT_RESAMPLE_CACHE_MEMORY_LIMIT );
+
+  END_TEST;
+}
+
+namespace
+{
+
+/**
+ * @brief Work out where TransformPixels() should move an input pixel to, one pixel at a time.
+ * @return The index of the pixel in the output image.
+ */
+unsigned int ReferenceTransformedIndex( unsigned int x, unsigned int y, unsigned int width, unsigned int height, PixelTransform transform )
+{
+  switch( transform )
+  {
+    case PixelTransformRotate90:
+      return ( width - 1u - x ) * height + y;
+    case PixelTransformRotate180:
+      return ( height - 1u - y ) * width + ( width - 1u - x );
+    case PixelTransformRotate270:
+      return x * height + ( height - 1u - y );
+    case PixelTransformTranspose:
+      return x * height + y;
+    case PixelTransformTransverse:
+      return ( width - 1u - x ) * height + ( height - 1u - y );
+  }
+  return 0u;
+}
+
+/**
+ * @brief Transform an image one pixel at a time.
+ */
+void ReferenceTransformPixels( const Dali::Vector<uint8_t>& pixelsIn, unsigned int width, unsigned int height, unsigned int pixelSize, PixelTransform transform, Dali::Vector<uint8_t>& pixelsOut )
+{
+  pixelsOut.Resize( pixelsIn.Count() );
+  for( unsigned int y = 0u; y < height; ++y )
+  {
+    for( unsigned int x = 0u; x < width; ++x )
+    {
+      memcpy( &pixelsOut[ReferenceTransformedIndex( x, y, width, height, transform ) * pixelSize], &pixelsIn[( y * width + x ) * pixelSize], pixelSize );
+    }
+  }
+}
+
+const PixelTransform ALL_PIXEL_TRANSFORMS[] = { PixelTransformRotate90, PixelTransformRotate180, PixelTransformRotate270, PixelTransformTranspose, PixelTransformTransverse };
+
+} // unnamed namespace
+
+/**
+ * @brief Test the tiled rotations and transpositions against a pixel at a time reference, with and without vectors.
+ */
+int UtcDaliImageOperationsTransformPixels(void)
+{
+  const unsigned int sizes[][2] = { { 1u, 1u }, { 1u, 37u }, { 37u, 1u }, { 16u, 16u }, { 67u, 45u }, { 130u, 259u } };
+  const unsigned int pixelSizes[] = { 1u, 2u, 3u, 4u, 6u };
+
+  srand48( 29 * 31 * 37 );
+
+  for( unsigned int mask = 0; mask < NUM_VECTORISED_TEST_FEATURE_MASKS; ++mask )
+  {
+    SetCpuFeatureMask( VECTORISED_TEST_FEATURE_MASKS[mask] );
+
+    for( auto&& size : sizes )
+    {
+      for( auto&& pixelSize : pixelSizes )
+      {
+        Dali::Vector<uint8_t> input;
+        input.Resize( size[0] * size[1] * pixelSize );
+        FillRandomBytes( input );
+
+        for( auto&& transform : ALL_PIXEL_TRANSFORMS )
+        {
+          Dali::Vector<uint8_t> expected;
+          ReferenceTransformPixels( input, size[0], size[1], pixelSize, transform, expected );
+
+          Dali::Vector<uint8_t> actual;
+          actual.Resize( input.Count() );
+          DALI_TEST_CHECK( TransformPixels( &input[0], size[0], size[1], pixelSize, transform, &actual[0] ) );
+          DALI_TEST_EQUALS( memcmp( &expected[0], &actual[0], expected.Count() ), 0, TEST_LOCATION );
+        }
+      }
+    }
+  }
+
+  SetCpuFeatureMask( CPU_FEATURE_ALL );
+
+  uint8_t pixel = 0u;
+  DALI_TEST_CHECK( !TransformPixels( &pixel, 1u, 1u, 0u, PixelTransformRotate90, &pixel ) );
+
+  END_TEST;
+}
+
+/**
+ * @brief Test the in-place rotations and transpositions give the same images as the ones to a separate buffer.
+ */
+int UtcDaliImageOperationsTransformPixelsInPlace(void)
+{
+  const unsigned int sizes[] = { 1u, 15u, 16u, 64u, 67u, 131u };
+  const unsigned int pixelSizes[] = { 1u, 2u, 3u, 4u, 6u };
+
+  srand48( 37 * 31 * 29 );
+
+  for( unsigned int mask = 0; mask < NUM_VECTORISED_TEST_FEATURE_MASKS; ++mask )
+  {
+    SetCpuFeatureMask( VECTORISED_TEST_FEATURE_MASKS[mask] );
+
+    for( auto&& size : sizes )
+    {
+      for( auto&& pixelSize : pixelSizes )
+      {
+        Dali::Vector<uint8_t> input;
+        input.Resize( size * size * pixelSize );
+        FillRandomBytes( input );
+
+        for( auto&& transform : ALL_PIXEL_TRANSFORMS )
+        {
+          Dali::Vector<uint8_t> expected;
+          ReferenceTransformPixels( input, size, size, pixelSize, transform, expected );
+
+          Dali::Vector<uint8_t> actual = input;
+          DALI_TEST_CHECK( TransformPixelsInPlace( &actual[0], size, size, pixelSize, transform ) );
+          DALI_TEST_EQUALS( memcmp( &expected[0], &actual[0], expected.Count() ), 0, TEST_LOCATION );
+        }
+      }
+    }
+  }
+
+  SetCpuFeatureMask( CPU_FEATURE_ALL );
+
+  // A 180 degree rotation doesn't need a square image, the others do:
+  Dali::Vector<uint8_t> input;
+  input.Resize( 33u * 17u * 3u );
+  FillRandomBytes( input );
+  Dali::Vector<uint8_t> expected;
+  ReferenceTransformPixels( input, 33u, 17u, 3u, PixelTransformRotate180, expected );
+  DALI_TEST_CHECK( TransformPixelsInPlace( &input[0], 33u, 17u, 3u, PixelTransformRotate180 ) );
+  DALI_TEST_EQUALS( memcmp( &expected[0], &input[0], expected.Count() ), 0, TEST_LOCATION );
+
+  DALI_TEST_CHECK( !TransformPixelsInPlace( &input[0], 33u, 17u, 3u, PixelTransformRotate90 ) );
+  DALI_TEST_CHECK( !TransformPixelsInPlace( &input[0], 33u, 17u, 3u, PixelTransformTranspose ) );
+
+  END_TEST;
+}
+
+/**
+ * @brief Test the vectorised, parallel shears of RotateByShear() give the same image as the scalar code on one thread.
+ *
+ * One scratch buffer is shared by all the rotations, so reusing it is also checked.
+ */
+int UtcDaliImageOperationsRotateByShear(void)
+{
+  const unsigned int sizes[][2] = { { 1u, 1u }, { 2u, 3u }, { 37u, 5u }, { 67u, 45u }, { 130u, 259u } };
+  const unsigned int pixelSizes[] = { 1u, 2u, 3u, 4u };
+  const float angles[] = { 0.1f, 0.7f, -0.3f, 1.f, 2.f, 3.5f, 4.f, 5.9f };
+
+  srand48( 41 * 43 * 47 );
+
+  // Go parallel for any size of image so small test images exercise the banding:
+  SetParallelResamplingMinimumPixels( 0u );
+
+  Dali::Vector<uint8_t> scratch;
+  for( auto&& size : sizes )
+  {
+    for( auto&& pixelSize : pixelSizes )
+    {
+      Dali::Vector<uint8_t> input;
+      input.Resize( size[0] * size[1] * pixelSize );
+      FillRandomBytes( input );
+
+      for( auto&& radians : angles )
+      {
+        SetCpuFeatureMask( CPU_FEATURE_NONE );
+        SetParallelResamplingEnabled( false );
+
+        uint8_t* expected = nullptr;
+        unsigned int expectedWidth = size[0];
+        unsigned int expectedHeight = size[1];
+        RotateByShear( &input[0], size[0], size[1], pixelSize, radians, expected, expectedWidth, expectedHeight );
+        DALI_TEST_CHECK( nullptr != expected );
+
+        for( unsigned int mask = 0; mask < NUM_VECTORISED_TEST_FEATURE_MASKS; ++mask )
+        {
+          SetCpuFeatureMask( VECTORISED_TEST_FEATURE_MASKS[mask] );
+          SetParallelResamplingEnabled( true );
+
+          uint8_t* actual = nullptr;
+          unsigned int actualWidth = size[0];
+          unsigned int actualHeight = size[1];
+          RotateByShear( &input[0], size[0], size[1], pixelSize, radians, actual, actualWidth, actualHeight, scratch );
+          DALI_TEST_EQUALS( actualWidth, expectedWidth, TEST_LOCATION );
+          DALI_TEST_EQUALS( actualHeight, expectedHeight, TEST_LOCATION );
+          DALI_TEST_CHECK( nullptr != actual );
+          DALI_TEST_EQUALS( memcmp( expected, actual, expectedWidth * expectedHeight * pixelSize ), 0, TEST_LOCATION );
+          BufferPool::Get().Release( actual );
+        }
+        BufferPool::Get().Release( expected );
+      }
+    }
+  }
+
+  SetCpuFeatureMask( CPU_FEATURE_ALL );
+  SetParallelResamplingEnabled( true );
+  SetParallelResamplingMinimumPixels( DEFAULT_PARALLEL_RESAMPLING_MINIMUM_PIXELS );
+
+  END_TEST;
+}
+
+/**
+ * @brief Test the shears' outputs go back to the buffer pool as the glyph rendering hands them back.
+ *
+ * The font client shears software italic glyphs and the text renderer rotates the glyphs of
+ * circular text, both releasing the output with BufferPool::Release(). Nothing of either may be
+ * left tracked by the pool, or a later buffer malloc() puts at the same address would be kept
+ * with the wrong capacity.
+ */
+int UtcDaliImageOperationsShearOutputReleasedToPool(void)
+{
+  BufferPool& pool = BufferPool::Get();
+  pool.SetMemoryLimit( 4u * 1024u * 1024u );
+  pool.Trim( 0u );
+  pool.ResetStatistics();
+
+  srand48( 71 * 73 );
+
+  // A large L8 glyph given a software italic slant of 12 degrees, as the font client does:
+  const unsigned int glyphWidth = 300u;
+  const unsigned int glyphHeight = 300u;
+  Dali::Vector<uint8_t> glyph;
+  glyph.Resize( glyphWidth * glyphHeight );
+  FillRandomBytes( glyph );
+
+  uint8_t* sheared = nullptr;
+  unsigned int shearedWidth = 0u;
+  unsigned int shearedHeight = 0u;
+  HorizontalShear( &glyph[0], glyphWidth, glyphHeight, 1u, -0.20944f, sheared, shearedWidth, shearedHeight );
+  DALI_TEST_CHECK( nullptr != sheared );
+  DALI_TEST_CHECK( pool.IsPooled( sheared ) );
+
+  std::vector<uint8_t> glyphCopy( sheared, sheared + shearedWidth * shearedHeight );
+  pool.Release( sheared );
+  DALI_TEST_CHECK( !pool.IsPooled( sheared ) );
+  DALI_TEST_EQUALS( pool.GetStatistics().freeBuffers, 1u, TEST_LOCATION );
+
+  // An RGBA glyph rotated onto a circle, as the text renderer does:
+  Dali::Vector<uint8_t> emoji;
+  emoji.Resize( 160u * 160u * 4u );
+  FillRandomBytes( emoji );
+
+  uint8_t* rotated = nullptr;
+  unsigned int rotatedWidth = 0u;
+  unsigned int rotatedHeight = 0u;
+  RotateByShear( &emoji[0], 160u, 160u, 4u, 0.5f, rotated, rotatedWidth, rotatedHeight );
+  DALI_TEST_CHECK( nullptr != rotated );
+  pool.Release( rotated );
+  DALI_TEST_CHECK( !pool.IsPooled( rotated ) );
+
+  // Buffers from malloc() are freed rather than kept, whatever address they get:
+  const std::size_t freeBuffers = pool.GetStatistics().freeBuffers;
+  for( unsigned int i = 0u; i < 8u; ++i )
+  {
+    pool.Release( static_cast<uint8_t*>( malloc( ( 65u + 37u * i ) * 1024u ) ) );
+  }
+  DALI_TEST_EQUALS( pool.GetStatistics().freeBuffers, freeBuffers, TEST_LOCATION );
+
+  // Allocating again reuses the glyph's buffer, which is the whole size asked for:
+  const std::size_t hits = pool.GetStatistics().hits;
+  uint8_t* buffer = pool.Allocate( shearedWidth * shearedHeight );
+  DALI_TEST_CHECK( nullptr != buffer );
+  DALI_TEST_EQUALS( pool.GetStatistics().hits, hits + 1u, TEST_LOCATION );
+  memset( buffer, 0xa5, shearedWidth * shearedHeight );
+  pool.Release( buffer );
+
+  pool.Trim( 0u );
+  pool.SetMemoryLimit( 0u );
+
+  END_TEST;
+}
@@ -15,7 +15,10 @@
  *
  */
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
+#include <vector>
 
 #include <stdlib.h>
 #include <dali/public-api/dali-core.h>
@@ -25,6 +28,12 @@
 // Internal headers are allowed here
 
 #include <dali/internal/imaging/common/pixel-manipulation.h>
+#include <dali/internal/imaging/common/pixel-buffer-impl.h>
+#include <dali/internal/imaging/common/alpha-mask.h>
+#include <dali/internal/imaging/common/buffer-pool.h>
+#include <dali/internal/imaging/common/cpu-features.h>
+#include <dali/internal/imaging/common/pixel-format-conversion.h>
+#include <dali/internal/imaging/common/pixel-buffer-pipeline.h>
 
 using namespace Dali;
 using namespace Dali::Internal::Adaptor;
@@ -184,3 +193,806 @@ int UtcDaliPixelManipulation03N(void)
 
   END_TEST;
 }
+
+int UtcDaliPixelManipulationConvertPixels(void)
+{
+  tet_infoline("Testing Dali::Internal::Adaptor::ConvertPixels to and from RGBA8888");
+
+  const unsigned int numPixels = 256u;
+
+  for( int formatIdx=1; formatIdx<Dali::Pixel::COMPRESSED_R11_EAC; ++formatIdx)
+  {
+    Dali::Pixel::Format format = static_cast<Dali::Pixel::Format>(formatIdx);
+    const unsigned int bytesPerPixel = Dali::Pixel::GetBytesPerPixel( format );
+    tet_printf( "Testing conversion of %s\n", FormatToString(format) );
+
+    std::vector<unsigned char> source( numPixels * bytesPerPixel );
+    for( unsigned int i = 0; i < source.size(); ++i )
+    {
+      source[i] = static_cast<unsigned char>( ( i * 97u + formatIdx ) % 256u );
+    }
+
+    std::vector<unsigned char> rgba( numPixels * 4u );
+    DALI_TEST_CHECK( Dali::Internal::Adaptor::ConvertPixels( &source[0], format, &rgba[0], Dali::Pixel::RGBA8888, numPixels ) );
+
+    std::vector<unsigned char> roundTrip( source.size() );
+    DALI_TEST_CHECK( Dali::Internal::Adaptor::ConvertPixels( &rgba[0], Dali::Pixel::RGBA8888, &roundTrip[0], format, numPixels ) );
+
+    bool matches = true;
+    for( unsigned int i = 0; i < numPixels; ++i )
+    {
+      unsigned char* sourcePixel = &source[i * bytesPerPixel];
+
+      // Widening to RGBA8888 must agree with the per-pixel conversion functions
+      if( Dali::Internal::Adaptor::HasChannel( format, Dali::Internal::Adaptor::RED ) )
+      {
+        unsigned char expected[4] = { 0, 0, 0, 0 };
+        Dali::Internal::Adaptor::ConvertColorChannelsToRGBA8888( sourcePixel, 0, format, expected, 0 );
+        matches = matches && expected[0] == rgba[i * 4u] && expected[1] == rgba[i * 4u + 1u] && expected[2] == rgba[i * 4u + 2u];
+      }
+      const unsigned int expectedAlpha = Dali::Pixel::HasAlpha( format ) ? Dali::Internal::Adaptor::ConvertAlphaChannelToA8( sourcePixel, 0, format ) : 0xFFu;
+      matches = matches && rgba[i * 4u + 3u] == expectedAlpha;
+
+      // Every channel must survive the round trip
+      for( int channelIdx=0; channelIdx < Dali::Internal::Adaptor::MAX_NUMBER_OF_CHANNELS; ++channelIdx )
+      {
+        Dali::Internal::Adaptor::Channel channel = static_cast<Dali::Internal::Adaptor::Channel>(channelIdx);
+        matches = matches && Dali::Internal::Adaptor::ReadChannel( sourcePixel, format, channel ) ==
+                             Dali::Internal::Adaptor::ReadChannel( &roundTrip[i * bytesPerPixel], format, channel );
+      }
+    }
+    DALI_TEST_CHECK( matches );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliPixelManipulationConvertPixelsLuminance(void)
+{
+  tet_infoline("Testing Dali::Internal::Adaptor::ConvertPixels between luminance and color formats");
+
+  unsigned char luminance[3] = { 0x00, 0x80, 0xFF };
+  unsigned char rgb[9];
+  DALI_TEST_CHECK( Dali::Internal::Adaptor::ConvertPixels( luminance, Dali::Pixel::L8, rgb, Dali::Pixel::RGB888, 3u ) );
+  for( unsigned int i = 0; i < 3u; ++i )
+  {
+    DALI_TEST_EQUALS( rgb[i * 3u], luminance[i], TEST_LOCATION );
+    DALI_TEST_EQUALS( rgb[i * 3u + 1u], luminance[i], TEST_LOCATION );
+    DALI_TEST_EQUALS( rgb[i * 3u + 2u], luminance[i], TEST_LOCATION );
+  }
+
+  unsigned char colors[8] = { 0xFF, 0x00, 0x00, 0xFF,   0x00, 0xFF, 0x00, 0x80 };
+  unsigned char la[4];
+  DALI_TEST_CHECK( Dali::Internal::Adaptor::ConvertPixels( colors, Dali::Pixel::RGBA8888, la, Dali::Pixel::LA88, 2u ) );
+  DALI_TEST_EQUALS( la[0], 0x4Du, TEST_LOCATION ); // Red
+  DALI_TEST_EQUALS( la[1], 0xFFu, TEST_LOCATION );
+  DALI_TEST_EQUALS( la[2], 0x95u, TEST_LOCATION ); // Green
+  DALI_TEST_EQUALS( la[3], 0x80u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliPixelManipulationConvertPixelsN(void)
+{
+  tet_infoline("Testing Dali::Internal::Adaptor::ConvertPixels refuses formats without simple channels");
+
+  unsigned char source[4] = { 1, 2, 3, 4 };
+  unsigned char dest[4] = { 0, 0, 0, 0 };
+
+  DALI_TEST_CHECK( ! Dali::Internal::Adaptor::ConvertPixels( source, Dali::Pixel::COMPRESSED_RGB8_ETC1, dest, Dali::Pixel::RGBA8888, 1u ) );
+  DALI_TEST_CHECK( ! Dali::Internal::Adaptor::ConvertPixels( source, Dali::Pixel::RGBA8888, dest, Dali::Pixel::DEPTH_FLOAT, 1u ) );
+  DALI_TEST_EQUALS( dest[0], 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+namespace
+{
+
+/**
+ * @brief The formats ConvertPixels() handles.
+ */
+const Dali::Pixel::Format CONVERTIBLE_FORMATS[] =
+{
+  Dali::Pixel::A8, Dali::Pixel::L8, Dali::Pixel::LA88, Dali::Pixel::RGB565, Dali::Pixel::BGR565,
+  Dali::Pixel::RGBA4444, Dali::Pixel::BGRA4444, Dali::Pixel::RGBA5551, Dali::Pixel::BGRA5551,
+  Dali::Pixel::RGB888, Dali::Pixel::RGB8888, Dali::Pixel::BGR8888, Dali::Pixel::RGBA8888, Dali::Pixel::BGRA8888
+};
+const unsigned int NUM_CONVERTIBLE_FORMATS = sizeof( CONVERTIBLE_FORMATS ) / sizeof( CONVERTIBLE_FORMATS[0] );
+
+/**
+ * @brief The conversions with vectorised kernels.
+ */
+const Dali::Pixel::Format VECTORISED_CONVERSIONS[][2] =
+{
+  { Dali::Pixel::RGB888,   Dali::Pixel::RGBA8888 },
+  { Dali::Pixel::RGBA8888, Dali::Pixel::RGB888 },
+  { Dali::Pixel::RGB8888,  Dali::Pixel::RGB888 },
+  { Dali::Pixel::BGRA8888, Dali::Pixel::RGB888 },
+  { Dali::Pixel::BGR8888,  Dali::Pixel::RGB888 },
+  { Dali::Pixel::RGBA8888, Dali::Pixel::BGRA8888 },
+  { Dali::Pixel::BGRA8888, Dali::Pixel::RGBA8888 },
+  { Dali::Pixel::L8,       Dali::Pixel::RGBA8888 },
+  { Dali::Pixel::LA88,     Dali::Pixel::RGBA8888 },
+  { Dali::Pixel::RGBA8888, Dali::Pixel::RGB565 },
+  { Dali::Pixel::RGBA8888, Dali::Pixel::RGBA4444 }
+};
+const unsigned int NUM_VECTORISED_CONVERSIONS = sizeof( VECTORISED_CONVERSIONS ) / sizeof( VECTORISED_CONVERSIONS[0] );
+
+/**
+ * @brief Enough pixels for several iterations of every kernel, and some left over.
+ */
+const unsigned int NUM_CONVERSION_TEST_PIXELS = 131u;
+
+/**
+ * @brief The width of a channel in the destination formats of the vectorised conversions.
+ */
+unsigned int GetChannelBits( Dali::Pixel::Format format, Dali::Internal::Adaptor::Channel channel )
+{
+  switch( format )
+  {
+    case Dali::Pixel::RGB565:   return channel == Dali::Internal::Adaptor::GREEN ? 6u : 5u;
+    case Dali::Pixel::RGBA4444: return 4u;
+    default:                    return 8u;
+  }
+}
+
+} // unnamed namespace
+
+int UtcDaliPixelManipulationConvertPixelsVectorised(void)
+{
+  tet_infoline("Testing Dali::Internal::Adaptor::ConvertPixels gives the same result for every instruction set and pair of formats");
+
+  using namespace Dali::Internal::Platform;
+
+  const unsigned int featureMasks[] = { CPU_FEATURE_NONE, CPU_FEATURE_SSE2, CPU_FEATURE_SSE2 | CPU_FEATURE_SSSE3, CPU_FEATURE_ALL };
+
+  for( unsigned int srcIdx = 0; srcIdx < NUM_CONVERTIBLE_FORMATS; ++srcIdx )
+  {
+    const Dali::Pixel::Format srcFormat = CONVERTIBLE_FORMATS[srcIdx];
+    const unsigned int srcBytesPerPixel = Dali::Pixel::GetBytesPerPixel( srcFormat );
+    std::vector<unsigned char> source( NUM_CONVERSION_TEST_PIXELS * srcBytesPerPixel );
+    for( unsigned int i = 0; i < source.size(); ++i )
+    {
+      source[i] = static_cast<unsigned char>( ( i * 151u + srcIdx * 7u ) % 256u );
+    }
+
+    for( unsigned int destIdx = 0; destIdx < NUM_CONVERTIBLE_FORMATS; ++destIdx )
+    {
+      const Dali::Pixel::Format destFormat = CONVERTIBLE_FORMATS[destIdx];
+      const unsigned int destBytesPerPixel = Dali::Pixel::GetBytesPerPixel( destFormat );
+
+      SetCpuFeatureMask( CPU_FEATURE_NONE );
+      std::vector<unsigned char> expected( NUM_CONVERSION_TEST_PIXELS * destBytesPerPixel );
+      DALI_TEST_CHECK( Dali::Internal::Adaptor::ConvertPixels( &source[0], srcFormat, &expected[0], destFormat, NUM_CONVERSION_TEST_PIXELS ) );
+
+      bool matches = true;
+      for( unsigned int maskIdx = 1; maskIdx < sizeof( featureMasks ) / sizeof( featureMasks[0] ); ++maskIdx )
+      {
+        SetCpuFeatureMask( featureMasks[maskIdx] );
+
+        // Every length up to a few vectors, so each kernel's leftover pixels are covered:
+        for( unsigned int numPixels = 0; numPixels <= NUM_CONVERSION_TEST_PIXELS; numPixels += ( numPixels < 40u ? 1u : 13u ) )
+        {
+          std::vector<unsigned char> converted( NUM_CONVERSION_TEST_PIXELS * destBytesPerPixel, 0xA5u );
+          Dali::Internal::Adaptor::ConvertPixels( &source[0], srcFormat, &converted[0], destFormat, numPixels );
+          matches = matches && std::equal( &converted[0], &converted[0] + numPixels * destBytesPerPixel, &expected[0] );
+          matches = matches && std::all_of( converted.begin() + numPixels * destBytesPerPixel, converted.end(), []( unsigned char value ) { return value == 0xA5u; } );
+        }
+
+        // Formats of the same size can be converted in place:
+        if( srcBytesPerPixel == destBytesPerPixel )
+        {
+          std::vector<unsigned char> inPlace( source );
+          Dali::Internal::Adaptor::ConvertPixels( &inPlace[0], srcFormat, &inPlace[0], destFormat, NUM_CONVERSION_TEST_PIXELS );
+          matches = matches && inPlace == expected;
+        }
+      }
+      if( !matches )
+      {
+        tet_printf( "Conversion of %s to %s differs\n", FormatToString( srcFormat ), FormatToString( destFormat ) );
+      }
+      DALI_TEST_CHECK( matches );
+    }
+  }
+  SetCpuFeatureMask( CPU_FEATURE_ALL );
+
+  END_TEST;
+}
+
+int UtcDaliPixelManipulationConvertPixelsChannels(void)
+{
+  tet_infoline("Testing the vectorised conversions of Dali::Internal::Adaptor::ConvertPixels agree with ReadChannel and WriteChannel");
+
+  using namespace Dali::Internal::Adaptor;
+
+  for( unsigned int conversionIdx = 0; conversionIdx < NUM_VECTORISED_CONVERSIONS; ++conversionIdx )
+  {
+    const Dali::Pixel::Format srcFormat = VECTORISED_CONVERSIONS[conversionIdx][0];
+    const Dali::Pixel::Format destFormat = VECTORISED_CONVERSIONS[conversionIdx][1];
+    const unsigned int srcBytesPerPixel = Dali::Pixel::GetBytesPerPixel( srcFormat );
+    const unsigned int destBytesPerPixel = Dali::Pixel::GetBytesPerPixel( destFormat );
+
+    std::vector<unsigned char> source( NUM_CONVERSION_TEST_PIXELS * srcBytesPerPixel );
+    for( unsigned int i = 0; i < source.size(); ++i )
+    {
+      source[i] = static_cast<unsigned char>( ( i * 89u + conversionIdx ) % 256u );
+    }
+    std::vector<unsigned char> converted( NUM_CONVERSION_TEST_PIXELS * destBytesPerPixel );
+    DALI_TEST_CHECK( ConvertPixels( &source[0], srcFormat, &converted[0], destFormat, NUM_CONVERSION_TEST_PIXELS ) );
+
+    bool matches = true;
+    for( unsigned int i = 0; i < NUM_CONVERSION_TEST_PIXELS; ++i )
+    {
+      // The sources all have 8 bit channels, and gray is spread to all three colors:
+      unsigned char* sourcePixel = &source[i * srcBytesPerPixel];
+      const bool hasColor = HasChannel( srcFormat, RED );
+      const unsigned int values[] =
+      {
+        ReadChannel( sourcePixel, srcFormat, hasColor ? RED : LUMINANCE ),
+        ReadChannel( sourcePixel, srcFormat, hasColor ? GREEN : LUMINANCE ),
+        ReadChannel( sourcePixel, srcFormat, hasColor ? BLUE : LUMINANCE ),
+        HasChannel( srcFormat, ALPHA ) ? ReadChannel( sourcePixel, srcFormat, ALPHA ) : 0xFFu
+      };
+      const Channel channels[] = { RED, GREEN, BLUE, ALPHA };
+
+      unsigned char expected[4] = { 0, 0, 0, 0 };
+      for( unsigned int c = 0; c < 4u; ++c )
+      {
+        if( HasChannel( destFormat, channels[c] ) )
+        {
+          WriteChannel( expected, destFormat, channels[c], values[c] >> ( 8u - GetChannelBits( destFormat, channels[c] ) ) );
+        }
+      }
+      matches = matches && std::equal( expected, expected + destBytesPerPixel, &converted[i * destBytesPerPixel] );
+    }
+    if( !matches )
+    {
+      tet_printf( "Conversion of %s to %s differs\n", FormatToString( srcFormat ), FormatToString( destFormat ) );
+    }
+    DALI_TEST_CHECK( matches );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliPixelManipulationSwapRedAndBlue(void)
+{
+  tet_infoline("Testing Dali::Internal::Adaptor::SwapRedAndBlue with and without the vectorised kernels");
+
+  using namespace Dali::Internal::Platform;
+
+  for( unsigned int bytesPerPixel = 3u; bytesPerPixel <= 4u; ++bytesPerPixel )
+  {
+    std::vector<unsigned char> source( NUM_CONVERSION_TEST_PIXELS * bytesPerPixel );
+    for( unsigned int i = 0; i < source.size(); ++i )
+    {
+      source[i] = static_cast<unsigned char>( i * 37u );
+    }
+
+    for( unsigned int featureMask : { static_cast<unsigned int>( CPU_FEATURE_NONE ), static_cast<unsigned int>( CPU_FEATURE_ALL ) } )
+    {
+      SetCpuFeatureMask( featureMask );
+
+      bool matches = true;
+      for( unsigned int numPixels = 0; numPixels <= NUM_CONVERSION_TEST_PIXELS; ++numPixels )
+      {
+        std::vector<unsigned char> swapped( source );
+        Dali::Internal::Adaptor::SwapRedAndBlue( &swapped[0], bytesPerPixel, numPixels );
+        for( unsigned int i = 0; i < swapped.size(); ++i )
+        {
+          const unsigned int byte = i % bytesPerPixel;
+          const unsigned int expected = ( i / bytesPerPixel >= numPixels || byte == 1u || byte == 3u ) ? source[i] : source[i - byte + 2u - byte];
+          matches = matches && swapped[i] == expected;
+        }
+      }
+      DALI_TEST_CHECK( matches );
+    }
+  }
+  SetCpuFeatureMask( CPU_FEATURE_ALL );
+
+  END_TEST;
+}
+
+int UtcDaliPixelManipulationConvertRGB555ToRGB888(void)
+{
+  tet_infoline("Testing Dali::Internal::Adaptor::ConvertRGB555ToRGB888 with and without the vectorised kernels");
+
+  using namespace Dali::Internal::Platform;
+
+  // Every 16 bit value, including those with the unused top bit set:
+  const unsigned int numValues = 65536u;
+  std::vector<unsigned char> source( numValues * 2u );
+  for( unsigned int i = 0; i < numValues; ++i )
+  {
+    source[i * 2u] = static_cast<unsigned char>( i );
+    source[i * 2u + 1u] = static_cast<unsigned char>( i >> 8u );
+  }
+
+  for( unsigned int featureMask : { static_cast<unsigned int>( CPU_FEATURE_NONE ), static_cast<unsigned int>( CPU_FEATURE_ALL ) } )
+  {
+    SetCpuFeatureMask( featureMask );
+
+    bool matches = true;
+    for( unsigned int numPixels : { 0u, 1u, 7u, 8u, 9u, 17u, numValues } )
+    {
+      std::vector<unsigned char> converted( numValues * 3u + 1u, 0xA5u );
+      Dali::Internal::Adaptor::ConvertRGB555ToRGB888( &source[0], &converted[0], numPixels );
+      for( unsigned int i = 0; i < numPixels; ++i )
+      {
+        matches = matches && converted[i * 3u]      == ( ( i >> 10u ) & 0x1Fu ) * 255u / 31u &&
+                             converted[i * 3u + 1u] == ( ( i >> 5u ) & 0x1Fu ) * 255u / 31u &&
+                             converted[i * 3u + 2u] == ( i & 0x1Fu ) * 255u / 31u;
+      }
+
+      // Nothing is written past the end of the run:
+      matches = matches && converted[numPixels * 3u] == 0xA5u;
+    }
+    DALI_TEST_CHECK( matches );
+  }
+  SetCpuFeatureMask( CPU_FEATURE_ALL );
+
+  END_TEST;
+}
+
+namespace
+{
+
+const unsigned int MASK_TEST_WIDTH = 7u;
+const unsigned int MASK_TEST_HEIGHT = 5u;
+
+/**
+ * @brief Fill a buffer with bytes that cover the whole 0-255 range.
+ */
+void FillMaskTestBuffer( Dali::Internal::Adaptor::PixelBuffer& buffer, unsigned int seed )
+{
+  const unsigned int size = buffer.GetWidth() * buffer.GetHeight() * Dali::Pixel::GetBytesPerPixel( buffer.GetPixelFormat() );
+  unsigned char* bytes = buffer.GetBuffer();
+  for( unsigned int i = 0; i < size; ++i )
+  {
+    bytes[i] = static_cast<unsigned char>( ( i * 37u + seed * 101u ) % 256u );
+  }
+}
+
+/**
+ * @brief The value the mask multiplies pixel i by.
+ */
+unsigned int GetMaskValue( const Dali::Internal::Adaptor::PixelBuffer& mask, unsigned int i )
+{
+  const unsigned char* pixel = mask.GetConstBuffer() + i * Dali::Pixel::GetBytesPerPixel( mask.GetPixelFormat() );
+  switch( mask.GetPixelFormat() )
+  {
+    case Dali::Pixel::LA88:
+    {
+      return pixel[1];
+    }
+    case Dali::Pixel::RGBA8888:
+    {
+      return pixel[3];
+    }
+    default:
+    {
+      return pixel[0];
+    }
+  }
+}
+
+} // unnamed namespace
+
+int UtcDaliAlphaMaskApplyMaskToAlphaChannel(void)
+{
+  tet_infoline("Testing Dali::Internal::Adaptor::ApplyMaskToAlphaChannel with and without premultiplied alpha");
+
+  using Dali::Internal::Adaptor::PixelBuffer;
+  using Dali::Internal::Adaptor::PixelBufferPtr;
+
+  // A8, L8 and RGBA8888 masks have fast paths, LA88 masks use the generic one:
+  const Dali::Pixel::Format maskFormats[] = { Dali::Pixel::A8, Dali::Pixel::L8, Dali::Pixel::RGBA8888, Dali::Pixel::LA88 };
+  const unsigned int numPixels = MASK_TEST_WIDTH * MASK_TEST_HEIGHT;
+
+  for( unsigned int formatIndex = 0; formatIndex < sizeof( maskFormats ) / sizeof( maskFormats[0] ); ++formatIndex )
+  {
+    for( unsigned int preMultiplied = 0; preMultiplied < 2; ++preMultiplied )
+    {
+      tet_printf( "Mask format %s, premultiplied %u\n", FormatToString( maskFormats[formatIndex] ), preMultiplied );
+
+      PixelBufferPtr buffer = PixelBuffer::New( MASK_TEST_WIDTH, MASK_TEST_HEIGHT, Dali::Pixel::RGBA8888 );
+      PixelBufferPtr mask = PixelBuffer::New( MASK_TEST_WIDTH, MASK_TEST_HEIGHT, maskFormats[formatIndex] );
+      FillMaskTestBuffer( *buffer, 1u );
+      FillMaskTestBuffer( *mask, 2u );
+      if( preMultiplied )
+      {
+        buffer->MultiplyColorByAlpha();
+      }
+
+      std::vector<unsigned char> original( buffer->GetBuffer(), buffer->GetBuffer() + numPixels * 4u );
+      Dali::Internal::Adaptor::ApplyMaskToAlphaChannel( *buffer, *mask );
+
+      const unsigned char* pixels = buffer->GetBuffer();
+      bool matches = true;
+      for( unsigned int i = 0; i < numPixels; ++i )
+      {
+        const unsigned int maskValue = GetMaskValue( *mask, i );
+        for( unsigned int channel = 0; channel < 4u; ++channel )
+        {
+          const unsigned int value = original[i * 4u + channel];
+          const unsigned int expected = ( preMultiplied || channel == 3u ) ? value * maskValue / 255u : value;
+          matches = matches && ( pixels[i * 4u + channel] == expected );
+        }
+      }
+      DALI_TEST_CHECK( matches );
+    }
+  }
+
+  END_TEST;
+}
+
+int UtcDaliAlphaMaskCreateNewMaskedBuffer(void)
+{
+  tet_infoline("Testing Dali::Internal::Adaptor::CreateNewMaskedBuffer");
+
+  using Dali::Internal::Adaptor::PixelBuffer;
+  using Dali::Internal::Adaptor::PixelBufferPtr;
+
+  const Dali::Pixel::Format bufferFormats[] = { Dali::Pixel::RGB888, Dali::Pixel::RGBA8888 };
+  const Dali::Pixel::Format maskFormats[] = { Dali::Pixel::A8, Dali::Pixel::L8, Dali::Pixel::RGBA8888, Dali::Pixel::LA88 };
+  const unsigned int numPixels = MASK_TEST_WIDTH * MASK_TEST_HEIGHT;
+
+  for( unsigned int bufferIndex = 0; bufferIndex < sizeof( bufferFormats ) / sizeof( bufferFormats[0] ); ++bufferIndex )
+  {
+    for( unsigned int maskIndex = 0; maskIndex < sizeof( maskFormats ) / sizeof( maskFormats[0] ); ++maskIndex )
+    {
+      tet_printf( "Buffer format %s, mask format %s\n", FormatToString( bufferFormats[bufferIndex] ), FormatToString( maskFormats[maskIndex] ) );
+
+      PixelBufferPtr buffer = PixelBuffer::New( MASK_TEST_WIDTH, MASK_TEST_HEIGHT, bufferFormats[bufferIndex] );
+      PixelBufferPtr mask = PixelBuffer::New( MASK_TEST_WIDTH, MASK_TEST_HEIGHT, maskFormats[maskIndex] );
+      FillMaskTestBuffer( *buffer, 3u );
+      FillMaskTestBuffer( *mask, 4u );
+
+      PixelBufferPtr masked = Dali::Internal::Adaptor::CreateNewMaskedBuffer( *buffer, *mask );
+      DALI_TEST_EQUALS( masked->GetPixelFormat(), Dali::Pixel::RGBA8888, TEST_LOCATION );
+
+      const bool hasAlpha = Dali::Pixel::HasAlpha( bufferFormats[bufferIndex] );
+      const unsigned int bytesPerPixel = Dali::Pixel::GetBytesPerPixel( bufferFormats[bufferIndex] );
+      const unsigned char* source = buffer->GetBuffer();
+      const unsigned char* pixels = masked->GetBuffer();
+      bool matches = true;
+      for( unsigned int i = 0; i < numPixels; ++i )
+      {
+        const unsigned char* sourcePixel = source + i * bytesPerPixel;
+        const unsigned int maskValue = GetMaskValue( *mask, i );
+        const unsigned int expectedAlpha = hasAlpha ? sourcePixel[3] * maskValue / 255u : maskValue;
+        matches = matches &&
+                  pixels[i * 4u] == sourcePixel[0] &&
+                  pixels[i * 4u + 1u] == sourcePixel[1] &&
+                  pixels[i * 4u + 2u] == sourcePixel[2] &&
+                  pixels[i * 4u + 3u] == expectedAlpha;
+      }
+      DALI_TEST_CHECK( matches );
+    }
+  }
+
+  END_TEST;
+}
+
+int UtcDaliPixelBufferPipeline(void)
+{
+  tet_infoline("Testing Dali::Internal::Adaptor::PixelBufferPipeline matches masking, premultiplying and converting one step at a time");
+
+  using Dali::Internal::Adaptor::PixelBuffer;
+  using Dali::Internal::Adaptor::PixelBufferPtr;
+  using Dali::Internal::Adaptor::PixelBufferPipeline;
+
+  // RGBA8888 is masked in place, RGB888 becomes RGBA8888:
+  const Dali::Pixel::Format bufferFormats[] = { Dali::Pixel::RGBA8888, Dali::Pixel::RGB888 };
+  const Dali::Pixel::Format maskFormats[] = { Dali::Pixel::A8, Dali::Pixel::LA88 };
+  const Dali::Pixel::Format outputFormats[] = { Dali::Pixel::RGBA8888, Dali::Pixel::RGBA4444, Dali::Pixel::LA88 };
+  const unsigned int numPixels = MASK_TEST_WIDTH * MASK_TEST_HEIGHT;
+
+  for( unsigned int bufferIndex = 0; bufferIndex < sizeof( bufferFormats ) / sizeof( bufferFormats[0] ); ++bufferIndex )
+  {
+    for( unsigned int maskIndex = 0; maskIndex < sizeof( maskFormats ) / sizeof( maskFormats[0] ); ++maskIndex )
+    {
+      for( unsigned int outputIndex = 0; outputIndex < sizeof( outputFormats ) / sizeof( outputFormats[0] ); ++outputIndex )
+      {
+        tet_printf( "Buffer format %s, mask format %s, output format %s\n", FormatToString( bufferFormats[bufferIndex] ), FormatToString( maskFormats[maskIndex] ), FormatToString( outputFormats[outputIndex] ) );
+
+        PixelBufferPtr mask = PixelBuffer::New( MASK_TEST_WIDTH, MASK_TEST_HEIGHT, maskFormats[maskIndex] );
+        FillMaskTestBuffer( *mask, 5u );
+
+        // The steps one at a time:
+        PixelBufferPtr expected = PixelBuffer::New( MASK_TEST_WIDTH, MASK_TEST_HEIGHT, bufferFormats[bufferIndex] );
+        FillMaskTestBuffer( *expected, 6u );
+        if( Dali::Pixel::HasAlpha( bufferFormats[bufferIndex] ) )
+        {
+          Dali::Internal::Adaptor::ApplyMaskToAlphaChannel( *expected, *mask );
+        }
+        else
+        {
+          expected = Dali::Internal::Adaptor::CreateNewMaskedBuffer( *expected, *mask );
+        }
+        expected->MultiplyColorByAlpha();
+        std::vector<unsigned char> expectedPixels( numPixels * Dali::Pixel::GetBytesPerPixel( outputFormats[outputIndex] ) );
+        Dali::Internal::Adaptor::ConvertPixels( expected->GetBuffer(), expected->GetPixelFormat(), &expectedPixels[0], outputFormats[outputIndex], numPixels );
+
+        // The same steps fused:
+        PixelBufferPtr buffer = PixelBuffer::New( MASK_TEST_WIDTH, MASK_TEST_HEIGHT, bufferFormats[bufferIndex] );
+        FillMaskTestBuffer( *buffer, 6u );
+        PixelBufferPipeline pipeline;
+        pipeline.SetMask( mask );
+        pipeline.SetMultiplyColorByAlpha();
+        pipeline.SetOutputFormat( outputFormats[outputIndex] );
+        PixelBufferPtr processed = pipeline.Process( buffer );
+
+        DALI_TEST_EQUALS( processed->GetPixelFormat(), outputFormats[outputIndex], TEST_LOCATION );
+        DALI_TEST_EQUALS( processed->GetWidth(), MASK_TEST_WIDTH, TEST_LOCATION );
+        DALI_TEST_EQUALS( processed->GetHeight(), MASK_TEST_HEIGHT, TEST_LOCATION );
+        DALI_TEST_CHECK( processed->IsAlphaPreMultiplied() );
+        DALI_TEST_CHECK( std::equal( expectedPixels.begin(), expectedPixels.end(), processed->GetBuffer() ) );
+      }
+    }
+  }
+
+  END_TEST;
+}
+
+int UtcDaliPixelBufferPipelineInPlace(void)
+{
+  tet_infoline("Testing Dali::Internal::Adaptor::PixelBufferPipeline processes the buffer in place when its size and format are kept");
+
+  using Dali::Internal::Adaptor::PixelBuffer;
+  using Dali::Internal::Adaptor::PixelBufferPtr;
+  using Dali::Internal::Adaptor::PixelBufferPipeline;
+
+  PixelBufferPtr buffer = PixelBuffer::New( MASK_TEST_WIDTH, MASK_TEST_HEIGHT, Dali::Pixel::RGBA8888 );
+  FillMaskTestBuffer( *buffer, 7u );
+
+  // A mask of a different size is resized to fit:
+  PixelBufferPtr mask = PixelBuffer::New( MASK_TEST_WIDTH * 2u, MASK_TEST_HEIGHT * 2u, Dali::Pixel::A8 );
+  FillMaskTestBuffer( *mask, 8u );
+
+  PixelBufferPipeline pipeline;
+  pipeline.SetMask( mask );
+  PixelBufferPtr processed = pipeline.Process( buffer );
+
+  DALI_TEST_CHECK( processed == buffer );
+  DALI_TEST_EQUALS( processed->GetPixelFormat(), Dali::Pixel::RGBA8888, TEST_LOCATION );
+  DALI_TEST_EQUALS( processed->GetWidth(), MASK_TEST_WIDTH, TEST_LOCATION );
+  DALI_TEST_EQUALS( processed->GetHeight(), MASK_TEST_HEIGHT, TEST_LOCATION );
+  DALI_TEST_CHECK( !processed->IsAlphaPreMultiplied() );
+
+  END_TEST;
+}
+
+int UtcDaliBufferPoolReuse(void)
+{
+  tet_infoline("Testing Dali::Internal::Platform::BufferPool reuses buffers of the same size class and keeps within its memory limit");
+
+  using Dali::Internal::Platform::BufferPool;
+  using Dali::Internal::Platform::PooledBuffer;
+
+  BufferPool& pool = BufferPool::Get();
+  const std::size_t memoryLimit = 1024u * 1024u;
+  pool.SetMemoryLimit( memoryLimit );
+  pool.Trim( 0u );
+  pool.ResetStatistics();
+
+  // The first buffer of a size class comes from malloc():
+  uint8_t* buffer = pool.Allocate( 100u * 1024u );
+  DALI_TEST_CHECK( nullptr != buffer );
+  DALI_TEST_CHECK( pool.IsPooled( buffer ) );
+  DALI_TEST_EQUALS( pool.GetStatistics().misses, 1u, TEST_LOCATION );
+  pool.Release( buffer );
+  DALI_TEST_EQUALS( pool.GetStatistics().freeBuffers, 1u, TEST_LOCATION );
+
+  // A slightly larger buffer in the same class reuses it:
+  uint8_t* reused = pool.Allocate( 110u * 1024u );
+  DALI_TEST_CHECK( reused == buffer );
+  DALI_TEST_EQUALS( pool.GetStatistics().hits, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( pool.GetStatistics().freeBuffers, 0u, TEST_LOCATION );
+  pool.Release( reused );
+
+  // Small buffers and buffers from malloc() aren't kept:
+  pool.Release( pool.Allocate( 1024u ) );
+  pool.Release( static_cast< uint8_t* >( malloc( 200u * 1024u ) ) );
+  DALI_TEST_EQUALS( pool.GetStatistics().freeBuffers, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( pool.GetStatistics().misses, 1u, TEST_LOCATION );
+
+  // The least recently freed buffers are dropped to stay within the limit:
+  uint8_t* buffers[3];
+  for( auto&& largeBuffer : buffers )
+  {
+    largeBuffer = pool.Allocate( 512u * 1024u );
+  }
+  for( auto&& largeBuffer : buffers )
+  {
+    pool.Release( largeBuffer );
+  }
+  DALI_TEST_CHECK( pool.GetStatistics().freeBytes <= memoryLimit );
+  DALI_TEST_EQUALS( pool.GetStatistics().freeBuffers, 2u, TEST_LOCATION );
+
+  // A scratch buffer keeps its contents when it grows:
+  {
+    PooledBuffer scratch( 70u * 1024u );
+    memset( scratch.Begin(), 0x5a, scratch.Count() );
+    scratch.Resize( 300u * 1024u );
+    DALI_TEST_EQUALS( scratch.Count(), 300u * 1024u, TEST_LOCATION );
+    DALI_TEST_EQUALS( static_cast< unsigned int >( scratch.Begin()[70u * 1024u - 1u] ), 0x5au, TEST_LOCATION );
+  }
+
+  pool.Trim( 0u );
+  DALI_TEST_EQUALS( pool.GetStatistics().freeBuffers, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( pool.GetStatistics().freeBytes, 0u, TEST_LOCATION );
+
+  // Disabled, the pool neither keeps nor counts buffers:
+  pool.SetMemoryLimit( 0u );
+  pool.ResetStatistics();
+  buffer = pool.Allocate( 100u * 1024u );
+  DALI_TEST_CHECK( !pool.IsPooled( buffer ) );
+  pool.Release( buffer );
+  DALI_TEST_EQUALS( pool.GetStatistics().misses, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( pool.GetStatistics().freeBuffers, 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliBufferPoolPixelBuffer(void)
+{
+  tet_infoline("Testing PixelBuffer allocates from the Dali::Internal::Platform::BufferPool");
+
+  using Dali::Internal::Adaptor::PixelBuffer;
+  using Dali::Internal::Adaptor::PixelBufferPtr;
+  using Dali::Internal::Platform::BufferPool;
+
+  BufferPool& pool = BufferPool::Get();
+  pool.SetMemoryLimit( 4u * 1024u * 1024u );
+  pool.Trim( 0u );
+  pool.ResetStatistics();
+
+  // A buffer of the same size as one just destroyed reuses its memory:
+  PixelBufferPtr buffer = PixelBuffer::New( 256u, 256u, Dali::Pixel::RGBA8888 );
+  const unsigned char* pixels = buffer->GetBuffer();
+  buffer.Reset();
+  DALI_TEST_EQUALS( pool.GetStatistics().freeBuffers, 1u, TEST_LOCATION );
+
+  buffer = PixelBuffer::New( 256u, 256u, Dali::Pixel::RGBA8888 );
+  DALI_TEST_CHECK( buffer->GetBuffer() == pixels );
+  DALI_TEST_EQUALS( pool.GetStatistics().hits, 1u, TEST_LOCATION );
+
+  // Converting to PixelData hands the buffer over for good:
+  {
+    Dali::PixelData pixelData = PixelBuffer::Convert( *buffer );
+    DALI_TEST_CHECK( pixelData );
+    DALI_TEST_CHECK( !pool.IsPooled( pixels ) );
+  }
+  buffer.Reset();
+  DALI_TEST_EQUALS( pool.GetStatistics().freeBuffers, 0u, TEST_LOCATION );
+
+  pool.SetMemoryLimit( 0u );
+
+  END_TEST;
+}
+
+int UtcDaliPixelBufferCreatePixelDataShared(void)
+{
+  tet_infoline("Testing PixelBuffer::CreatePixelData() shares the buffer rather than copying it");
+
+  PixelBufferPtr buffer = PixelBuffer::New( 16u, 16u, Pixel::RGBA8888 );
+  memset( buffer->GetBuffer(), 0x42, buffer->GetBufferSize() );
+  const unsigned char* pixels = buffer->GetConstBuffer();
+
+  Dali::PixelData pixelData = buffer->CreatePixelData();
+  DALI_TEST_CHECK( pixelData );
+  DALI_TEST_CHECK( buffer->CreatePixelData() == pixelData );
+  DALI_TEST_CHECK( buffer->GetConstBuffer() == pixels );
+
+  // Once the PixelData is gone, writing to the buffer doesn't need a copy:
+  pixelData.Reset();
+  DALI_TEST_CHECK( buffer->GetBuffer() == pixels );
+
+  // Converting a shared buffer hands over the same PixelData:
+  pixelData = buffer->CreatePixelData();
+  Dali::PixelData converted = PixelBuffer::Convert( *buffer );
+  DALI_TEST_CHECK( converted == pixelData );
+  DALI_TEST_CHECK( buffer->GetConstBuffer() == NULL );
+
+  END_TEST;
+}
+
+int UtcDaliPixelBufferCopyOnWrite(void)
+{
+  tet_infoline("Testing writing to a PixelBuffer shared with a PixelData copies the buffer first");
+
+  PixelBufferPtr buffer = PixelBuffer::New( 16u, 16u, Pixel::RGBA8888 );
+  const unsigned int bufferSize = buffer->GetBufferSize();
+  memset( buffer->GetBuffer(), 0x42, bufferSize );
+  const unsigned char* pixels = buffer->GetConstBuffer();
+
+  Dali::PixelData pixelData = buffer->CreatePixelData();
+
+  // The write goes to a copy, leaving the shared pixels as they were:
+  unsigned char* writable = buffer->GetBuffer();
+  DALI_TEST_CHECK( writable != pixels );
+  DALI_TEST_CHECK( std::all_of( writable, writable + bufferSize, []( unsigned char value ) { return value == 0x42; } ) );
+  memset( writable, 0x24, bufferSize );
+  DALI_TEST_CHECK( std::all_of( pixels, pixels + bufferSize, []( unsigned char value ) { return value == 0x42; } ) );
+
+  // The next PixelData shares the new pixels:
+  Dali::PixelData newPixelData = buffer->CreatePixelData();
+  DALI_TEST_CHECK( newPixelData != pixelData );
+  DALI_TEST_CHECK( buffer->GetConstBuffer() == writable );
+
+  // Operations in place copy a shared buffer too:
+  buffer->MultiplyColorByAlpha();
+  DALI_TEST_CHECK( buffer->GetConstBuffer() != writable );
+  DALI_TEST_EQUALS( buffer->GetConstBuffer()[0], static_cast<unsigned char>( 0x24 * 0x24 / 255 ), TEST_LOCATION );
+
+  // The PixelData keep their buffers alive after the PixelBuffer has gone:
+  buffer.Reset();
+  DALI_TEST_CHECK( std::all_of( pixels, pixels + bufferSize, []( unsigned char value ) { return value == 0x42; } ) );
+  DALI_TEST_CHECK( std::all_of( writable, writable + bufferSize, []( unsigned char value ) { return value == 0x24; } ) );
+
+  END_TEST;
+}
+
+int UtcDaliPixelBufferMetadataLoader(void)
+{
+  tet_infoline("Testing the metadata loader of a PixelBuffer is only called when the metadata is first asked for");
+
+  using Dali::Internal::Adaptor::PixelBufferPipeline;
+
+  unsigned int calls = 0u;
+  PixelBufferPtr buffer = PixelBuffer::New( 16u, 16u, Pixel::RGB888 );
+  buffer->SetMetadataLoader( [&calls]()
+  {
+    ++calls;
+    std::unique_ptr<Dali::Property::Map> map( new Dali::Property::Map() );
+    map->Insert( "Orientation", 6 );
+    return map;
+  } );
+  DALI_TEST_EQUALS( calls, 0u, TEST_LOCATION );
+
+  // The pipeline passes the loader on without calling it:
+  PixelBufferPipeline pipeline;
+  pipeline.SetOutputFormat( Pixel::RGBA8888 );
+  PixelBufferPtr processed = pipeline.Process( buffer );
+  DALI_TEST_CHECK( processed != buffer );
+  DALI_TEST_EQUALS( calls, 0u, TEST_LOCATION );
+
+  Dali::Property::Map metadata;
+  DALI_TEST_CHECK( buffer->GetMetadata( metadata ) );
+  DALI_TEST_EQUALS( calls, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( metadata.Find( "Orientation" )->Get<int>(), 6, TEST_LOCATION );
+
+  // Asking again uses the map already built:
+  metadata.Clear();
+  DALI_TEST_CHECK( buffer->GetMetadata( metadata ) );
+  DALI_TEST_EQUALS( calls, 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( metadata.Count(), 1u, TEST_LOCATION );
+
+  metadata.Clear();
+  DALI_TEST_CHECK( processed->GetMetadata( metadata ) );
+  DALI_TEST_EQUALS( calls, 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( metadata.Count(), 1u, TEST_LOCATION );
+
+  // Setting the metadata replaces the loader:
+  PixelBufferPtr replaced = PixelBuffer::New( 16u, 16u, Pixel::RGB888 );
+  replaced->SetMetadataLoader( [&calls]()
+  {
+    ++calls;
+    return std::unique_ptr<Dali::Property::Map>( new Dali::Property::Map() );
+  } );
+  Dali::Property::Map newMetadata;
+  newMetadata.Insert( "Make", "DALi" );
+  replaced->SetMetadata( newMetadata );
+  metadata.Clear();
+  DALI_TEST_CHECK( replaced->GetMetadata( metadata ) );
+  DALI_TEST_EQUALS( calls, 2u, TEST_LOCATION );
+  DALI_TEST_EQUALS( metadata.Find( "Make" )->Get<std::string>(), std::string( "DALi" ), TEST_LOCATION );
+
+  // Without either there is no metadata:
+  PixelBufferPtr empty = PixelBuffer::New( 16u, 16u, Pixel::RGB888 );
+  DALI_TEST_CHECK( !empty->GetMetadata( metadata ) );
+
+  END_TEST;
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <unistd.h>
+#include <dali-test-suite-utils.h>
+#include <dali/internal/imaging/common/mapped-file.h>
+
+using namespace Dali::Internal::Platform;
+
+namespace
+{
+
+const char* const TEST_FILE_CONTENTS = "Some bytes which would be an encoded image";
+
+/**
+ * @brief Write a temporary file and open it for reading. It is deleted when closed.
+ */
+FILE* OpenTemporaryFile( const char* contents )
+{
+  FILE* const file = tmpfile();
+  if( file )
+  {
+    fwrite( contents, 1u, strlen( contents ), file );
+    fflush( file );
+    rewind( file );
+  }
+  return file;
+}
+
+} // unnamed namespace
+
+int UtcDaliMappedFileMapRegularFile(void)
+{
+  FILE* const file = OpenTemporaryFile( TEST_FILE_CONTENTS );
+  DALI_TEST_CHECK( file );
+
+  // The whole file is mapped whatever the position of the stream:
+  fseek( file, 5, SEEK_SET );
+
+  MappedFile mappedFile;
+  DALI_TEST_CHECK( mappedFile.Map( file ) );
+  DALI_TEST_EQUALS( mappedFile.GetSize(), strlen( TEST_FILE_CONTENTS ), TEST_LOCATION );
+  DALI_TEST_CHECK( mappedFile.GetData() != nullptr );
+  DALI_TEST_CHECK( memcmp( mappedFile.GetData(), TEST_FILE_CONTENTS, strlen( TEST_FILE_CONTENTS ) ) == 0 );
+  DALI_TEST_EQUALS( ftell( file ), 5L, TEST_LOCATION );
+
+  // The mapping outlives the stream:
+  fclose( file );
+  DALI_TEST_CHECK( memcmp( mappedFile.GetData(), TEST_FILE_CONTENTS, strlen( TEST_FILE_CONTENTS ) ) == 0 );
+
+  mappedFile.Unmap();
+  DALI_TEST_CHECK( mappedFile.GetData() == nullptr );
+  DALI_TEST_EQUALS( mappedFile.GetSize(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliMappedFileMemoryStream(void)
+{
+  char buffer[] = "Downloaded image";
+  FILE* const file = fmemopen( buffer, sizeof( buffer ), "rb" );
+  DALI_TEST_CHECK( file );
+
+  // Streams over memory have to be read as before:
+  MappedFile mappedFile;
+  DALI_TEST_CHECK( !mappedFile.Map( file ) );
+  DALI_TEST_CHECK( mappedFile.GetData() == nullptr );
+  DALI_TEST_EQUALS( mappedFile.GetSize(), 0u, TEST_LOCATION );
+
+  fclose( file );
+  END_TEST;
+}
+
+int UtcDaliMappedFileEmptyFile(void)
+{
+  FILE* const file = OpenTemporaryFile( "" );
+  DALI_TEST_CHECK( file );
+
+  MappedFile mappedFile;
+  DALI_TEST_CHECK( !mappedFile.Map( file ) );
+  DALI_TEST_CHECK( !mappedFile.Map( nullptr ) );
+  DALI_TEST_CHECK( mappedFile.GetData() == nullptr );
+
+  fclose( file );
+  END_TEST;
+}
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <dali-test-suite-utils.h>
+
+#include <dali/devel-api/adaptor-framework/bitmap-saver.h>
+#include <dali/internal/imaging/common/loader-png.h>
+#include "image-loaders.h"
+
+using namespace Dali;
+
+namespace
+{
+
+/**
+ * @brief Fill an image with smooth gradients and a band of noise, so every PNG filter gets picked somewhere.
+ */
+std::vector<unsigned char> MakeTestImage( unsigned int width, unsigned int height, unsigned int pixelBytes )
+{
+  std::vector<unsigned char> pixels( width * height * pixelBytes );
+  unsigned int random = 1u;
+  for( unsigned int y = 0u; y < height; ++y )
+  {
+    for( unsigned int x = 0u; x < width; ++x )
+    {
+      for( unsigned int channel = 0u; channel < pixelBytes; ++channel )
+      {
+        random = random * 1103515245u + 12345u;
+        const bool noisy = ( y / 64u ) % 3u == 1u;
+        pixels[( y * width + x ) * pixelBytes + channel] = static_cast<unsigned char>( noisy ? random >> 16u : x * 3u + y * ( channel + 1u ) + channel * 40u );
+      }
+    }
+  }
+  return pixels;
+}
+
+/**
+ * @brief Encode an image, decode it again and check that every pixel survived.
+ */
+void TestRoundTrip( unsigned int width, unsigned int height, Pixel::Format pixelFormat, bool parallel )
+{
+  const unsigned int pixelBytes = Pixel::GetBytesPerPixel( pixelFormat );
+  const std::vector<unsigned char> pixels = MakeTestImage( width, height, pixelBytes );
+
+  Vector<unsigned char> encoded;
+  DALI_TEST_CHECK( TizenPlatform::EncodeToPng( pixels.data(), encoded, width, height, pixelFormat, parallel ) );
+
+  FILE* const fp = fmemopen( encoded.Begin(), encoded.Count(), "rb" );
+  AutoCloseFile autoClose( fp );
+  Devel::PixelBuffer decoded;
+  DALI_TEST_CHECK( TizenPlatform::LoadBitmapFromPng( ImageLoader::Input( fp ), decoded ) );
+  DALI_TEST_EQUALS( decoded.GetWidth(), width, TEST_LOCATION );
+  DALI_TEST_EQUALS( decoded.GetHeight(), height, TEST_LOCATION );
+  DALI_TEST_EQUALS( Pixel::GetBytesPerPixel( decoded.GetPixelFormat() ), pixelBytes, TEST_LOCATION );
+
+  // The decoder always gives RGB(A) order:
+  const unsigned char* const decodedPixels = decoded.GetBuffer();
+  bool same = true;
+  for( unsigned int i = 0u; i < width * height * pixelBytes && same; ++i )
+  {
+    const unsigned int channel = i % pixelBytes;
+    const unsigned int sourceIndex = ( pixelFormat == Pixel::BGRA8888 && channel != 3u ) ? i - channel + 2u - channel : i;
+    same = decodedPixels[i] == pixels[sourceIndex];
+  }
+  DALI_TEST_CHECK( same );
+}
+
+/**
+ * @brief The IDAT chunks of a PNG file.
+ */
+struct ImageData
+{
+  unsigned int chunkCount;         ///< The number of IDAT chunks.
+  std::vector<unsigned char> data; ///< The zlib stream held in them.
+};
+
+ImageData GetImageData( const unsigned char* encoded, std::size_t size )
+{
+  ImageData imageData = { 0u, std::vector<unsigned char>() };
+  std::size_t offset = 8u; // Skip the signature
+  while( offset + 12u <= size )
+  {
+    const std::size_t length = ( static_cast<std::size_t>( encoded[offset] ) << 24 ) | ( encoded[offset + 1u] << 16 ) | ( encoded[offset + 2u] << 8 ) | encoded[offset + 3u];
+    if( memcmp( encoded + offset + 4u, "IDAT", 4u ) == 0 )
+    {
+      ++imageData.chunkCount;
+      imageData.data.insert( imageData.data.end(), encoded + offset + 8u, encoded + offset + 8u + length );
+    }
+    offset += length + 12u;
+  }
+  return imageData;
+}
+
+/**
+ * @brief Count the empty stored blocks which a full flush writes, byte-aligned, into a deflate stream.
+ */
+unsigned int CountFullFlushes( const std::vector<unsigned char>& data )
+{
+  const unsigned char marker[] = { 0x00, 0x00, 0xff, 0xff };
+  unsigned int count = 0u;
+  for( std::size_t i = 0u; i + sizeof( marker ) <= data.size(); ++i )
+  {
+    if( memcmp( &data[i], marker, sizeof( marker ) ) == 0 )
+    {
+      ++count;
+    }
+  }
+  return count;
+}
+
+std::vector<unsigned char> ReadFile( const char* filename )
+{
+  std::vector<unsigned char> contents;
+  FILE* const fp = fopen( filename, "rb" );
+  if( fp )
+  {
+    int byte;
+    while( ( byte = fgetc( fp ) ) != EOF )
+    {
+      contents.push_back( static_cast<unsigned char>( byte ) );
+    }
+    fclose( fp );
+  }
+  return contents;
+}
+
+} // unnamed namespace
+
+int UtcDaliPngEncodeParallelRGB888(void)
+{
+  TestRoundTrip( 1280u, 720u, Pixel::RGB888, true );
+  END_TEST;
+}
+
+int UtcDaliPngEncodeParallelRGBA8888(void)
+{
+  TestRoundTrip( 517u, 611u, Pixel::RGBA8888, true );
+  END_TEST;
+}
+
+int UtcDaliPngEncodeParallelBGRA8888(void)
+{
+  TestRoundTrip( 640u, 480u, Pixel::BGRA8888, true );
+  END_TEST;
+}
+
+int UtcDaliPngEncodeParallelSmallImage(void)
+{
+  // Too small to split, so encoded by libpng:
+  TestRoundTrip( 300u, 7u, Pixel::RGB888, true );
+  END_TEST;
+}
+
+int UtcDaliPngEncodeParallelStrips(void)
+{
+  // 3841 bytes a row once filtered, so 34 rows to each 128K strip, and 22 strips, however many cores there are:
+  const unsigned int width = 1280u;
+  const unsigned int height = 720u;
+  const std::vector<unsigned char> pixels = MakeTestImage( width, height, 3u );
+
+  Vector<unsigned char> parallel;
+  DALI_TEST_CHECK( TizenPlatform::EncodeToPng( pixels.data(), parallel, width, height, Pixel::RGB888, true ) );
+  const ImageData parallelData = GetImageData( parallel.Begin(), parallel.Count() );
+
+  // The strips are joined in one chunk, every one but the last ending with a full flush:
+  DALI_TEST_EQUALS( parallelData.chunkCount, 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( CountFullFlushes( parallelData.data ) >= 21u );
+
+  // libpng writes the stream in several chunks, without flushing it:
+  Vector<unsigned char> serial;
+  DALI_TEST_CHECK( TizenPlatform::EncodeToPng( pixels.data(), serial, width, height, Pixel::RGB888, false ) );
+  const ImageData serialData = GetImageData( serial.Begin(), serial.Count() );
+  DALI_TEST_CHECK( serialData.chunkCount > 1u );
+
+  // The strips don't depend on the number of cores, so the same image always gives the same file:
+  Vector<unsigned char> again;
+  DALI_TEST_CHECK( TizenPlatform::EncodeToPng( pixels.data(), again, width, height, Pixel::RGB888, true ) );
+  DALI_TEST_EQUALS( again.Count(), parallel.Count(), TEST_LOCATION );
+  DALI_TEST_CHECK( memcmp( again.Begin(), parallel.Begin(), parallel.Count() ) == 0 );
+
+  END_TEST;
+}
+
+int UtcDaliPngEncodeToFile(void)
+{
+  const unsigned int width = 1280u;
+  const unsigned int height = 720u;
+  const std::vector<unsigned char> pixels = MakeTestImage( width, height, 3u );
+  const char* const filename = "/tmp/dali-png-encoder-test.png";
+
+  Vector<unsigned char> serial;
+  DALI_TEST_CHECK( TizenPlatform::EncodeToPng( pixels.data(), serial, width, height, Pixel::RGB888, false ) );
+  Vector<unsigned char> parallel;
+  DALI_TEST_CHECK( TizenPlatform::EncodeToPng( pixels.data(), parallel, width, height, Pixel::RGB888, true ) );
+
+  // Unless asked to, EncodeToFile() uses libpng:
+  DALI_TEST_CHECK( EncodeToFile( pixels.data(), filename, Pixel::RGB888, width, height ) );
+  std::vector<unsigned char> saved = ReadFile( filename );
+  DALI_TEST_EQUALS( saved.size(), static_cast<std::size_t>( serial.Count() ), TEST_LOCATION );
+  DALI_TEST_CHECK( memcmp( saved.data(), serial.Begin(), serial.Count() ) == 0 );
+
+  DALI_TEST_CHECK( EncodeToFile( pixels.data(), filename, Pixel::RGB888, width, height, true ) );
+  saved = ReadFile( filename );
+  DALI_TEST_EQUALS( saved.size(), static_cast<std::size_t>( parallel.Count() ), TEST_LOCATION );
+  DALI_TEST_CHECK( memcmp( saved.data(), parallel.Begin(), parallel.Count() ) == 0 );
+
+  remove( filename );
+  END_TEST;
+}
+
+int UtcDaliPngEncodeSerial(void)
+{
+  TestRoundTrip( 1280u, 720u, Pixel::RGB888, false );
+  TestRoundTrip( 640u, 480u, Pixel::BGRA8888, false );
+  END_TEST;
+}
+
+int UtcDaliPngEncodeUnsupportedFormatN(void)
+{
+  const std::vector<unsigned char> pixels = MakeTestImage( 16u, 16u, 1u );
+  Vector<unsigned char> encoded;
+  DALI_TEST_CHECK( !TizenPlatform::EncodeToPng( pixels.data(), encoded, 16u, 16u, Pixel::L8, true ) );
+  DALI_TEST_CHECK( encoded.Count() == 0u );
+  END_TEST;
+}
@@ -1109,6 +1109,7 @@ public:
     namedParams["type"] = ToString(type);
 
     mTextureTrace.PushCall("TexImage2D", out.str(), namedParams);
+    StoreTextureData(width, height, format, type, pixels);
   }
 
   inline void TexParameterf(GLenum target, GLenum pname, GLfloat param)
@@ -1172,6 +1173,7 @@ public:
     namedParams["width"] = ToString(width);
     namedParams["height"] = ToString(height);
     mTextureTrace.PushCall("TexSubImage2D", out.str(), namedParams);
+    StoreTextureData(width, height, format, type, pixels);
   }
 
   inline void Uniform1f(GLint location, GLfloat value )
@@ -1963,6 +1965,12 @@ public: // TEST FUNCTIONS
   inline void ResetTextureCallStack() { mTextureTrace.Reset(); }
   inline TraceCallStack& GetTextureTrace() { return mTextureTrace; }
 
+  /**
+   * The pixels passed to the last TexImage2D or TexSubImage2D call which had any,
+   * for unsigned byte formats. Empty for other types.
+   */
+  inline const std::vector<unsigned char>& GetLastTextureData() const { return mLastTextureData; }
+
   //Methods for Texture verification
   inline void EnableTexParameterCallTrace(bool enable) { mTexParamaterTrace.Enable(enable); }
   inline void ResetTexParameterCallStack() { mTexParamaterTrace.Reset(); }
@@ -2218,6 +2226,31 @@ private:
   std::vector<GLuint> mDeletedTextureIds;
   std::vector<GLuint> mBoundTextures;
 
+  inline void StoreTextureData(GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels)
+  {
+    if( pixels == NULL )
+    {
+      return;
+    }
+
+    size_t bytesPerPixel = 0u;
+    if( type == GL_UNSIGNED_BYTE )
+    {
+      switch( format )
+      {
+        case GL_ALPHA:
+        case GL_LUMINANCE:       bytesPerPixel = 1u; break;
+        case GL_LUMINANCE_ALPHA: bytesPerPixel = 2u; break;
+        case GL_RGB:             bytesPerPixel = 3u; break;
+        case GL_RGBA:            bytesPerPixel = 4u; break;
+        default:                 break;
+      }
+    }
+
+    const unsigned char* const bytes = static_cast<const unsigned char*>( pixels );
+    mLastTextureData.assign( bytes, bytes + width * height * bytesPerPixel );
+  }
+
   struct ActiveTextureType
   {
     std::vector<GLuint> mBoundTextures;
@@ -2230,6 +2263,7 @@ private:
   TraceCallStack mShaderTrace;
   TraceCallStack mTextureTrace;
   TraceCallStack mTexParamaterTrace;
+  std::vector<unsigned char> mLastTextureData;
   TraceCallStack mDrawTrace;
   TraceCallStack mDepthFunctionTrace;
   TraceCallStack mStencilFunctionTrace;
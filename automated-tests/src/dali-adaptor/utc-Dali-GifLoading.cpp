@@ -16,6 +16,8 @@
  */
 
 #include <stdlib.h>
+#include <cstring>
+#include <vector>
 #include <dali/dali.h>
 #include <dali-test-suite-utils.h>
 #include <dali/devel-api/adaptor-framework/gif-loading.h>
@@ -48,6 +50,119 @@ void VerifyLoad( std::vector<Dali::PixelData>& pixelDataList, Dali::Vector<uint3
     DALI_TEST_EQUALS( frameDelayList[idx], delay, TEST_LOCATION );
   }
 }
+
+/**
+ * Read back the pixels of a frame, by uploading it to a texture.
+ */
+std::vector<unsigned char> GetPixels( TestApplication& application, Dali::PixelData pixelData )
+{
+  Texture texture = Texture::New( TextureType::TEXTURE_2D, pixelData.GetPixelFormat(), pixelData.GetWidth(), pixelData.GetHeight() );
+  texture.Upload( pixelData );
+  application.SendNotification();
+  application.Render();
+  return application.GetGlAbstraction().GetLastTextureData();
+}
+
+/**
+ * Check the frames of a gif streamed through the smallest frame cache match those the default loader decodes.
+ */
+void VerifyStreaming( TestApplication& application, const char* url )
+{
+  std::vector<Dali::PixelData> pixelDataList;
+  Dali::Vector<uint32_t> frameDelayList;
+  std::unique_ptr<Dali::GifLoading> gifLoading = GifLoading::New( url, true );
+  DALI_TEST_CHECK( gifLoading->LoadAllFrames( pixelDataList, frameDelayList ) );
+  VerifyLoad( pixelDataList, frameDelayList, 5u, 100u, 100u, 1000u );
+
+  std::vector<std::vector<unsigned char>> expectedPixels;
+  for( auto&& pixelData : pixelDataList )
+  {
+    expectedPixels.push_back( GetPixels( application, pixelData ) );
+    DALI_TEST_EQUALS( expectedPixels.back().size(), 100u * 100u * 4u, TEST_LOCATION );
+  }
+
+  // Play the animation one frame at a time, twice round
+  std::unique_ptr<Dali::GifLoading> streamingGifLoading = GifLoading::New( url, true, 3u );
+  DALI_TEST_EQUALS( streamingGifLoading->GetImageCount(), 5, TEST_LOCATION );
+
+  std::vector<Dali::PixelData> streamedPixelDataList;
+  for( int frameIndex = 0; frameIndex < 10; ++frameIndex )
+  {
+    DALI_TEST_CHECK( streamingGifLoading->LoadNextNFrames( frameIndex, 1, streamedPixelDataList ) );
+  }
+
+  DALI_TEST_EQUALS( streamedPixelDataList.size(), 10u, TEST_LOCATION );
+  for( uint32_t idx = 0; idx < streamedPixelDataList.size(); idx++ )
+  {
+    const std::vector<unsigned char> pixels = GetPixels( application, streamedPixelDataList[idx] );
+    DALI_TEST_EQUALS( pixels.size(), expectedPixels[idx % 5u].size(), TEST_LOCATION );
+    DALI_TEST_CHECK( memcmp( pixels.data(), expectedPixels[idx % 5u].data(), pixels.size() ) == 0 );
+  }
+
+  // Going back to the start re-decodes the frames which were recycled
+  streamedPixelDataList.clear();
+  DALI_TEST_CHECK( streamingGifLoading->LoadNextNFrames( 0, 5, streamedPixelDataList ) );
+  DALI_TEST_EQUALS( streamedPixelDataList.size(), 5u, TEST_LOCATION );
+  for( uint32_t idx = 0; idx < streamedPixelDataList.size(); idx++ )
+  {
+    const std::vector<unsigned char> pixels = GetPixels( application, streamedPixelDataList[idx] );
+    DALI_TEST_EQUALS( pixels.size(), expectedPixels[idx].size(), TEST_LOCATION );
+    DALI_TEST_CHECK( memcmp( pixels.data(), expectedPixels[idx].data(), pixels.size() ) == 0 );
+  }
+}
+
+/**
+ * Check pasting the update of each frame of a gif onto the frame before gives the frame LoadNextNFrames() decodes.
+ */
+void VerifyFrameUpdates( TestApplication& application, const char* url )
+{
+  std::vector<Dali::PixelData> pixelDataList;
+  std::unique_ptr<Dali::GifLoading> gifLoading = GifLoading::New( url, true );
+  DALI_TEST_CHECK( gifLoading->LoadNextNFrames( 0, 5, pixelDataList ) );
+  DALI_TEST_EQUALS( pixelDataList.size(), 5u, TEST_LOCATION );
+
+  std::vector<Dali::PixelData> updates;
+  std::vector<Dali::Rect<int>> updatedAreas;
+  gifLoading = GifLoading::New( url, true );
+  DALI_TEST_CHECK( gifLoading->LoadNextNFrameUpdates( 0, 5, updates, updatedAreas ) );
+  DALI_TEST_EQUALS( updates.size(), 5u, TEST_LOCATION );
+  DALI_TEST_EQUALS( updatedAreas.size(), 5u, TEST_LOCATION );
+
+  // The first frame updates the whole image
+  DALI_TEST_EQUALS( updatedAreas[0], Rect<int>( 0, 0, 100, 100 ), TEST_LOCATION );
+
+  const unsigned int bytesPerPixel = 4u;
+  std::vector<unsigned char> canvas( 100u * 100u * bytesPerPixel, 0u );
+  for( uint32_t idx = 0; idx < 5u; idx++ )
+  {
+    // The rest update an area within the image, returned at the size of the area
+    const Rect<int>& area = updatedAreas[idx];
+    DALI_TEST_CHECK( area.x >= 0 && area.y >= 0 );
+    DALI_TEST_CHECK( area.x + area.width <= 100 && area.y + area.height <= 100 );
+    if( updates[idx] )
+    {
+      DALI_TEST_EQUALS( updates[idx].GetWidth(), static_cast<unsigned int>( area.width ), TEST_LOCATION );
+      DALI_TEST_EQUALS( updates[idx].GetHeight(), static_cast<unsigned int>( area.height ), TEST_LOCATION );
+
+      const std::vector<unsigned char> pixels = GetPixels( application, updates[idx] );
+      const unsigned int rowSize = area.width * bytesPerPixel;
+      DALI_TEST_EQUALS( pixels.size(), rowSize * area.height, TEST_LOCATION );
+      for( int y = 0; y < area.height; ++y )
+      {
+        memcpy( &canvas[ ( ( area.y + y ) * 100u + area.x ) * bytesPerPixel ], &pixels[ y * rowSize ], rowSize );
+      }
+    }
+    else
+    {
+      // Nothing changed
+      DALI_TEST_CHECK( ( area.width <= 0 ) || ( area.height <= 0 ) );
+    }
+
+    const std::vector<unsigned char> expectedPixels = GetPixels( application, pixelDataList[idx] );
+    DALI_TEST_EQUALS( expectedPixels.size(), canvas.size(), TEST_LOCATION );
+    DALI_TEST_CHECK( memcmp( canvas.data(), expectedPixels.data(), canvas.size() ) == 0 );
+  }
+}
 }
 
 void utc_dali_gif_loader_startup(void)
@@ -108,6 +223,58 @@ int UtcDaliGifLoadingN(void)
   END_TEST;
 }
 
+int UtcDaliGifLoadingStreamingP(void)
+{
+  TestApplication application;
+
+  VerifyStreaming( application, gGif_100_Prev );
+  VerifyStreaming( application, gGif_100_Bgnd );
+
+  END_TEST;
+}
+
+int UtcDaliGifLoadingStreamingN(void)
+{
+  std::vector<Dali::PixelData> pixelDataList;
+  Dali::Vector<uint32_t> frameDelayList;
+
+  std::unique_ptr<Dali::GifLoading> gifLoading = GifLoading::New( gGifNonExist, true, 3u );
+  bool succeed = gifLoading->LoadAllFrames( pixelDataList, frameDelayList );
+
+  // Check that the loading failed
+  DALI_TEST_CHECK( !succeed );
+  DALI_TEST_EQUALS( pixelDataList.size(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gifLoading->GetImageCount(), 0, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliGifLoadingLoadNextNFrameUpdatesP(void)
+{
+  TestApplication application;
+
+  VerifyFrameUpdates( application, gGif_100_Prev );
+  VerifyFrameUpdates( application, gGif_100_Bgnd );
+
+  END_TEST;
+}
+
+int UtcDaliGifLoadingLoadNextNFrameUpdatesN(void)
+{
+  std::vector<Dali::PixelData> updates;
+  std::vector<Dali::Rect<int>> updatedAreas;
+
+  std::unique_ptr<Dali::GifLoading> gifLoading = GifLoading::New( gGifNonExist, true );
+  bool succeed = gifLoading->LoadNextNFrameUpdates( 0, 1, updates, updatedAreas );
+
+  // Check that the loading failed
+  DALI_TEST_CHECK( !succeed );
+  DALI_TEST_EQUALS( updates.size(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( updatedAreas.size(), 0u, TEST_LOCATION );
+
+  END_TEST;
+}
+
 int UtcDaliGifLoadingGetImageSizeP(void)
 {
   std::unique_ptr<Dali::GifLoading> gifLoading = GifLoading::New( gGif_100_None, true );
@@ -16,6 +16,12 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
 #include <dali/dali.h>
 #include <dali-test-suite-utils.h>
 #include <dali-test-img-utils.h>
@@ -70,6 +76,50 @@ const char* IMAGE_WIDTH_EVEN_EXIF8_RGB = TEST_RESOURCE_DIR "/f-even-exif-8.jpg";
 
 // this is image is not exist, for negative test
 const char* IMAGENONEXIST = "non-exist.jpg";
+
+Devel::PixelBuffer CropPixelBuffer( Devel::PixelBuffer pixelBuffer, unsigned int x, unsigned int y, unsigned int width, unsigned int height )
+{
+  Devel::PixelBuffer cropped = Devel::PixelBuffer::New( width, height, pixelBuffer.GetPixelFormat() );
+  const unsigned int bytesPerPixel = Pixel::GetBytesPerPixel( pixelBuffer.GetPixelFormat() );
+  for( unsigned int row = 0; row < height; ++row )
+  {
+    memcpy( cropped.GetBuffer() + row * width * bytesPerPixel,
+            pixelBuffer.GetBuffer() + ( ( y + row ) * pixelBuffer.GetWidth() + x ) * bytesPerPixel,
+            width * bytesPerPixel );
+  }
+  return cropped;
+}
+
+Devel::PixelBuffer CreateMask( unsigned int width, unsigned int height )
+{
+  Devel::PixelBuffer mask = Devel::PixelBuffer::New( width, height, Pixel::L8 );
+  for( unsigned int i = 0; i < width * height; ++i )
+  {
+    mask.GetBuffer()[i] = static_cast<unsigned char>( ( i * 7u ) % 256u );
+  }
+  return mask;
+}
+
+/**
+ * Check masking and premultiplying while loading gives the same pixels as doing each step after loading.
+ */
+void VerifyMaskedLoad( const char* url, ImageDimensions size, FittingMode::Type fittingMode, Devel::PixelBuffer mask )
+{
+  Devel::PixelBuffer expected = Dali::LoadImageFromFile( url, size, fittingMode, SamplingMode::BOX_THEN_LINEAR, true );
+  DALI_TEST_CHECK( expected );
+  expected.ApplyMask( mask, 1.0f, false );
+  expected.MultiplyColorByAlpha();
+
+  Devel::PixelBuffer pixelBuffer = Dali::LoadImageFromFile( url, size, fittingMode, SamplingMode::BOX_THEN_LINEAR, true, mask, true, Pixel::INVALID );
+  DALI_TEST_CHECK( pixelBuffer );
+  DALI_TEST_EQUALS( pixelBuffer.GetWidth(), expected.GetWidth(), TEST_LOCATION );
+  DALI_TEST_EQUALS( pixelBuffer.GetHeight(), expected.GetHeight(), TEST_LOCATION );
+  DALI_TEST_EQUALS( pixelBuffer.GetPixelFormat(), expected.GetPixelFormat(), TEST_LOCATION );
+  DALI_TEST_CHECK( pixelBuffer.IsAlphaPreMultiplied() );
+
+  const unsigned int byteCount = expected.GetWidth() * expected.GetHeight() * Pixel::GetBytesPerPixel( expected.GetPixelFormat() );
+  DALI_TEST_CHECK( memcmp( pixelBuffer.GetBuffer(), expected.GetBuffer(), byteCount ) == 0 );
+}
 }
 
 void utc_dali_load_image_startup(void)
@@ -215,6 +265,214 @@ int UtcDaliLoadImageP(void)
   END_TEST;
 }
 
+int UtcDaliLoadImageFittingModeCropP(void)
+{
+  // The JPEG loader only decodes the part of the image which the fitting mode keeps.
+  // Each file is stored in a different orientation, so the files only match each other within the tolerance of the other
+  // EXIF tests, but each crop matches the same crop of the whole image decoded from the same file exactly:
+  Devel::PixelBuffer firstImage = Dali::LoadImageFromFile( IMAGE_WIDTH_ODD_EXIF1_RGB );
+  DALI_TEST_CHECK( firstImage );
+  Devel::PixelBuffer firstTopAndBottomCropped = CropPixelBuffer( firstImage, 0u, 16u, 55u, 32u );
+  Devel::PixelBuffer firstSidesCropped = CropPixelBuffer( firstImage, 11u, 0u, 32u, 64u );
+
+  const char* const images[] =
+  {
+    IMAGE_WIDTH_ODD_EXIF1_RGB, IMAGE_WIDTH_ODD_EXIF2_RGB, IMAGE_WIDTH_ODD_EXIF3_RGB, IMAGE_WIDTH_ODD_EXIF4_RGB,
+    IMAGE_WIDTH_ODD_EXIF5_RGB, IMAGE_WIDTH_ODD_EXIF6_RGB, IMAGE_WIDTH_ODD_EXIF7_RGB, IMAGE_WIDTH_ODD_EXIF8_RGB
+  };
+  for( const char* image : images )
+  {
+    tet_printf( "Image %s\n", image );
+
+    Devel::PixelBuffer wholeImage = Dali::LoadImageFromFile( image );
+    DALI_TEST_CHECK( wholeImage );
+    Devel::PixelBuffer topAndBottomCropped = CropPixelBuffer( wholeImage, 0u, 16u, 55u, 32u );
+    Devel::PixelBuffer sidesCropped = CropPixelBuffer( wholeImage, 11u, 0u, 32u, 64u );
+
+    // The crops must land in the same place whatever the orientation of the file:
+    DALI_IMAGE_TEST_EQUALS( firstTopAndBottomCropped, topAndBottomCropped, 8, TEST_LOCATION );
+    DALI_IMAGE_TEST_EQUALS( firstSidesCropped, sidesCropped, 8, TEST_LOCATION );
+
+    Devel::PixelBuffer pixelBuffer = Dali::LoadImageFromFile( image, ImageDimensions( 55u, 32u ), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true );
+    DALI_TEST_CHECK( pixelBuffer );
+    DALI_TEST_EQUALS( pixelBuffer.GetWidth(), 55u, TEST_LOCATION );
+    DALI_TEST_EQUALS( pixelBuffer.GetHeight(), 32u, TEST_LOCATION );
+    DALI_IMAGE_TEST_EQUALS( topAndBottomCropped, pixelBuffer, 0, TEST_LOCATION );
+
+    pixelBuffer = Dali::LoadImageFromFile( image, ImageDimensions( 55u, 32u ), FittingMode::FIT_WIDTH, SamplingMode::BOX_THEN_LINEAR, true );
+    DALI_TEST_CHECK( pixelBuffer );
+    DALI_TEST_EQUALS( pixelBuffer.GetWidth(), 55u, TEST_LOCATION );
+    DALI_TEST_EQUALS( pixelBuffer.GetHeight(), 32u, TEST_LOCATION );
+    DALI_IMAGE_TEST_EQUALS( topAndBottomCropped, pixelBuffer, 0, TEST_LOCATION );
+
+    pixelBuffer = Dali::LoadImageFromFile( image, ImageDimensions( 32u, 64u ), FittingMode::SCALE_TO_FILL, SamplingMode::BOX_THEN_LINEAR, true );
+    DALI_TEST_CHECK( pixelBuffer );
+    DALI_TEST_EQUALS( pixelBuffer.GetWidth(), 32u, TEST_LOCATION );
+    DALI_TEST_EQUALS( pixelBuffer.GetHeight(), 64u, TEST_LOCATION );
+    DALI_IMAGE_TEST_EQUALS( sidesCropped, pixelBuffer, 0, TEST_LOCATION );
+
+    pixelBuffer = Dali::LoadImageFromFile( image, ImageDimensions( 32u, 64u ), FittingMode::FIT_HEIGHT, SamplingMode::BOX_THEN_LINEAR, true );
+    DALI_TEST_CHECK( pixelBuffer );
+    DALI_TEST_EQUALS( pixelBuffer.GetWidth(), 32u, TEST_LOCATION );
+    DALI_TEST_EQUALS( pixelBuffer.GetHeight(), 64u, TEST_LOCATION );
+    DALI_IMAGE_TEST_EQUALS( sidesCropped, pixelBuffer, 0, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliLoadImageFromFileWithMaskP(void)
+{
+  // An image with an alpha channel is masked in place:
+  VerifyMaskedLoad( IMAGE_34_RGBA, ImageDimensions(), FittingMode::DEFAULT, CreateMask( 34u, 34u ) );
+
+  // One without becomes RGBA8888, cropped for the fitting mode, with a mask of another size:
+  VerifyMaskedLoad( IMAGE_128_RGB, ImageDimensions( 64u, 32u ), FittingMode::SCALE_TO_FILL, CreateMask( 20u, 20u ) );
+
+  // Only converted to another format:
+  Devel::PixelBuffer expected = Dali::LoadImageFromFile( IMAGE_128_RGB );
+  Devel::PixelBuffer converted = Dali::LoadImageFromFile( IMAGE_128_RGB, ImageDimensions(), FittingMode::DEFAULT, SamplingMode::BOX_THEN_LINEAR, true,
+                                                          Devel::PixelBuffer(), false, Pixel::RGBA8888 );
+  DALI_TEST_CHECK( converted );
+  DALI_TEST_EQUALS( converted.GetWidth(), 128u, TEST_LOCATION );
+  DALI_TEST_EQUALS( converted.GetHeight(), 128u, TEST_LOCATION );
+  DALI_TEST_EQUALS( converted.GetPixelFormat(), Pixel::RGBA8888, TEST_LOCATION );
+  DALI_TEST_CHECK( !converted.IsAlphaPreMultiplied() );
+  bool same = true;
+  for( unsigned int i = 0; i < 128u * 128u; ++i )
+  {
+    same = same && ( memcmp( converted.GetBuffer() + i * 4u, expected.GetBuffer() + i * 3u, 3u ) == 0 ) && ( converted.GetBuffer()[i * 4u + 3u] == 0xffu );
+  }
+  DALI_TEST_CHECK( same );
+
+  Devel::PixelBuffer missing = Dali::LoadImageFromFile( IMAGENONEXIST, ImageDimensions(), FittingMode::DEFAULT, SamplingMode::BOX_THEN_LINEAR, true,
+                                                        CreateMask( 4u, 4u ), true, Pixel::RGBA8888 );
+  DALI_TEST_CHECK( !missing );
+
+  END_TEST;
+}
+
+int UtcDaliLoadImagePlanesFromFileP(void)
+{
+  // The JPEG has no chroma subsampling, so all three planes are the size of the image:
+  std::vector<Devel::PixelBuffer> buffers;
+  Dali::LoadImagePlanesFromFile( IMAGE_128_RGB, buffers );
+  DALI_TEST_EQUALS( buffers.size(), 3u, TEST_LOCATION );
+  for( Devel::PixelBuffer& plane : buffers )
+  {
+    DALI_TEST_CHECK( plane );
+    DALI_TEST_EQUALS( plane.GetWidth(), 128u, TEST_LOCATION );
+    DALI_TEST_EQUALS( plane.GetHeight(), 128u, TEST_LOCATION );
+    DALI_TEST_EQUALS( plane.GetPixelFormat(), Pixel::L8, TEST_LOCATION );
+  }
+
+  // Converted the way the shader would, the planes give the image which is decoded to RGB:
+  Devel::PixelBuffer rgb = Dali::LoadImageFromFile( IMAGE_128_RGB );
+  DALI_TEST_CHECK( rgb );
+  int maxDifference = 0;
+  for( unsigned int i = 0u; i < 128u * 128u; ++i )
+  {
+    const float y  = buffers[0].GetBuffer()[i];
+    const float cb = buffers[1].GetBuffer()[i] - 128.0f;
+    const float cr = buffers[2].GetBuffer()[i] - 128.0f;
+    const float converted[3] = { y + 1.402f * cr, y - 0.344136f * cb - 0.714136f * cr, y + 1.772f * cb };
+    for( unsigned int component = 0u; component < 3u; ++component )
+    {
+      const int value = std::min( std::max( static_cast<int>( converted[component] + 0.5f ), 0 ), 255 );
+      maxDifference = std::max( maxDifference, std::abs( value - static_cast<int>( rgb.GetBuffer()[i * 3u + component] ) ) );
+    }
+  }
+  DALI_TEST_CHECK( maxDifference <= 2 );
+
+  // The DCT scales the planes to the size asked for:
+  Dali::LoadImagePlanesFromFile( IMAGE_128_RGB, buffers, ImageDimensions( 64u, 64u ) );
+  DALI_TEST_EQUALS( buffers.size(), 3u, TEST_LOCATION );
+  for( Devel::PixelBuffer& plane : buffers )
+  {
+    DALI_TEST_EQUALS( plane.GetWidth(), 64u, TEST_LOCATION );
+    DALI_TEST_EQUALS( plane.GetHeight(), 64u, TEST_LOCATION );
+  }
+
+  END_TEST;
+}
+
+int UtcDaliLoadImagePlanesFromFileFallbackP(void)
+{
+  std::vector<Devel::PixelBuffer> buffers;
+
+  // Formats other than JPEG load as a single image:
+  Dali::LoadImagePlanesFromFile( IMAGE_34_RGBA, buffers );
+  DALI_TEST_EQUALS( buffers.size(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( buffers[0].GetWidth(), 34u, TEST_LOCATION );
+  DALI_TEST_EQUALS( buffers[0].GetHeight(), 34u, TEST_LOCATION );
+  DALI_TEST_EQUALS( buffers[0].GetPixelFormat(), Pixel::RGBA8888, TEST_LOCATION );
+
+  // So does a JPEG which needs reorienting:
+  Dali::LoadImagePlanesFromFile( IMAGE_WIDTH_EVEN_EXIF6_RGB, buffers );
+  DALI_TEST_EQUALS( buffers.size(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( buffers[0].GetWidth(), 50u, TEST_LOCATION );
+  DALI_TEST_EQUALS( buffers[0].GetHeight(), 64u, TEST_LOCATION );
+  DALI_TEST_EQUALS( buffers[0].GetPixelFormat(), Pixel::RGB888, TEST_LOCATION );
+
+  // And one which needs cropping to fit:
+  Dali::LoadImagePlanesFromFile( IMAGE_128_RGB, buffers, ImageDimensions( 64u, 32u ), FittingMode::SCALE_TO_FILL );
+  DALI_TEST_EQUALS( buffers.size(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( buffers[0].GetWidth(), 64u, TEST_LOCATION );
+  DALI_TEST_EQUALS( buffers[0].GetHeight(), 32u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliLoadImagePlanesFromFileN(void)
+{
+  std::vector<Devel::PixelBuffer> buffers;
+  Dali::LoadImagePlanesFromFile( IMAGENONEXIST, buffers );
+  DALI_TEST_CHECK( buffers.empty() );
+
+  END_TEST;
+}
+
+int UtcDaliLoadImagePreviewFromFileP(void)
+{
+  // Without a thumbnail, the image is decoded at 1/8 scale:
+  Devel::PixelBuffer preview = Dali::LoadImagePreviewFromFile( IMAGE_128_RGB );
+  DALI_TEST_CHECK( preview );
+  DALI_TEST_EQUALS( preview.GetWidth(), 16u, TEST_LOCATION );
+  DALI_TEST_EQUALS( preview.GetHeight(), 16u, TEST_LOCATION );
+  DALI_TEST_EQUALS( preview.GetPixelFormat(), Pixel::RGB888, TEST_LOCATION );
+
+  // Otherwise the EXIF thumbnail is decoded:
+  preview = Dali::LoadImagePreviewFromFile( IMAGE_LARGE_EXIF3_RGB );
+  DALI_TEST_CHECK( preview );
+  DALI_TEST_EQUALS( preview.GetWidth(), 153u, TEST_LOCATION );
+  DALI_TEST_EQUALS( preview.GetHeight(), 196u, TEST_LOCATION );
+
+  // The thumbnail is reoriented like the image:
+  preview = Dali::LoadImagePreviewFromFile( IMAGE_WIDTH_EVEN_EXIF6_RGB );
+  DALI_TEST_CHECK( preview );
+  DALI_TEST_EQUALS( preview.GetWidth(), 39u, TEST_LOCATION );
+  DALI_TEST_EQUALS( preview.GetHeight(), 50u, TEST_LOCATION );
+
+  preview = Dali::LoadImagePreviewFromFile( IMAGE_WIDTH_EVEN_EXIF6_RGB, false );
+  DALI_TEST_CHECK( preview );
+  DALI_TEST_EQUALS( preview.GetWidth(), 50u, TEST_LOCATION );
+  DALI_TEST_EQUALS( preview.GetHeight(), 39u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+int UtcDaliLoadImagePreviewFromFileN(void)
+{
+  // Formats without a fast preview give nothing:
+  Devel::PixelBuffer preview = Dali::LoadImagePreviewFromFile( IMAGE_34_RGBA );
+  DALI_TEST_CHECK( !preview );
+
+  preview = Dali::LoadImagePreviewFromFile( IMAGENONEXIST );
+  DALI_TEST_CHECK( !preview );
+
+  END_TEST;
+}
+
 int UtcDaliLoadImageN(void)
 {
   Devel::PixelBuffer pixelBuffer = Dali::LoadImageFromFile( IMAGENONEXIST );
@@ -223,6 +481,97 @@ int UtcDaliLoadImageN(void)
   END_TEST;
 }
 
+int UtcDaliLoadImageFromArchiveP(void)
+{
+  char archivePath[] = "/tmp/utc-Dali-ImageLoading-XXXXXX.dpk";
+  const int fileDescriptor = mkstemps( archivePath, 4 );
+  DALI_TEST_CHECK( fileDescriptor >= 0 );
+  close( fileDescriptor );
+
+  std::vector<std::string> names;
+  names.push_back( "icon-edit.png" );
+  names.push_back( "gallery-small-1.jpg" );
+  DALI_TEST_CHECK( Dali::BuildImageArchive( archivePath, TEST_RESOURCE_DIR, names ) );
+
+  // The images load as they do from their own files:
+  for( const std::string& name : names )
+  {
+    Devel::PixelBuffer expected = Dali::LoadImageFromFile( std::string( TEST_RESOURCE_DIR "/" ) + name );
+    Devel::PixelBuffer pixelBuffer = Dali::LoadImageFromFile( std::string( archivePath ) + "#" + name );
+    DALI_TEST_CHECK( pixelBuffer );
+    DALI_TEST_EQUALS( pixelBuffer.GetWidth(), expected.GetWidth(), TEST_LOCATION );
+    DALI_TEST_EQUALS( pixelBuffer.GetHeight(), expected.GetHeight(), TEST_LOCATION );
+    DALI_TEST_EQUALS( pixelBuffer.GetPixelFormat(), expected.GetPixelFormat(), TEST_LOCATION );
+    const unsigned int byteCount = expected.GetWidth() * expected.GetHeight() * Pixel::GetBytesPerPixel( expected.GetPixelFormat() );
+    DALI_TEST_CHECK( memcmp( pixelBuffer.GetBuffer(), expected.GetBuffer(), byteCount ) == 0 );
+
+    ImageDimensions dimensions = Dali::GetOriginalImageSize( std::string( archivePath ) + "#" + name );
+    DALI_TEST_EQUALS( static_cast<unsigned int>( dimensions.GetWidth() ), expected.GetWidth(), TEST_LOCATION );
+    DALI_TEST_EQUALS( static_cast<unsigned int>( dimensions.GetHeight() ), expected.GetHeight(), TEST_LOCATION );
+  }
+
+  // Fitted to a size as any other image:
+  Devel::PixelBuffer scaled = Dali::LoadImageFromFile( std::string( archivePath ) + "#gallery-small-1.jpg", ImageDimensions( 64, 64 ) );
+  DALI_TEST_CHECK( scaled );
+  DALI_TEST_EQUALS( scaled.GetWidth(), 64u, TEST_LOCATION );
+  DALI_TEST_EQUALS( scaled.GetHeight(), 64u, TEST_LOCATION );
+
+  Devel::PixelBuffer missing = Dali::LoadImageFromFile( std::string( archivePath ) + "#" + IMAGENONEXIST );
+  DALI_TEST_CHECK( !missing );
+
+  unlink( archivePath );
+
+  END_TEST;
+}
+
+int UtcDaliLoadImageFromArchiveN(void)
+{
+  std::vector<std::string> names;
+  names.push_back( IMAGENONEXIST );
+  DALI_TEST_CHECK( !Dali::BuildImageArchive( "/tmp/utc-Dali-ImageLoading-N.dpk", TEST_RESOURCE_DIR, names ) );
+
+  Devel::PixelBuffer pixelBuffer = Dali::LoadImageFromFile( "non-exist.dpk#icon-edit.png" );
+  DALI_TEST_CHECK( !pixelBuffer );
+
+  END_TEST;
+}
+
+int UtcDaliLoadImageFromFileNamedLikeArchiveP(void)
+{
+  // A plain image whose path has ".dpk#" in it, where no archive is:
+  char path[] = "/tmp/utc-Dali-ImageLoading-XXXXXX.dpk#icon-edit.png";
+  const int fileDescriptor = mkstemps( path, 14 );
+  DALI_TEST_CHECK( fileDescriptor >= 0 );
+
+  std::vector<char> contents;
+  FILE* const source = fopen( IMAGE_34_RGBA, "rb" );
+  DALI_TEST_CHECK( source );
+  char buffer[4096];
+  size_t count;
+  while( ( count = fread( buffer, 1, sizeof( buffer ), source ) ) > 0 )
+  {
+    contents.insert( contents.end(), buffer, buffer + count );
+  }
+  fclose( source );
+  DALI_TEST_CHECK( write( fileDescriptor, contents.data(), contents.size() ) == static_cast<ssize_t>( contents.size() ) );
+  close( fileDescriptor );
+
+  Devel::PixelBuffer expected = Dali::LoadImageFromFile( IMAGE_34_RGBA );
+  Devel::PixelBuffer pixelBuffer = Dali::LoadImageFromFile( path );
+  DALI_TEST_CHECK( pixelBuffer );
+  DALI_TEST_EQUALS( pixelBuffer.GetWidth(), 34u, TEST_LOCATION );
+  DALI_TEST_EQUALS( pixelBuffer.GetHeight(), 34u, TEST_LOCATION );
+  DALI_TEST_EQUALS( pixelBuffer.GetPixelFormat(), Pixel::RGBA8888, TEST_LOCATION );
+  DALI_TEST_CHECK( memcmp( pixelBuffer.GetBuffer(), expected.GetBuffer(), 34u * 34u * 4u ) == 0 );
+
+  ImageDimensions dimensions = Dali::GetOriginalImageSize( path );
+  DALI_TEST_EQUALS( static_cast<unsigned int>( dimensions.GetWidth() ), 34u, TEST_LOCATION );
+  DALI_TEST_EQUALS( static_cast<unsigned int>( dimensions.GetHeight() ), 34u, TEST_LOCATION );
+
+  unlink( path );
+
+  END_TEST;
+}
 
 int UtcDaliDownloadImageP(void)
 {
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <cstdlib>
 #include <dali/dali.h>
 #include <dali-test-suite-utils.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
@@ -750,3 +752,98 @@ int UtcDaliPixelBufferGaussianBlur(void)
 
   END_TEST;
 }
+
+int UtcDaliPixelBufferApproximateGaussianBlur(void)
+{
+  TestApplication application;
+
+  Devel::PixelBuffer imageData = Devel::PixelBuffer::New( 10, 10, Pixel::RGBA8888 );
+  FillCheckerboard(imageData);
+
+  unsigned char* buffer = imageData.GetBuffer();
+
+  DALI_TEST_EQUALS( buffer[43], 0xffu, TEST_LOCATION );
+  DALI_TEST_EQUALS( buffer[55], 0x00u, TEST_LOCATION );
+
+  imageData.ApplyApproximateGaussianBlur( 0.0f );
+
+  // Test that the pixels' alpha values are not changed because there is no blur
+  DALI_TEST_EQUALS( buffer[43], 0xffu, TEST_LOCATION );
+  DALI_TEST_EQUALS( buffer[55], 0x00u, TEST_LOCATION );
+
+  imageData.ApplyApproximateGaussianBlur( 1.0f );
+
+  // Test that the checkerboard is smoothed to mid grey
+  DALI_TEST_EQUALS( buffer[43], 0x71u, TEST_LOCATION );
+  DALI_TEST_EQUALS( buffer[55], 0x71u, TEST_LOCATION );
+
+  END_TEST;
+}
+
+/**
+ * Fill an RGBA8888 buffer with 16x16 blocks over gentle gradients, so a blur has hard edges and slopes to smooth.
+ */
+void FillBlocks( Devel::PixelBuffer imageData )
+{
+  const unsigned int width = imageData.GetWidth();
+  const unsigned int height = imageData.GetHeight();
+  unsigned char* pixel = imageData.GetBuffer();
+  for( unsigned int y = 0; y < height; ++y )
+  {
+    for( unsigned int x = 0; x < width; ++x, pixel += 4 )
+    {
+      const bool on = ( ( x / 16u ) + ( y / 16u ) ) % 2u;
+      pixel[0] = on ? 0xff : 0x00;
+      pixel[1] = static_cast<unsigned char>( std::min( x * 2u, 255u ) );
+      pixel[2] = static_cast<unsigned char>( std::min( y * 2u, 255u ) );
+      pixel[3] = on ? 0xff : 0x40;
+    }
+  }
+}
+
+/**
+ * Blur blocks with both blurs and check the approximate one is within a tolerance of the exact one.
+ */
+void VerifyApproximateGaussianBlur( unsigned int width, unsigned int height, float blurRadius )
+{
+  // Three box blurs differ from a Gaussian by a few percent at hard edges, and much less elsewhere:
+  const int maximumTolerance = 16;
+  const float meanTolerance = 2.0f;
+
+  Devel::PixelBuffer exact = Devel::PixelBuffer::New( width, height, Pixel::RGBA8888 );
+  Devel::PixelBuffer approximate = Devel::PixelBuffer::New( width, height, Pixel::RGBA8888 );
+  FillBlocks( exact );
+  FillBlocks( approximate );
+
+  exact.ApplyGaussianBlur( blurRadius );
+  approximate.ApplyApproximateGaussianBlur( blurRadius );
+
+  const unsigned int size = width * height * 4u;
+  int maximumDifference = 0;
+  float totalDifference = 0.0f;
+  for( unsigned int i = 0; i < size; ++i )
+  {
+    const int difference = std::abs( static_cast<int>( exact.GetBuffer()[i] ) - static_cast<int>( approximate.GetBuffer()[i] ) );
+    maximumDifference = std::max( maximumDifference, difference );
+    totalDifference += difference;
+  }
+
+  DALI_TEST_CHECK( maximumDifference <= maximumTolerance );
+  DALI_TEST_CHECK( totalDifference / size <= meanTolerance );
+
+  // The blocks are blurred away, not left as they were:
+  DALI_TEST_CHECK( approximate.GetBuffer()[0] > 0x00u );
+}
+
+int UtcDaliPixelBufferApproximateGaussianBlurLargeRadius(void)
+{
+  TestApplication application;
+
+  // Boxes about 25 pixels wide, which keep running sums rather than being a pixel each:
+  VerifyApproximateGaussianBlur( 128u, 128u, 30.0f );
+
+  // Narrower than a box, so it reaches past both edges of every scanline of the first pass:
+  VerifyApproximateGaussianBlur( 8u, 128u, 30.0f );
+
+  END_TEST;
+}
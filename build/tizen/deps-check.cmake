@@ -66,6 +66,7 @@ CHECK_MODULE_AND_SET( FREETYPE freetype2>=${FREETYPE_REQUIRED} freetype_availabl
 CHECK_MODULE_AND_SET( FREETYPE_BITMAP_SUPPORT freetype2>=${FREETYPE_BITMAP_SUPPORT_VERSION} freetype_bitmap_support)
 CHECK_MODULE_AND_SET( FONTCONFIG fontconfig fontconfig_available )
 CHECK_MODULE_AND_SET( PNG libpng [] )
+CHECK_MODULE_AND_SET( ZLIB zlib [] )
 CHECK_MODULE_AND_SET( LIBEXIF libexif [] )
 CHECK_MODULE_AND_SET( LIBDRM libdrm [] )
 CHECK_MODULE_AND_SET( LIBCURL libcurl [] )
@@ -234,6 +235,7 @@ SET( DALI_CFLAGS
   ${FONTCONFIG_CFLAGS}
   ${CAIRO_CFLAGS}
   ${PNG_CFLAGS}
+  ${ZLIB_CFLAGS}
   ${DLOG_CFLAGS}
   ${VCONF_CFLAGS}
   ${EXIF_CFLAGS}
@@ -255,6 +257,7 @@ SET( DALI_LDFLAGS
   ${FONTCONFIG_LDFLAGS}
   ${CAIRO_LDFLAGS}
   ${PNG_LDFLAGS}
+  ${ZLIB_LDFLAGS}
   ${DLOG_LDFLAGS}
   ${VCONF_LDFLAGS}
   ${EXIF_LDFLAGS}
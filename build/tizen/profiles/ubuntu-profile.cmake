@@ -97,6 +97,7 @@ ADD_COMPILE_OPTIONS(
   ${FONTCONFIG_CFLAGS}
   ${CAIRO_CFLAGS}
   ${PNG_CFLAGS}
+  ${ZLIB_CFLAGS}
   ${DLOG_CFLAGS}
   ${VCONF_CFLAGS}
   ${EXIF_CFLAGS}
@@ -117,6 +118,7 @@ SET(REQUIRED_LIBS ${ECORE_LDFLAGS}
   ${FREETYPE_BITMAP_SUPPORT}
   ${FONTCONFIG_LDFLAGS}
   ${PNG_LDFLAGS}
+  ${ZLIB_LDFLAGS}
   ${LIBEXIF_LDFLAGS}
   ${LIBDRM_LDFLAGS}
   ${LIBCURL_LDFLAGS}
@@ -91,7 +91,8 @@ bool EncodeToFormat( const unsigned char* pixelBuffer,
                      FileFormat formatEncoding,
                      std::size_t width,
                      std::size_t height,
-                     Pixel::Format pixelFormat )
+                     Pixel::Format pixelFormat,
+                     bool parallelEncode )
 {
   switch( formatEncoding )
   {
@@ -102,7 +103,7 @@ bool EncodeToFormat( const unsigned char* pixelBuffer,
     }
     case PNG_FORMAT:
     {
-      return TizenPlatform::EncodeToPng( pixelBuffer, encodedPixels, width, height, pixelFormat );
+      return TizenPlatform::EncodeToPng( pixelBuffer, encodedPixels, width, height, pixelFormat, parallelEncode );
       break;
     }
     default:
@@ -121,11 +122,21 @@ bool EncodeToFile(const unsigned char* const pixelBuffer,
                   const Pixel::Format pixelFormat,
                   const std::size_t width,
                   const std::size_t height )
+{
+  return EncodeToFile( pixelBuffer, filename, pixelFormat, width, height, false );
+}
+
+bool EncodeToFile(const unsigned char* const pixelBuffer,
+                  const std::string& filename,
+                  const Pixel::Format pixelFormat,
+                  const std::size_t width,
+                  const std::size_t height,
+                  const bool parallelEncode )
 {
   DALI_ASSERT_DEBUG(pixelBuffer != 0 && filename.size() > 4 && width > 0 && height > 0);
   Vector< unsigned char > pixbufEncoded;
   const FileFormat format = GetFormatFromFileName( filename );
-  const bool encodeResult = EncodeToFormat( pixelBuffer, pixbufEncoded, format, width, height, pixelFormat );
+  const bool encodeResult = EncodeToFormat( pixelBuffer, pixbufEncoded, format, width, height, pixelFormat, parallelEncode );
   if(!encodeResult)
   {
     DALI_LOG_ERROR("Encoding pixels failed\n");
@@ -46,6 +46,30 @@ DALI_ADAPTOR_API bool EncodeToFile(const unsigned char* const pixelBuffer,
                                   const std::size_t width,
                                   const std::size_t height);
 
+/**
+ * Store the given pixel data to a file, choosing how PNG files are encoded.
+ * The suffix of the filename determines what type of file will be stored,
+ * currently only jpeg and png formats are supported.
+ *
+ * The other EncodeToFile() compresses PNG files on the calling thread.
+ *
+ * @param[in] pixelBuffer    Pointer to the pixel data
+ * @param[in] filename       Filename to save
+ * @param[in] pixelFormat    The format of the buffer's pixels
+ * @param[in] width          The width of the image in pixels
+ * @param[in] height         The height of the image in pixels
+ * @param[in] parallelEncode Whether to compress strips of a big PNG image on several threads.
+ *                           If false, or the image is small, it is compressed on the calling thread.
+ *
+ * @return true if the file was saved
+ */
+DALI_ADAPTOR_API bool EncodeToFile(const unsigned char* const pixelBuffer,
+                                  const std::string& filename,
+                                  const Pixel::Format pixelFormat,
+                                  const std::size_t width,
+                                  const std::size_t height,
+                                  const bool parallelEncode);
+
 } // namespace Dali
 
 
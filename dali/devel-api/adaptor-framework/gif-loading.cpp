@@ -26,10 +26,17 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <gif_lib.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/images/pixel-data.h>
 #include <dali/internal/imaging/common/file-download.h>
+#include <dali/internal/imaging/common/mapped-file.h>
 #include <dali/internal/system/common/file-reader.h>
 
 #define IMG_TOO_BIG( w, h )                                                        \
@@ -53,6 +60,9 @@ Debug::Filter *gGifLoadingLogFilter = Debug::Filter::New( Debug::NoLogging, fals
 
 const int IMG_MAX_SIZE = 65000;
 constexpr size_t MAXIMUM_DOWNLOAD_IMAGE_SIZE  = 50 * 1024 * 1024;
+constexpr size_t DEFAULT_FRAME_CACHE_BYTES    = 512 * 1024; ///< The memory decoded frames may use when no frame cache size is given
+constexpr uint32_t MINIMUM_FRAME_CACHE_SIZE   = 3u;         ///< Composing a frame may need it, the previous frame and the last preserved frame
+constexpr uint32_t DECODE_AHEAD_TIME          = 200u;       ///< When streaming, the frames due within this many milliseconds are decoded ahead
 
 #if GIFLIB_MAJOR < 5
 const int DISPOSE_BACKGROUND = 2;       /* Set area too background color */
@@ -118,6 +128,29 @@ struct GifAnimationData
   bool animated;
 };
 
+/**
+ * @brief The canvas sized buffers holding the decoded frames of an animated gif.
+ *
+ * No more than capacity buffers are allocated. Once they are all in use, a frame
+ * being decoded takes the buffer of the least recently used frame which isn't
+ * needed to compose it.
+ */
+struct FrameCache
+{
+  FrameCache()
+  : decodedFrames(),
+    freeBuffers(),
+    capacity( 0u ),
+    allocated( 0u )
+  {
+  }
+
+  std::deque<int> decodedFrames;      /**< The indices of the frames holding a buffer, least recently used first. */
+  std::vector<uint32_t *> freeBuffers; /**< Buffers which no frame holds. */
+  uint32_t capacity;                  /**< The number of buffers to allocate before recycling them, or 0 to work it out from the canvas size. */
+  uint32_t allocated;                 /**< The number of buffers allocated. */
+};
+
 struct LoaderInfo
 {
   LoaderInfo()
@@ -131,13 +164,16 @@ struct LoaderInfo
     FileData()
     : fileName( nullptr ),
       globalMap ( nullptr ),
+      map( nullptr ),
       length( 0 ),
       isLocalResource( true )
     {
     }
 
     const char *fileName;  /**< The absolute path of the file. */
-    unsigned char *globalMap ;      /**< A pointer to the entire contents of the file that have been mapped with mmap(2). */
+    unsigned char *globalMap ;      /**< A copy of the entire contents of the file, when it can't be mapped. */
+    Internal::Platform::MappedFile mappedFile; /**< The mapping of a local file. */
+    const unsigned char *map; /**< The entire contents of the file: either the mapping or globalMap. */
     long long length;  /**< The length of the file in bytes. */
     bool isLocalResource; /**< The flag whether the file is a local resource */
   };
@@ -151,12 +187,13 @@ struct LoaderInfo
     {
     }
 
-    unsigned char *map;
+    const unsigned char *map;
     int position, length; // yes - gif uses ints for file sizes.
   };
 
   FileData fileData;
   GifAnimationData animated;
+  FrameCache frameCache;
   GifFileType *gif;
   int imageNumber;
   FileInfo fileInfo;
@@ -357,61 +394,197 @@ void ClipCoordinates( int imageWidth, int imageHeight, int *xin, int *yin, int x
 }
 
 /**
- * @brief Flush out rgba frame images to save memory but skip current,
- * previous and lastPreservedFrame frames (needed for dispose mode DISPOSE_PREVIOUS)
+ * @brief Find the frame which a frame disposed to the previous frame is restored to:
+ * the last frame before the given one which isn't disposed to the previous frame itself.
+ *
+ * @param[in] animated A structure containing GIF animation data
+ * @param[in] index The index of the frame being composed
+ * @return A pointer to the ImageFrame, or nullptr if there is none.
+ */
+ImageFrame *FindLastPreservedFrame( const GifAnimationData &animated, int index )
+{
+  ImageFrame *frame = nullptr;
+  do
+  {
+    frame = FindFrame( animated, --index );
+  } while( frame && frame->info.dispose == DISPOSE_PREVIOUS );
+  return frame;
+}
+
+/**
+ * @brief Mark a decoded frame as the most recently used one, so it is the last to be recycled.
+ *
+ * @param[in] cache The frame cache
+ * @param[in] index The index of the frame
+ */
+void TouchFrame( FrameCache &cache, int index )
+{
+  auto iter = std::find( cache.decodedFrames.begin(), cache.decodedFrames.end(), index );
+  if( iter != cache.decodedFrames.end() )
+  {
+    cache.decodedFrames.erase( iter );
+    cache.decodedFrames.push_back( index );
+  }
+}
+
+/**
+ * @brief Give a frame a buffer to decode into. Once the cache is full, the buffer of the
+ * least recently used frame is recycled, but the previous and lastPreservedFrame frames
+ * (needed for dispose mode DISPOSE_PREVIOUS) keep theirs.
  *
  * @param[in] animated A structure containing GIF animation data
+ * @param[in] cache The frame cache
  * @param[in] width Width of the image
  * @param[in] height Height of the image
- * @param[in] thisframe The current frame
+ * @param[in] thisframe The frame to give a buffer to
  * @param[in] prevframe The previous frame
  * @param[in] lastPreservedFrame The last preserved frame
  */
-void FlushFrames( GifAnimationData &animated, int width, int height, ImageFrame *thisframe, ImageFrame *prevframe, ImageFrame *lastPreservedFrame )
+void AcquireFrameBuffer( GifAnimationData &animated, FrameCache &cache, unsigned int width, unsigned int height,
+                         ImageFrame *thisframe, ImageFrame *prevframe, ImageFrame *lastPreservedFrame )
 {
-  DALI_LOG_INFO( gGifLoadingLogFilter, Debug::Concise, "FlushFrames() START \n" );
-
-  // target is the amount of memory we want to be under for stored frames
-  int total = 0, target = 512 * 1024;
+  if( cache.capacity == 0u )
+  {
+    cache.capacity = std::max( MINIMUM_FRAME_CACHE_SIZE,
+                               static_cast<uint32_t>( DEFAULT_FRAME_CACHE_BYTES / ( width * height * sizeof( uint32_t ) ) ) );
+  }
 
-  // total up the amount of memory used by stored frames for this image
-  for( auto &&frame : animated.frames )
+  if( cache.freeBuffers.empty() && ( cache.allocated >= cache.capacity ) )
   {
-    if( frame.data )
+    for( auto iter = cache.decodedFrames.begin(); iter != cache.decodedFrames.end(); ++iter )
     {
-      total++;
+      ImageFrame *frame = FindFrame( animated, *iter );
+      if( (frame != prevframe) && (frame != lastPreservedFrame) )
+      {
+        cache.freeBuffers.push_back( frame->data );
+        frame->data = nullptr;
+        frame->loaded = false;
+        cache.decodedFrames.erase( iter );
+        break;
+      }
     }
   }
-  total *= ( width * height * sizeof( uint32_t ) );
 
-  DALI_LOG_INFO( gGifLoadingLogFilter, Debug::Concise, "Total used frame size: %d\n", total );
+  // If every cached frame is still needed, go over the capacity rather than fail
+  if( cache.freeBuffers.empty() )
+  {
+    thisframe->data = new uint32_t[ width * height ];
+    cache.allocated++;
+  }
+  else
+  {
+    thisframe->data = cache.freeBuffers.back();
+    cache.freeBuffers.pop_back();
+  }
+  cache.decodedFrames.push_back( thisframe->index );
+
+  DALI_LOG_INFO( gGifLoadingLogFilter, Debug::Concise, "AcquireFrameBuffer: frame %d, %u of %u buffers allocated\n",
+                 thisframe->index, cache.allocated, cache.capacity );
+}
 
-  // If we use more than target (512k) for frames - flush
-  if( total > target )
+/**
+ * @brief Delete the buffers of all the frames and the recycled buffers.
+ *
+ * @param[in] animated A structure containing GIF animation data
+ * @param[in] cache The frame cache
+ */
+void ReleaseFrameBuffers( GifAnimationData &animated, FrameCache &cache )
+{
+  for( auto &&frame : animated.frames )
   {
-    // Clean frames (except current and previous) until below target
-    for( auto &&frame : animated.frames )
-    {
-      if( (frame.index != thisframe->index) && (!prevframe || frame.index != prevframe->index) &&
-          (!lastPreservedFrame || frame.index != lastPreservedFrame->index) )
-      {
-        if( frame.data != nullptr )
-        {
-          delete[] frame.data;
-          frame.data = nullptr;
+    delete[] frame.data;
+    frame.data = nullptr;
+    frame.loaded = false;
+  }
+  for( auto &&buffer : cache.freeBuffers )
+  {
+    delete[] buffer;
+  }
+  cache.freeBuffers.clear();
+  cache.decodedFrames.clear();
+  cache.allocated = 0u;
+}
 
-          // subtract memory used and if below target - stop flush
-          total -= ( width * height * sizeof( uint32_t ) );
-          if( total < target )
-          {
-            break;
-          }
-        }
-      }
-    }
+/**
+ * @brief Get the area of the image a frame is drawn to, clipped to the image.
+ *
+ * @param[in] prop A ImageProperties structure containing information about gif data.
+ * @param[in] frameInfo A pointer pointing to Frame Information data
+ * @return The area, which is empty if the frame is drawn outside the image.
+ */
+Rect<int> GetFrameArea( const ImageProperties &prop, const FrameInfo *frameInfo )
+{
+  int xin = 0, yin = 0, x = 0, y = 0, w = 0, h = 0;
+  ClipCoordinates( prop.w, prop.h, &xin, &yin,
+                   frameInfo->x, frameInfo->y, frameInfo->w, frameInfo->h,
+                   &x, &y, &w, &h );
+  if( (w <= 0) || (h <= 0) )
+  {
+    return Rect<int>( 0, 0, 0, 0 );
+  }
+  return Rect<int>( x, y, w, h );
+}
+
+/**
+ * @brief Grow an area to cover another one too.
+ *
+ * @param[in,out] area The area to grow
+ * @param[in] other The area to cover
+ */
+void MergeArea( Rect<int> &area, const Rect<int> &other )
+{
+  if( (other.width <= 0) || (other.height <= 0) )
+  {
+    return;
+  }
+  if( (area.width <= 0) || (area.height <= 0) )
+  {
+    area = other;
+    return;
+  }
+  const int right = std::max( area.x + area.width, other.x + other.width );
+  const int bottom = std::max( area.y + area.height, other.y + other.height );
+  area.x = std::min( area.x, other.x );
+  area.y = std::min( area.y, other.y );
+  area.width = right - area.x;
+  area.height = bottom - area.y;
+}
+
+/**
+ * @brief Work out the area of the image which differs between a frame and the frame before it:
+ * the area the frame is drawn to, plus the area the previous frame is disposed of, which for
+ * DISPOSE_PREVIOUS is where the previous and last preserved frames were drawn.
+ *
+ * @param[in] animated A structure containing GIF animation data
+ * @param[in] prop A ImageProperties structure containing information about gif data.
+ * @param[in] index The index of the frame
+ * @return The area, which is the whole image for the first frame.
+ */
+Rect<int> GetUpdatedArea( const GifAnimationData &animated, const ImageProperties &prop, int index )
+{
+  const ImageFrame *frame = FindFrame( animated, index );
+  const ImageFrame *previousFrame = FindFrame( animated, index - 1 );
+  if( (!animated.animated) || (!frame) || (!previousFrame) )
+  {
+    return Rect<int>( 0, 0, prop.w, prop.h );
   }
 
-  DALI_LOG_INFO( gGifLoadingLogFilter, Debug::Concise, "FlushFrames() END \n" );
+  Rect<int> area = GetFrameArea( prop, &frame->info );
+  if( previousFrame->info.dispose == DISPOSE_BACKGROUND )
+  {
+    MergeArea( area, GetFrameArea( prop, &previousFrame->info ) );
+  }
+  else if( previousFrame->info.dispose == DISPOSE_PREVIOUS )
+  {
+    MergeArea( area, GetFrameArea( prop, &previousFrame->info ) );
+
+    const ImageFrame *lastPreservedFrame = FindLastPreservedFrame( animated, index );
+    if( lastPreservedFrame )
+    {
+      MergeArea( area, GetFrameArea( prop, &lastPreservedFrame->info ) );
+    }
+  }
+  return area;
 }
 
 /**
@@ -652,26 +825,37 @@ bool ReadHeader( LoaderInfo &loaderInfo,
       return false;
     }
 
-    if( fseek( fp, 0, SEEK_END ) <= -1 )
-    {
-      return false;
-    }
-
-    fileData.length = ftell( fp );
-    if( fileData.length <= -1 )
-    {
-      return false;
-    }
-
-    if( ( ! fseek( fp, 0, SEEK_SET ) ) )
+    // Map the file rather than copying it, so only the pages being decoded need to be resident
+    if( fileData.mappedFile.Map( fp ) )
     {
-      fileData.globalMap = reinterpret_cast<GifByteType*>( malloc(sizeof( GifByteType ) * fileData.length ) );
-      fileData.length = fread( fileData.globalMap, sizeof( GifByteType ), fileData.length, fp);
-      fileInfo.map = fileData.globalMap;
+      fileData.map = fileData.mappedFile.GetData();
+      fileData.length = fileData.mappedFile.GetSize();
+      fileInfo.map = fileData.map;
     }
     else
     {
-      return false;
+      if( fseek( fp, 0, SEEK_END ) <= -1 )
+      {
+        return false;
+      }
+
+      fileData.length = ftell( fp );
+      if( fileData.length <= -1 )
+      {
+        return false;
+      }
+
+      if( ( ! fseek( fp, 0, SEEK_SET ) ) )
+      {
+        fileData.globalMap = reinterpret_cast<GifByteType*>( malloc(sizeof( GifByteType ) * fileData.length ) );
+        fileData.length = fread( fileData.globalMap, sizeof( GifByteType ), fileData.length, fp);
+        fileData.map = fileData.globalMap;
+        fileInfo.map = fileData.map;
+      }
+      else
+      {
+        return false;
+      }
     }
   }
   else
@@ -697,7 +881,8 @@ bool ReadHeader( LoaderInfo &loaderInfo,
           {
             fileData.globalMap = reinterpret_cast<GifByteType*>( malloc(sizeof( GifByteType ) * blobSize ) );
             fileData.length = fread( fileData.globalMap, sizeof( GifByteType ), blobSize, fp);
-            fileInfo.map = fileData.globalMap;
+            fileData.map = fileData.globalMap;
+            fileInfo.map = fileData.map;
           }
           else
           {
@@ -894,6 +1079,7 @@ on_error: // jump here on any errors to clean up
  * @param[in] loaderInfo A LoaderInfo structure containing file descriptor and other data about GIF.
  * @param[in/out] prop A ImageProperties structure containing information about gif data.
  * @param[out] pixels A pointer to buffer which will contain all pixel data of the frame on return.
+ *                    For animated images, nullptr just decodes the frame into the frame cache.
  * @param[out] error Error code
  * @return The true or false whether reading was successful or not.
  */
@@ -925,6 +1111,7 @@ bool ReadNextFrame( LoaderInfo &loaderInfo, ImageProperties &prop, //  use for w
     if( (frame->loaded) && (frame->data) )
     {
       // frame is already there and decoded - jump to end
+      TouchFrame( loaderInfo.frameCache, index );
       goto on_ok;
     }
   }
@@ -938,7 +1125,7 @@ open_file:
   gif = loaderInfo.gif;
   if( !gif )
   {
-    loaderInfo.fileInfo.map = fileData.globalMap ;
+    loaderInfo.fileInfo.map = fileData.map;
     if( !loaderInfo.fileInfo.map )
     {
       LOADERR("LOAD_ERROR_CORRUPT_FILE");
@@ -1023,8 +1210,9 @@ open_file:
       {
         bool first = false;
 
-        // allocate it
-        thisFrame->data = new uint32_t[prop.w * prop.h];
+        // allocate it, keeping the frames this one is composed from
+        lastPreservedFrame = FindLastPreservedFrame( animated, imageNumber );
+        AcquireFrameBuffer( animated, loaderInfo.frameCache, prop.w, prop.h, thisFrame, previousFrame, lastPreservedFrame );
 
         if( !thisFrame->data )
         {
@@ -1061,22 +1249,12 @@ open_file:
           }
           else if( frameInfo->dispose == DISPOSE_PREVIOUS ) // GIF_DISPOSE_RESTORE
           {
-            int prevIndex = 2;
-            do
+            if( ( ! lastPreservedFrame ) || ( ! lastPreservedFrame->data ) )
             {
-              // Find last preserved frame.
-              lastPreservedFrame = FindFrame( animated, imageNumber - prevIndex );
-              if( ! lastPreservedFrame )
-              {
-                LOADERR( "LOAD_ERROR_LAST_PRESERVED_FRAME_NOT_FOUND" );
-              }
-              prevIndex++;
-            } while( lastPreservedFrame && lastPreservedFrame->info.dispose == DISPOSE_PREVIOUS );
-
-            if ( lastPreservedFrame )
-            {
-              memcpy( thisFrame->data, lastPreservedFrame->data, prop.w * prop.h * sizeof(uint32_t) );
+              LOADERR( "LOAD_ERROR_LAST_PRESERVED_FRAME_NOT_FOUND" );
             }
+
+            memcpy( thisFrame->data, lastPreservedFrame->data, prop.w * prop.h * sizeof(uint32_t) );
           }
         }
         // now draw this frame on top
@@ -1093,8 +1271,6 @@ open_file:
 
         // mark as loaded and done
         thisFrame->loaded = true;
-
-        FlushFrames( animated, prop.w, prop.h, thisFrame, previousFrame, lastPreservedFrame );
       }
       // if we have a frame BUT the image is not animated. different
       // path
@@ -1175,7 +1351,7 @@ on_ok:
 
   // if it was an animated image we need to copy the data to the
   // pixels for the image from the frame holding the data
-  if( animated.animated && frame->data )
+  if( pixels && animated.animated && frame->data )
   {
     memcpy( pixels, frame->data, prop.w * prop.h * sizeof( uint32_t ) );
   }
@@ -1189,8 +1365,10 @@ on_error: // jump here on any errors to clean up
 struct GifLoading::Impl
 {
 public:
-  Impl( const std::string& url, bool isLocalResource )
-  : mUrl( url )
+  Impl( const std::string& url, bool isLocalResource, uint32_t cacheSize )
+  : mUrl( url ),
+    mWaitingRequests( 0 ),
+    mTerminate( false )
   {
     loaderInfo.gif = nullptr;
     int error;
@@ -1198,17 +1376,45 @@ public:
     loaderInfo.fileData.isLocalResource = isLocalResource;
 
     ReadHeader( loaderInfo, imageProperties, &error );
+
+    // Streaming only makes sense for animations; a still image is decoded straight into the pixel data
+    if( ( cacheSize > 0u ) && loaderInfo.animated.animated )
+    {
+      loaderInfo.frameCache.capacity = std::max( cacheSize, MINIMUM_FRAME_CACHE_SIZE );
+      mDecodeAheadThread = std::thread( &Impl::DecodeAhead, this );
+    }
   }
 
-  // Moveable but not copyable
+  // Neither copyable nor moveable, as the decode ahead thread refers to this
 
   Impl( const Impl& ) = delete;
   Impl& operator=( const Impl& ) = delete;
-  Impl( Impl&& ) = default;
-  Impl& operator=( Impl&& ) = default;
+  Impl( Impl&& ) = delete;
+  Impl& operator=( Impl&& ) = delete;
 
   ~Impl()
   {
+    if( mDecodeAheadThread.joinable() )
+    {
+      {
+        std::lock_guard<std::mutex> lock( mMutex );
+        mTerminate = true;
+      }
+      mCondition.notify_one();
+      mDecodeAheadThread.join();
+    }
+
+    // Close the gif left open part way through the animation
+    if( loaderInfo.gif )
+    {
+#if (GIFLIB_MAJOR > 5) || ((GIFLIB_MAJOR == 5) && (GIFLIB_MINOR >= 1))
+      DGifCloseFile( loaderInfo.gif, NULL );
+#else
+      DGifCloseFile( loaderInfo.gif );
+#endif
+      loaderInfo.gif = nullptr;
+    }
+
     if( loaderInfo.fileData.globalMap  )
     {
       free( loaderInfo.fileData.globalMap );
@@ -1216,13 +1422,84 @@ public:
     }
 
     // Delete all image frames
-    for( auto &&frame : loaderInfo.animated.frames )
+    ReleaseFrameBuffers( loaderInfo.animated, loaderInfo.frameCache );
+  }
+
+  /**
+   * @brief Queue the frames due to be shown after the ones just loaded to be decoded in the background.
+   *
+   * As many frames are queued as are shown in the next DECODE_AHEAD_TIME, leaving room in the cache
+   * for the frames just loaded and the ones needed to compose the queued frames.
+   * @note mMutex must be locked.
+   * @param[in] frameIndex The index of the first frame to decode, counting from 0.
+   */
+  void QueueDecodeAhead( int frameIndex )
+  {
+    mDecodeAheadFrames.clear();
+    if( !mDecodeAheadThread.joinable() )
+    {
+      return;
+    }
+
+    const GifAnimationData &animated = loaderInfo.animated;
+    const int maximumFrames = std::min( static_cast<int>( loaderInfo.frameCache.capacity ) - 2, animated.frameCount - 1 );
+    uint32_t time = 0u;
+    for( int i = 0; ( i < maximumFrames ) && ( time < DECODE_AHEAD_TIME ); ++i )
+    {
+      const int index = 1 + ( (frameIndex + i) % animated.frameCount );
+      const ImageFrame *frame = FindFrame( animated, index );
+      if( !frame )
+      {
+        break;
+      }
+      mDecodeAheadFrames.push_back( index );
+      // frame delays are in 1/100ths of a sec
+      time += frame->info.delay * 10u;
+    }
+
+    if( !mDecodeAheadFrames.empty() )
     {
-      if( frame.data != nullptr )
+      mCondition.notify_one();
+    }
+  }
+
+  /**
+   * @brief Lock loaderInfo to load the frames asked for, dropping the frames queued to decode ahead.
+   *
+   * The decode ahead thread yields between frames while a request is waiting, so the
+   * request waits for at most the frame being decoded.
+   * @return The lock of mMutex.
+   */
+  std::unique_lock<std::mutex> LockForRequest()
+  {
+    ++mWaitingRequests;
+    std::unique_lock<std::mutex> lock( mMutex );
+    --mWaitingRequests;
+    mDecodeAheadFrames.clear();
+    return lock;
+  }
+
+  /**
+   * @brief The main loop of the decode ahead thread.
+   */
+  void DecodeAhead()
+  {
+    std::unique_lock<std::mutex> lock( mMutex );
+    while( true )
+    {
+      // Waiting releases the mutex, to any request between frames too
+      mCondition.wait( lock, [this]{ return mTerminate || ( !mDecodeAheadFrames.empty() && ( mWaitingRequests == 0 ) ); } );
+      if( mTerminate )
+      {
+        break;
+      }
+
+      int error;
+      loaderInfo.animated.currentFrame = mDecodeAheadFrames.front();
+      mDecodeAheadFrames.pop_front();
+      if( !ReadNextFrame( loaderInfo, imageProperties, nullptr, &error ) )
       {
-        // De-allocate memory of the frame data.
-        delete[] frame.data;
-        frame.data = nullptr;
+        mDecodeAheadFrames.clear();
       }
     }
   }
@@ -1230,6 +1507,13 @@ public:
   std::string mUrl;
   LoaderInfo loaderInfo;
   ImageProperties imageProperties;
+
+  std::mutex mMutex;                   ///< Protects loaderInfo once the decode ahead thread is running.
+  std::condition_variable mCondition;  ///< Signalled when frames are queued or the thread is stopping.
+  std::thread mDecodeAheadThread;      ///< Decodes queued frames into the frame cache, when streaming.
+  std::deque<int> mDecodeAheadFrames;  ///< The indices of the frames to decode ahead.
+  std::atomic<int> mWaitingRequests;   ///< The number of requests waiting for mMutex, which the decode ahead thread yields to.
+  bool mTerminate;                     ///< Set to stop the decode ahead thread.
 };
 
 std::unique_ptr<GifLoading> GifLoading::New( const std::string &url, bool isLocalResource )
@@ -1237,8 +1521,18 @@ std::unique_ptr<GifLoading> GifLoading::New( const std::string &url, bool isLoca
   return std::unique_ptr<GifLoading>( new GifLoading( url, isLocalResource ) );
 }
 
+std::unique_ptr<GifLoading> GifLoading::New( const std::string &url, bool isLocalResource, uint32_t cacheSize )
+{
+  return std::unique_ptr<GifLoading>( new GifLoading( url, isLocalResource, cacheSize ) );
+}
+
 GifLoading::GifLoading( const std::string &url, bool isLocalResource )
-: mImpl( new GifLoading::Impl( url, isLocalResource ) )
+: mImpl( new GifLoading::Impl( url, isLocalResource, 0u ) )
+{
+}
+
+GifLoading::GifLoading( const std::string &url, bool isLocalResource, uint32_t cacheSize )
+: mImpl( new GifLoading::Impl( url, isLocalResource, cacheSize ) )
 {
 }
 
@@ -1257,6 +1551,13 @@ bool GifLoading::LoadNextNFrames( int frameStartIndex, int count, std::vector<Da
 
   DALI_LOG_INFO( gGifLoadingLogFilter, Debug::Concise, "LoadNextNFrames( frameStartIndex:%d, count:%d )\n", frameStartIndex, count );
 
+  if( mImpl->loaderInfo.animated.frameCount <= 0 )
+  {
+    return false;
+  }
+
+  std::unique_lock<std::mutex> lock = mImpl->LockForRequest();
+
   for( int i = 0; i < count; ++i )
   {
     auto pixelBuffer = new unsigned char[ bufferSize ];
@@ -1265,14 +1566,99 @@ bool GifLoading::LoadNextNFrames( int frameStartIndex, int count, std::vector<Da
 
     if( ReadNextFrame( mImpl->loaderInfo, mImpl->imageProperties, pixelBuffer, &error ) )
     {
-      if( pixelBuffer )
+      pixelData.push_back( Dali::PixelData::New( pixelBuffer, bufferSize,
+                                                 mImpl->imageProperties.w, mImpl->imageProperties.h,
+                                                 Dali::Pixel::RGBA8888, Dali::PixelData::DELETE_ARRAY) );
+      ret = true;
+    }
+    else
+    {
+      delete[] pixelBuffer;
+    }
+  }
+
+  if( ret )
+  {
+    mImpl->QueueDecodeAhead( frameStartIndex + count );
+  }
+
+  return ret;
+}
+
+bool GifLoading::LoadNextNFrameUpdates( int frameStartIndex, int count, std::vector<Dali::PixelData> &updates,
+                                        std::vector<Dali::Rect<int>> &updatedAreas )
+{
+  const ImageProperties &prop = mImpl->imageProperties;
+  const GifAnimationData &animated = mImpl->loaderInfo.animated;
+
+  // A still image is decoded straight into a whole image sized buffer
+  if( !animated.animated )
+  {
+    const size_t previousCount = updates.size();
+    const bool ret = LoadNextNFrames( frameStartIndex, count, updates );
+    updatedAreas.insert( updatedAreas.end(), updates.size() - previousCount, Rect<int>( 0, 0, prop.w, prop.h ) );
+    return ret;
+  }
+
+  int error;
+  bool ret = false;
+  const size_t previousUpdateCount = updates.size();
+  const size_t previousAreaCount = updatedAreas.size();
+
+  DALI_LOG_INFO( gGifLoadingLogFilter, Debug::Concise, "LoadNextNFrameUpdates( frameStartIndex:%d, count:%d )\n", frameStartIndex, count );
+
+  std::unique_lock<std::mutex> lock = mImpl->LockForRequest();
+
+  for( int i = 0; i < count; ++i )
+  {
+    const int index = 1 + ( (frameStartIndex + i) % animated.frameCount );
+    mImpl->loaderInfo.animated.currentFrame = index;
+
+    // Compose the frame in the frame cache, then copy out the area which changed
+    const ImageFrame *frame = nullptr;
+    if( ReadNextFrame( mImpl->loaderInfo, mImpl->imageProperties, nullptr, &error ) )
+    {
+      frame = FindFrame( animated, index );
+    }
+    if( !frame || !frame->data )
+    {
+      // keep the updates in step with the frames asked for
+      updates.push_back( Dali::PixelData() );
+      updatedAreas.push_back( Rect<int>() );
+      continue;
+    }
+
+    const Rect<int> area = GetUpdatedArea( animated, prop, index );
+    if( (area.width <= 0) || (area.height <= 0) )
+    {
+      // nothing changed
+      updates.push_back( Dali::PixelData() );
+    }
+    else
+    {
+      const unsigned int rowSize = area.width * sizeof( uint32_t );
+      const unsigned int bufferSize = rowSize * area.height;
+      auto pixelBuffer = new unsigned char[ bufferSize ];
+      for( int y = 0; y < area.height; ++y )
       {
-        pixelData.push_back( Dali::PixelData::New( pixelBuffer, bufferSize,
-                                                   mImpl->imageProperties.w, mImpl->imageProperties.h,
-                                                   Dali::Pixel::RGBA8888, Dali::PixelData::DELETE_ARRAY) );
-        ret = true;
+        memcpy( pixelBuffer + y * rowSize, frame->data + ( area.y + y ) * prop.w + area.x, rowSize );
       }
+      updates.push_back( Dali::PixelData::New( pixelBuffer, bufferSize, area.width, area.height,
+                                               Dali::Pixel::RGBA8888, Dali::PixelData::DELETE_ARRAY ) );
     }
+    updatedAreas.push_back( area );
+    ret = true;
+  }
+
+  if( ret )
+  {
+    mImpl->QueueDecodeAhead( frameStartIndex + count );
+  }
+  else
+  {
+    // nothing decoded, so leave the vectors as they were
+    updates.resize( previousUpdateCount );
+    updatedAreas.resize( previousAreaCount );
   }
 
   return ret;
@@ -38,7 +38,13 @@ typedef Dali::Uint16Pair ImageDimensions;
  * data is actually needed.
  * Note, once the GIF has loaded, the undecoded data will reside in memory until this object
  * is released. (This is to speed up frame loads, which would otherwise have to re-acquire the
- * data from disk)
+ * data from disk) Local files are mapped rather than copied, so only the pages being decoded
+ * need to be resident.
+ *
+ * Decoded frames are cached to compose the following frames from. When created with a frame
+ * cache size, at most that many frames are kept decoded, their buffers are reused for later
+ * frames, and after each LoadNextNFrames() the frames due next are decoded in the background.
+ * This suits playing long animations a few frames at a time.
  */
 class DALI_ADAPTOR_API GifLoading
 {
@@ -52,6 +58,16 @@ public:
    */
   static std::unique_ptr<GifLoading> New( const std::string& url, bool isLocalResource );
 
+  /**
+   * Create a GifLoading which streams the frames of the gif through a bounded frame cache.
+   * @param[in] url The url of the gif image to load
+   * @param[in] isLocalResource The true or false whether this is a local resource.
+   * @param[in] cacheSize The maximum number of decoded frames to keep, raised to 3 if lower. 0 keeps as many
+   * as fit in a fixed memory budget and doesn't decode ahead, as New( url, isLocalResource ) does.
+   * @return A newly created GifLoading.
+   */
+  static std::unique_ptr<GifLoading> New( const std::string& url, bool isLocalResource, uint32_t cacheSize );
+
   /**
    * @brief Constructor
    *
@@ -61,6 +77,16 @@ public:
    */
   GifLoading( const std::string& url, bool isLocalResource );
 
+  /**
+   * @brief Constructor
+   *
+   * Construct a Loader with the given URL, which streams frames through a bounded frame cache
+   * @param[in] url The url of the gif image to load
+   * @param[in] isLocalResource The true or false whether this is a local resource.
+   * @param[in] cacheSize The maximum number of decoded frames to keep, or 0 for the default cache.
+   */
+  GifLoading( const std::string& url, bool isLocalResource, uint32_t cacheSize );
+
   // Moveable but not copyable
 
   GifLoading( const GifLoading& ) = delete;
@@ -85,6 +111,29 @@ public:
    */
   bool LoadNextNFrames( int frameStartIndex, int count, std::vector<Dali::PixelData>& pixelData );
 
+  /**
+   * @brief Load the next N Frames of the gif as the areas which changed from the frame before each.
+   *
+   * A frame usually only redraws part of the image. Instead of the whole image, this returns the
+   * pixels of the area which differs from the previous frame of the animation, so the texture
+   * showing that frame can be updated by uploading just the area, e.g. with
+   * Texture::Upload( update, 0u, 0u, area.x, area.y, area.width, area.height ).
+   * The area of the first frame, and of every frame of a still image, is the whole image.
+   * An empty PixelData handle and area are returned for a frame which changes nothing, and for a
+   * frame which fails to decode, so when this succeeds there is one update and one area per frame
+   * asked for.
+   *
+   * @note This function will load the entire gif into memory if not already loaded.
+   * @param[in] frameStartIndex The frame counter to start from. Will usually be the next frame
+   * after the previous invocation of this method, or 0 to start.
+   * @param[in] count The number of frames to load
+   * @param[out] updates The vector in which to return the pixels of the updated area of each frame
+   * @param[out] updatedAreas The vector in which to return the updated area of each frame
+   * @return True if the frame data was successfully loaded
+   */
+  bool LoadNextNFrameUpdates( int frameStartIndex, int count, std::vector<Dali::PixelData>& updates,
+                              std::vector<Dali::Rect<int>>& updatedAreas );
+
   /**
    * @brief Load all frames of an animated gif file.
    *
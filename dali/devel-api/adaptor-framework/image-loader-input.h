@@ -19,6 +19,7 @@
 
 // EXTERNAL INCLUDES
 #include <cstdio>
+#include <string>
 #include <dali/public-api/images/image-operations.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 #include <dali/integration-api/bitmap.h>
@@ -48,11 +49,15 @@ public:
    */
 struct Input
 {
-  Input( FILE* file, ScalingParameters scalingParameters = ScalingParameters(), bool reorientationRequested = true ) :
-    file(file), scalingParameters(scalingParameters), reorientationRequested(reorientationRequested) {}
+  Input( FILE* file, ScalingParameters scalingParameters = ScalingParameters(), bool reorientationRequested = true, bool metadataRequested = true,
+         const std::string& entryName = std::string() ) :
+    file(file), scalingParameters(scalingParameters), reorientationRequested(reorientationRequested), metadataRequested(metadataRequested),
+    entryName(entryName) {}
   FILE* file;
   ScalingParameters scalingParameters;
   bool reorientationRequested;
+  bool metadataRequested; ///< Whether the loader should provide the image metadata, such as EXIF fields, for PixelBuffer::GetMetadata()
+  std::string entryName;  ///< The name of the image to load when the file is an image archive, empty otherwise
 };
 
 
@@ -19,8 +19,12 @@
 
 // INTERNAL INCLUDES
 #include <dali/public-api/object/property-map.h>
+#include <dali/internal/imaging/common/image-archive.h>
 #include <dali/internal/imaging/common/image-loader.h>
+#include <dali/internal/imaging/common/pixel-buffer-impl.h>
+#include <dali/internal/imaging/common/pixel-buffer-pipeline.h>
 #include <dali/internal/imaging/common/file-download.h>
+#include <dali/internal/legacy/common/tizen-platform-abstraction.h>
 #include <dali/internal/system/common/file-reader.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 
@@ -36,15 +40,44 @@ const size_t MAXIMUM_DOWNLOAD_IMAGE_SIZE  = 50 * 1024 * 1024 ;
 }
 
 Devel::PixelBuffer LoadImageFromFile( const std::string& url, ImageDimensions size, FittingMode::Type fittingMode, SamplingMode::Type samplingMode, bool orientationCorrection )
+{
+  return LoadImageFromFile( url, size, fittingMode, samplingMode, orientationCorrection, Devel::PixelBuffer(), false, Pixel::INVALID );
+}
+
+Devel::PixelBuffer LoadImageFromFile( const std::string& url, ImageDimensions size, FittingMode::Type fittingMode, SamplingMode::Type samplingMode, bool orientationCorrection,
+                                      Devel::PixelBuffer mask, bool multiplyColorByAlpha, Pixel::Format pixelFormat )
 {
   Integration::BitmapResourceType resourceType( size, fittingMode, samplingMode, orientationCorrection );
 
+  // The steps run along with the crop for the fitting mode, in one traversal of the pixels:
+  Internal::Adaptor::PixelBufferPipeline pipeline;
+  if( mask )
+  {
+    pipeline.SetMask( &GetImplementation( mask ) );
+  }
+  if( multiplyColorByAlpha )
+  {
+    pipeline.SetMultiplyColorByAlpha();
+  }
+  if( pixelFormat != Pixel::INVALID )
+  {
+    pipeline.SetOutputFormat( pixelFormat );
+  }
+
+  // The url is split once, as finding whether it is of an image in an archive reads the status of the file:
+  const Internal::Platform::ImageArchive::Url archiveUrl( url );
+  Dali::Devel::PixelBuffer bitmap;
+  bool success = false;
+  if( TizenPlatform::ImageLoader::ConvertArchiveEntryToBitmap( resourceType, archiveUrl, pipeline, bitmap, success ) )
+  {
+    return success ? bitmap : Dali::Devel::PixelBuffer();
+  }
+
   Internal::Platform::FileReader fileReader( url );
   FILE * const fp = fileReader.GetFile();
   if( fp != NULL )
   {
-    Dali::Devel::PixelBuffer bitmap;
-    bool success = TizenPlatform::ImageLoader::ConvertStreamToBitmap( resourceType, url, fp, bitmap );
+    success = TizenPlatform::ImageLoader::ConvertStreamToBitmap( resourceType, archiveUrl, fp, pipeline, bitmap );
     if( success && bitmap )
     {
       return bitmap;
@@ -53,6 +86,84 @@ Devel::PixelBuffer LoadImageFromFile( const std::string& url, ImageDimensions si
   return Dali::Devel::PixelBuffer();
 }
 
+void LoadImagePlanesFromFile( const std::string& url, std::vector<Devel::PixelBuffer>& buffers, ImageDimensions size, FittingMode::Type fittingMode, SamplingMode::Type samplingMode, bool orientationCorrection )
+{
+  Integration::BitmapResourceType resourceType( size, fittingMode, samplingMode, orientationCorrection );
+
+  buffers.clear();
+
+  const Internal::Platform::ImageArchive::Url archiveUrl( url );
+  Internal::Platform::FileReader fileReader( archiveUrl.filePath );
+  FILE * const fp = fileReader.GetFile();
+  if( fp != NULL )
+  {
+    if( !TizenPlatform::ImageLoader::ConvertStreamToPlanes( resourceType, archiveUrl, fp, buffers ) )
+    {
+      buffers.clear();
+    }
+  }
+}
+
+Devel::PixelBuffer LoadImagePreviewFromFile( const std::string& url, bool orientationCorrection )
+{
+  const Internal::Platform::ImageArchive::Url archiveUrl( url );
+  Internal::Platform::FileReader fileReader( archiveUrl.filePath );
+  FILE * const fp = fileReader.GetFile();
+  if( fp != NULL )
+  {
+    Dali::Devel::PixelBuffer preview;
+    if( TizenPlatform::ImageLoader::ConvertStreamToPreview( archiveUrl, fp, orientationCorrection, preview ) )
+    {
+      return preview;
+    }
+  }
+  return Dali::Devel::PixelBuffer();
+}
+
+unsigned int LoadCompressedImageLevelsFromFile( const std::string& url, std::vector<Devel::PixelBuffer>& buffers )
+{
+  unsigned int numberOfLayers = 0u;
+  buffers.clear();
+
+  const Internal::Platform::ImageArchive::Url archiveUrl( url );
+  Internal::Platform::FileReader fileReader( archiveUrl.filePath );
+  FILE * const fp = fileReader.GetFile();
+  if( fp != NULL )
+  {
+    if( !TizenPlatform::ImageLoader::ConvertStreamToLevels( archiveUrl, fp, buffers, numberOfLayers ) )
+    {
+      buffers.clear();
+      numberOfLayers = 0u;
+    }
+  }
+  return numberOfLayers;
+}
+
+bool BuildImageArchive( const std::string& archivePath, const std::string& directory, const std::vector<std::string>& names )
+{
+  std::vector<std::pair<std::string, Devel::PixelBuffer>> images;
+  images.reserve( names.size() );
+
+  for( const std::string& name : names )
+  {
+    Devel::PixelBuffer image = LoadImageFromFile( directory + "/" + name );
+    if( !image )
+    {
+      DALI_LOG_ERROR( "Unable to load %s into image archive %s\n", name.c_str(), archivePath.c_str() );
+      return false;
+    }
+    images.push_back( std::make_pair( name, image ) );
+  }
+
+  Dali::Vector<uint8_t> archive;
+  if( !Internal::Platform::ImageArchive::Write( images, archive ) )
+  {
+    return false;
+  }
+
+  return TizenPlatform::SaveFile( archivePath, archive.Begin(), archive.Count() );
+}
+
 ImageDimensions GetClosestImageSize( const std::string& filename,
                                      ImageDimensions size,
                                      FittingMode::Type fittingMode,
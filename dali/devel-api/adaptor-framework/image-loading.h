@@ -19,6 +19,7 @@
 
 // EXTERNAL INCLUDES
 #include <string>
+#include <vector>
 #include <dali/public-api/images/image-operations.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 
@@ -48,6 +49,133 @@ DALI_ADAPTOR_API Devel::PixelBuffer LoadImageFromFile(
   SamplingMode::Type samplingMode = SamplingMode::BOX_THEN_LINEAR,
   bool orientationCorrection = true );
 
+/**
+ * @brief Load an image synchronously from local file, then mask it, multiply its colors by its alpha
+ * and convert it to another pixel format.
+ *
+ * The result is the same as loading the image with LoadImageFromFile(), then calling
+ * PixelBuffer::ApplyMask( mask, 1.0f, false ) and PixelBuffer::MultiplyColorByAlpha(), but the
+ * steps run along with the crop for the fitting mode, a few scanlines at a time. The pixels are
+ * read and written once rather than once for each step, and when neither the size nor the pixel
+ * format changes no second buffer is allocated.
+ *
+ * @note This method is thread safe, i.e. can be called from any thread.
+ *
+ * @param [in] url The URL of the image file to load.
+ * @param [in] size The width and height to fit the loaded image to, 0.0 means whole image
+ * @param [in] fittingMode The method used to fit the shape of the image before loading to the shape defined by the size parameter.
+ * @param [in] samplingMode The filtering method used when sampling pixels from the input image while fitting it to desired size.
+ * @param [in] orientationCorrection Reorient the image to respect any orientation metadata in its header.
+ * @param [in] mask The mask to apply, resized to the loaded image, or an empty handle for none.
+ * @param [in] multiplyColorByAlpha Whether to multiply the color channels by the alpha channel.
+ * @param [in] pixelFormat The pixel format to convert the image to, or Pixel::INVALID to keep the one it loads as.
+ * @return handle to the loaded PixelBuffer object or an empty handle in case loading failed.
+ */
+DALI_ADAPTOR_API Devel::PixelBuffer LoadImageFromFile(
+  const std::string& url,
+  ImageDimensions size,
+  FittingMode::Type fittingMode,
+  SamplingMode::Type samplingMode,
+  bool orientationCorrection,
+  Devel::PixelBuffer mask,
+  bool multiplyColorByAlpha,
+  Pixel::Format pixelFormat );
+
+/**
+ * @brief Load an image synchronously from local file, as its Y, Cb and Cr planes where possible.
+ *
+ * A JPEG image is decoded straight to three Pixel::L8 buffers, the luma plane
+ * followed by the two chroma planes, so that they can be uploaded as separate
+ * textures and converted to RGB in a shader. If the file subsamples the chroma,
+ * those planes are smaller than the luma plane, e.g. half the width and half the
+ * height for 4:2:0, which with the skipped colour conversion halves the memory
+ * the image takes up.
+ *
+ * The planes are only decoded when the JPEG decoder can scale the image to the
+ * size asked for by itself and the image doesn't need reorienting. Otherwise,
+ * and for every other format, a single buffer is loaded as by LoadImageFromFile.
+ *
+ * The buffers have no metadata.
+ *
+ * @note This method is thread safe, i.e. can be called from any thread.
+ *
+ * @param [in] url The URL of the image file to load.
+ * @param [out] buffers Set to the three planes, to a single loaded image, or cleared in case loading failed.
+ * @param [in] size The width and height to fit the loaded image to, 0.0 means whole image
+ * @param [in] fittingMode The method used to fit the shape of the image before loading to the shape defined by the size parameter.
+ * @param [in] samplingMode The filtering method used when sampling pixels from the input image while fitting it to desired size.
+ * @param [in] orientationCorrection Reorient the image to respect any orientation metadata in its header.
+ */
+DALI_ADAPTOR_API void LoadImagePlanesFromFile(
+  const std::string& url,
+  std::vector<Devel::PixelBuffer>& buffers,
+  ImageDimensions size = ImageDimensions( 0, 0 ),
+  FittingMode::Type fittingMode = FittingMode::DEFAULT,
+  SamplingMode::Type samplingMode = SamplingMode::BOX_THEN_LINEAR,
+  bool orientationCorrection = true );
+
+/**
+ * @brief Load a small preview of an image synchronously from local file.
+ *
+ * The preview takes a fraction of the time of loading the whole image, so it can
+ * be shown as a placeholder, e.g. while scrolling through a gallery, until the
+ * image loaded with LoadImageFromFile or asynchronously takes its place.
+ *
+ * For a JPEG image the thumbnail embedded in its EXIF data is loaded if there is
+ * one, otherwise the image is decoded at 1/8 of its size. The preview may not
+ * have the aspect ratio of the image, so should be stretched to fill the space
+ * the image will take. Other formats have no fast preview, so nothing is loaded.
+ *
+ * @note This method is thread safe, i.e. can be called from any thread.
+ *
+ * @param [in] url The URL of the image file to load.
+ * @param [in] orientationCorrection Reorient the preview to respect any orientation metadata in the header of the image.
+ * @return handle to the preview, or an empty handle in case the format has no fast preview or loading failed.
+ */
+DALI_ADAPTOR_API Devel::PixelBuffer LoadImagePreviewFromFile(
+  const std::string& url,
+  bool orientationCorrection = true );
+
+/**
+ * @brief Load every mipmap level and array layer of a compressed texture synchronously from local file.
+ *
+ * The buffers are ordered by mipmap level and then by array layer, so the layers
+ * of the full size image come first, followed by the layers of each smaller level.
+ * Each can be uploaded to its level and layer of a texture as it is.
+ *
+ * The compressed data of a KTX file isn't read, the buffers point into the file
+ * mapped into memory, which stays mapped until they have all been released. The
+ * data is only copied if a buffer is written to, or converted to a PixelData.
+ * Every other format is loaded as a single buffer as by LoadImageFromFile.
+ *
+ * @note This method is thread safe, i.e. can be called from any thread.
+ *
+ * @param [in] url The URL of the image file to load.
+ * @param [out] buffers Set to the images, or cleared in case loading failed.
+ * @return The number of array layers in each mipmap level, 1 if the texture isn't an array, or 0 in case loading failed.
+ */
+DALI_ADAPTOR_API unsigned int LoadCompressedImageLevelsFromFile(
+  const std::string& url,
+  std::vector<Devel::PixelBuffer>& buffers );
+
+/**
+ * @brief Pack images into an image archive, from which they load without being decoded.
+ *
+ * Each image is decoded, or read as it is if it is a compressed texture, and stored
+ * under its name. Loading an image from the archive, with a url of the form
+ * "icons.dpk#icon.png", then only looks up its name in the index of the archive,
+ * which is mapped into memory once for all the images in it.
+ *
+ * @param [in] archivePath The path of the archive to write, e.g. "icons.dpk".
+ * @param [in] directory The directory the images are in.
+ * @param [in] names The paths of the images relative to the directory, which are also their names in the archive.
+ * @return true if the archive was written, false if an image failed to load, or the archive couldn't be written.
+ */
+DALI_ADAPTOR_API bool BuildImageArchive(
+  const std::string& archivePath,
+  const std::string& directory,
+  const std::vector<std::string>& names );
+
 /**
  * @brief Determine the size of an image that LoadImageFromFile will provide when
  * given the same image loading parameters.
@@ -111,6 +111,11 @@ void PixelBuffer::ApplyGaussianBlur( const float blurRadius )
   GetImplementation(*this).ApplyGaussianBlur( blurRadius );
 }
 
+void PixelBuffer::ApplyApproximateGaussianBlur( const float blurRadius )
+{
+  GetImplementation(*this).ApplyApproximateGaussianBlur( blurRadius );
+}
+
 void PixelBuffer::Crop( uint16_t x, uint16_t y, uint16_t width, uint16_t height )
 {
   GetImplementation(*this).Crop( x, y, ImageDimensions( width, height ) );
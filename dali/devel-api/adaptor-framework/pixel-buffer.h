@@ -115,9 +115,14 @@ public:
   static PixelData Convert( PixelBuffer& pixelBuffer );
 
   /**
-   * Copy the data from this object into a new PixelData object, which could be
+   * Create a PixelData object sharing this object's data, which could be
    * used for uploading to a texture.
-   * @return a new PixelData object containing a copy of this pixel buffer's data.
+   *
+   * The data isn't copied. If this pixel buffer is written to through
+   * GetBuffer() while the PixelData is still in use, it is copied then, so
+   * the PixelData keeps the data it was created with. Compressed textures
+   * loaded from a mapped file are the exception, they are copied here.
+   * @return a PixelData object containing this pixel buffer's data.
    */
   Dali::PixelData CreatePixelData() const;
 
@@ -128,6 +133,10 @@ public:
    * @warning If there is no pixel buffer (e.g. this object has been
    * converted to a PixelData), this method will return NULL.
    *
+   * @note If the buffer is shared with a PixelData from CreatePixelData()
+   * which is still in use, or is in a mapped file, it is copied first. Use
+   * the const overload to read the buffer without copying it.
+   *
    * @SINCE_1_2.46
    * @return The pixel buffer, or NULL.
    */
@@ -195,6 +204,19 @@ public:
    */
   void ApplyGaussianBlur( const float blurRadius );
 
+  /**
+   * Apply an approximation of a Gaussian blur to this pixel data with the given radius.
+   *
+   * Three box blurs are applied in a row, so the cost per pixel doesn't grow with
+   * the radius. This is faster than ApplyGaussianBlur() for big radii, at the cost
+   * of slightly different results.
+   *
+   * @note A bigger radius will yield a blurrier image. Only works for pixel data in RGBA format.
+   *
+   * @param[in] blurRadius The radius for Gaussian blur. A value of 0 or negative value indicates no blur.
+   */
+  void ApplyApproximateGaussianBlur( const float blurRadius );
+
   /**
    * @brief Crops this buffer to the given crop rectangle.
    *
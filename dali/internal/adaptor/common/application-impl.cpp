@@ -29,6 +29,7 @@
 #include <dali/internal/system/common/command-line-options.h>
 #include <dali/internal/adaptor/common/framework.h>
 #include <dali/internal/adaptor/common/lifecycle-controller-impl.h>
+#include <dali/internal/imaging/common/buffer-pool.h>
 #include <dali/internal/window-system/common/window-impl.h>
 #include <dali/internal/window-system/common/window-render-surface.h>
 #include <dali/internal/window-system/common/render-surface-factory.h>
@@ -342,6 +343,12 @@ void Application::OnBatteryLow( Dali::DeviceStatus::Battery::Status status )
 
 void Application::OnMemoryLow( Dali::DeviceStatus::Memory::Status status )
 {
+  if( status != Dali::DeviceStatus::Memory::NORMAL )
+  {
+    // Give the free image buffers back to the system
+    Internal::Platform::BufferPool::Get().Trim( 0u );
+  }
+
   Dali::Application application(this);
   mMemoryLowSignal.Emit( application );
 
@@ -27,11 +27,224 @@ namespace Internal
 namespace Adaptor
 {
 
-void ApplyMaskToAlphaChannel( PixelBuffer& buffer, const PixelBuffer& mask )
+namespace
+{
+
+/**
+ * @brief Where an A8 mask keeps its alpha values.
+ */
+struct MaskA8
+{
+  static const unsigned int BYTES_PER_PIXEL = 1u;
+  static const unsigned int ALPHA_OFFSET = 0u;
+};
+
+/**
+ * @brief Where an L8 mask keeps the luminance values which are used as alpha.
+ */
+struct MaskL8
+{
+  static const unsigned int BYTES_PER_PIXEL = 1u;
+  static const unsigned int ALPHA_OFFSET = 0u;
+};
+
+/**
+ * @brief Where an RGBA8888 mask keeps its alpha values.
+ */
+struct MaskRGBA8888
+{
+  static const unsigned int BYTES_PER_PIXEL = 4u;
+  static const unsigned int ALPHA_OFFSET = 3u;
+};
+
+/**
+ * @brief The layouts of the color buffers which CreateNewMaskedBuffer() has fast paths for.
+ */
+struct ColorRGB888
+{
+  static const unsigned int BYTES_PER_PIXEL = 3u;
+  static const bool HAS_ALPHA = false;
+};
+
+struct ColorRGBA8888
+{
+  static const unsigned int BYTES_PER_PIXEL = 4u;
+  static const bool HAS_ALPHA = true;
+};
+
+/**
+ * @brief Multiply two 8 bit values, truncating the result as the generic path does.
+ */
+inline unsigned char MultiplyChannel( unsigned int value, unsigned int alpha )
+{
+  return static_cast<unsigned char>( value * alpha / 255u );
+}
+
+/**
+ * @brief A kernel that masks a buffer in place.
+ */
+typedef void (*ApplyMaskKernel)( unsigned char* pixels, const unsigned char* mask, unsigned int numPixels );
+
+/**
+ * @brief A kernel that writes a masked RGBA8888 copy of a buffer.
+ */
+typedef void (*CreateMaskedBufferKernel)( const unsigned char* pixels, const unsigned char* mask, unsigned char* destPixels, unsigned int numPixels );
+
+/**
+ * @brief Multiply the alpha channel of an RGBA8888 buffer by a mask.
+ */
+template< typename MaskFormat >
+void ApplyMaskToRGBA8888( unsigned char* pixels, const unsigned char* mask, unsigned int numPixels )
+{
+  const unsigned char* maskAlpha = mask + MaskFormat::ALPHA_OFFSET;
+  for( unsigned int i = 0; i < numPixels; ++i, pixels += 4u, maskAlpha += MaskFormat::BYTES_PER_PIXEL )
+  {
+    pixels[3] = MultiplyChannel( pixels[3], *maskAlpha );
+  }
+}
+
+/**
+ * @brief Multiply every channel of a premultiplied RGBA8888 buffer by a mask.
+ */
+template< typename MaskFormat >
+void ApplyMaskToPremultipliedRGBA8888( unsigned char* pixels, const unsigned char* mask, unsigned int numPixels )
+{
+  const unsigned char* maskAlpha = mask + MaskFormat::ALPHA_OFFSET;
+  for( unsigned int i = 0; i < numPixels; ++i, pixels += 4u, maskAlpha += MaskFormat::BYTES_PER_PIXEL )
+  {
+    const unsigned int alpha = *maskAlpha;
+    pixels[0] = MultiplyChannel( pixels[0], alpha );
+    pixels[1] = MultiplyChannel( pixels[1], alpha );
+    pixels[2] = MultiplyChannel( pixels[2], alpha );
+    pixels[3] = MultiplyChannel( pixels[3], alpha );
+  }
+}
+
+/**
+ * @brief Copy a buffer to RGBA8888, multiplying its alpha by a mask or taking the alpha from the mask if it has none.
+ */
+template< typename ColorFormat, typename MaskFormat >
+void CreateMaskedRGBA8888( const unsigned char* pixels, const unsigned char* mask, unsigned char* destPixels, unsigned int numPixels )
+{
+  const unsigned char* maskAlpha = mask + MaskFormat::ALPHA_OFFSET;
+  for( unsigned int i = 0; i < numPixels; ++i, pixels += ColorFormat::BYTES_PER_PIXEL, destPixels += 4u, maskAlpha += MaskFormat::BYTES_PER_PIXEL )
+  {
+    destPixels[0] = pixels[0];
+    destPixels[1] = pixels[1];
+    destPixels[2] = pixels[2];
+    destPixels[3] = ColorFormat::HAS_ALPHA ? MultiplyChannel( pixels[3], *maskAlpha ) : *maskAlpha;
+  }
+}
+
+/**
+ * @brief Pick the kernel for masking a buffer in place with a mask of the given format.
+ */
+template< typename MaskFormat >
+ApplyMaskKernel GetApplyMaskKernel( Pixel::Format format, bool preMultiplied )
+{
+  if( format == Pixel::RGBA8888 )
+  {
+    return preMultiplied ? &ApplyMaskToPremultipliedRGBA8888< MaskFormat > : &ApplyMaskToRGBA8888< MaskFormat >;
+  }
+  return nullptr;
+}
+
+/**
+ * @brief Pick the kernel for masking a buffer in place.
+ * @param[in] format The pixel format of the buffer
+ * @param[in] preMultiplied Whether the buffer's color channels are premultiplied by its alpha
+ * @param[in] maskFormat The pixel format of the mask
+ * @return The kernel, or nullptr if the generic path has to be used
+ */
+ApplyMaskKernel GetApplyMaskKernel( Pixel::Format format, bool preMultiplied, Pixel::Format maskFormat )
+{
+  switch( maskFormat )
+  {
+    case Pixel::A8:
+    {
+      return GetApplyMaskKernel< MaskA8 >( format, preMultiplied );
+    }
+    case Pixel::L8:
+    {
+      return GetApplyMaskKernel< MaskL8 >( format, preMultiplied );
+    }
+    case Pixel::RGBA8888:
+    {
+      return GetApplyMaskKernel< MaskRGBA8888 >( format, preMultiplied );
+    }
+    default:
+    {
+      return nullptr;
+    }
+  }
+}
+
+/**
+ * @brief Pick the kernel for writing a masked copy of a buffer with a mask of the given format.
+ */
+template< typename MaskFormat >
+CreateMaskedBufferKernel GetCreateMaskedBufferKernel( Pixel::Format format )
+{
+  switch( format )
+  {
+    case Pixel::RGB888:
+    {
+      return &CreateMaskedRGBA8888< ColorRGB888, MaskFormat >;
+    }
+    case Pixel::RGBA8888:
+    {
+      return &CreateMaskedRGBA8888< ColorRGBA8888, MaskFormat >;
+    }
+    default:
+    {
+      return nullptr;
+    }
+  }
+}
+
+/**
+ * @brief Pick the kernel for writing a masked copy of a buffer.
+ * @param[in] format The pixel format of the buffer
+ * @param[in] maskFormat The pixel format of the mask
+ * @return The kernel, or nullptr if the generic path has to be used
+ */
+CreateMaskedBufferKernel GetCreateMaskedBufferKernel( Pixel::Format format, Pixel::Format maskFormat )
 {
+  switch( maskFormat )
+  {
+    case Pixel::A8:
+    {
+      return GetCreateMaskedBufferKernel< MaskA8 >( format );
+    }
+    case Pixel::L8:
+    {
+      return GetCreateMaskedBufferKernel< MaskL8 >( format );
+    }
+    case Pixel::RGBA8888:
+    {
+      return GetCreateMaskedBufferKernel< MaskRGBA8888 >( format );
+    }
+    default:
+    {
+      return nullptr;
+    }
+  }
+}
+
+} // unnamed namespace
+
+void ApplyMaskToAlphaChannel( unsigned char* pixels, Pixel::Format format, bool preMultiplied, const unsigned char* mask, Pixel::Format maskFormat, unsigned int numPixels )
+{
+  ApplyMaskKernel kernel = GetApplyMaskKernel( format, preMultiplied, maskFormat );
+  if( kernel )
+  {
+    kernel( pixels, mask, numPixels );
+    return;
+  }
+
   int srcAlphaByteOffset=0;
   int srcAlphaMask=0;
-  Dali::Pixel::Format srcPixelFormat = mask.GetPixelFormat();
+  Dali::Pixel::Format srcPixelFormat = maskFormat;
 
   if( Pixel::HasAlpha(srcPixelFormat) )
   {
@@ -44,14 +257,14 @@ void ApplyMaskToAlphaChannel( PixelBuffer& buffer, const PixelBuffer& mask )
 
   int destAlphaByteOffset=0;
   int destAlphaMask=0;
-  Dali::Pixel::Format destPixelFormat = buffer.GetPixelFormat();
+  Dali::Pixel::Format destPixelFormat = format;
   Dali::Pixel::GetAlphaOffsetAndMask( destPixelFormat, destAlphaByteOffset, destAlphaMask );
 
   unsigned int srcBytesPerPixel = Dali::Pixel::GetBytesPerPixel( srcPixelFormat );
-  unsigned char* srcBuffer = mask.GetBuffer();
-  unsigned char* destBuffer = buffer.GetBuffer();
+  unsigned char* srcBuffer = const_cast<unsigned char*>( mask );
+  unsigned char* destBuffer = pixels;
 
-  unsigned int destBytesPerPixel = Dali::Pixel::GetBytesPerPixel( buffer.GetPixelFormat() );
+  unsigned int destBytesPerPixel = Dali::Pixel::GetBytesPerPixel( destPixelFormat );
 
   int srcOffset=0;
   int destOffset=0;
@@ -59,58 +272,66 @@ void ApplyMaskToAlphaChannel( PixelBuffer& buffer, const PixelBuffer& mask )
   float srcAlphaValue = 1.0f;
 
   // if image is premultiplied, the other channels of the image need to multiply by alpha.
-  if( buffer.IsAlphaPreMultiplied() )
+  if( preMultiplied )
   {
-    for( unsigned int row = 0; row < buffer.GetHeight(); ++row )
+    for( unsigned int i = 0; i < numPixels; ++i )
     {
-      for( unsigned int col = 0; col < buffer.GetWidth(); ++col )
-      {
-        auto srcAlpha      = ReadChannel( srcBuffer + srcOffset, srcPixelFormat, Adaptor::ALPHA);
-        auto destRed       = ReadChannel( destBuffer + destOffset, destPixelFormat, Adaptor::RED);
-        auto destGreen     = ReadChannel( destBuffer + destOffset, destPixelFormat, Adaptor::GREEN);
-        auto destBlue      = ReadChannel( destBuffer + destOffset, destPixelFormat, Adaptor::BLUE);
-        auto destLuminance = ReadChannel( destBuffer + destOffset, destPixelFormat, Adaptor::LUMINANCE);
-        auto destAlpha     = ReadChannel( destBuffer + destOffset, destPixelFormat, Adaptor::ALPHA);
-
-        WriteChannel( destBuffer + destOffset, destPixelFormat, Adaptor::RED, destRed*srcAlpha / 255 );
-        WriteChannel( destBuffer + destOffset, destPixelFormat, Adaptor::GREEN, destGreen*srcAlpha/255 );
-        WriteChannel( destBuffer + destOffset, destPixelFormat, Adaptor::BLUE, destBlue*srcAlpha/255 );
-        WriteChannel( destBuffer + destOffset, destPixelFormat, Adaptor::LUMINANCE, destLuminance*srcAlpha/255 );
-        WriteChannel( destBuffer + destOffset, destPixelFormat, Adaptor::ALPHA, destAlpha*srcAlpha/255 );
-
-        srcOffset  += srcBytesPerPixel;
-        destOffset += destBytesPerPixel;
-      }
+      // An L8 mask's luminance is used as its alpha, as in the non-premultiplied path
+      auto srcAlpha      = ReadChannel( srcBuffer + srcOffset, srcPixelFormat, ( srcPixelFormat == Pixel::L8 ) ? Adaptor::LUMINANCE : Adaptor::ALPHA );
+      auto destRed       = ReadChannel( destBuffer + destOffset, destPixelFormat, Adaptor::RED);
+      auto destGreen     = ReadChannel( destBuffer + destOffset, destPixelFormat, Adaptor::GREEN);
+      auto destBlue      = ReadChannel( destBuffer + destOffset, destPixelFormat, Adaptor::BLUE);
+      auto destLuminance = ReadChannel( destBuffer + destOffset, destPixelFormat, Adaptor::LUMINANCE);
+      auto destAlpha     = ReadChannel( destBuffer + destOffset, destPixelFormat, Adaptor::ALPHA);
+
+      WriteChannel( destBuffer + destOffset, destPixelFormat, Adaptor::RED, destRed*srcAlpha / 255 );
+      WriteChannel( destBuffer + destOffset, destPixelFormat, Adaptor::GREEN, destGreen*srcAlpha/255 );
+      WriteChannel( destBuffer + destOffset, destPixelFormat, Adaptor::BLUE, destBlue*srcAlpha/255 );
+      WriteChannel( destBuffer + destOffset, destPixelFormat, Adaptor::LUMINANCE, destLuminance*srcAlpha/255 );
+      WriteChannel( destBuffer + destOffset, destPixelFormat, Adaptor::ALPHA, destAlpha*srcAlpha/255 );
+
+      srcOffset  += srcBytesPerPixel;
+      destOffset += destBytesPerPixel;
     }
   }
   else
   {
-    for( unsigned int row = 0; row < buffer.GetHeight(); ++row )
+    for( unsigned int i = 0; i < numPixels; ++i )
     {
-      for( unsigned int col = 0; col < buffer.GetWidth(); ++col )
-      {
-        unsigned char alpha = srcBuffer[srcOffset + srcAlphaByteOffset] & srcAlphaMask;
-        srcAlphaValue = float(alpha)/255.0f;
-
-        unsigned char destAlpha = destBuffer[destOffset + destAlphaByteOffset] & destAlphaMask;
-        float destAlphaValue = Clamp(float(destAlpha) * srcAlphaValue, 0.0f, 255.0f);
-        destAlpha = destAlphaValue;
-        destBuffer[destOffset + destAlphaByteOffset] &= ~destAlphaMask;
-        destBuffer[destOffset + destAlphaByteOffset] |= ( destAlpha & destAlphaMask );
-
-        srcOffset  += srcBytesPerPixel;
-        destOffset += destBytesPerPixel;
-      }
+      unsigned char alpha = srcBuffer[srcOffset + srcAlphaByteOffset] & srcAlphaMask;
+      srcAlphaValue = float(alpha)/255.0f;
+
+      unsigned char destAlpha = destBuffer[destOffset + destAlphaByteOffset] & destAlphaMask;
+      float destAlphaValue = Clamp(float(destAlpha) * srcAlphaValue, 0.0f, 255.0f);
+      destAlpha = destAlphaValue;
+      destBuffer[destOffset + destAlphaByteOffset] &= ~destAlphaMask;
+      destBuffer[destOffset + destAlphaByteOffset] |= ( destAlpha & destAlphaMask );
+
+      srcOffset  += srcBytesPerPixel;
+      destOffset += destBytesPerPixel;
     }
   }
 }
 
-PixelBufferPtr CreateNewMaskedBuffer( const PixelBuffer& buffer, const PixelBuffer& mask )
+void ApplyMaskToAlphaChannel( PixelBuffer& buffer, const PixelBuffer& mask )
 {
+  ApplyMaskToAlphaChannel( buffer.GetBuffer(), buffer.GetPixelFormat(), buffer.IsAlphaPreMultiplied(),
+                           mask.GetConstBuffer(), mask.GetPixelFormat(), buffer.GetWidth() * buffer.GetHeight() );
+}
+
+void CreateMaskedPixels( const unsigned char* pixels, Pixel::Format format, const unsigned char* mask, Pixel::Format maskFormat, unsigned char* destPixels, unsigned int numPixels )
+{
+  CreateMaskedBufferKernel kernel = GetCreateMaskedBufferKernel( format, maskFormat );
+  if( kernel )
+  {
+    kernel( pixels, mask, destPixels, numPixels );
+    return;
+  }
+
   // Set up source alpha offsets
   int srcAlphaByteOffset=0;
   int srcAlphaMask=0;
-  Dali::Pixel::Format srcPixelFormat = mask.GetPixelFormat();
+  Dali::Pixel::Format srcPixelFormat = maskFormat;
 
   if( Pixel::HasAlpha(srcPixelFormat) )
   {
@@ -122,10 +343,10 @@ PixelBufferPtr CreateNewMaskedBuffer( const PixelBuffer& buffer, const PixelBuff
   }
 
   unsigned int srcBytesPerPixel = Dali::Pixel::GetBytesPerPixel( srcPixelFormat );
-  unsigned char* srcBuffer = mask.GetBuffer();
+  const unsigned char* srcBuffer = mask;
 
   // Set up source color offsets
-  Dali::Pixel::Format srcColorPixelFormat = buffer.GetPixelFormat();
+  Dali::Pixel::Format srcColorPixelFormat = format;
   unsigned int srcColorBytesPerPixel = Dali::Pixel::GetBytesPerPixel( srcColorPixelFormat );
 
   // Setup destination offsets
@@ -135,48 +356,49 @@ PixelBufferPtr CreateNewMaskedBuffer( const PixelBuffer& buffer, const PixelBuff
   int destAlphaMask=0;
   Dali::Pixel::GetAlphaOffsetAndMask( destPixelFormat, destAlphaByteOffset, destAlphaMask );
 
-  PixelBufferPtr newPixelBuffer = PixelBuffer::New( buffer.GetWidth(), buffer.GetHeight(),
-                                                    destPixelFormat );
-  unsigned char* destBuffer = newPixelBuffer->GetBuffer();
-  unsigned char* oldBuffer = buffer.GetBuffer();
+  unsigned char* destBuffer = destPixels;
+  unsigned char* oldBuffer = const_cast<unsigned char*>( pixels );
 
   int srcAlphaOffset=0;
   int srcColorOffset=0;
   int destOffset=0;
-  bool hasAlpha = Dali::Pixel::HasAlpha(buffer.GetPixelFormat());
+  bool hasAlpha = Dali::Pixel::HasAlpha( format );
 
   float srcAlphaValue = 1.0f;
   unsigned char destAlpha = 0;
 
-  for( unsigned int row = 0; row < buffer.GetHeight(); ++row )
+  for( unsigned int i = 0; i < numPixels; ++i )
   {
-    for( unsigned int col = 0; col < buffer.GetWidth(); ++col )
-    {
-      unsigned char alpha = srcBuffer[srcAlphaOffset + srcAlphaByteOffset] & srcAlphaMask;
-      srcAlphaValue = float(alpha)/255.0f;
+    unsigned char alpha = srcBuffer[srcAlphaOffset + srcAlphaByteOffset] & srcAlphaMask;
+    srcAlphaValue = float(alpha)/255.0f;
 
-      ConvertColorChannelsToRGBA8888(oldBuffer, srcColorOffset, srcColorPixelFormat, destBuffer, destOffset );
+    ConvertColorChannelsToRGBA8888(oldBuffer, srcColorOffset, srcColorPixelFormat, destBuffer, destOffset );
 
-      if( hasAlpha )
-      {
-        destAlpha = ConvertAlphaChannelToA8( oldBuffer, srcColorOffset, srcColorPixelFormat );
-        float destAlphaValue = Clamp(float(destAlpha) * srcAlphaValue, 0.0f, 255.0f);
-        destAlpha = destAlphaValue;
-      }
-      else
-      {
-        destAlpha = floorf(Clamp(srcAlphaValue * 255.0f, 0.0f, 255.0f));
-      }
+    if( hasAlpha )
+    {
+      destAlpha = ConvertAlphaChannelToA8( oldBuffer, srcColorOffset, srcColorPixelFormat );
+      float destAlphaValue = Clamp(float(destAlpha) * srcAlphaValue, 0.0f, 255.0f);
+      destAlpha = destAlphaValue;
+    }
+    else
+    {
+      destAlpha = floorf(Clamp(srcAlphaValue * 255.0f, 0.0f, 255.0f));
+    }
 
-      destBuffer[destOffset + destAlphaByteOffset] &= ~destAlphaMask;
-      destBuffer[destOffset + destAlphaByteOffset] |= ( destAlpha & destAlphaMask );
+    destBuffer[destOffset + destAlphaByteOffset] &= ~destAlphaMask;
+    destBuffer[destOffset + destAlphaByteOffset] |= ( destAlpha & destAlphaMask );
 
-      srcColorOffset += srcColorBytesPerPixel;
-      srcAlphaOffset += srcBytesPerPixel;
-      destOffset += destBytesPerPixel;
-    }
+    srcColorOffset += srcColorBytesPerPixel;
+    srcAlphaOffset += srcBytesPerPixel;
+    destOffset += destBytesPerPixel;
   }
+}
 
+PixelBufferPtr CreateNewMaskedBuffer( const PixelBuffer& buffer, const PixelBuffer& mask )
+{
+  PixelBufferPtr newPixelBuffer = PixelBuffer::New( buffer.GetWidth(), buffer.GetHeight(), Pixel::RGBA8888 );
+  CreateMaskedPixels( buffer.GetConstBuffer(), buffer.GetPixelFormat(), mask.GetConstBuffer(), mask.GetPixelFormat(),
+                      newPixelBuffer->GetBuffer(), buffer.GetWidth() * buffer.GetHeight() );
   return newPixelBuffer;
 }
 
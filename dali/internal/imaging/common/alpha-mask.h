@@ -32,6 +32,17 @@ namespace Adaptor
  */
 void ApplyMaskToAlphaChannel( PixelBuffer& buffer, const PixelBuffer& mask );
 
+/**
+ * Apply the mask to the alpha channel of a run of pixels
+ * @param[in,out] pixels The pixels to apply the mask to
+ * @param[in] format The pixel format of the pixels
+ * @param[in] preMultiplied Whether the color channels of the pixels are premultiplied by their alpha
+ * @param[in] mask The mask values for the pixels
+ * @param[in] maskFormat The pixel format of the mask
+ * @param[in] numPixels The number of pixels to mask
+ */
+void ApplyMaskToAlphaChannel( unsigned char* pixels, Pixel::Format format, bool preMultiplied, const unsigned char* mask, Pixel::Format maskFormat, unsigned int numPixels );
+
 /**
  * Create a new PixelBuffer with an alpha channel large enough to handle the alpha from
  * the mask, converting the color values to the new size, and either multiplying the mask's
@@ -44,6 +55,19 @@ void ApplyMaskToAlphaChannel( PixelBuffer& buffer, const PixelBuffer& mask );
  */
 PixelBufferPtr CreateNewMaskedBuffer( const PixelBuffer& buffer, const PixelBuffer& mask );
 
+/**
+ * Write a run of pixels as RGBA8888, either multiplying the mask's alpha into their
+ * alpha value or using the mask's alpha value as their alpha, as CreateNewMaskedBuffer() does.
+ *
+ * @param[in] pixels The pixels to apply the mask to
+ * @param[in] format The pixel format of the pixels
+ * @param[in] mask The mask values for the pixels
+ * @param[in] maskFormat The pixel format of the mask
+ * @param[out] destPixels The masked RGBA8888 pixels. Must not overlap @p pixels.
+ * @param[in] numPixels The number of pixels to mask
+ */
+void CreateMaskedPixels( const unsigned char* pixels, Pixel::Format format, const unsigned char* mask, Pixel::Format maskFormat, unsigned char* destPixels, unsigned int numPixels );
+
 } //namespace Adaptor
 } //namespace Internal
 } //namespace Dali
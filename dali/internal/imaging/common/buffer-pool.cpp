@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/common/buffer-pool.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+namespace
+{
+
+/**
+ * @brief The capacity of the size class a buffer falls in.
+ *
+ * There are four classes to each power of two, so a buffer is rounded up by at
+ * most a quarter of its size.
+ * @param[in] size The size of the buffer, at least MINIMUM_POOLED_BUFFER_SIZE.
+ * @return The capacity of its size class.
+ */
+std::size_t GetSizeClassCapacity( std::size_t size )
+{
+  std::size_t powerOfTwo = MINIMUM_POOLED_BUFFER_SIZE;
+  while( powerOfTwo <= size / 2u )
+  {
+    powerOfTwo *= 2u;
+  }
+  const std::size_t step = powerOfTwo / 4u;
+  return ( size + step - 1u ) / step * step;
+}
+
+/**
+ * @brief Free a list of buffers.
+ */
+void FreeBuffers( std::vector< uint8_t* >& buffers )
+{
+  for( auto buffer : buffers )
+  {
+    free( buffer );
+  }
+}
+
+} // unnamed namespace
+
+BufferPool& BufferPool::Get()
+{
+  static BufferPool pool;
+  return pool;
+}
+
+BufferPool::BufferPool()
+: mFreeBuffers(),
+  mAllocated(),
+  mNumAllocated( 0u ),
+  mMemoryLimit( 0u ),
+  mFreeBytes( 0u ),
+  mHits( 0u ),
+  mMisses( 0u ),
+  mMutex()
+{
+}
+
+BufferPool::~BufferPool()
+{
+  for( auto&& freeBuffer : mFreeBuffers )
+  {
+    free( freeBuffer.buffer );
+  }
+}
+
+void BufferPool::SetMemoryLimit( std::size_t memoryLimit )
+{
+  std::vector< uint8_t* > evicted;
+  {
+    std::lock_guard< std::mutex > lock( mMutex );
+    mMemoryLimit = memoryLimit;
+    Evict( memoryLimit, evicted );
+  }
+  FreeBuffers( evicted );
+}
+
+std::size_t BufferPool::GetMemoryLimit() const
+{
+  return mMemoryLimit;
+}
+
+uint8_t* BufferPool::Allocate( std::size_t size )
+{
+  if( size < MINIMUM_POOLED_BUFFER_SIZE || 0u == mMemoryLimit )
+  {
+    return static_cast< uint8_t* >( malloc( size ) );
+  }
+
+  const std::size_t capacity = GetSizeClassCapacity( size );
+  {
+    std::lock_guard< std::mutex > lock( mMutex );
+    for( auto iter = mFreeBuffers.begin(); iter != mFreeBuffers.end(); ++iter )
+    {
+      if( iter->capacity == capacity )
+      {
+        uint8_t* const buffer = iter->buffer;
+        mFreeBytes -= capacity;
+        mFreeBuffers.erase( iter );
+        mAllocated[buffer] = capacity;
+        ++mNumAllocated;
+        ++mHits;
+        return buffer;
+      }
+    }
+    ++mMisses;
+  }
+
+  // Allocate outside the lock, as the pages of a large buffer may be mapped in here:
+  uint8_t* const buffer = static_cast< uint8_t* >( malloc( capacity ) );
+  if( buffer )
+  {
+    std::lock_guard< std::mutex > lock( mMutex );
+    mAllocated[buffer] = capacity;
+    ++mNumAllocated;
+  }
+  return buffer;
+}
+
+void BufferPool::Release( uint8_t* buffer )
+{
+  if( nullptr == buffer )
+  {
+    return;
+  }
+
+  if( 0u != mNumAllocated )
+  {
+    std::vector< uint8_t* > evicted;
+    {
+      std::lock_guard< std::mutex > lock( mMutex );
+      auto iter = mAllocated.find( buffer );
+      if( iter != mAllocated.end() )
+      {
+        const std::size_t capacity = iter->second;
+        mAllocated.erase( iter );
+        --mNumAllocated;
+
+        if( capacity <= mMemoryLimit )
+        {
+          FreeBuffer freeBuffer = { buffer, capacity };
+          mFreeBuffers.push_front( freeBuffer );
+          mFreeBytes += capacity;
+          Evict( mMemoryLimit, evicted );
+          buffer = nullptr;
+        }
+      }
+    }
+    FreeBuffers( evicted );
+  }
+
+  free( buffer );
+}
+
+void BufferPool::Detach( uint8_t* buffer )
+{
+  if( nullptr != buffer && 0u != mNumAllocated )
+  {
+    std::lock_guard< std::mutex > lock( mMutex );
+    if( mAllocated.erase( buffer ) > 0u )
+    {
+      --mNumAllocated;
+    }
+  }
+}
+
+bool BufferPool::IsPooled( const uint8_t* buffer ) const
+{
+  if( nullptr == buffer || 0u == mNumAllocated )
+  {
+    return false;
+  }
+  std::lock_guard< std::mutex > lock( mMutex );
+  return mAllocated.find( buffer ) != mAllocated.end();
+}
+
+void BufferPool::Trim( std::size_t memoryLimit )
+{
+  std::vector< uint8_t* > evicted;
+  {
+    std::lock_guard< std::mutex > lock( mMutex );
+    Evict( memoryLimit, evicted );
+  }
+  FreeBuffers( evicted );
+}
+
+BufferPool::Statistics BufferPool::GetStatistics() const
+{
+  std::lock_guard< std::mutex > lock( mMutex );
+  Statistics statistics = { mHits, mMisses, mFreeBuffers.size(), mFreeBytes };
+  return statistics;
+}
+
+void BufferPool::ResetStatistics()
+{
+  std::lock_guard< std::mutex > lock( mMutex );
+  mHits = 0u;
+  mMisses = 0u;
+}
+
+void BufferPool::Evict( std::size_t memoryLimit, std::vector< uint8_t* >& evicted )
+{
+  while( mFreeBytes > memoryLimit && !mFreeBuffers.empty() )
+  {
+    evicted.push_back( mFreeBuffers.back().buffer );
+    mFreeBytes -= mFreeBuffers.back().capacity;
+    mFreeBuffers.pop_back();
+  }
+}
+
+PooledBuffer::PooledBuffer()
+: mBuffer( nullptr ),
+  mSize( 0u )
+{
+}
+
+PooledBuffer::PooledBuffer( std::size_t size )
+: mBuffer( nullptr ),
+  mSize( 0u )
+{
+  Resize( size );
+}
+
+PooledBuffer::~PooledBuffer()
+{
+  BufferPool::Get().Release( mBuffer );
+}
+
+void PooledBuffer::Clear()
+{
+  BufferPool::Get().Release( mBuffer );
+  mBuffer = nullptr;
+  mSize = 0u;
+}
+
+void PooledBuffer::Resize( std::size_t size )
+{
+  if( size <= mSize )
+  {
+    mSize = size;
+    return;
+  }
+
+  uint8_t* const buffer = BufferPool::Get().Allocate( size );
+  if( nullptr == buffer )
+  {
+    throw std::bad_alloc();
+  }
+  if( mSize > 0u )
+  {
+    memcpy( buffer, mBuffer, mSize );
+  }
+  BufferPool::Get().Release( mBuffer );
+  mBuffer = buffer;
+  mSize = size;
+}
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Dali
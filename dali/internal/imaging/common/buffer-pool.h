@@ -0,0 +1,256 @@
+#ifndef DALI_INTERNAL_PLATFORM_BUFFER_POOL_H
+#define DALI_INTERNAL_PLATFORM_BUFFER_POOL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+/**
+ * @brief The smallest buffer kept by the pool, in bytes.
+ *
+ * malloc() already recycles smaller blocks cheaply. Larger ones are mapped and
+ * unmapped by the C library on every allocation, which faults in every page.
+ */
+const std::size_t MINIMUM_POOLED_BUFFER_SIZE = 64u * 1024u;
+
+/**
+ * @brief A process-wide pool of the large buffers images are decoded and processed in.
+ *
+ * Freed buffers are kept in size classes, four to each power of two, and handed
+ * out again for any later request in the same class. Images of the same size,
+ * such as the thumbnails of a scrolling gallery, then reuse the same memory
+ * instead of going back to the system each time.
+ *
+ * The pool is disabled until SetMemoryLimit() is called. The least recently
+ * freed buffers are given back to the system to keep the free buffers within
+ * the limit.
+ *
+ * Buffers are allocated with malloc(), so ownership of one may be handed to
+ * code which calls free() on it, such as PixelData, after calling Detach().
+ * Release() frees buffers the pool didn't allocate, so any malloc() buffer
+ * may be passed to it.
+ */
+class BufferPool
+{
+public:
+
+  /**
+   * @brief Counts of how well the pool is doing.
+   */
+  struct Statistics
+  {
+    std::size_t hits;          ///< Allocations served with a free buffer from the pool.
+    std::size_t misses;        ///< Allocations of a pooled size which had to call malloc().
+    std::size_t freeBuffers;   ///< The number of free buffers held by the pool.
+    std::size_t freeBytes;     ///< The memory held by the free buffers, in bytes.
+  };
+
+  /**
+   * @brief Get the process-wide pool.
+   * @return The buffer pool.
+   */
+  static BufferPool& Get();
+
+  /**
+   * @brief Set the most memory the free buffers in the pool may hold.
+   *
+   * Free buffers are given back to the system, least recently freed first, until
+   * the pool is within the limit.
+   * @param[in] memoryLimit The limit in bytes. Zero, the default, disables the pool.
+   */
+  void SetMemoryLimit( std::size_t memoryLimit );
+
+  /**
+   * @brief Get the most memory the free buffers in the pool may hold.
+   * @return The limit in bytes. Zero if the pool is disabled.
+   */
+  std::size_t GetMemoryLimit() const;
+
+  /**
+   * @brief Allocate a buffer, reusing a free one of the same size class if there is one.
+   * @param[in] size The size of the buffer in bytes.
+   * @return The buffer, or nullptr if it couldn't be allocated. Its contents are undefined.
+   */
+  uint8_t* Allocate( std::size_t size );
+
+  /**
+   * @brief Give a buffer back to the pool.
+   *
+   * The buffer is kept for reuse if it came from the pool and fits within the
+   * memory limit, otherwise it is freed.
+   * @param[in] buffer A buffer from Allocate() or malloc(). May be nullptr.
+   */
+  void Release( uint8_t* buffer );
+
+  /**
+   * @brief Stop tracking a buffer which is about to be freed with free(), or reallocated.
+   * @param[in] buffer A buffer from Allocate(). Others are ignored.
+   */
+  void Detach( uint8_t* buffer );
+
+  /**
+   * @brief Whether a buffer was allocated from the pool and will be kept by Release().
+   * @param[in] buffer The buffer.
+   * @return true if the pool is tracking the buffer.
+   */
+  bool IsPooled( const uint8_t* buffer ) const;
+
+  /**
+   * @brief Give free buffers back to the system, least recently freed first.
+   * @param[in] memoryLimit The most memory the free buffers may hold afterwards. Zero frees them all.
+   */
+  void Trim( std::size_t memoryLimit );
+
+  /**
+   * @brief Get the hit and miss counts, and the memory held by the pool.
+   * @return The statistics.
+   */
+  Statistics GetStatistics() const;
+
+  /**
+   * @brief Reset the hit and miss counts to zero.
+   */
+  void ResetStatistics();
+
+private:
+
+  /**
+   * @brief Constructor.
+   */
+  BufferPool();
+
+  /**
+   * @brief Destructor. Frees the free buffers.
+   */
+  ~BufferPool();
+
+  /**
+   * @brief Take free buffers out of the pool until they hold at most memoryLimit bytes. The mutex must be held.
+   * @param[in] memoryLimit The most memory the free buffers may hold.
+   * @param[in,out] evicted The buffers taken out are appended, to be freed once the mutex is released.
+   */
+  void Evict( std::size_t memoryLimit, std::vector< uint8_t* >& evicted );
+
+  // Undefined
+  BufferPool( const BufferPool& );
+  BufferPool& operator=( const BufferPool& );
+
+private:
+
+  struct FreeBuffer
+  {
+    uint8_t*    buffer;   ///< The buffer.
+    std::size_t capacity; ///< The capacity of its size class.
+  };
+
+  std::list< FreeBuffer >                           mFreeBuffers;  ///< The free buffers, most recently freed first.
+  std::unordered_map< const uint8_t*, std::size_t > mAllocated;    ///< The capacity of each buffer handed out by Allocate().
+  std::atomic< std::size_t >                        mNumAllocated; ///< The size of mAllocated, so Release() can skip the lock when it is empty.
+  std::atomic< std::size_t >                        mMemoryLimit;  ///< The most memory the free buffers may hold.
+  std::size_t                                       mFreeBytes;    ///< The memory held by the free buffers.
+  std::size_t                                       mHits;         ///< Allocations served from the pool.
+  std::size_t                                       mMisses;       ///< Allocations of a pooled size which called malloc().
+  mutable std::mutex                                mMutex;        ///< Protects the pool, which is used from the image loading and worker threads.
+};
+
+/**
+ * @brief A buffer from the BufferPool which is released when it goes out of scope.
+ *
+ * Stands in for a Dali::Vector<uint8_t> used as a scratch buffer. Like it,
+ * Resize() throws std::bad_alloc if the memory can't be allocated.
+ */
+class PooledBuffer
+{
+public:
+
+  /**
+   * @brief Create an empty buffer.
+   */
+  PooledBuffer();
+
+  /**
+   * @brief Create a buffer of the given size.
+   * @param[in] size The size in bytes.
+   */
+  explicit PooledBuffer( std::size_t size );
+
+  /**
+   * @brief Destructor. Releases the buffer to the pool.
+   */
+  ~PooledBuffer();
+
+  /**
+   * @brief Release the buffer to the pool, leaving this empty.
+   */
+  void Clear();
+
+  /**
+   * @brief Change the size of the buffer, keeping the contents which fit.
+   * @param[in] size The new size in bytes.
+   */
+  void Resize( std::size_t size );
+
+  /**
+   * @brief Get the start of the buffer.
+   * @return The buffer, or nullptr if it is empty.
+   */
+  uint8_t* Begin() const
+  {
+    return mBuffer;
+  }
+
+  /**
+   * @brief Get the size of the buffer.
+   * @return The size in bytes.
+   */
+  std::size_t Count() const
+  {
+    return mSize;
+  }
+
+private:
+
+  // Undefined
+  PooledBuffer( const PooledBuffer& );
+  PooledBuffer& operator=( const PooledBuffer& );
+
+private:
+
+  uint8_t*    mBuffer; ///< The buffer, or nullptr.
+  std::size_t mSize;   ///< The size of the buffer in bytes.
+};
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Dali
+
+#endif // DALI_INTERNAL_PLATFORM_BUFFER_POOL_H
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/common/cpu-features.h>
+
+// EXTERNAL INCLUDES
+#include <atomic>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+namespace
+{
+
+std::atomic<unsigned int> gCpuFeatureMask( CPU_FEATURE_ALL ); ///< The features client code has allowed us to use.
+
+/**
+ * @brief Queries the processor for the extensions we have kernels for.
+ */
+unsigned int DetectCpuFeatures()
+{
+  unsigned int features = CPU_FEATURE_NONE;
+
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+  __builtin_cpu_init();
+  if( __builtin_cpu_supports( "sse2" ) )
+  {
+    features |= CPU_FEATURE_SSE2;
+  }
+  if( __builtin_cpu_supports( "ssse3" ) )
+  {
+    features |= CPU_FEATURE_SSSE3;
+  }
+  if( __builtin_cpu_supports( "avx2" ) )
+  {
+    features |= CPU_FEATURE_AVX2;
+  }
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+  // When the compiler targets NEON the whole binary already depends on it.
+  features |= CPU_FEATURE_NEON;
+#endif
+
+  return features;
+}
+
+} // unnamed namespace
+
+unsigned int GetCpuFeatures()
+{
+  static const unsigned int detectedFeatures = DetectCpuFeatures();
+  return detectedFeatures & gCpuFeatureMask.load( std::memory_order_relaxed );
+}
+
+bool HasCpuFeature( CpuFeature feature )
+{
+  return ( GetCpuFeatures() & feature ) == static_cast<unsigned int>( feature );
+}
+
+void SetCpuFeatureMask( unsigned int mask )
+{
+  gCpuFeatureMask.store( mask, std::memory_order_relaxed );
+}
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Dali
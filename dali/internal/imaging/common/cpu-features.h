@@ -0,0 +1,72 @@
+#ifndef DALI_INTERNAL_PLATFORM_CPU_FEATURES_H
+#define DALI_INTERNAL_PLATFORM_CPU_FEATURES_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+/**
+ * @brief Instruction set extensions the image processing kernels can make use of.
+ *
+ * The values are bit flags so a set of them can be stored in a single mask.
+ */
+enum CpuFeature
+{
+  CPU_FEATURE_NONE  = 0u,
+  CPU_FEATURE_SSE2  = 1u << 0u, ///< x86 SSE2, always available on x86-64.
+  CPU_FEATURE_SSSE3 = 1u << 1u, ///< x86 SSSE3 byte shuffles.
+  CPU_FEATURE_AVX2  = 1u << 2u, ///< x86 AVX2 256 bit integer operations.
+  CPU_FEATURE_NEON  = 1u << 3u, ///< ARM Advanced SIMD.
+  CPU_FEATURE_ALL   = ~0u
+};
+
+/**
+ * @brief Detects the instruction set extensions of the processor we are running on.
+ *
+ * The detection is only done on the first call and the result is cached.
+ * Extensions are only reported if the kernels for them have been compiled in.
+ * @return A bitwise-or of the CpuFeature flags which are available and enabled.
+ */
+unsigned int GetCpuFeatures();
+
+/**
+ * @brief Whether a given instruction set extension can be used by the image processing kernels.
+ * @param[in] feature The feature to test for.
+ * @return True if the feature is supported by the processor and has not been masked off.
+ */
+bool HasCpuFeature( CpuFeature feature );
+
+/**
+ * @brief Restricts the set of instruction set extensions that GetCpuFeatures() reports.
+ *
+ * This allows the scalar reference kernels or a lower tier of vectorised kernels to be
+ * selected at runtime, e.g. to check that all the variants produce identical output.
+ * @param[in] mask A bitwise-or of the CpuFeature flags which may be used. Pass CPU_FEATURE_ALL to restore the default.
+ */
+void SetCpuFeatureMask( unsigned int mask );
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Dali
+
+#endif // DALI_INTERNAL_PLATFORM_CPU_FEATURES_H
@@ -16,11 +16,25 @@
 
 // EXTERNAL INCLUDES
 #include <memory.h>
+#include <stdint.h>
+#include <algorithm>
 #include <cmath>
+#include <vector>
+
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+#define DALI_GAUSSIAN_BLUR_X86_SIMD
+#include <emmintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define DALI_GAUSSIAN_BLUR_NEON
+#include <arm_neon.h>
+#endif
 
 // INTERNAL INCLUDES
 #include <dali/internal/imaging/common/gaussian-blur.h>
 #include <dali/internal/imaging/common/pixel-buffer-impl.h>
+#include <dali/internal/imaging/common/cpu-features.h>
 
 namespace Dali
 {
@@ -31,31 +45,45 @@ namespace Internal
 namespace Adaptor
 {
 
+namespace
+{
 
+const unsigned int WEIGHT_SHIFT = 14u;                          ///< The weights are 2.14 fixed-point numbers, so even a weight of one fits in a signed 16 bit lane.
+const uint32_t WEIGHT_ONE = 1u << WEIGHT_SHIFT;                 ///< The weights of a kernel sum to this.
+const unsigned int BOX_SHIFT = 16u;                             ///< Box filter reciprocals are 0.16 fixed-point numbers.
+const unsigned int TILE_SIZE = 16u;                             ///< Scanlines per strip, and columns per tile, of the blocked transposition.
+const unsigned int NUM_BOX_PASSES = 3u;                         ///< Three box blurs in a row are within a few percent of a Gaussian.
 
-void ConvoluteAndTranspose( unsigned char* inBuffer,
-                            unsigned char* outBuffer,
-                            const unsigned int bufferWidth,
-                            const unsigned int bufferHeight,
-                            const float blurRadius )
+/**
+ * @brief Calculate the fixed-point weights of a one dimensional Gaussian kernel.
+ *
+ * The weights start out as the same floating point weights the blur has always used.
+ * Taps which are too small to matter are dropped from the ends of the kernel and
+ * the rest are rounded to fixed-point, with the rounding error given to the center
+ * tap so the kernel still sums to exactly one.
+ *
+ * @param[in] blurRadius The radius for Gaussian blur
+ * @param[out] weights The weights of taps -radius to +radius, followed by a zero so the taps can be taken in pairs.
+ * @return The radius of the kernel in pixels.
+ */
+int CalculateGaussianWeights( const float blurRadius, std::vector<int16_t>& weights )
 {
-  // Calculate the weights for gaussian blur
-  int radius = static_cast<int>( std::ceil( blurRadius ) );
-  int rows = radius * 2 + 1;
+  const int radius = static_cast<int>( std::ceil( blurRadius ) );
+  const int rows = radius * 2 + 1;
 
-  float sigma = ( blurRadius < Math::MACHINE_EPSILON_1 ) ? 0.0f : blurRadius * 0.4f + 0.6f; // The same equation used by Android
-  float sigma22 = 2.0f * sigma * sigma;
-  float sqrtSigmaPi2 = std::sqrt( 2.0f * Math::PI ) * sigma;
-  float radius2 = radius * radius;
+  const float sigma = ( blurRadius < Math::MACHINE_EPSILON_1 ) ? 0.0f : blurRadius * 0.4f + 0.6f; // The same equation used by Android
+  const float sigma22 = 2.0f * sigma * sigma;
+  const float sqrtSigmaPi2 = std::sqrt( 2.0f * Math::PI ) * sigma;
+  const float radius2 = radius * radius;
   float normalizeFactor = 0.0f;
 
-  float* weightMatrix = new float[rows];
+  std::vector<float> weightMatrix( rows );
   int index = 0;
 
-  for ( int row = -radius; row <= radius; row++ )
+  for( int row = -radius; row <= radius; row++ )
   {
-    float distance = row * row;
-    if ( distance > radius2 )
+    const float distance = row * row;
+    if( distance > radius2 )
     {
       weightMatrix[index] = 0.0f;
     }
@@ -67,47 +95,513 @@ void ConvoluteAndTranspose( unsigned char* inBuffer,
     index++;
   }
 
-  for ( int i = 0; i < rows; i++ )
+  for( int i = 0; i < rows; i++ )
   {
     weightMatrix[i] /= normalizeFactor;
   }
 
-  // Perform the convolution and transposition using the weights
-  int columns = rows;
-  int columns2 = columns / 2;
-  for ( unsigned int y = 0; y < bufferHeight; y++ )
+  // The weights fall away from the center so negligible ones are all at the ends:
+  int usedRadius = radius;
+  while( usedRadius > 0 && fabsf( weightMatrix[radius - usedRadius] ) <= Math::MACHINE_EPSILON_1 )
+  {
+    --usedRadius;
+  }
+
+  weights.assign( usedRadius * 2 + 2, 0 );
+  int32_t total = 0;
+  for( int i = 0; i < usedRadius * 2 + 1; ++i )
   {
-    unsigned int targetPixelIndex = y;
-    unsigned int ioffset = y * bufferWidth;
-    for ( unsigned int x = 0; x < bufferWidth; x++ )
+    weights[i] = static_cast<int16_t>( std::lround( weightMatrix[radius - usedRadius + i] * WEIGHT_ONE ) );
+    total += weights[i];
+  }
+  weights[usedRadius] = static_cast<int16_t>( weights[usedRadius] + static_cast<int32_t>( WEIGHT_ONE ) - total );
+
+  return usedRadius;
+}
+
+/**
+ * @brief Copy a scanline of RGBA8888 pixels, repeating the edge pixels to pad it on both sides.
+ *
+ * Padding the scanline lets the filters read past its ends without clamping every tap.
+ * @param[in] inRow The scanline to copy.
+ * @param[in] width The number of pixels in the scanline.
+ * @param[in] padLeft The number of copies of the first pixel to put in front of the scanline.
+ * @param[in] padRight The number of copies of the last pixel to put after the scanline.
+ * @param[out] paddedRow The padded scanline, of width + padLeft + padRight pixels.
+ */
+void PadRow( const uint32_t* inRow, unsigned int width, unsigned int padLeft, unsigned int padRight, uint32_t* paddedRow )
+{
+  std::fill( paddedRow, paddedRow + padLeft, inRow[0] );
+  memcpy( paddedRow + padLeft, inRow, width * sizeof( uint32_t ) );
+  std::fill( paddedRow + padLeft + width, paddedRow + padLeft + width + padRight, inRow[width - 1u] );
+}
+
+/**
+ * @brief Convolve a padded scanline with a kernel, one pixel at a time.
+ *
+ * This is the reference the vectorised versions are bit-exact with.
+ * @param[in] paddedRow The scanline, padded by the kernel radius on the left and the radius plus one on the right.
+ * @param[in] weights The fixed-point kernel weights, padded to an even number of taps.
+ * @param[in] begin The first output pixel to produce.
+ * @param[in] width The number of pixels in the unpadded scanline.
+ * @param[out] outRow The filtered scanline.
+ */
+void ConvolveRowScalar( const uint32_t* paddedRow, const std::vector<int16_t>& weights, unsigned int begin, unsigned int width, uint32_t* outRow )
+{
+  const uint8_t* const bytes = reinterpret_cast<const uint8_t*>( paddedRow );
+  const unsigned int numTaps = weights.size();
+  for( unsigned int x = begin; x < width; ++x )
+  {
+    uint32_t sums[4] = { 0u, 0u, 0u, 0u };
+    const uint8_t* pixel = bytes + x * 4u;
+    for( unsigned int tap = 0; tap < numTaps; ++tap, pixel += 4u )
+    {
+      const uint32_t weight = static_cast<uint32_t>( weights[tap] );
+      sums[0] += weight * pixel[0];
+      sums[1] += weight * pixel[1];
+      sums[2] += weight * pixel[2];
+      sums[3] += weight * pixel[3];
+    }
+
+    uint8_t* const out = reinterpret_cast<uint8_t*>( &outRow[x] );
+    for( unsigned int channel = 0; channel < 4u; ++channel )
     {
-      float r = 0.0f, g = 0.0f, b = 0.0f, a = 0.0f;
-      int weightColumnOffset = columns2;
-      for ( int column = -columns2; column <= columns2; column++ )
+      out[channel] = static_cast<uint8_t>( std::min( ( sums[channel] + ( WEIGHT_ONE >> 1u ) ) >> WEIGHT_SHIFT, 255u ) );
+    }
+  }
+}
+
+#if defined(DALI_GAUSSIAN_BLUR_X86_SIMD)
+
+/**
+ * @brief Convolve a padded scanline with a kernel, four pixels at a time.
+ *
+ * Pairs of taps are interleaved so one multiply-add instruction applies both of
+ * them to all four channels of a pixel.
+ * @return The number of output pixels produced.
+ */
+__attribute__((target("sse2"))) unsigned int ConvolveRowSse2( const uint32_t* paddedRow, const std::vector<int16_t>& weights, unsigned int width, uint32_t* outRow )
+{
+  const unsigned int numTaps = weights.size();
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i rounding = _mm_set1_epi32( WEIGHT_ONE >> 1u );
+
+  unsigned int x = 0;
+  for( ; x + 4u <= width; x += 4u )
+  {
+    __m128i sum0 = rounding, sum1 = rounding, sum2 = rounding, sum3 = rounding;
+    for( unsigned int tap = 0; tap < numTaps; tap += 2u )
+    {
+      const __m128i weightPair = _mm_set1_epi32( static_cast<int>( ( static_cast<uint32_t>( static_cast<uint16_t>( weights[tap + 1u] ) ) << 16u ) | static_cast<uint16_t>( weights[tap] ) ) );
+      const __m128i first  = _mm_loadu_si128( reinterpret_cast<const __m128i*>( paddedRow + x + tap ) );
+      const __m128i second = _mm_loadu_si128( reinterpret_cast<const __m128i*>( paddedRow + x + tap + 1u ) );
+
+      // Interleave the components of the pixels under the two taps then widen to 16 bits:
+      const __m128i interleavedLow  = _mm_unpacklo_epi8( first, second );
+      const __m128i interleavedHigh = _mm_unpackhi_epi8( first, second );
+      sum0 = _mm_add_epi32( sum0, _mm_madd_epi16( _mm_unpacklo_epi8( interleavedLow, zero ), weightPair ) );
+      sum1 = _mm_add_epi32( sum1, _mm_madd_epi16( _mm_unpackhi_epi8( interleavedLow, zero ), weightPair ) );
+      sum2 = _mm_add_epi32( sum2, _mm_madd_epi16( _mm_unpacklo_epi8( interleavedHigh, zero ), weightPair ) );
+      sum3 = _mm_add_epi32( sum3, _mm_madd_epi16( _mm_unpackhi_epi8( interleavedHigh, zero ), weightPair ) );
+    }
+
+    const __m128i low  = _mm_packs_epi32( _mm_srai_epi32( sum0, WEIGHT_SHIFT ), _mm_srai_epi32( sum1, WEIGHT_SHIFT ) );
+    const __m128i high = _mm_packs_epi32( _mm_srai_epi32( sum2, WEIGHT_SHIFT ), _mm_srai_epi32( sum3, WEIGHT_SHIFT ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( outRow + x ), _mm_packus_epi16( low, high ) );
+  }
+  return x;
+}
+
+#endif // DALI_GAUSSIAN_BLUR_X86_SIMD
+
+#if defined(DALI_GAUSSIAN_BLUR_NEON)
+
+/**
+ * @brief Convolve a padded scanline with a kernel, four pixels at a time.
+ * @return The number of output pixels produced.
+ */
+unsigned int ConvolveRowNeon( const uint32_t* paddedRow, const std::vector<int16_t>& weights, unsigned int width, uint32_t* outRow )
+{
+  const unsigned int numTaps = weights.size();
+
+  unsigned int x = 0;
+  for( ; x + 4u <= width; x += 4u )
+  {
+    uint32x4_t sum0 = vdupq_n_u32( WEIGHT_ONE >> 1u );
+    uint32x4_t sum1 = sum0, sum2 = sum0, sum3 = sum0;
+    for( unsigned int tap = 0; tap < numTaps; ++tap )
+    {
+      const uint16_t weight = static_cast<uint16_t>( weights[tap] );
+      const uint8x16_t pixels = vld1q_u8( reinterpret_cast<const uint8_t*>( paddedRow + x + tap ) );
+      const uint16x8_t low  = vmovl_u8( vget_low_u8( pixels ) );
+      const uint16x8_t high = vmovl_u8( vget_high_u8( pixels ) );
+      sum0 = vmlal_n_u16( sum0, vget_low_u16( low ), weight );
+      sum1 = vmlal_n_u16( sum1, vget_high_u16( low ), weight );
+      sum2 = vmlal_n_u16( sum2, vget_low_u16( high ), weight );
+      sum3 = vmlal_n_u16( sum3, vget_high_u16( high ), weight );
+    }
+
+    const uint16x8_t low  = vcombine_u16( vqshrn_n_u32( sum0, WEIGHT_SHIFT ), vqshrn_n_u32( sum1, WEIGHT_SHIFT ) );
+    const uint16x8_t high = vcombine_u16( vqshrn_n_u32( sum2, WEIGHT_SHIFT ), vqshrn_n_u32( sum3, WEIGHT_SHIFT ) );
+    vst1q_u8( reinterpret_cast<uint8_t*>( outRow + x ), vcombine_u8( vqmovn_u16( low ), vqmovn_u16( high ) ) );
+  }
+  return x;
+}
+
+#endif // DALI_GAUSSIAN_BLUR_NEON
+
+/**
+ * @brief Horizontal Gaussian filter for a scanline of RGBA8888 pixels.
+ */
+class GaussianRowFilter
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param[in] blurRadius The radius for Gaussian blur
+   * @param[in] width The number of pixels in each scanline.
+   */
+  GaussianRowFilter( const float blurRadius, unsigned int width )
+  : mWeights(),
+    mPaddedRow(),
+    mRadius( 0u ),
+    mWidth( width )
+  {
+    mRadius = static_cast<unsigned int>( CalculateGaussianWeights( blurRadius, mWeights ) );
+    // The extra pixel on the right is read by the zero weight that pads the kernel to an even length:
+    mPaddedRow.resize( width + mRadius * 2u + 1u );
+  }
+
+  /**
+   * @brief Filter a scanline.
+   * @param[in] inRow The scanline to filter.
+   * @param[out] outRow The filtered scanline.
+   */
+  void operator()( const uint32_t* inRow, uint32_t* outRow )
+  {
+    PadRow( inRow, mWidth, mRadius, mRadius + 1u, &mPaddedRow[0] );
+
+    unsigned int x = 0u;
+#if defined(DALI_GAUSSIAN_BLUR_X86_SIMD)
+    if( Platform::HasCpuFeature( Platform::CPU_FEATURE_SSE2 ) )
+    {
+      x = ConvolveRowSse2( &mPaddedRow[0], mWeights, mWidth, outRow );
+    }
+#elif defined(DALI_GAUSSIAN_BLUR_NEON)
+    if( Platform::HasCpuFeature( Platform::CPU_FEATURE_NEON ) )
+    {
+      x = ConvolveRowNeon( &mPaddedRow[0], mWeights, mWidth, outRow );
+    }
+#endif
+    ConvolveRowScalar( &mPaddedRow[0], mWeights, x, mWidth, outRow );
+  }
+
+private:
+
+  std::vector<int16_t>  mWeights;   ///< The fixed-point kernel.
+  std::vector<uint32_t> mPaddedRow; ///< Scratch space for the padded input scanline.
+  unsigned int          mRadius;    ///< The radius of the kernel.
+  unsigned int          mWidth;     ///< The number of pixels in each scanline.
+};
+
+/**
+ * @brief Average each pixel of a padded scanline with its neighbours in a window centered on it.
+ *
+ * A running sum over the window is kept for each channel so the cost per
+ * pixel doesn't depend on the size of the window.
+ * @param[in] paddedRow The scanline, padded by the box radius on the left and the radius plus one on the right.
+ * @param[in] width The number of pixels in the unpadded scanline.
+ * @param[in] window The width of the box, an odd number of pixels.
+ * @param[in] reciprocal The fixed-point reciprocal of the box width.
+ * @param[out] outRow The filtered scanline.
+ */
+void BoxBlurPaddedRow( const uint32_t* paddedRow, unsigned int width, unsigned int window, uint32_t reciprocal, uint32_t* outRow )
+{
+  const uint32_t rounding = 1u << ( BOX_SHIFT - 1u );
+  uint32_t sum0 = 0u, sum1 = 0u, sum2 = 0u, sum3 = 0u;
+  for( unsigned int i = 0; i < window; ++i )
+  {
+    const uint32_t pixel = paddedRow[i];
+    sum0 += pixel & 0xffu;
+    sum1 += ( pixel >> 8u ) & 0xffu;
+    sum2 += ( pixel >> 16u ) & 0xffu;
+    sum3 += pixel >> 24u;
+  }
+
+  for( unsigned int x = 0; x < width; ++x )
+  {
+    outRow[x] = std::min( ( sum0 * reciprocal + rounding ) >> BOX_SHIFT, 255u ) |
+                std::min( ( sum1 * reciprocal + rounding ) >> BOX_SHIFT, 255u ) << 8u |
+                std::min( ( sum2 * reciprocal + rounding ) >> BOX_SHIFT, 255u ) << 16u |
+                std::min( ( sum3 * reciprocal + rounding ) >> BOX_SHIFT, 255u ) << 24u;
+
+    // Slide the window along by one pixel:
+    const uint32_t leaving = paddedRow[x];
+    const uint32_t entering = paddedRow[x + window];
+    sum0 += ( entering & 0xffu ) - ( leaving & 0xffu );
+    sum1 += ( ( entering >> 8u ) & 0xffu ) - ( ( leaving >> 8u ) & 0xffu );
+    sum2 += ( ( entering >> 16u ) & 0xffu ) - ( ( leaving >> 16u ) & 0xffu );
+    sum3 += ( entering >> 24u ) - ( leaving >> 24u );
+  }
+}
+
+#if defined(DALI_GAUSSIAN_BLUR_X86_SIMD)
+
+/**
+ * @brief Widen the four channels of a pixel to 32 bit lanes.
+ */
+__attribute__((target("sse2"))) inline __m128i WidenPixelSse2( uint32_t pixel, __m128i zero )
+{
+  return _mm_unpacklo_epi16( _mm_unpacklo_epi8( _mm_cvtsi32_si128( static_cast<int>( pixel ) ), zero ), zero );
+}
+
+/**
+ * @brief Box blur a padded scanline with the running sums of all four channels in one register.
+ *
+ * Bit-exact with BoxBlurPaddedRow().
+ */
+__attribute__((target("sse2"))) void BoxBlurPaddedRowSse2( const uint32_t* paddedRow, unsigned int width, unsigned int window, uint32_t reciprocal, uint32_t* outRow )
+{
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i multiplier = _mm_set1_epi32( static_cast<int>( reciprocal ) );
+  const __m128i rounding = _mm_set1_epi32( 1 << ( BOX_SHIFT - 1u ) );
+
+  __m128i sums = zero;
+  for( unsigned int i = 0; i < window; ++i )
+  {
+    sums = _mm_add_epi32( sums, WidenPixelSse2( paddedRow[i], zero ) );
+  }
+
+  for( unsigned int x = 0; x < width; ++x )
+  {
+    // There's no 32 bit multiply in SSE2, so multiply the even and odd channels separately and gather the low halves:
+    const __m128i even = _mm_mul_epu32( sums, multiplier );
+    const __m128i odd  = _mm_mul_epu32( _mm_srli_epi64( sums, 32 ), multiplier );
+    const __m128i products = _mm_unpacklo_epi32( _mm_shuffle_epi32( even, _MM_SHUFFLE( 0, 0, 2, 0 ) ), _mm_shuffle_epi32( odd, _MM_SHUFFLE( 0, 0, 2, 0 ) ) );
+    const __m128i averages = _mm_packs_epi32( _mm_srli_epi32( _mm_add_epi32( products, rounding ), BOX_SHIFT ), zero );
+    outRow[x] = static_cast<uint32_t>( _mm_cvtsi128_si32( _mm_packus_epi16( averages, zero ) ) );
+
+    sums = _mm_sub_epi32( _mm_add_epi32( sums, WidenPixelSse2( paddedRow[x + window], zero ) ), WidenPixelSse2( paddedRow[x], zero ) );
+  }
+}
+
+#endif // DALI_GAUSSIAN_BLUR_X86_SIMD
+
+#if defined(DALI_GAUSSIAN_BLUR_NEON)
+
+/**
+ * @brief Widen the four channels of a pixel to 32 bit lanes.
+ */
+inline uint32x4_t WidenPixelNeon( uint32_t pixel )
+{
+  return vmovl_u16( vget_low_u16( vmovl_u8( vreinterpret_u8_u32( vdup_n_u32( pixel ) ) ) ) );
+}
+
+/**
+ * @brief Box blur a padded scanline with the running sums of all four channels in one register.
+ *
+ * Bit-exact with BoxBlurPaddedRow().
+ */
+void BoxBlurPaddedRowNeon( const uint32_t* paddedRow, unsigned int width, unsigned int window, uint32_t reciprocal, uint32_t* outRow )
+{
+  const uint32x4_t rounding = vdupq_n_u32( 1u << ( BOX_SHIFT - 1u ) );
+  const uint32x4_t maximum = vdupq_n_u32( 255u );
+
+  uint32x4_t sums = vdupq_n_u32( 0u );
+  for( unsigned int i = 0; i < window; ++i )
+  {
+    sums = vaddq_u32( sums, WidenPixelNeon( paddedRow[i] ) );
+  }
+
+  for( unsigned int x = 0; x < width; ++x )
+  {
+    const uint32x4_t averages = vminq_u32( vshrq_n_u32( vmlaq_n_u32( rounding, sums, reciprocal ), BOX_SHIFT ), maximum );
+    const uint16x4_t narrowed = vmovn_u32( averages );
+    outRow[x] = vget_lane_u32( vreinterpret_u32_u8( vmovn_u16( vcombine_u16( narrowed, narrowed ) ) ), 0 );
+
+    sums = vsubq_u32( vaddq_u32( sums, WidenPixelNeon( paddedRow[x + window] ) ), WidenPixelNeon( paddedRow[x] ) );
+  }
+}
+
+#endif // DALI_GAUSSIAN_BLUR_NEON
+
+/**
+ * @brief Horizontal filter for a scanline of RGBA8888 pixels that applies three box blurs in a row.
+ *
+ * Each box blur costs the same whatever its size.
+ */
+class BoxRowFilter
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param[in] boxRadii The radius of each of the box blurs.
+   * @param[in] width The number of pixels in each scanline.
+   */
+  BoxRowFilter( const unsigned int boxRadii[NUM_BOX_PASSES], unsigned int width )
+  : mPaddedRow(),
+    mPassRow( width ),
+    mWidth( width )
+  {
+    unsigned int maximumRadius = 0u;
+    for( unsigned int pass = 0; pass < NUM_BOX_PASSES; ++pass )
+    {
+      mRadii[pass] = boxRadii[pass];
+      mReciprocals[pass] = ( ( 1u << BOX_SHIFT ) + boxRadii[pass] ) / ( boxRadii[pass] * 2u + 1u ); // Rounded to nearest.
+      maximumRadius = std::max( maximumRadius, boxRadii[pass] );
+    }
+    mPaddedRow.resize( width + maximumRadius * 2u + 1u );
+  }
+
+  /**
+   * @brief Filter a scanline.
+   * @param[in] inRow The scanline to filter.
+   * @param[out] outRow The filtered scanline.
+   */
+  void operator()( const uint32_t* inRow, uint32_t* outRow )
+  {
+    const uint32_t* passInput = inRow;
+    for( unsigned int pass = 0; pass < NUM_BOX_PASSES; ++pass )
+    {
+      // Ping-pong so the last pass writes to the output:
+      uint32_t* const passOutput = ( pass % 2u == NUM_BOX_PASSES % 2u ) ? &mPassRow[0] : outRow;
+      BoxBlurRow( passInput, mRadii[pass], mReciprocals[pass], passOutput );
+      passInput = passOutput;
+    }
+  }
+
+private:
+
+  /**
+   * @brief Apply one box blur to a scanline.
+   */
+  void BoxBlurRow( const uint32_t* inRow, unsigned int radius, uint32_t reciprocal, uint32_t* outRow )
+  {
+    PadRow( inRow, mWidth, radius, radius + 1u, &mPaddedRow[0] );
+
+#if defined(DALI_GAUSSIAN_BLUR_X86_SIMD)
+    if( Platform::HasCpuFeature( Platform::CPU_FEATURE_SSE2 ) )
+    {
+      BoxBlurPaddedRowSse2( &mPaddedRow[0], mWidth, radius * 2u + 1u, reciprocal, outRow );
+      return;
+    }
+#elif defined(DALI_GAUSSIAN_BLUR_NEON)
+    if( Platform::HasCpuFeature( Platform::CPU_FEATURE_NEON ) )
+    {
+      BoxBlurPaddedRowNeon( &mPaddedRow[0], mWidth, radius * 2u + 1u, reciprocal, outRow );
+      return;
+    }
+#endif
+    BoxBlurPaddedRow( &mPaddedRow[0], mWidth, radius * 2u + 1u, reciprocal, outRow );
+  }
+
+  std::vector<uint32_t> mPaddedRow;                  ///< Scratch space for the padded input scanline.
+  std::vector<uint32_t> mPassRow;                    ///< Scratch space for the output of intermediate passes.
+  unsigned int          mRadii[NUM_BOX_PASSES];      ///< The radius of each box blur.
+  uint32_t              mReciprocals[NUM_BOX_PASSES];///< The fixed-point reciprocal of each box blur's width.
+  unsigned int          mWidth;                      ///< The number of pixels in each scanline.
+};
+
+/**
+ * @brief Filter each scanline of an RGBA8888 image and write the result transposed.
+ *
+ * Scanlines are filtered a strip at a time into a small buffer, which is then
+ * written out in square tiles. Each tile writes a run of TILE_SIZE pixels to
+ * each of TILE_SIZE output scanlines rather than touching a new cache line
+ * for every pixel.
+ * @param[in] inBuffer The input image.
+ * @param[out] outBuffer The filtered, transposed image.
+ * @param[in] bufferWidth The width of the input image.
+ * @param[in] bufferHeight The height of the input image.
+ * @param[in] rowFilter The horizontal filter to apply.
+ */
+template< typename RowFilter >
+void FilterRowsAndTranspose( const unsigned char* inBuffer,
+                             unsigned char* outBuffer,
+                             const unsigned int bufferWidth,
+                             const unsigned int bufferHeight,
+                             RowFilter& rowFilter )
+{
+  const uint32_t* const inPixels = reinterpret_cast<const uint32_t*>( inBuffer );
+  uint32_t* const outPixels = reinterpret_cast<uint32_t*>( outBuffer );
+  std::vector<uint32_t> strip( TILE_SIZE * bufferWidth );
+
+  for( unsigned int stripY = 0; stripY < bufferHeight; stripY += TILE_SIZE )
+  {
+    const unsigned int stripHeight = std::min( TILE_SIZE, bufferHeight - stripY );
+    for( unsigned int row = 0; row < stripHeight; ++row )
+    {
+      rowFilter( inPixels + ( stripY + row ) * bufferWidth, &strip[row * bufferWidth] );
+    }
+
+    for( unsigned int tileX = 0; tileX < bufferWidth; tileX += TILE_SIZE )
+    {
+      const unsigned int tileEnd = std::min( tileX + TILE_SIZE, bufferWidth );
+      for( unsigned int x = tileX; x < tileEnd; ++x )
       {
-        float weight = weightMatrix[weightColumnOffset + column];
-        if ( fabsf( weight ) > Math::MACHINE_EPSILON_1 )
+        uint32_t* const outColumn = outPixels + x * bufferHeight + stripY;
+        for( unsigned int row = 0; row < stripHeight; ++row )
         {
-          int ix = x + column;
-          ix = std::max( 0, std::min( ix, static_cast<int>( bufferWidth - 1 ) ) );
-          unsigned int sourcePixelIndex = ioffset + ix;
-          r += weight * inBuffer[sourcePixelIndex*4];
-          g += weight * inBuffer[sourcePixelIndex*4+1];
-          b += weight * inBuffer[sourcePixelIndex*4+2];
-          a += weight * inBuffer[sourcePixelIndex*4+3];
+          outColumn[row] = strip[row * bufferWidth + x];
         }
       }
+    }
+  }
+}
 
-      outBuffer[targetPixelIndex*4] = std::max( 0, std::min( static_cast<int>( r + 0.5f ), 255 ) );
-      outBuffer[targetPixelIndex*4+1] = std::max( 0, std::min( static_cast<int>( g + 0.5f ), 255 ) );
-      outBuffer[targetPixelIndex*4+2] = std::max( 0, std::min( static_cast<int>( b + 0.5f ), 255 ) );
-      outBuffer[targetPixelIndex*4+3] = std::max( 0, std::min( static_cast<int>( a + 0.5f ), 255 ) );
+/**
+ * @brief Work out the radii of three box blurs which together approximate a Gaussian blur.
+ * @param[in] blurRadius The radius for Gaussian blur
+ * @param[out] boxRadii The radius of each box blur.
+ */
+void CalculateBoxRadii( const float blurRadius, unsigned int boxRadii[NUM_BOX_PASSES] )
+{
+  // Use the same standard deviation as the exact blur:
+  const float sigma = blurRadius * 0.4f + 0.6f;
+  const float n = static_cast<float>( NUM_BOX_PASSES );
 
-      targetPixelIndex += bufferHeight;
-    }
+  // Find the odd box widths either side of the ideal one, then how many of the smaller ones give the closest variance:
+  int lowerWidth = static_cast<int>( std::floor( std::sqrt( 12.0f * sigma * sigma / n + 1.0f ) ) );
+  if( lowerWidth % 2 == 0 )
+  {
+    --lowerWidth;
+  }
+  const int upperWidth = lowerWidth + 2;
+  const float numLower = ( 12.0f * sigma * sigma - n * lowerWidth * lowerWidth - 4.0f * n * lowerWidth - 3.0f * n ) / ( -4.0f * lowerWidth - 4.0f );
+  const unsigned int roundedNumLower = static_cast<unsigned int>( std::max( 0l, std::lround( numLower ) ) );
+
+  for( unsigned int pass = 0; pass < NUM_BOX_PASSES; ++pass )
+  {
+    const int width = pass < roundedNumLower ? lowerWidth : upperWidth;
+    boxRadii[pass] = static_cast<unsigned int>( std::max( 0, ( width - 1 ) / 2 ) );
   }
+}
+
+} // unnamed namespace
 
-  delete [] weightMatrix;
+void ConvoluteAndTranspose( unsigned char* inBuffer,
+                            unsigned char* outBuffer,
+                            const unsigned int bufferWidth,
+                            const unsigned int bufferHeight,
+                            const float blurRadius )
+{
+  GaussianRowFilter rowFilter( blurRadius, bufferWidth );
+  FilterRowsAndTranspose( inBuffer, outBuffer, bufferWidth, bufferHeight, rowFilter );
+}
+
+void BoxBlurAndTranspose( unsigned char* inBuffer,
+                          unsigned char* outBuffer,
+                          const unsigned int bufferWidth,
+                          const unsigned int bufferHeight,
+                          const float blurRadius )
+{
+  unsigned int boxRadii[NUM_BOX_PASSES];
+  CalculateBoxRadii( blurRadius, boxRadii );
+
+  BoxRowFilter rowFilter( boxRadii, bufferWidth );
+  FilterRowsAndTranspose( inBuffer, outBuffer, bufferWidth, bufferHeight, rowFilter );
 }
 
 void PerformGaussianBlurRGBA( PixelBuffer& buffer, const float blurRadius )
@@ -115,9 +609,8 @@ void PerformGaussianBlurRGBA( PixelBuffer& buffer, const float blurRadius )
   unsigned int bufferWidth = buffer.GetWidth();
   unsigned int bufferHeight = buffer.GetHeight();
 
-  // Create a temporary buffer for the two-pass blur
+  // Create a temporary buffer for the two-pass blur. The first pass writes all of it.
   PixelBufferPtr softShadowImageBuffer = PixelBuffer::New( bufferWidth, bufferHeight, Pixel::RGBA8888 );
-  memcpy( softShadowImageBuffer->GetBuffer(), buffer.GetBuffer(), 4u * bufferWidth * bufferHeight );
 
   // We perform the blur first but write its output image buffer transposed, so that we
   // can just do it in two passes. The first pass blurs horizontally and transposes, the
@@ -130,6 +623,17 @@ void PerformGaussianBlurRGBA( PixelBuffer& buffer, const float blurRadius )
   // On leaving scope, softShadowImageBuffer will get destroyed.
 }
 
+void PerformApproximateGaussianBlurRGBA( PixelBuffer& buffer, const float blurRadius )
+{
+  unsigned int bufferWidth = buffer.GetWidth();
+  unsigned int bufferHeight = buffer.GetHeight();
+
+  // The same two transposing passes as PerformGaussianBlurRGBA():
+  PixelBufferPtr softShadowImageBuffer = PixelBuffer::New( bufferWidth, bufferHeight, Pixel::RGBA8888 );
+  BoxBlurAndTranspose( buffer.GetBuffer(), softShadowImageBuffer->GetBuffer(), bufferWidth, bufferHeight, blurRadius );
+  BoxBlurAndTranspose( softShadowImageBuffer->GetBuffer(), buffer.GetBuffer(), bufferHeight, bufferWidth, blurRadius );
+}
+
 } //namespace Adaptor
 
 }// namespace Internal
@@ -39,6 +39,19 @@ namespace Adaptor
  */
 void ConvoluteAndTranspose( unsigned char* inBuffer, unsigned char* outBuffer, const unsigned int bufferWidth, const unsigned int bufferHeight, const float blurRadius );
 
+/**
+ * Perform three successive one dimension box blurs approximating a Gaussian blur and write the output buffer transposed.
+ *
+ * The cost per pixel does not depend on the blur radius.
+ *
+ * @param[in] inBuffer The input buffer with the source image
+ * @param[in] outBuffer The output buffer with the blur applied and transposed
+ * @param[in] bufferWidth The width of the buffer
+ * @param[in] bufferHeight The height of the buffer
+ * @param[in] blurRadius The radius of the Gaussian blur to approximate
+ */
+void BoxBlurAndTranspose( unsigned char* inBuffer, unsigned char* outBuffer, const unsigned int bufferWidth, const unsigned int bufferHeight, const float blurRadius );
+
 /**
  * Perform Gaussian blur on a buffer.
  *
@@ -52,6 +65,20 @@ void ConvoluteAndTranspose( unsigned char* inBuffer, unsigned char* outBuffer, c
  */
 void PerformGaussianBlurRGBA( PixelBuffer& buffer, const float blurRadius );
 
+/**
+ * Perform an approximate Gaussian blur on a buffer.
+ *
+ * Each dimension is blurred by three box blurs in a row, which is within a few
+ * percent of a true Gaussian blur but takes the same time for any radius.
+ * This makes it much faster than PerformGaussianBlurRGBA() for large radii.
+ *
+ * @note The pixel format of the buffer must be RGBA8888
+ *
+ * @param[in] buffer The buffer to apply the blur to
+ * @param[in] blurRadius The radius of the Gaussian blur to approximate
+ */
+void PerformApproximateGaussianBlurRGBA( PixelBuffer& buffer, const float blurRadius );
+
 } //namespace Adaptor
 
 } //namespace Internal
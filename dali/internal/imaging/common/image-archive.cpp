@@ -0,0 +1,468 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/common/image-archive.h>
+
+// EXTERNAL INCLUDES
+#include <sys/stat.h>
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <dali/integration-api/debug.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/imaging/common/mapped-file.h>
+#include <dali/internal/imaging/common/pixel-buffer-impl.h>
+#include <dali/internal/system/common/file-reader.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+namespace
+{
+
+const uint8_t FILE_IDENTIFIER[] = { 'D', 'P', 'K', 1 }; ///< The magic bytes and the version of the format
+const char URL_EXTENSION[] = ".dpk#";                  ///< What follows the path of an archive in the url of an image in it
+const std::size_t HEADER_SIZE = 12u;                   ///< Identifier, number of entries and size of the names
+const std::size_t INDEX_ENTRY_SIZE = 24u;              ///< Name offset and length, pixel offset and size, width, height and format
+const uint32_t PIXEL_ALIGNMENT = 16u;                  ///< The pixels of each image start on this boundary
+const std::size_t MAXIMUM_CACHED_ARCHIVES = 8u;        ///< Archives kept open at once, the least recently opened is dropped
+
+uint16_t ReadUint16( const uint8_t* bytes )
+{
+  return static_cast<uint16_t>( bytes[0] | ( bytes[1] << 8 ) );
+}
+
+uint32_t ReadUint32( const uint8_t* bytes )
+{
+  return static_cast<uint32_t>( bytes[0] ) | ( static_cast<uint32_t>( bytes[1] ) << 8 ) |
+         ( static_cast<uint32_t>( bytes[2] ) << 16 ) | ( static_cast<uint32_t>( bytes[3] ) << 24 );
+}
+
+void WriteUint16( uint8_t* bytes, uint16_t value )
+{
+  bytes[0] = static_cast<uint8_t>( value );
+  bytes[1] = static_cast<uint8_t>( value >> 8 );
+}
+
+void WriteUint32( uint8_t* bytes, uint32_t value )
+{
+  bytes[0] = static_cast<uint8_t>( value );
+  bytes[1] = static_cast<uint8_t>( value >> 8 );
+  bytes[2] = static_cast<uint8_t>( value >> 16 );
+  bytes[3] = static_cast<uint8_t>( value >> 24 );
+}
+
+/**
+ * @brief An index entry, as it is in the file.
+ */
+struct IndexEntry
+{
+  uint32_t nameOffset;
+  uint32_t nameLength;
+  uint32_t offset;
+  uint32_t size;
+  uint16_t width;
+  uint16_t height;
+  uint32_t pixelFormat;
+};
+
+IndexEntry ReadIndexEntry( const uint8_t* index, uint32_t entryIndex )
+{
+  const uint8_t* const bytes = index + entryIndex * INDEX_ENTRY_SIZE;
+  IndexEntry entry;
+  entry.nameOffset = ReadUint32( bytes );
+  entry.nameLength = ReadUint32( bytes + 4 );
+  entry.offset = ReadUint32( bytes + 8 );
+  entry.size = ReadUint32( bytes + 12 );
+  entry.width = ReadUint16( bytes + 16 );
+  entry.height = ReadUint16( bytes + 18 );
+  entry.pixelFormat = ReadUint32( bytes + 20 );
+  return entry;
+}
+
+/**
+ * @brief Compare names in byte order, as std::string does.
+ */
+int CompareNames( const char* name, std::size_t length, const char* otherName, std::size_t otherLength )
+{
+  const int result = memcmp( name, otherName, std::min( length, otherLength ) );
+  if( result != 0 )
+  {
+    return result;
+  }
+  return ( length < otherLength ) ? -1 : ( length > otherLength ? 1 : 0 );
+}
+
+/**
+ * @brief Check the whole of a mapped archive, so finding and loading the images needn't.
+ * @param[in] mappedFile The mapped file
+ * @return true if it is a valid archive, false otherwise
+ */
+bool Validate( const MappedFile& mappedFile )
+{
+  const uint8_t* const data = mappedFile.GetData();
+  const uint64_t fileSize = mappedFile.GetSize();
+  if( fileSize < HEADER_SIZE || memcmp( data, FILE_IDENTIFIER, sizeof( FILE_IDENTIFIER ) ) != 0 )
+  {
+    return false;
+  }
+
+  const uint32_t numberOfEntries = ReadUint32( data + 4 );
+  const uint32_t bytesOfNames = ReadUint32( data + 8 );
+  const uint64_t namesOffset = HEADER_SIZE + static_cast<uint64_t>( numberOfEntries ) * INDEX_ENTRY_SIZE;
+  if( namesOffset + bytesOfNames > fileSize )
+  {
+    DALI_LOG_ERROR( "Image archive index is larger than the file.\n" );
+    return false;
+  }
+
+  const uint8_t* const index = data + HEADER_SIZE;
+  const char* const names = reinterpret_cast<const char*>( data + namesOffset );
+  for( uint32_t entryIndex = 0u; entryIndex < numberOfEntries; ++entryIndex )
+  {
+    const IndexEntry entry = ReadIndexEntry( index, entryIndex );
+    const Pixel::Format pixelFormat = static_cast<Pixel::Format>( entry.pixelFormat );
+    const unsigned int bytesPerPixel = ( entry.pixelFormat >= Pixel::FIRST_VALID_PIXEL_FORMAT && entry.pixelFormat <= Pixel::LAST_VALID_PIXEL_FORMAT ) ?
+                                       Pixel::GetBytesPerPixel( pixelFormat ) : 0u;
+
+    if( static_cast<uint64_t>( entry.nameOffset ) + entry.nameLength > bytesOfNames ||
+        static_cast<uint64_t>( entry.offset ) + entry.size > fileSize ||
+        entry.offset < namesOffset + bytesOfNames ||
+        entry.offset % PIXEL_ALIGNMENT != 0u ||
+        entry.size == 0u || entry.width == 0u || entry.height == 0u ||
+        entry.pixelFormat < Pixel::FIRST_VALID_PIXEL_FORMAT || entry.pixelFormat > Pixel::LAST_VALID_PIXEL_FORMAT ||
+        ( bytesPerPixel > 0u && entry.size != static_cast<uint32_t>( entry.width ) * entry.height * bytesPerPixel ) )
+    {
+      DALI_LOG_ERROR( "Image archive entry %u is invalid.\n", entryIndex );
+      return false;
+    }
+
+    // The names must be in order to be searched for:
+    if( entryIndex > 0u )
+    {
+      const IndexEntry previous = ReadIndexEntry( index, entryIndex - 1u );
+      if( CompareNames( names + previous.nameOffset, previous.nameLength, names + entry.nameOffset, entry.nameLength ) >= 0 )
+      {
+        DALI_LOG_ERROR( "Image archive index is not sorted.\n" );
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @brief An archive which has been opened, and the file it was opened from.
+ */
+struct CachedArchive
+{
+  dev_t                               device;
+  ino_t                               inode;
+  off_t                               size;
+  struct timespec                     modified;
+  std::shared_ptr<const ImageArchive> archive;
+};
+
+/**
+ * @brief The archives opened, newest last.
+ */
+struct ArchiveCache
+{
+  std::mutex                mutex;    ///< The cache is used from every image loading thread.
+  std::deque<CachedArchive> archives;
+};
+
+ArchiveCache& GetArchiveCache()
+{
+  static ArchiveCache cache;
+  return cache;
+}
+
+bool IsSameFile( const CachedArchive& cached, const struct stat& fileStat )
+{
+  return cached.device == fileStat.st_dev && cached.inode == fileStat.st_ino &&
+         cached.size == fileStat.st_size &&
+         cached.modified.tv_sec == fileStat.st_mtim.tv_sec && cached.modified.tv_nsec == fileStat.st_mtim.tv_nsec;
+}
+
+/**
+ * @brief Find an archive in the cache.
+ * @param[in] fileStat The status of the file
+ * @return The archive, or nullptr if it isn't cached
+ */
+std::shared_ptr<const ImageArchive> FindCachedArchive( const struct stat& fileStat )
+{
+  ArchiveCache& cache = GetArchiveCache();
+  std::lock_guard<std::mutex> lock( cache.mutex );
+  for( const CachedArchive& cached : cache.archives )
+  {
+    if( IsSameFile( cached, fileStat ) )
+    {
+      return cached.archive;
+    }
+  }
+  return nullptr;
+}
+
+/**
+ * @brief Add an archive to the cache, replacing any other version of the same file.
+ * @param[in] fileStat The status of the file
+ * @param[in] archive The archive
+ * @return The archive cached for the file, which is another one if it was opened at the same time on another thread
+ */
+std::shared_ptr<const ImageArchive> CacheArchive( const struct stat& fileStat, std::shared_ptr<const ImageArchive> archive )
+{
+  // The archives dropped are released once the mutex is, as unmapping them may take a while:
+  std::deque<CachedArchive> dropped;
+
+  ArchiveCache& cache = GetArchiveCache();
+  std::lock_guard<std::mutex> lock( cache.mutex );
+  for( auto iter = cache.archives.begin(); iter != cache.archives.end(); )
+  {
+    if( IsSameFile( *iter, fileStat ) )
+    {
+      return iter->archive;
+    }
+    if( iter->device == fileStat.st_dev && iter->inode == fileStat.st_ino )
+    {
+      // The file has been rewritten:
+      dropped.push_back( std::move( *iter ) );
+      iter = cache.archives.erase( iter );
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+
+  cache.archives.push_back( CachedArchive{ fileStat.st_dev, fileStat.st_ino, fileStat.st_size, fileStat.st_mtim, archive } );
+  while( cache.archives.size() > MAXIMUM_CACHED_ARCHIVES )
+  {
+    dropped.push_back( std::move( cache.archives.front() ) );
+    cache.archives.pop_front();
+  }
+  return archive;
+}
+
+} // unnamed namespace
+
+ImageArchive::ImageArchive( std::shared_ptr<const MappedFile> mappedFile )
+: mMappedFile( std::move( mappedFile ) ),
+  mIndex( mMappedFile->GetData() + HEADER_SIZE ),
+  mNames( nullptr ),
+  mNumberOfEntries( ReadUint32( mMappedFile->GetData() + 4 ) )
+{
+  mNames = reinterpret_cast<const char*>( mIndex + static_cast<std::size_t>( mNumberOfEntries ) * INDEX_ENTRY_SIZE );
+}
+
+ImageArchive::~ImageArchive()
+{
+}
+
+ImageArchive::Url::Url( const std::string& url )
+: filePath( url ),
+  entryName(),
+  fileStatus()
+{
+  // A plain file may have ".dpk#" in its path too, so the url is only split where the part before names an archive file:
+  const std::size_t extensionLength = sizeof( URL_EXTENSION ) - 1u;
+  for( std::size_t position = url.find( URL_EXTENSION ); position != std::string::npos; position = url.find( URL_EXTENSION, position + 1u ) )
+  {
+    if( position + extensionLength == url.size() )
+    {
+      break;
+    }
+
+    const std::string path = url.substr( 0u, position + extensionLength - 1u );
+    if( stat( path.c_str(), &fileStatus ) == 0 && S_ISREG( fileStatus.st_mode ) )
+    {
+      filePath = path;
+      entryName = url.substr( position + extensionLength );
+      break;
+    }
+  }
+}
+
+std::shared_ptr<const ImageArchive> ImageArchive::Get( const Url& url )
+{
+  // A cached archive is found with the status read when the url was split, without opening the file again:
+  std::shared_ptr<const ImageArchive> archive = FindCachedArchive( url.fileStatus );
+  if( !archive )
+  {
+    FileReader fileReader( url.filePath );
+    archive = Get( fileReader.GetFile() );
+  }
+  return archive;
+}
+
+std::shared_ptr<const ImageArchive> ImageArchive::Get( FILE* file )
+{
+  struct stat fileStat;
+  const int fileDescriptor = file ? fileno( file ) : -1;
+  if( fileDescriptor < 0 || fstat( fileDescriptor, &fileStat ) != 0 )
+  {
+    return nullptr;
+  }
+
+  std::shared_ptr<const ImageArchive> archive = FindCachedArchive( fileStat );
+  if( !archive )
+  {
+    std::shared_ptr<MappedFile> mappedFile( new MappedFile );
+    if( !mappedFile->Map( file ) || !Validate( *mappedFile ) )
+    {
+      return nullptr;
+    }
+
+    archive = CacheArchive( fileStat, std::shared_ptr<const ImageArchive>( new ImageArchive( std::move( mappedFile ) ) ) );
+  }
+  return archive;
+}
+
+bool ImageArchive::ReadHeader( FILE* file )
+{
+  uint8_t header[HEADER_SIZE];
+  return file && fread( header, 1u, HEADER_SIZE, file ) == HEADER_SIZE &&
+         memcmp( header, FILE_IDENTIFIER, sizeof( FILE_IDENTIFIER ) ) == 0;
+}
+
+bool ImageArchive::Write( const std::vector<std::pair<std::string, Dali::Devel::PixelBuffer>>& images, Dali::Vector<uint8_t>& archive )
+{
+  // The index is sorted by name, so an image can be found with a binary search:
+  std::vector<const std::pair<std::string, Dali::Devel::PixelBuffer>*> sortedImages;
+  sortedImages.reserve( images.size() );
+  for( const auto& image : images )
+  {
+    sortedImages.push_back( &image );
+  }
+  std::sort( sortedImages.begin(), sortedImages.end(),
+             []( const std::pair<std::string, Dali::Devel::PixelBuffer>* lhs, const std::pair<std::string, Dali::Devel::PixelBuffer>* rhs )
+             {
+               return lhs->first < rhs->first;
+             } );
+
+  uint64_t bytesOfNames = 0u;
+  for( std::size_t imageIndex = 0u; imageIndex < sortedImages.size(); ++imageIndex )
+  {
+    const auto& image = *sortedImages[imageIndex];
+    if( ( imageIndex > 0u && image.first == sortedImages[imageIndex - 1u]->first ) ||
+        !image.second || Dali::GetImplementation( image.second ).GetBufferSize() == 0u ||
+        image.second.GetWidth() == 0u || image.second.GetHeight() == 0u ||
+        image.second.GetWidth() > UINT16_MAX || image.second.GetHeight() > UINT16_MAX )
+    {
+      DALI_LOG_ERROR( "Can't add image %s to an archive\n", image.first.c_str() );
+      return false;
+    }
+    bytesOfNames += image.first.size();
+  }
+
+  // Lay the file out, checking it fits the 32 bit offsets:
+  const uint64_t namesOffset = HEADER_SIZE + static_cast<uint64_t>( sortedImages.size() ) * INDEX_ENTRY_SIZE;
+  uint64_t fileSize = namesOffset + bytesOfNames;
+  std::vector<uint32_t> offsets;
+  offsets.reserve( sortedImages.size() );
+  for( const auto* image : sortedImages )
+  {
+    fileSize = ( fileSize + PIXEL_ALIGNMENT - 1u ) & ~static_cast<uint64_t>( PIXEL_ALIGNMENT - 1u );
+    offsets.push_back( static_cast<uint32_t>( fileSize ) );
+    fileSize += Dali::GetImplementation( image->second ).GetBufferSize();
+  }
+  if( fileSize > UINT32_MAX )
+  {
+    DALI_LOG_ERROR( "Images too big for an archive\n" );
+    return false;
+  }
+
+  archive.Clear();
+  archive.Resize( static_cast<std::size_t>( fileSize ), 0u );
+  uint8_t* const data = archive.Begin();
+  memcpy( data, FILE_IDENTIFIER, sizeof( FILE_IDENTIFIER ) );
+  WriteUint32( data + 4, static_cast<uint32_t>( sortedImages.size() ) );
+  WriteUint32( data + 8, static_cast<uint32_t>( bytesOfNames ) );
+
+  uint32_t nameOffset = 0u;
+  for( std::size_t imageIndex = 0u; imageIndex < sortedImages.size(); ++imageIndex )
+  {
+    const std::string& name = sortedImages[imageIndex]->first;
+    const Internal::Adaptor::PixelBuffer& pixelBuffer = Dali::GetImplementation( sortedImages[imageIndex]->second );
+
+    uint8_t* const entry = data + HEADER_SIZE + imageIndex * INDEX_ENTRY_SIZE;
+    WriteUint32( entry, nameOffset );
+    WriteUint32( entry + 4, static_cast<uint32_t>( name.size() ) );
+    WriteUint32( entry + 8, offsets[imageIndex] );
+    WriteUint32( entry + 12, pixelBuffer.GetBufferSize() );
+    WriteUint16( entry + 16, static_cast<uint16_t>( pixelBuffer.GetWidth() ) );
+    WriteUint16( entry + 18, static_cast<uint16_t>( pixelBuffer.GetHeight() ) );
+    WriteUint32( entry + 20, static_cast<uint32_t>( pixelBuffer.GetPixelFormat() ) );
+
+    memcpy( data + namesOffset + nameOffset, name.data(), name.size() );
+    nameOffset += static_cast<uint32_t>( name.size() );
+
+    memcpy( data + offsets[imageIndex], pixelBuffer.GetConstBuffer(), pixelBuffer.GetBufferSize() );
+  }
+
+  return true;
+}
+
+bool ImageArchive::Find( const std::string& entryName, Entry& entry ) const
+{
+  uint32_t first = 0u;
+  uint32_t count = mNumberOfEntries;
+  while( count > 0u )
+  {
+    const uint32_t step = count / 2u;
+    const IndexEntry middle = ReadIndexEntry( mIndex, first + step );
+    if( CompareNames( mNames + middle.nameOffset, middle.nameLength, entryName.data(), entryName.size() ) < 0 )
+    {
+      first += step + 1u;
+      count -= step + 1u;
+    }
+    else
+    {
+      count = step;
+    }
+  }
+
+  if( first == mNumberOfEntries )
+  {
+    return false;
+  }
+
+  const IndexEntry found = ReadIndexEntry( mIndex, first );
+  if( CompareNames( mNames + found.nameOffset, found.nameLength, entryName.data(), entryName.size() ) != 0 )
+  {
+    return false;
+  }
+
+  entry.offset = found.offset;
+  entry.size = found.size;
+  entry.width = found.width;
+  entry.height = found.height;
+  entry.pixelFormat = static_cast<Pixel::Format>( found.pixelFormat );
+  return true;
+}
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Dali
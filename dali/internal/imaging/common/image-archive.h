@@ -0,0 +1,186 @@
+#ifndef DALI_INTERNAL_PLATFORM_IMAGE_ARCHIVE_H
+#define DALI_INTERNAL_PLATFORM_IMAGE_ARCHIVE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <sys/stat.h>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <utility>
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/common/vector-wrapper.h>
+#include <dali/public-api/images/pixel.h>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+class MappedFile;
+
+/**
+ * @brief A read-only archive of many images packed into one file, which is mapped into memory.
+ *
+ * The images are stored ready to upload, either decoded or as compressed textures,
+ * so loading one is a lookup in the index of the archive, and the pixels are used
+ * straight from the mapping. An image in an archive is loaded with a url of the
+ * form "icons.dpk#icon.png", the path of the archive, a '#', and the name of the image.
+ *
+ * The file is laid out as follows, with every value in little-endian order:
+ *
+ * - The header: the 4 bytes 'D', 'P', 'K', 1, then the number of images and
+ *   the size of the names as 32 bit values.
+ * - The index: for each image, in byte order of their names, the offset of its
+ *   name from the start of the names and the length of the name, the offset of
+ *   its pixels from the start of the file and their size, all 32 bit values,
+ *   then its width and height as 16 bit values and its Pixel::Format as a
+ *   32 bit value.
+ * - The names of the images, not terminated.
+ * - The pixels of each image, starting on a 16 byte boundary. Decoded images
+ *   are tightly packed, compressed textures are as they would be uploaded.
+ *
+ * Archives are cached once they are opened, so thousands of images can be loaded
+ * from one while mapping it only once. They are reopened if the file changes.
+ */
+class ImageArchive
+{
+public:
+
+  /**
+   * @brief Where an image is in an archive.
+   */
+  struct Entry
+  {
+    uint32_t      offset;      ///< The offset of the pixels from the start of the file
+    uint32_t      size;        ///< The size of the pixels in bytes
+    uint16_t      width;       ///< The width of the image in pixels
+    uint16_t      height;      ///< The height of the image in pixels
+    Pixel::Format pixelFormat; ///< The pixel format
+  };
+
+  /**
+   * @brief The url of an image, split into the file to open and the name of the image in it.
+   *
+   * Only a url whose part before ".dpk#" is an existing file is of an image in an
+   * archive, so splitting it reads the status of the file. The url is split once
+   * per load and passed down, so the loaders and the archive cache use that status.
+   */
+  struct Url
+  {
+    /**
+     * @brief Split a url.
+     * @param[in] url The url of the image, e.g. "icons.dpk#icon.png" or "icon.png"
+     */
+    explicit Url( const std::string& url );
+
+    /**
+     * @brief Whether the url is of an image in an archive.
+     * @return true if it is, false otherwise
+     */
+    bool IsInArchive() const
+    {
+      return !entryName.empty();
+    }
+
+    std::string filePath;   ///< The path of the archive if the image is in one, e.g. "icons.dpk", or else the whole url
+    std::string entryName;  ///< The name of the image in the archive, e.g. "icon.png", or empty if it isn't in one
+    struct stat fileStatus; ///< The status of the archive when the url was split, if the image is in one
+  };
+
+  /**
+   * @brief Get the archive an image is in, opening and mapping it unless it is cached.
+   * @param[in] url The url of the image, which must be in an archive
+   * @return The archive, or nullptr if the file isn't a valid archive
+   */
+  static std::shared_ptr<const ImageArchive> Get( const Url& url );
+
+  /**
+   * @brief Get the archive a stream reads, mapping it unless it is cached.
+   * @param[in] file The stream. Its position is left as it was.
+   * @return The archive, or nullptr if the file isn't a valid archive
+   */
+  static std::shared_ptr<const ImageArchive> Get( FILE* file );
+
+  /**
+   * @brief Check whether the start of a stream is the header of an archive.
+   * @param[in] file The stream, at the start of the file.
+   * @return true if it is an archive, false otherwise
+   */
+  static bool ReadHeader( FILE* file );
+
+  /**
+   * @brief Pack images into an archive.
+   * @param[in] images The name of each image, and its pixels. The names must be unique.
+   * @param[out] archive Set to the archive, to be saved to a file
+   * @return true if the archive was made, false if there are too many or too big images, or repeated names
+   */
+  static bool Write( const std::vector<std::pair<std::string, Dali::Devel::PixelBuffer>>& images, Dali::Vector<uint8_t>& archive );
+
+  /**
+   * @brief Destructor. Unmaps the file once no image is using it.
+   */
+  ~ImageArchive();
+
+  /**
+   * @brief Find an image in the archive.
+   * @param[in] entryName The name of the image
+   * @param[out] entry Set to where the image is in the archive
+   * @return true if the archive has the image, false otherwise
+   */
+  bool Find( const std::string& entryName, Entry& entry ) const;
+
+  /**
+   * @brief Get the mapped file, for the pixel buffers using the images in place.
+   * @return The mapped file
+   */
+  const std::shared_ptr<const MappedFile>& GetMappedFile() const
+  {
+    return mMappedFile;
+  }
+
+private:
+
+  /**
+   * @brief Create an archive from a mapped file, which must have been validated.
+   * @param[in] mappedFile The mapped file
+   */
+  explicit ImageArchive( std::shared_ptr<const MappedFile> mappedFile );
+
+  // Undefined
+  ImageArchive( const ImageArchive& );
+  ImageArchive& operator=( const ImageArchive& );
+
+private:
+
+  std::shared_ptr<const MappedFile> mMappedFile;      ///< The mapped file.
+  const uint8_t*                    mIndex;           ///< The index in the mapping.
+  const char*                       mNames;           ///< The names in the mapping.
+  uint32_t                          mNumberOfEntries; ///< The number of images.
+};
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Dali
+
+#endif // DALI_INTERNAL_PLATFORM_IMAGE_ARCHIVE_H
@@ -18,15 +18,18 @@
 
 #include <dali/devel-api/common/ref-counted-dali-vector.h>
 #include <dali/internal/imaging/common/pixel-buffer-impl.h>
+#include <dali/internal/imaging/common/pixel-buffer-pipeline.h>
 
 #include <dali/internal/imaging/common/loader-astc.h>
 #include <dali/internal/imaging/common/loader-bmp.h>
+#include <dali/internal/imaging/common/loader-dpk.h>
 #include <dali/internal/imaging/common/loader-gif.h>
 #include <dali/internal/imaging/common/loader-ico.h>
 #include <dali/internal/imaging/common/loader-jpeg.h>
 #include <dali/internal/imaging/common/loader-ktx.h>
 #include <dali/internal/imaging/common/loader-png.h>
 #include <dali/internal/imaging/common/loader-wbmp.h>
+#include <dali/internal/imaging/common/image-archive.h>
 #include <dali/internal/imaging/common/image-operations.h>
 #include <dali/devel-api/adaptor-framework/image-loader-input.h>
 #include <dali/internal/imaging/common/image-loader-plugin-proxy.h>
@@ -65,6 +68,7 @@ enum FileFormats
   FORMAT_KTX,
   FORMAT_ASTC,
   FORMAT_ICO,
+  FORMAT_DPK,
   FORMAT_MAGIC_BYTE_COUNT,
 
   // formats after this one do not use magic bytes
@@ -85,9 +89,42 @@ const Dali::ImageLoader::BitmapLoader BITMAP_LOADER_LOOKUP_TABLE[FORMAT_TOTAL_CO
   { Ktx::MAGIC_BYTE_1,  Ktx::MAGIC_BYTE_2,  LoadBitmapFromKtx,  LoadKtxHeader,  Bitmap::BITMAP_COMPRESSED       },
   { Astc::MAGIC_BYTE_1, Astc::MAGIC_BYTE_2, LoadBitmapFromAstc, LoadAstcHeader, Bitmap::BITMAP_COMPRESSED       },
   { Ico::MAGIC_BYTE_1,  Ico::MAGIC_BYTE_2,  LoadBitmapFromIco,  LoadIcoHeader,  Bitmap::BITMAP_2D_PACKED_PIXELS },
+  { Dpk::MAGIC_BYTE_1,  Dpk::MAGIC_BYTE_2,  LoadBitmapFromDpk,  LoadDpkHeader,  Bitmap::BITMAP_2D_PACKED_PIXELS },
   { 0x0,                0x0,                LoadBitmapFromWbmp, LoadWbmpHeader, Bitmap::BITMAP_2D_PACKED_PIXELS },
 };
 
+using LoadPlanesFunction = bool( * )( const Dali::ImageLoader::Input& input, std::vector<Dali::Devel::PixelBuffer>& pixelBuffers );
+using LoadLevelsFunction = bool( * )( const Dali::ImageLoader::Input& input, std::vector<Dali::Devel::PixelBuffer>& pixelBuffers, unsigned int& numberOfLayers );
+
+/**
+ * The other ways some formats can be decoded, found by the function they decode a bitmap with.
+ */
+struct OtherLoaders
+{
+  Dali::ImageLoader::LoadBitmapFunction loader;
+  LoadPlanesFunction planesLoader;
+  Dali::ImageLoader::LoadBitmapFunction previewLoader;
+  LoadLevelsFunction levelsLoader;
+};
+
+const OtherLoaders OTHER_LOADERS_LOOKUP_TABLE[] =
+{
+  { LoadBitmapFromJpeg, LoadPlanesFromJpeg, LoadPreviewFromJpeg, nullptr           },
+  { LoadBitmapFromKtx,  nullptr,            nullptr,             LoadLevelsFromKtx },
+};
+
+const OtherLoaders* GetOtherLoaders( Dali::ImageLoader::LoadBitmapFunction loader )
+{
+  for( const OtherLoaders& otherLoaders : OTHER_LOADERS_LOOKUP_TABLE )
+  {
+    if( otherLoaders.loader == loader )
+    {
+      return &otherLoaders;
+    }
+  }
+  return nullptr;
+}
+
 const unsigned int MAGIC_LENGTH = 2;
 
 /**
@@ -108,13 +145,21 @@ const FormatExtension FORMAT_EXTENSIONS[] =
  { ".ktx",  FORMAT_KTX  },
  { ".astc", FORMAT_ASTC },
  { ".ico",  FORMAT_ICO  },
+ { ".dpk",  FORMAT_DPK  },
  { ".wbmp", FORMAT_WBMP }
 };
 
 const unsigned int FORMAT_EXTENSIONS_COUNT = sizeof(FORMAT_EXTENSIONS) / sizeof(FormatExtension);
 
-FileFormats GetFormatHint( const std::string& filename )
+FileFormats GetFormatHint( const Internal::Platform::ImageArchive::Url& url )
 {
+  // An image in an archive is named by what follows the path of the archive:
+  if( url.IsInArchive() )
+  {
+    return FORMAT_DPK;
+  }
+
+  const std::string& filename = url.filePath;
   FileFormats format = FORMAT_UNKNOWN;
 
   for ( unsigned int i = 0; i < FORMAT_EXTENSIONS_COUNT; ++i )
@@ -251,7 +296,13 @@ bool GetBitmapLoaderFunctions( FILE *fp,
 namespace ImageLoader
 {
 
-bool ConvertStreamToBitmap( const BitmapResourceType& resource, std::string path, FILE * const fp, Dali::Devel::PixelBuffer& pixelBuffer )
+bool ConvertStreamToBitmap( const BitmapResourceType& resource, std::string path, FILE * const fp, Dali::Devel::PixelBuffer& pixelBuffer, bool metadataRequested )
+{
+  return ConvertStreamToBitmap( resource, Internal::Platform::ImageArchive::Url( path ), fp, Internal::Adaptor::PixelBufferPipeline(), pixelBuffer, metadataRequested );
+}
+
+bool ConvertStreamToBitmap( const BitmapResourceType& resource, const Internal::Platform::ImageArchive::Url& url, FILE * const fp,
+                            const Internal::Adaptor::PixelBufferPipeline& pipeline, Dali::Devel::PixelBuffer& pixelBuffer, bool metadataRequested )
 {
   DALI_LOG_TRACE_METHOD( gLogFilter );
 
@@ -265,67 +316,285 @@ bool ConvertStreamToBitmap( const BitmapResourceType& resource, std::string path
     Bitmap::Profile profile;
 
     if ( GetBitmapLoaderFunctions( fp,
-                                   GetFormatHint( path ),
+                                   GetFormatHint( url ),
                                    function,
                                    header,
                                    profile,
-                                   path ) )
+                                   url.filePath ) )
     {
       const Dali::ImageLoader::ScalingParameters scalingParameters( resource.size, resource.scalingMode, resource.samplingMode );
-      const Dali::ImageLoader::Input input( fp, scalingParameters, resource.orientationCorrection );
+      const Dali::ImageLoader::Input input( fp, scalingParameters, resource.orientationCorrection, metadataRequested,
+                                            url.entryName );
 
       // Run the image type decoder:
       result = function( input, pixelBuffer );
 
       if (!result)
       {
-        DALI_LOG_WARNING( "Unable to convert %s\n", path.c_str() );
+        DALI_LOG_WARNING( "Unable to convert %s\n", url.filePath.c_str() );
         pixelBuffer.Reset();
       }
 
-      pixelBuffer = Internal::Platform::ApplyAttributesToBitmap( pixelBuffer, resource.size, resource.scalingMode, resource.samplingMode );
+      if( pixelBuffer )
+      {
+        Internal::Adaptor::PixelBufferPipeline fittingPipeline( pipeline );
+        fittingPipeline.SetAttributes( resource.size, resource.scalingMode, resource.samplingMode );
+        pixelBuffer = Dali::Devel::PixelBuffer( fittingPipeline.Process( &GetImplementation( pixelBuffer ) ).Get() );
+      }
+    }
+    else
+    {
+      DALI_LOG_WARNING( "Image Decoder for %s unavailable\n", url.filePath.c_str() );
+    }
+  }
+
+  return result;
+}
+
+bool ConvertStreamToPlanes( const BitmapResourceType& resource, const Internal::Platform::ImageArchive::Url& url, FILE * const fp, std::vector<Dali::Devel::PixelBuffer>& pixelBuffers )
+{
+  DALI_LOG_TRACE_METHOD( gLogFilter );
+
+  bool result = false;
+  pixelBuffers.clear();
+
+  if (fp != NULL)
+  {
+    Dali::ImageLoader::LoadBitmapFunction function;
+    Dali::ImageLoader::LoadBitmapHeaderFunction header;
+
+    Bitmap::Profile profile;
+
+    if ( GetBitmapLoaderFunctions( fp,
+                                   GetFormatHint( url ),
+                                   function,
+                                   header,
+                                   profile,
+                                   url.filePath ) )
+    {
+      const Dali::ImageLoader::ScalingParameters scalingParameters( resource.size, resource.scalingMode, resource.samplingMode );
+      const Dali::ImageLoader::Input input( fp, scalingParameters, resource.orientationCorrection, false,
+                                            url.entryName );
+
+      const OtherLoaders* otherLoaders = GetOtherLoaders( function );
+      LoadPlanesFunction planesFunction = otherLoaders ? otherLoaders->planesLoader : nullptr;
+
+      // Run the image type decoder:
+      if( planesFunction )
+      {
+        result = planesFunction( input, pixelBuffers );
+      }
+      else
+      {
+        Dali::Devel::PixelBuffer pixelBuffer;
+        result = function( input, pixelBuffer ) && pixelBuffer;
+        if( result )
+        {
+          pixelBuffers.push_back( pixelBuffer );
+        }
+      }
+
+      if (!result)
+      {
+        DALI_LOG_WARNING( "Unable to convert %s\n", url.filePath.c_str() );
+        pixelBuffers.clear();
+      }
+
+      // Planes come out of the decoder at the size asked for, only a single bitmap may need processing:
+      if( pixelBuffers.size() == 1u )
+      {
+        Internal::Adaptor::PixelBufferPipeline pipeline;
+        pipeline.SetAttributes( resource.size, resource.scalingMode, resource.samplingMode );
+        pixelBuffers[0] = Dali::Devel::PixelBuffer( pipeline.Process( &GetImplementation( pixelBuffers[0] ) ).Get() );
+      }
     }
     else
     {
-      DALI_LOG_WARNING( "Image Decoder for %s unavailable\n", path.c_str() );
+      DALI_LOG_WARNING( "Image Decoder for %s unavailable\n", url.filePath.c_str() );
     }
   }
 
   return result;
 }
 
+bool ConvertStreamToPreview( const Internal::Platform::ImageArchive::Url& url, FILE * const fp, bool orientationCorrection, Dali::Devel::PixelBuffer& pixelBuffer )
+{
+  DALI_LOG_TRACE_METHOD( gLogFilter );
+
+  bool result = false;
+
+  if (fp != NULL)
+  {
+    Dali::ImageLoader::LoadBitmapFunction function;
+    Dali::ImageLoader::LoadBitmapHeaderFunction header;
+
+    Bitmap::Profile profile;
+
+    if ( GetBitmapLoaderFunctions( fp,
+                                   GetFormatHint( url ),
+                                   function,
+                                   header,
+                                   profile,
+                                   url.filePath ) )
+    {
+      const OtherLoaders* otherLoaders = GetOtherLoaders( function );
+      if( otherLoaders && otherLoaders->previewLoader )
+      {
+        const Dali::ImageLoader::Input input( fp, Dali::ImageLoader::ScalingParameters(), orientationCorrection, false );
+        result = otherLoaders->previewLoader( input, pixelBuffer ) && pixelBuffer;
+      }
+
+      if (!result)
+      {
+        pixelBuffer.Reset();
+      }
+    }
+  }
+
+  return result;
+}
+
+bool ConvertStreamToLevels( const Internal::Platform::ImageArchive::Url& url, FILE * const fp, std::vector<Dali::Devel::PixelBuffer>& pixelBuffers, unsigned int& numberOfLayers )
+{
+  DALI_LOG_TRACE_METHOD( gLogFilter );
+
+  bool result = false;
+  pixelBuffers.clear();
+  numberOfLayers = 0u;
+
+  if (fp != NULL)
+  {
+    Dali::ImageLoader::LoadBitmapFunction function;
+    Dali::ImageLoader::LoadBitmapHeaderFunction header;
+
+    Bitmap::Profile profile;
+
+    if ( GetBitmapLoaderFunctions( fp,
+                                   GetFormatHint( url ),
+                                   function,
+                                   header,
+                                   profile,
+                                   url.filePath ) )
+    {
+      const Dali::ImageLoader::Input input( fp, Dali::ImageLoader::ScalingParameters(), true, false,
+                                            url.entryName );
+
+      const OtherLoaders* otherLoaders = GetOtherLoaders( function );
+      LoadLevelsFunction levelsFunction = otherLoaders ? otherLoaders->levelsLoader : nullptr;
+
+      // Run the image type decoder:
+      if( levelsFunction )
+      {
+        result = levelsFunction( input, pixelBuffers, numberOfLayers );
+      }
+      else
+      {
+        Dali::Devel::PixelBuffer pixelBuffer;
+        result = function( input, pixelBuffer ) && pixelBuffer;
+        if( result )
+        {
+          pixelBuffers.push_back( pixelBuffer );
+          numberOfLayers = 1u;
+        }
+      }
+
+      if (!result)
+      {
+        DALI_LOG_WARNING( "Unable to convert %s\n", url.filePath.c_str() );
+        pixelBuffers.clear();
+        numberOfLayers = 0u;
+      }
+    }
+    else
+    {
+      DALI_LOG_WARNING( "Image Decoder for %s unavailable\n", url.filePath.c_str() );
+    }
+  }
+
+  return result;
+}
+
+bool ConvertArchiveEntryToBitmap( const BitmapResourceType& resource, const std::string& url, Dali::Devel::PixelBuffer& pixelBuffer, bool& result )
+{
+  return ConvertArchiveEntryToBitmap( resource, Internal::Platform::ImageArchive::Url( url ), Internal::Adaptor::PixelBufferPipeline(), pixelBuffer, result );
+}
+
+bool ConvertArchiveEntryToBitmap( const BitmapResourceType& resource, const Internal::Platform::ImageArchive::Url& url,
+                                  const Internal::Adaptor::PixelBufferPipeline& pipeline, Dali::Devel::PixelBuffer& pixelBuffer, bool& result )
+{
+  if( !url.IsInArchive() )
+  {
+    return false;
+  }
+
+  DALI_LOG_TRACE_METHOD( gLogFilter );
+
+  // The archive is usually cached, then neither a file is opened nor a loader probed for:
+  result = false;
+  std::shared_ptr<const Internal::Platform::ImageArchive> archive = Internal::Platform::ImageArchive::Get( url );
+  if( archive )
+  {
+    result = LoadBitmapFromImageArchive( *archive, url.entryName, pixelBuffer );
+  }
+  else
+  {
+    DALI_LOG_WARNING( "Unable to open image archive %s\n", url.filePath.c_str() );
+  }
+
+  if( !result )
+  {
+    pixelBuffer.Reset();
+  }
+
+  if( pixelBuffer )
+  {
+    Internal::Adaptor::PixelBufferPipeline fittingPipeline( pipeline );
+    fittingPipeline.SetAttributes( resource.size, resource.scalingMode, resource.samplingMode );
+    pixelBuffer = Dali::Devel::PixelBuffer( fittingPipeline.Process( &GetImplementation( pixelBuffer ) ).Get() );
+  }
+  return true;
+}
+
 ResourcePointer LoadImageSynchronously( const Integration::BitmapResourceType& resource, const std::string& path )
 {
   ResourcePointer result;
   Dali::Devel::PixelBuffer bitmap;
 
-  Internal::Platform::FileReader fileReader( path );
-  FILE * const fp = fileReader.GetFile();
-  if( fp != NULL )
+  const Internal::Platform::ImageArchive::Url url( path );
+  const Internal::Adaptor::PixelBufferPipeline pipeline;
+  bool success = false;
+  if( !ConvertArchiveEntryToBitmap( resource, url, pipeline, bitmap, success ) )
   {
-    bool success = ConvertStreamToBitmap(resource, path, fp, bitmap);
-    if (success && bitmap)
+    Internal::Platform::FileReader fileReader( url.filePath );
+    FILE * const fp = fileReader.GetFile();
+    if( fp != NULL )
     {
-      Bitmap::Profile profile{Bitmap::Profile::BITMAP_2D_PACKED_PIXELS};
+      // The Bitmap has nowhere to keep metadata:
+      success = ConvertStreamToBitmap( resource, url, fp, pipeline, bitmap, false );
+    }
+  }
 
-      // For backward compatibility the Bitmap must be created
-      auto retval = Bitmap::New(profile, Dali::ResourcePolicy::OWNED_DISCARD);
+  if (success && bitmap)
+  {
+    Bitmap::Profile profile{Bitmap::Profile::BITMAP_2D_PACKED_PIXELS};
 
-      DALI_LOG_SET_OBJECT_STRING( retval, path );
+    // For backward compatibility the Bitmap must be created
+    auto retval = Bitmap::New(profile, Dali::ResourcePolicy::OWNED_DISCARD);
 
-      retval->GetPackedPixelsProfile()->ReserveBuffer(
-              bitmap.GetPixelFormat(),
-              bitmap.GetWidth(),
-              bitmap.GetHeight(),
-              bitmap.GetWidth(),
-              bitmap.GetHeight()
-            );
+    DALI_LOG_SET_OBJECT_STRING( retval, path );
 
-      auto& impl = Dali::GetImplementation(bitmap);
+    retval->GetPackedPixelsProfile()->ReserveBuffer(
+            bitmap.GetPixelFormat(),
+            bitmap.GetWidth(),
+            bitmap.GetHeight(),
+            bitmap.GetWidth(),
+            bitmap.GetHeight()
+          );
 
-      std::copy( impl.GetBuffer(), impl.GetBuffer()+impl.GetBufferSize(), retval->GetBuffer());
-      result.Reset(retval);
-    }
+    auto& impl = Dali::GetImplementation(bitmap);
+
+    std::copy( impl.GetConstBuffer(), impl.GetConstBuffer()+impl.GetBufferSize(), retval->GetBuffer());
+    result.Reset(retval);
   }
   return result;
 }
@@ -340,7 +609,8 @@ ImageDimensions  GetClosestImageSize( const std::string& filename,
   unsigned int width = 0;
   unsigned int height = 0;
 
-  Internal::Platform::FileReader fileReader( filename );
+  const Internal::Platform::ImageArchive::Url url( filename );
+  Internal::Platform::FileReader fileReader( url.filePath );
   FILE *fp = fileReader.GetFile();
   if (fp != NULL)
   {
@@ -349,13 +619,14 @@ ImageDimensions  GetClosestImageSize( const std::string& filename,
     Bitmap::Profile profile;
 
     if ( GetBitmapLoaderFunctions( fp,
-                                   GetFormatHint(filename),
+                                   GetFormatHint( url ),
                                    loaderFunction,
                                    headerFunction,
                                    profile,
-                                   filename ) )
+                                   url.filePath ) )
     {
-      const Dali::ImageLoader::Input input( fp, Dali::ImageLoader::ScalingParameters( size, fittingMode, samplingMode ), orientationCorrection );
+      const Dali::ImageLoader::Input input( fp, Dali::ImageLoader::ScalingParameters( size, fittingMode, samplingMode ), orientationCorrection, true,
+                                            url.entryName );
 
       const bool read_res = headerFunction( input, width, height );
       if(!read_res)
@@ -23,7 +23,10 @@
 #include <dali/integration-api/bitmap.h>
 #include <dali/public-api/images/pixel-data.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/internal/imaging/common/image-archive.h>
+#include <dali/internal/imaging/common/pixel-buffer-pipeline.h>
 #include <string>
+#include <vector>
 
 namespace Dali
 {
@@ -42,9 +45,83 @@ namespace ImageLoader
  * @param[in] path The path to the resource.
  * @param[in] fp File Pointer. Closed on exit.
  * @param[out] bitmap Pointer to write bitmap to
+ * @param[in] metadataRequested Whether the metadata of the image will be asked for. Loading it is skipped if not.
  * @return true on success, false on failure
  */
-bool ConvertStreamToBitmap( const Integration::BitmapResourceType& resource, std::string path, FILE * const fp, Dali::Devel::PixelBuffer& pixelBuffer );
+bool ConvertStreamToBitmap( const Integration::BitmapResourceType& resource, std::string path, FILE * const fp, Dali::Devel::PixelBuffer& pixelBuffer, bool metadataRequested = true );
+
+/**
+ * Convert a file stream into a bitmap, running more post-processing steps along with the fitting mode.
+ * The steps, e.g. a mask, run in the same traversal of the pixels as the crop for the fitting mode.
+ * @param[in] resource The resource to convert.
+ * @param[in] url The url of the resource, split by the caller, which opened the file to read from it.
+ * @param[in] fp File Pointer. Closed on exit.
+ * @param[in] pipeline The steps to run after loading. The fitting mode of the resource is added to a copy of it.
+ * @param[out] bitmap Pointer to write bitmap to
+ * @param[in] metadataRequested Whether the metadata of the image will be asked for. Loading it is skipped if not.
+ * @return true on success, false on failure
+ */
+bool ConvertStreamToBitmap( const Integration::BitmapResourceType& resource, const Internal::Platform::ImageArchive::Url& url, FILE * const fp,
+                            const Internal::Adaptor::PixelBufferPipeline& pipeline, Dali::Devel::PixelBuffer& pixelBuffer, bool metadataRequested = true );
+
+/**
+ * Convert an image in an image archive into a bitmap, when the url is of one.
+ * The archive is looked up in the cache of mapped archives, without opening the file
+ * or probing for its format, and the bitmap uses the pixels in place.
+ * @param[in] resource The resource to convert.
+ * @param[in] url The url of the image, e.g. "icons.dpk#icon.png"
+ * @param[out] pixelBuffer Set to the bitmap
+ * @param[out] result Set to true on success, false on failure, if the url is of an image in an archive
+ * @return true if the url is of an image in an archive, false if it has to be loaded with ConvertStreamToBitmap()
+ */
+bool ConvertArchiveEntryToBitmap( const Integration::BitmapResourceType& resource, const std::string& url, Dali::Devel::PixelBuffer& pixelBuffer, bool& result );
+
+/**
+ * Convert an image in an image archive into a bitmap, when the url is of one, running more post-processing steps
+ * along with the fitting mode as ConvertStreamToBitmap() does.
+ * @param[in] resource The resource to convert.
+ * @param[in] url The url of the image, split by the caller. The archive cache is looked up with the status of the archive read while splitting it.
+ * @param[in] pipeline The steps to run after loading. The fitting mode of the resource is added to a copy of it.
+ * @param[out] pixelBuffer Set to the bitmap
+ * @param[out] result Set to true on success, false on failure, if the url is of an image in an archive
+ * @return true if the url is of an image in an archive, false if it has to be loaded with ConvertStreamToBitmap()
+ */
+bool ConvertArchiveEntryToBitmap( const Integration::BitmapResourceType& resource, const Internal::Platform::ImageArchive::Url& url,
+                                  const Internal::Adaptor::PixelBufferPipeline& pipeline, Dali::Devel::PixelBuffer& pixelBuffer, bool& result );
+
+/**
+ * Convert a file stream into the planes of its image, for formats which can be
+ * decoded to planes, or into a single bitmap.
+ * @param[in] resource The resource to convert.
+ * @param[in] url The url of the resource, split by the caller, which opened the file to read from it.
+ * @param[in] fp File Pointer. Closed on exit.
+ * @param[out] pixelBuffers Set to the planes, or to a single bitmap processed as by ConvertStreamToBitmap()
+ * @return true on success, false on failure
+ */
+bool ConvertStreamToPlanes( const Integration::BitmapResourceType& resource, const Internal::Platform::ImageArchive::Url& url, FILE * const fp,
+                            std::vector<Dali::Devel::PixelBuffer>& pixelBuffers );
+
+/**
+ * Convert a file stream into a small preview of its image, for formats which can decode one quickly.
+ * @param[in] url The url of the resource, split by the caller, which opened the file to read from it.
+ * @param[in] fp File Pointer. Closed on exit.
+ * @param[in] orientationCorrection Whether to reorient the preview as the image would be.
+ * @param[out] pixelBuffer Set to the preview, or reset if the format has no fast preview
+ * @return true on success, false on failure or if the format has no fast preview
+ */
+bool ConvertStreamToPreview( const Internal::Platform::ImageArchive::Url& url, FILE * const fp, bool orientationCorrection, Dali::Devel::PixelBuffer& pixelBuffer );
+
+/**
+ * Convert a file stream into the mipmap levels and array layers of a compressed texture,
+ * for formats which can hold them, or into a single bitmap.
+ * The images aren't scaled, as compressed textures are uploaded the way they are stored.
+ * @param[in] url The url of the resource, split by the caller, which opened the file to read from it.
+ * @param[in] fp File Pointer. Closed on exit.
+ * @param[out] pixelBuffers Set to the images, ordered by mipmap level and then by array layer
+ * @param[out] numberOfLayers Set to the number of array layers of each level
+ * @return true on success, false on failure
+ */
+bool ConvertStreamToLevels( const Internal::Platform::ImageArchive::Url& url, FILE * const fp, std::vector<Dali::Devel::PixelBuffer>& pixelBuffers, unsigned int& numberOfLayers );
 
 /**
  * Convert a bitmap and write to a file stream.
@@ -18,18 +18,36 @@
 #include <dali/internal/imaging/common/image-operations.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <stddef.h>
 #include <cmath>
 #include <limits>
+#include <list>
 #include <memory>
+#include <mutex>
+#include <vector>
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/math/vector2.h>
 #include <third-party/resampler/resampler.h>
 #include <dali/devel-api/adaptor-framework/image-loading.h>
 
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+#define DALI_IMAGE_OPERATIONS_X86_SIMD
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define DALI_IMAGE_OPERATIONS_NEON
+#include <arm_neon.h>
+#endif
+
 // INTERNAL INCLUDES
+#include <dali/internal/imaging/common/buffer-pool.h>
+#include <dali/internal/imaging/common/cpu-features.h>
+#include <dali/internal/imaging/common/worker-pool.h>
 
 namespace Dali
 {
@@ -499,767 +517,1985 @@ ImageDimensions CalculateDesiredDimensions( unsigned int bitmapWidth, unsigned i
 }
 
 /**
- * @brief Rotates the given buffer @p pixelsIn 90 degrees counter clockwise.
- *
- * @note It allocates memory for the returned @p pixelsOut buffer.
- * @note Code got from https://www.codeproject.com/Articles/202/High-quality-image-rotation-rotate-by-shear by Eran Yariv.
- * @note It may fail if malloc() fails to allocate memory.
- *
- * @param[in] pixelsIn The input buffer.
- * @param[in] widthIn The width of the input buffer.
- * @param[in] heightIn The height of the input buffer.
- * @param[in] pixelSize The size of the pixel.
- * @param[out] pixelsOut The rotated output buffer.
- * @param[out] widthOut The width of the output buffer.
- * @param[out] heightOut The height of the output buffer.
+ * @defgroup TransformKernels Building blocks of TransformPixels() and TransformPixelsInPlace().
  *
- * @return Whether the rotation succeded.
+ * The transforms which swap width and height are done a small square block
+ * at a time. Each block is read from and written to a few cache lines instead
+ * of every input pixel landing on a different output scanline. The blocks are
+ * walked in larger tiles so the output scanlines being filled stay in the cache
+ * and the TLB. A block is as many pixels wide as fit in a 16 byte vector, so
+ * one vector holds a scanline of it.
+ * @{
  */
-bool Rotate90( const uint8_t* const pixelsIn,
-               unsigned int widthIn,
-               unsigned int heightIn,
-               unsigned int pixelSize,
-               uint8_t*& pixelsOut,
-               unsigned int& widthOut,
-               unsigned int& heightOut )
-{
-  // The new size of the image.
-  widthOut = heightIn;
-  heightOut = widthIn;
-
-  // Allocate memory for the rotated buffer.
-  pixelsOut = static_cast<uint8_t*>( malloc ( widthOut * heightOut * pixelSize ) );
-  if( nullptr == pixelsOut )
-  {
-    widthOut = 0u;
-    heightOut = 0u;
 
-    // Return if the memory allocations fails.
-    return false;
-  }
+const unsigned int TRANSFORM_TILE_SIZE = 64u; ///< The width and height, in pixels, of the tiles the blocks are walked in.
 
-  // Rotate the buffer.
-  for( unsigned int y = 0u; y < heightIn; ++y )
+/**
+ * @brief Transpose one square block of pixels.
+ * @param[in] inRows Pointers to the first pixel of each scanline of the block in the input.
+ * @param[in] outRows Pointers to the first pixel of each scanline of the block in the output.
+ */
+typedef void (*TransposeBlockFunction)( const uint8_t* const* inRows, uint8_t* const* outRows );
+
+/**
+ * @brief Reverse the order of some whole 16 byte vectors of pixels.
+ * @return The number of pixels reversed. The caller deals with the remaining pixels.
+ */
+typedef unsigned int (*ReversePixelsFunction)( const uint8_t* pixelsIn, uint8_t* pixelsOut, unsigned int width );
+
+/**
+ * @brief Transpose a square block of pixels a pixel at a time.
+ */
+template< unsigned int PIXEL_SIZE, unsigned int BLOCK_SIZE >
+void TransposeBlock( const uint8_t* const* inRows, uint8_t* const* outRows )
+{
+  for( unsigned int outRow = 0u; outRow < BLOCK_SIZE; ++outRow )
   {
-    const unsigned int srcLineIndex = y * widthIn;
-    const unsigned int dstX = y;
-    for( unsigned int x = 0u; x < widthIn; ++x )
+    uint8_t* const out = outRows[outRow];
+    for( unsigned int inRow = 0u; inRow < BLOCK_SIZE; ++inRow )
     {
-      const unsigned int dstY = heightOut - x - 1u;
-      const unsigned int dstIndex = pixelSize * ( dstY * widthOut + dstX );
-      const unsigned int srcIndex = pixelSize * ( srcLineIndex + x );
-
-      for( unsigned int channel = 0u; channel < pixelSize; ++channel )
-      {
-        *( pixelsOut + dstIndex + channel ) = *( pixelsIn + srcIndex + channel );
-      }
+      memcpy( out + inRow * PIXEL_SIZE, inRows[inRow] + outRow * PIXEL_SIZE, PIXEL_SIZE );
     }
   }
+}
 
-  return true;
+#if defined(DALI_IMAGE_OPERATIONS_X86_SIMD)
+
+/** @brief Transpose an 8x8 matrix of 16 bit values held a row per vector. */
+__attribute__((target("sse2"))) inline void Transpose8x8Sse2( __m128i rows[8] )
+{
+  const __m128i a0 = _mm_unpacklo_epi16( rows[0], rows[1] );
+  const __m128i a1 = _mm_unpackhi_epi16( rows[0], rows[1] );
+  const __m128i a2 = _mm_unpacklo_epi16( rows[2], rows[3] );
+  const __m128i a3 = _mm_unpackhi_epi16( rows[2], rows[3] );
+  const __m128i a4 = _mm_unpacklo_epi16( rows[4], rows[5] );
+  const __m128i a5 = _mm_unpackhi_epi16( rows[4], rows[5] );
+  const __m128i a6 = _mm_unpacklo_epi16( rows[6], rows[7] );
+  const __m128i a7 = _mm_unpackhi_epi16( rows[6], rows[7] );
+
+  const __m128i b0 = _mm_unpacklo_epi32( a0, a2 );
+  const __m128i b1 = _mm_unpackhi_epi32( a0, a2 );
+  const __m128i b2 = _mm_unpacklo_epi32( a1, a3 );
+  const __m128i b3 = _mm_unpackhi_epi32( a1, a3 );
+  const __m128i b4 = _mm_unpacklo_epi32( a4, a6 );
+  const __m128i b5 = _mm_unpackhi_epi32( a4, a6 );
+  const __m128i b6 = _mm_unpacklo_epi32( a5, a7 );
+  const __m128i b7 = _mm_unpackhi_epi32( a5, a7 );
+
+  rows[0] = _mm_unpacklo_epi64( b0, b4 );
+  rows[1] = _mm_unpackhi_epi64( b0, b4 );
+  rows[2] = _mm_unpacklo_epi64( b1, b5 );
+  rows[3] = _mm_unpackhi_epi64( b1, b5 );
+  rows[4] = _mm_unpacklo_epi64( b2, b6 );
+  rows[5] = _mm_unpackhi_epi64( b2, b6 );
+  rows[6] = _mm_unpacklo_epi64( b3, b7 );
+  rows[7] = _mm_unpackhi_epi64( b3, b7 );
 }
 
-/**
- * @brief Rotates the given buffer @p pixelsIn 180 degrees counter clockwise.
- *
- * @note It allocates memory for the returned @p pixelsOut buffer.
- * @note Code got from https://www.codeproject.com/Articles/202/High-quality-image-rotation-rotate-by-shear by Eran Yariv.
- * @note It may fail if malloc() fails to allocate memory.
- *
- * @param[in] pixelsIn The input buffer.
- * @param[in] widthIn The width of the input buffer.
- * @param[in] heightIn The height of the input buffer.
- * @param[in] pixelSize The size of the pixel.
- * @param[out] pixelsOut The rotated output buffer.
- *
- * @return Whether the rotation succeded.
- */
-bool Rotate180( const uint8_t* const pixelsIn,
-                unsigned int widthIn,
-                unsigned int heightIn,
-                unsigned int pixelSize,
-                uint8_t*& pixelsOut )
-{
-  // Allocate memory for the rotated buffer.
-  pixelsOut = static_cast<uint8_t*>( malloc ( widthIn * heightIn * pixelSize ) );
-  if( nullptr == pixelsOut )
+/** @brief Transpose a 16x16 block of 1 byte pixels. */
+__attribute__((target("sse2"))) void TransposeBlock1Sse2( const uint8_t* const* inRows, uint8_t* const* outRows )
+{
+  // Interleave pairs of scanlines, leaving two 8x8 matrices of 16 bit pixel pairs to transpose:
+  __m128i low[8];
+  __m128i high[8];
+  for( unsigned int i = 0u; i < 8u; ++i )
   {
-    // Return if the memory allocations fails.
-    return false;
+    const __m128i row0 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( inRows[i * 2u] ) );
+    const __m128i row1 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( inRows[i * 2u + 1u] ) );
+    low[i] = _mm_unpacklo_epi8( row0, row1 );
+    high[i] = _mm_unpackhi_epi8( row0, row1 );
   }
-
-  // Rotate the buffer.
-  for( unsigned int y = 0u; y < heightIn; ++y )
+  Transpose8x8Sse2( low );
+  Transpose8x8Sse2( high );
+  for( unsigned int i = 0u; i < 8u; ++i )
   {
-    const unsigned int srcLineIndex = y * widthIn;
-    const unsigned int dstY = heightIn - y - 1u;
-    for( unsigned int x = 0u; x < widthIn; ++x )
-    {
-      const unsigned int dstX = widthIn - x - 1u;
-      const unsigned int dstIndex = pixelSize * ( dstY * widthIn + dstX );
-      const unsigned int srcIndex = pixelSize * ( srcLineIndex + x );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( outRows[i] ), low[i] );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( outRows[i + 8u] ), high[i] );
+  }
+}
 
-      for( unsigned int channel = 0u; channel < pixelSize; ++channel )
-      {
-        *( pixelsOut + dstIndex + channel ) = *( pixelsIn + srcIndex + channel );
-      }
-    }
+/** @brief Transpose an 8x8 block of 2 byte pixels. */
+__attribute__((target("sse2"))) void TransposeBlock2Sse2( const uint8_t* const* inRows, uint8_t* const* outRows )
+{
+  __m128i rows[8];
+  for( unsigned int i = 0u; i < 8u; ++i )
+  {
+    rows[i] = _mm_loadu_si128( reinterpret_cast<const __m128i*>( inRows[i] ) );
+  }
+  Transpose8x8Sse2( rows );
+  for( unsigned int i = 0u; i < 8u; ++i )
+  {
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( outRows[i] ), rows[i] );
   }
+}
 
-  return true;
+/** @brief Transpose a 4x4 block of 4 byte pixels. */
+__attribute__((target("sse2"))) void TransposeBlock4Sse2( const uint8_t* const* inRows, uint8_t* const* outRows )
+{
+  const __m128i row0 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( inRows[0] ) );
+  const __m128i row1 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( inRows[1] ) );
+  const __m128i row2 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( inRows[2] ) );
+  const __m128i row3 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( inRows[3] ) );
+
+  const __m128i a0 = _mm_unpacklo_epi32( row0, row1 );
+  const __m128i a1 = _mm_unpackhi_epi32( row0, row1 );
+  const __m128i a2 = _mm_unpacklo_epi32( row2, row3 );
+  const __m128i a3 = _mm_unpackhi_epi32( row2, row3 );
+
+  _mm_storeu_si128( reinterpret_cast<__m128i*>( outRows[0] ), _mm_unpacklo_epi64( a0, a2 ) );
+  _mm_storeu_si128( reinterpret_cast<__m128i*>( outRows[1] ), _mm_unpackhi_epi64( a0, a2 ) );
+  _mm_storeu_si128( reinterpret_cast<__m128i*>( outRows[2] ), _mm_unpacklo_epi64( a1, a3 ) );
+  _mm_storeu_si128( reinterpret_cast<__m128i*>( outRows[3] ), _mm_unpackhi_epi64( a1, a3 ) );
 }
 
-/**
- * @brief Rotates the given buffer @p pixelsIn 270 degrees counter clockwise.
- *
- * @note It allocates memory for the returned @p pixelsOut buffer.
- * @note Code got from https://www.codeproject.com/Articles/202/High-quality-image-rotation-rotate-by-shear by Eran Yariv.
- * @note It may fail if malloc() fails to allocate memory.
- *
- * @param[in] pixelsIn The input buffer.
- * @param[in] widthIn The width of the input buffer.
- * @param[in] heightIn The height of the input buffer.
- * @param[in] pixelSize The size of the pixel.
- * @param[out] pixelsOut The rotated output buffer.
- * @param[out] widthOut The width of the output buffer.
- * @param[out] heightOut The height of the output buffer.
- *
- * @return Whether the rotation succeded.
- */
-bool Rotate270( const uint8_t* const pixelsIn,
-                unsigned int widthIn,
-                unsigned int heightIn,
-                unsigned int pixelSize,
-                uint8_t*& pixelsOut,
-                unsigned int& widthOut,
-                unsigned int& heightOut )
-{
-  // The new size of the image.
-  widthOut = heightIn;
-  heightOut = widthIn;
-
-  // Allocate memory for the rotated buffer.
-  pixelsOut = static_cast<uint8_t*>( malloc ( widthOut * heightOut * pixelSize ) );
-  if( nullptr == pixelsOut )
-  {
-    widthOut = 0u;
-    heightOut = 0u;
+/** @brief Reverse the order of the 16 bit values in a vector. */
+__attribute__((target("sse2"))) inline __m128i Reverse16BitSse2( __m128i pixels )
+{
+  pixels = _mm_shuffle_epi32( pixels, _MM_SHUFFLE( 1, 0, 3, 2 ) );
+  pixels = _mm_shufflelo_epi16( pixels, _MM_SHUFFLE( 0, 1, 2, 3 ) );
+  return _mm_shufflehi_epi16( pixels, _MM_SHUFFLE( 0, 1, 2, 3 ) );
+}
 
-    // Return if the memory allocations fails.
-    return false;
+/** @brief Reverse the order of a scanline's 1 byte pixels. */
+__attribute__((target("sse2"))) unsigned int ReversePixels1Sse2( const uint8_t* pixelsIn, uint8_t* pixelsOut, unsigned int width )
+{
+  const unsigned int numVectors = width / 16u;
+  for( unsigned int i = 0u; i < numVectors; ++i )
+  {
+    const __m128i pixels = Reverse16BitSse2( _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixelsIn + width - ( i + 1u ) * 16u ) ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( pixelsOut + i * 16u ), _mm_or_si128( _mm_slli_epi16( pixels, 8 ), _mm_srli_epi16( pixels, 8 ) ) );
   }
+  return numVectors * 16u;
+}
 
-  // Rotate the buffer.
-  for( unsigned int y = 0u; y < heightIn; ++y )
+/** @brief Reverse the order of a scanline's 2 byte pixels. */
+__attribute__((target("sse2"))) unsigned int ReversePixels2Sse2( const uint8_t* pixelsIn, uint8_t* pixelsOut, unsigned int width )
+{
+  const unsigned int numVectors = width / 8u;
+  for( unsigned int i = 0u; i < numVectors; ++i )
   {
-    const unsigned int srcLineIndex = y * widthIn;
-    const unsigned int dstX = widthOut - y - 1u;
-    for( unsigned int x = 0u; x < widthIn; ++x )
-    {
-      const unsigned int dstY = x;
-      const unsigned int dstIndex = pixelSize * ( dstY * widthOut + dstX );
-      const unsigned int srcIndex = pixelSize * ( srcLineIndex + x );
-
-      for( unsigned int channel = 0u; channel < pixelSize; ++channel )
-      {
-        *( pixelsOut + dstIndex + channel ) = *( pixelsIn + srcIndex + channel );
-      }
-    }
+    const __m128i pixels = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixelsIn + ( width - ( i + 1u ) * 8u ) * 2u ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( pixelsOut + i * 16u ), Reverse16BitSse2( pixels ) );
   }
-
-  return true;
+  return numVectors * 8u;
 }
 
-/**
- * @brief Skews a row horizontally (with filtered weights)
- *
- * @note Limited to 45 degree skewing only.
- * @note Code got from https://www.codeproject.com/Articles/202/High-quality-image-rotation-rotate-by-shear by Eran Yariv.
- *
- * @param[in] srcBufferPtr Pointer to the input pixel buffer.
- * @param[in] srcWidth The width of the input pixel buffer.
- * @param[in] pixelSize The size of the pixel.
- * @param[in,out] dstPixelBuffer Pointer to the output pixel buffer.
- * @param[in] dstWidth The width of the output pixel buffer.
- * @param[in] row The row index.
- * @param[in] offset The skew offset.
- * @param[in] weight The relative weight of right pixel.
- */
-void HorizontalSkew( const uint8_t* const srcBufferPtr,
-                     int srcWidth,
-                     unsigned int pixelSize,
-                     uint8_t*& dstBufferPtr,
-                     int dstWidth,
-                     unsigned int row,
-                     int offset,
-                     float weight )
+/** @brief Reverse the order of a scanline's 4 byte pixels. */
+__attribute__((target("sse2"))) unsigned int ReversePixels4Sse2( const uint8_t* pixelsIn, uint8_t* pixelsOut, unsigned int width )
 {
-  if( offset > 0 )
+  const unsigned int numVectors = width / 4u;
+  for( unsigned int i = 0u; i < numVectors; ++i )
   {
-    // Fill gap left of skew with background.
-    memset( dstBufferPtr + row * pixelSize * dstWidth, 0u, pixelSize * offset );
+    const __m128i pixels = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixelsIn + ( width - ( i + 1u ) * 4u ) * 4u ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( pixelsOut + i * 16u ), _mm_shuffle_epi32( pixels, _MM_SHUFFLE( 0, 1, 2, 3 ) ) );
   }
+  return numVectors * 4u;
+}
 
-  unsigned char oldLeft[4u] = { 0u, 0u, 0u, 0u };
+#endif // DALI_IMAGE_OPERATIONS_X86_SIMD
 
-  int i = 0;
-  for( i = 0u; i < srcWidth; ++i )
-  {
-    // Loop through row pixels
-    const unsigned int srcIndex = pixelSize * ( row * srcWidth + i );
+#if defined(DALI_IMAGE_OPERATIONS_NEON)
 
-    unsigned char src[4u] = { 0u, 0u, 0u, 0u };
-    for( unsigned int channel = 0u; channel < pixelSize; ++channel )
-    {
-      src[channel] = *( srcBufferPtr + srcIndex + channel );
-    }
+/** @brief Transpose an 8x8 matrix of 16 bit values held a row per vector. */
+inline void Transpose8x8Neon( uint16x8_t rows[8] )
+{
+  uint32x4x2_t b[4];
+  for( unsigned int i = 0u; i < 2u; ++i )
+  {
+    const uint16x8x2_t a01 = vzipq_u16( rows[i * 4u], rows[i * 4u + 1u] );
+    const uint16x8x2_t a23 = vzipq_u16( rows[i * 4u + 2u], rows[i * 4u + 3u] );
+    b[i * 2u] = vzipq_u32( vreinterpretq_u32_u16( a01.val[0] ), vreinterpretq_u32_u16( a23.val[0] ) );
+    b[i * 2u + 1u] = vzipq_u32( vreinterpretq_u32_u16( a01.val[1] ), vreinterpretq_u32_u16( a23.val[1] ) );
+  }
+  for( unsigned int i = 0u; i < 4u; ++i )
+  {
+    // Pair up the halves of the first four scanlines' columns with the last four's:
+    const uint32x4_t top = b[i / 2u].val[i % 2u];
+    const uint32x4_t bottom = b[2u + i / 2u].val[i % 2u];
+    rows[i * 2u] = vreinterpretq_u16_u32( vcombine_u32( vget_low_u32( top ), vget_low_u32( bottom ) ) );
+    rows[i * 2u + 1u] = vreinterpretq_u16_u32( vcombine_u32( vget_high_u32( top ), vget_high_u32( bottom ) ) );
+  }
+}
 
-    // Calculate weights
-    unsigned char left[4u] = { 0u, 0u, 0u, 0u };
-    for( unsigned int channel = 0u; channel < pixelSize; ++channel )
-    {
-      left[channel] = static_cast<unsigned char>( static_cast<float>( src[channel] ) * weight );
+/** @brief Transpose a 16x16 block of 1 byte pixels. */
+void TransposeBlock1Neon( const uint8_t* const* inRows, uint8_t* const* outRows )
+{
+  // Interleave pairs of scanlines, leaving two 8x8 matrices of 16 bit pixel pairs to transpose:
+  uint16x8_t low[8];
+  uint16x8_t high[8];
+  for( unsigned int i = 0u; i < 8u; ++i )
+  {
+    const uint8x16x2_t pairs = vzipq_u8( vld1q_u8( inRows[i * 2u] ), vld1q_u8( inRows[i * 2u + 1u] ) );
+    low[i] = vreinterpretq_u16_u8( pairs.val[0] );
+    high[i] = vreinterpretq_u16_u8( pairs.val[1] );
+  }
+  Transpose8x8Neon( low );
+  Transpose8x8Neon( high );
+  for( unsigned int i = 0u; i < 8u; ++i )
+  {
+    vst1q_u8( outRows[i], vreinterpretq_u8_u16( low[i] ) );
+    vst1q_u8( outRows[i + 8u], vreinterpretq_u8_u16( high[i] ) );
+  }
+}
 
-      // Update left over on source
-      src[channel] -= ( left[channel] - oldLeft[channel] );
-    }
+/** @brief Transpose an 8x8 block of 2 byte pixels. */
+void TransposeBlock2Neon( const uint8_t* const* inRows, uint8_t* const* outRows )
+{
+  uint16x8_t rows[8];
+  for( unsigned int i = 0u; i < 8u; ++i )
+  {
+    rows[i] = vreinterpretq_u16_u8( vld1q_u8( inRows[i] ) );
+  }
+  Transpose8x8Neon( rows );
+  for( unsigned int i = 0u; i < 8u; ++i )
+  {
+    vst1q_u8( outRows[i], vreinterpretq_u8_u16( rows[i] ) );
+  }
+}
 
-    // Check boundaries
-    if( ( i + offset >= 0 ) && ( i + offset < dstWidth ) )
-    {
-      const unsigned int dstIndex = pixelSize * ( row * dstWidth + i + offset );
+/** @brief Transpose a 4x4 block of 4 byte pixels. */
+void TransposeBlock4Neon( const uint8_t* const* inRows, uint8_t* const* outRows )
+{
+  const uint32x4x2_t a01 = vzipq_u32( vreinterpretq_u32_u8( vld1q_u8( inRows[0] ) ), vreinterpretq_u32_u8( vld1q_u8( inRows[1] ) ) );
+  const uint32x4x2_t a23 = vzipq_u32( vreinterpretq_u32_u8( vld1q_u8( inRows[2] ) ), vreinterpretq_u32_u8( vld1q_u8( inRows[3] ) ) );
 
-      for( unsigned int channel = 0u; channel < pixelSize; ++channel )
-      {
-        *( dstBufferPtr + dstIndex + channel ) = src[channel];
-      }
-    }
+  vst1q_u8( outRows[0], vreinterpretq_u8_u32( vcombine_u32( vget_low_u32( a01.val[0] ), vget_low_u32( a23.val[0] ) ) ) );
+  vst1q_u8( outRows[1], vreinterpretq_u8_u32( vcombine_u32( vget_high_u32( a01.val[0] ), vget_high_u32( a23.val[0] ) ) ) );
+  vst1q_u8( outRows[2], vreinterpretq_u8_u32( vcombine_u32( vget_low_u32( a01.val[1] ), vget_low_u32( a23.val[1] ) ) ) );
+  vst1q_u8( outRows[3], vreinterpretq_u8_u32( vcombine_u32( vget_high_u32( a01.val[1] ), vget_high_u32( a23.val[1] ) ) ) );
+}
 
-    // Save leftover for next pixel in scan
-    for( unsigned int channel = 0u; channel < pixelSize; ++channel )
-    {
-      oldLeft[channel] = left[channel];
-    }
+/** @brief Reverse the order of a scanline's 1 byte pixels. */
+unsigned int ReversePixels1Neon( const uint8_t* pixelsIn, uint8_t* pixelsOut, unsigned int width )
+{
+  const unsigned int numVectors = width / 16u;
+  for( unsigned int i = 0u; i < numVectors; ++i )
+  {
+    const uint8x16_t pixels = vrev64q_u8( vld1q_u8( pixelsIn + width - ( i + 1u ) * 16u ) );
+    vst1q_u8( pixelsOut + i * 16u, vcombine_u8( vget_high_u8( pixels ), vget_low_u8( pixels ) ) );
   }
+  return numVectors * 16u;
+}
 
-  // Go to rightmost point of skew
-  i += offset;
-  if( i < dstWidth )
+/** @brief Reverse the order of a scanline's 2 byte pixels. */
+unsigned int ReversePixels2Neon( const uint8_t* pixelsIn, uint8_t* pixelsOut, unsigned int width )
+{
+  const unsigned int numVectors = width / 8u;
+  for( unsigned int i = 0u; i < numVectors; ++i )
   {
-    // If still in image bounds, put leftovers there
-    const unsigned int dstIndex = pixelSize * ( row * dstWidth + i );
-
-    for( unsigned int channel = 0u; channel < pixelSize; ++channel )
-    {
-      *( dstBufferPtr + dstIndex + channel ) = oldLeft[channel];
-    }
+    const uint16x8_t pixels = vrev64q_u16( vreinterpretq_u16_u8( vld1q_u8( pixelsIn + ( width - ( i + 1u ) * 8u ) * 2u ) ) );
+    vst1q_u8( pixelsOut + i * 16u, vreinterpretq_u8_u16( vcombine_u16( vget_high_u16( pixels ), vget_low_u16( pixels ) ) ) );
+  }
+  return numVectors * 8u;
+}
 
-    // Clear to the right of the skewed line with background
-    ++i;
-    memset( dstBufferPtr + pixelSize * ( row * dstWidth + i ), 0u, pixelSize * ( dstWidth - i ) );
+/** @brief Reverse the order of a scanline's 4 byte pixels. */
+unsigned int ReversePixels4Neon( const uint8_t* pixelsIn, uint8_t* pixelsOut, unsigned int width )
+{
+  const unsigned int numVectors = width / 4u;
+  for( unsigned int i = 0u; i < numVectors; ++i )
+  {
+    const uint32x4_t pixels = vrev64q_u32( vreinterpretq_u32_u8( vld1q_u8( pixelsIn + ( width - ( i + 1u ) * 4u ) * 4u ) ) );
+    vst1q_u8( pixelsOut + i * 16u, vreinterpretq_u8_u32( vcombine_u32( vget_high_u32( pixels ), vget_low_u32( pixels ) ) ) );
   }
+  return numVectors * 4u;
 }
 
+#endif // DALI_IMAGE_OPERATIONS_NEON
+
 /**
- * @brief Skews a column vertically (with filtered weights)
- *
- * @note Limited to 45 degree skewing only.
- * @note Code got from https://www.codeproject.com/Articles/202/High-quality-image-rotation-rotate-by-shear by Eran Yariv.
- *
- * @param[in] srcBufferPtr Pointer to the input pixel buffer.
- * @param[in] srcWidth The width of the input pixel buffer.
- * @param[in] srcHeight The height of the input pixel buffer.
+ * @brief The block transposition to use for a pixel size.
+ */
+struct TransposeKernel
+{
+  unsigned int blockSize;          ///< The width and height of a block in pixels.
+  TransposeBlockFunction function; ///< Transposes one block.
+};
+
+/**
+ * @brief Pick the fastest block transposition available for a pixel size.
  * @param[in] pixelSize The size of the pixel.
- * @param[in,out] dstPixelBuffer Pointer to the output pixel buffer.
- * @param[in] dstWidth The width of the output pixel buffer.
- * @param[in] dstHeight The height of the output pixel buffer.
- * @param[in] column The column index.
- * @param[in] offset The skew offset.
- * @param[in] weight The relative weight of uppeer pixel.
+ * @return The kernel to use. Its function is nullptr for pixels of more than 4 bytes, which are moved one at a time.
  */
-void VerticalSkew( const uint8_t* const srcBufferPtr,
-                   int srcWidth,
-                   int srcHeight,
-                   unsigned int pixelSize,
-                   uint8_t*& dstBufferPtr,
-                   int dstWidth,
-                   int dstHeight,
-                   unsigned int column,
-                   int offset,
-                   float weight )
+TransposeKernel GetTransposeKernel( unsigned int pixelSize )
 {
-  for( int i = 0; i < offset; ++i )
+#if defined(DALI_IMAGE_OPERATIONS_X86_SIMD)
+  if( HasCpuFeature( CPU_FEATURE_SSE2 ) )
   {
-    // Fill gap above skew with background
-    const unsigned int dstIndex = pixelSize * ( i * dstWidth + column );
-
-    for( unsigned int channel = 0u; channel < pixelSize; ++channel )
+    switch( pixelSize )
     {
-      *( dstBufferPtr + dstIndex + channel ) = 0u;
+      case 1u: return TransposeKernel{ 16u, &TransposeBlock1Sse2 };
+      case 2u: return TransposeKernel{ 8u, &TransposeBlock2Sse2 };
+      case 4u: return TransposeKernel{ 4u, &TransposeBlock4Sse2 };
+      default: break;
     }
   }
-
-  unsigned char oldLeft[4u] = { 0u, 0u, 0u, 0u };
-
-  int yPos = 0;
-  int i = 0;
-  for( i = 0; i < srcHeight; ++i )
+#elif defined(DALI_IMAGE_OPERATIONS_NEON)
+  if( HasCpuFeature( CPU_FEATURE_NEON ) )
   {
-    // Loop through column pixels
-    const unsigned int srcIndex = pixelSize * ( i * srcWidth + column );
-
-    unsigned char src[4u] = { 0u, 0u, 0u, 0u };
-    for( unsigned int channel = 0u; channel < pixelSize; ++channel )
-    {
-      src[channel] = *( srcBufferPtr + srcIndex + channel );
-    }
-
-    yPos = i + offset;
-
-    // Calculate weights
-    unsigned char left[4u] = { 0u, 0u, 0u, 0u };
-    for( unsigned int channel = 0u; channel < pixelSize; ++channel )
-    {
-      left[channel] = static_cast<unsigned char>( static_cast<float>( src[channel] ) * weight );
-      // Update left over on source
-      src[channel] -= ( left[channel] - oldLeft[channel] );
-    }
-
-    // Check boundaries
-    if( ( yPos >= 0 ) && ( yPos < dstHeight ) )
-    {
-      const unsigned int dstIndex = pixelSize * ( yPos * dstWidth + column );
-
-      for( unsigned int channel = 0u; channel < pixelSize; ++channel )
-      {
-        *( dstBufferPtr + dstIndex + channel ) = src[channel];
-      }
-    }
-
-    // Save leftover for next pixel in scan
-    for( unsigned int channel = 0u; channel < pixelSize; ++channel )
+    switch( pixelSize )
     {
-      oldLeft[channel] = left[channel];
+      case 1u: return TransposeKernel{ 16u, &TransposeBlock1Neon };
+      case 2u: return TransposeKernel{ 8u, &TransposeBlock2Neon };
+      case 4u: return TransposeKernel{ 4u, &TransposeBlock4Neon };
+      default: break;
     }
   }
+#endif
 
-  // Go to bottom point of skew
-  i = yPos;
-  if( i < dstHeight )
+  // 3 byte pixels don't divide a vector evenly, so they are always copied a pixel at a time:
+  switch( pixelSize )
   {
-    // If still in image bounds, put leftovers there
-    const unsigned int dstIndex = pixelSize * ( i * dstWidth + column );
+    case 1u: return TransposeKernel{ 16u, &TransposeBlock<1u, 16u> };
+    case 2u: return TransposeKernel{ 8u, &TransposeBlock<2u, 8u> };
+    case 3u: return TransposeKernel{ 8u, &TransposeBlock<3u, 8u> };
+    case 4u: return TransposeKernel{ 4u, &TransposeBlock<4u, 4u> };
+    default: return TransposeKernel{ 1u, nullptr };
+  }
+}
 
-    for( unsigned int channel = 0u; channel < pixelSize; ++channel )
+/**
+ * @brief Pick the vectorised scanline reversal for a pixel size, if there is one.
+ * @param[in] pixelSize The size of the pixel.
+ * @return The kernel to use, or nullptr to reverse every pixel with the scalar code.
+ */
+ReversePixelsFunction GetReversePixelsKernel( unsigned int pixelSize )
+{
+#if defined(DALI_IMAGE_OPERATIONS_X86_SIMD)
+  if( HasCpuFeature( CPU_FEATURE_SSE2 ) )
+  {
+    switch( pixelSize )
     {
-      *( dstBufferPtr + dstIndex + channel ) = oldLeft[channel];
+      case 1u: return &ReversePixels1Sse2;
+      case 2u: return &ReversePixels2Sse2;
+      case 4u: return &ReversePixels4Sse2;
+      default: break;
     }
   }
-
-  while( ++i < dstHeight )
+#elif defined(DALI_IMAGE_OPERATIONS_NEON)
+  if( HasCpuFeature( CPU_FEATURE_NEON ) )
   {
-    // Clear below skewed line with background
-    const unsigned int dstIndex = pixelSize * ( i * dstWidth + column );
-
-    for( unsigned int channel = 0u; channel < pixelSize; ++channel )
+    switch( pixelSize )
     {
-      *( dstBufferPtr + dstIndex + channel ) = 0u;
+      case 1u: return &ReversePixels1Neon;
+      case 2u: return &ReversePixels2Neon;
+      case 4u: return &ReversePixels4Neon;
+      default: break;
     }
   }
+#endif
+  return nullptr;
 }
 
-} // namespace - unnamed
-
-ImageDimensions CalculateDesiredDimensions( ImageDimensions rawDimensions, ImageDimensions requestedDimensions )
+/**
+ * @brief Write a scanline with its pixels in reverse order.
+ * @pre @p pixelsIn must not alias @p pixelsOut.
+ * @param[in] pixelsIn The scanline to reverse.
+ * @param[out] pixelsOut The reversed scanline.
+ * @param[in] width The number of pixels in the scanline.
+ * @param[in] pixelSize The size of the pixel.
+ * @param[in] kernel The vectorised reversal to use, or nullptr.
+ */
+void ReverseScanline( const uint8_t* pixelsIn, uint8_t* pixelsOut, unsigned int width, unsigned int pixelSize, ReversePixelsFunction kernel )
 {
-  return CalculateDesiredDimensions( rawDimensions.GetWidth(), rawDimensions.GetHeight(), requestedDimensions.GetWidth(), requestedDimensions.GetHeight() ) ;
+  for( unsigned int x = kernel ? kernel( pixelsIn, pixelsOut, width ) : 0u; x < width; ++x )
+  {
+    memcpy( pixelsOut + x * pixelSize, pixelsIn + ( width - 1u - x ) * pixelSize, pixelSize );
+  }
 }
 
 /**
- * @brief Apply cropping and padding for specified fitting mode.
- *
- * Once the bitmap has been (optionally) downscaled to an appropriate size, this method performs alterations
- * based on the fitting mode.
- *
- * This will add vertical or horizontal borders if necessary.
- * Crop the source image data vertically or horizontally if necessary.
- * The aspect of the source image is preserved.
- * If the source image is smaller than the desired size, the algorithm will modify the the newly created
- *   bitmaps dimensions to only be as large as necessary, as a memory saving optimization. This will cause
- *   GPU scaling to be performed at render time giving the same result with less texture traversal.
- *
- * @param[in] bitmap            The source pixel buffer to perform modifications on.
- * @param[in] desiredDimensions The target dimensions to aim to fill based on the fitting mode.
- * @param[in] fittingMode       The fitting mode to use.
- *
- * @return                      A new bitmap with the padding and cropping required for fitting mode applied.
- *                              If no modification is needed or possible, the passed in bitmap is returned.
+ * @brief Rotate an image by 180 degrees into a separate buffer.
  */
-Dali::Devel::PixelBuffer CropAndPadForFittingMode( Dali::Devel::PixelBuffer& bitmap, ImageDimensions desiredDimensions, FittingMode::Type fittingMode );
+void Rotate180Pixels( const uint8_t* pixelsIn, unsigned int width, unsigned int height, unsigned int pixelSize, uint8_t* pixelsOut )
+{
+  const ReversePixelsFunction kernel = GetReversePixelsKernel( pixelSize );
+  const unsigned int stride = width * pixelSize;
+  for( unsigned int y = 0u; y < height; ++y )
+  {
+    ReverseScanline( pixelsIn + ( height - 1u - y ) * stride, pixelsOut + y * stride, width, pixelSize, kernel );
+  }
+}
 
 /**
- * @brief Adds horizontal or vertical borders to the source image.
+ * @brief Rotate an image by 180 degrees in place.
  *
- * @param[in] targetPixels     The destination image pointer to draw the borders on.
- * @param[in] bytesPerPixel    The number of bytes per pixel of the target pixel buffer.
- * @param[in] targetDimensions The dimensions of the destination image.
- * @param[in] padDimensions    The columns and scanlines to pad with borders.
+ * Scanlines are swapped in pairs from the top and bottom, reversing each, via a one scanline scratch buffer.
  */
-void AddBorders( PixelBuffer *targetPixels, const unsigned int bytesPerPixel, const ImageDimensions targetDimensions, const ImageDimensions padDimensions );
-
-Dali::Devel::PixelBuffer ApplyAttributesToBitmap( Dali::Devel::PixelBuffer bitmap, ImageDimensions dimensions, FittingMode::Type fittingMode, SamplingMode::Type samplingMode )
+void Rotate180PixelsInPlace( uint8_t* pixels, unsigned int width, unsigned int height, unsigned int pixelSize )
 {
-  if( bitmap )
+  const ReversePixelsFunction kernel = GetReversePixelsKernel( pixelSize );
+  const unsigned int stride = width * pixelSize;
+  std::vector<uint8_t> scanline( stride );
+  for( unsigned int y = 0u; y < ( height + 1u ) / 2u; ++y )
   {
-    // Calculate the desired box, accounting for a possible zero component:
-    const ImageDimensions desiredDimensions  = CalculateDesiredDimensions( bitmap.GetWidth(), bitmap.GetHeight(), dimensions.GetWidth(), dimensions.GetHeight() );
+    uint8_t* const top = pixels + y * stride;
+    uint8_t* const bottom = pixels + ( height - 1u - y ) * stride;
+    memcpy( &scanline[0], top, stride );
+    if( bottom != top )
+    {
+      ReverseScanline( bottom, top, width, pixelSize, kernel );
+    }
+    ReverseScanline( &scanline[0], bottom, width, pixelSize, kernel );
+  }
+}
 
-    // If a different size than the raw one has been requested, resize the image
-    // maximally using a repeated box filter without making it smaller than the
-    // requested size in either dimension:
-    bitmap = DownscaleBitmap( bitmap, desiredDimensions, fittingMode, samplingMode );
+/**
+ * @brief Write the transpose of an image into a separate buffer, optionally mirroring it too.
+ *
+ * Input pixel (x, y) goes to output scanline x, column y, each of which can
+ * be counted from the far end instead. This covers rotation by 90 or 270
+ * degrees as well as both transpositions.
+ *
+ * @param[in] pixelsIn The input buffer.
+ * @param[in] widthIn The width of the input buffer.
+ * @param[in] heightIn The height of the input buffer.
+ * @param[in] pixelSize The size of the pixel.
+ * @param[in] reverseScanlines Whether output scanline x is counted up from the bottom of the output.
+ * @param[in] reverseColumns Whether output column y is counted from the right of the output.
+ * @param[out] pixelsOut The output buffer. It is heightIn pixels wide and widthIn high.
+ */
+void TransposePixels( const uint8_t* pixelsIn,
+                      unsigned int widthIn,
+                      unsigned int heightIn,
+                      unsigned int pixelSize,
+                      bool reverseScanlines,
+                      bool reverseColumns,
+                      uint8_t* pixelsOut )
+{
+  const TransposeKernel kernel = GetTransposeKernel( pixelSize );
+  const unsigned int blockSize = kernel.blockSize;
+  const unsigned int strideIn = widthIn * pixelSize;
+  const unsigned int strideOut = heightIn * pixelSize;
+  const unsigned int blocksWidth = kernel.function ? widthIn - widthIn % blockSize : 0u;
+  const unsigned int blocksHeight = kernel.function ? heightIn - heightIn % blockSize : 0u;
 
-    // Cut the bitmap according to the desired width and height so that the
-    // resulting bitmap has the same aspect ratio as the desired dimensions.
-    // Add crop and add borders if necessary depending on fitting mode.
-    if( bitmap )
+  const uint8_t* inRows[16];
+  uint8_t* outRows[16];
+
+  for( unsigned int tileY = 0u; tileY < blocksHeight; tileY += TRANSFORM_TILE_SIZE )
+  {
+    const unsigned int tileEndY = std::min( tileY + TRANSFORM_TILE_SIZE, blocksHeight );
+    for( unsigned int tileX = 0u; tileX < blocksWidth; tileX += TRANSFORM_TILE_SIZE )
     {
-      bitmap = CropAndPadForFittingMode( bitmap, desiredDimensions, fittingMode );
+      const unsigned int tileEndX = std::min( tileX + TRANSFORM_TILE_SIZE, blocksWidth );
+      for( unsigned int y = tileY; y < tileEndY; y += blockSize )
+      {
+        // When the columns are reversed, feeding the block's scanlines in bottom up puts them in output order:
+        const unsigned int column = reverseColumns ? heightIn - y - blockSize : y;
+        for( unsigned int x = tileX; x < tileEndX; x += blockSize )
+        {
+          for( unsigned int i = 0u; i < blockSize; ++i )
+          {
+            const unsigned int inRow = reverseColumns ? y + blockSize - 1u - i : y + i;
+            const unsigned int outRow = reverseScanlines ? widthIn - 1u - x - i : x + i;
+            inRows[i] = pixelsIn + inRow * strideIn + x * pixelSize;
+            outRows[i] = pixelsOut + outRow * strideOut + column * pixelSize;
+          }
+          kernel.function( inRows, outRows );
+        }
+      }
     }
   }
 
-  return bitmap;
-}
-
-Dali::Devel::PixelBuffer CropAndPadForFittingMode( Dali::Devel::PixelBuffer& bitmap, ImageDimensions desiredDimensions, FittingMode::Type fittingMode )
-{
-  const unsigned int inputWidth = bitmap.GetWidth();
-  const unsigned int inputHeight = bitmap.GetHeight();
-
-  if( desiredDimensions.GetWidth() < 1u || desiredDimensions.GetHeight() < 1u )
+  // Pick up the pixels along the right and bottom edges which don't fill a block:
+  for( unsigned int y = 0u; y < heightIn; ++y )
   {
-    DALI_LOG_WARNING( "Image scaling aborted as desired dimensions too small (%u, %u).\n", desiredDimensions.GetWidth(), desiredDimensions.GetHeight() );
+    const unsigned int column = reverseColumns ? heightIn - 1u - y : y;
+    for( unsigned int x = ( y < blocksHeight ? blocksWidth : 0u ); x < widthIn; ++x )
+    {
+      const unsigned int outRow = reverseScanlines ? widthIn - 1u - x : x;
+      memcpy( pixelsOut + outRow * strideOut + column * pixelSize, pixelsIn + y * strideIn + x * pixelSize, pixelSize );
+    }
   }
-  else if( inputWidth != desiredDimensions.GetWidth() || inputHeight != desiredDimensions.GetHeight() )
-  {
-    // Calculate any padding or cropping that needs to be done based on the fitting mode.
-    // Note: If the desired size is larger than the original image, the desired size will be
-    // reduced while maintaining the aspect, in order to save unnecessary memory usage.
-    int scanlinesToCrop = 0;
-    int columnsToCrop = 0;
+}
 
-    CalculateBordersFromFittingMode( ImageDimensions( inputWidth, inputHeight ), fittingMode, desiredDimensions, scanlinesToCrop, columnsToCrop );
+/**
+ * @brief Transpose a square image in place.
+ *
+ * Blocks above the diagonal are swapped with their mirror images below it
+ * via a small scratch copy, so the image itself is the only large buffer.
+ */
+void TransposePixelsInPlace( uint8_t* pixels, unsigned int size, unsigned int pixelSize )
+{
+  const TransposeKernel kernel = GetTransposeKernel( pixelSize );
+  const unsigned int blockSize = kernel.blockSize;
+  const unsigned int blockStride = blockSize * pixelSize;
+  const unsigned int stride = size * pixelSize;
+  const unsigned int blocksSize = kernel.function ? size - size % blockSize : 0u;
 
-    unsigned int desiredWidth( desiredDimensions.GetWidth() );
-    unsigned int desiredHeight( desiredDimensions.GetHeight() );
+  uint8_t scratch[2u][16u * 16u];
+  const uint8_t* inRows[16];
+  uint8_t* outRows[16];
 
-    // Action the changes by making a new bitmap with the central part of the loaded one if required.
-    if( scanlinesToCrop != 0 || columnsToCrop != 0 )
+  for( unsigned int tileY = 0u; tileY < blocksSize; tileY += TRANSFORM_TILE_SIZE )
+  {
+    const unsigned int tileEndY = std::min( tileY + TRANSFORM_TILE_SIZE, blocksSize );
+    for( unsigned int tileX = tileY; tileX < blocksSize; tileX += TRANSFORM_TILE_SIZE )
     {
-      // Split the adding and removing of scanlines and columns into separate variables,
-      // so we can use one piece of generic code to action the changes.
-      unsigned int scanlinesToPad = 0;
-      unsigned int columnsToPad = 0;
-      if( scanlinesToCrop < 0 )
-      {
-        scanlinesToPad = -scanlinesToCrop;
-        scanlinesToCrop = 0;
-      }
-      if( columnsToCrop < 0 )
+      const unsigned int tileEndX = std::min( tileX + TRANSFORM_TILE_SIZE, blocksSize );
+      for( unsigned int y = tileY; y < tileEndY; y += blockSize )
       {
-        columnsToPad = -columnsToCrop;
-        columnsToCrop = 0;
+        for( unsigned int x = std::max( tileX, y ); x < tileEndX; x += blockSize )
+        {
+          // Copy out the block and its mirror before overwriting either. A block on the diagonal is its own mirror:
+          for( unsigned int i = 0u; i < blockSize; ++i )
+          {
+            memcpy( &scratch[0][i * blockStride], pixels + ( y + i ) * stride + x * pixelSize, blockStride );
+            if( x != y )
+            {
+              memcpy( &scratch[1][i * blockStride], pixels + ( x + i ) * stride + y * pixelSize, blockStride );
+            }
+          }
+
+          for( unsigned int i = 0u; i < blockSize; ++i )
+          {
+            inRows[i] = &scratch[0][i * blockStride];
+            outRows[i] = pixels + ( x + i ) * stride + y * pixelSize;
+          }
+          kernel.function( inRows, outRows );
+
+          if( x != y )
+          {
+            for( unsigned int i = 0u; i < blockSize; ++i )
+            {
+              inRows[i] = &scratch[1][i * blockStride];
+              outRows[i] = pixels + ( y + i ) * stride + x * pixelSize;
+            }
+            kernel.function( inRows, outRows );
+          }
+        }
       }
+    }
+  }
 
-      // If there is no filtering, then the final image size can become very large, exit if larger than maximum.
-      if( ( desiredWidth > MAXIMUM_TARGET_BITMAP_SIZE ) || ( desiredHeight > MAXIMUM_TARGET_BITMAP_SIZE ) ||
-          ( columnsToPad > MAXIMUM_TARGET_BITMAP_SIZE ) || ( scanlinesToPad > MAXIMUM_TARGET_BITMAP_SIZE ) )
+  // Swap the pairs of pixels with at least one in the partial blocks at the right and bottom edges:
+  for( unsigned int y = 0u; y < size; ++y )
+  {
+    for( unsigned int x = std::max( blocksSize, y + 1u ); x < size; ++x )
+    {
+      uint8_t* const upper = pixels + y * stride + x * pixelSize;
+      uint8_t* const lower = pixels + x * stride + y * pixelSize;
+      for( unsigned int channel = 0u; channel < pixelSize; ++channel )
       {
-        DALI_LOG_WARNING( "Image scaling aborted as final dimensions too large (%u, %u).\n", desiredWidth, desiredHeight );
-        return bitmap;
+        std::swap( upper[channel], lower[channel] );
       }
+    }
+  }
+}
 
-      // Create new PixelBuffer with the desired size.
-      const auto pixelFormat = bitmap.GetPixelFormat();
+/**@}*/
 
-      auto croppedBitmap = Devel::PixelBuffer::New( desiredWidth, desiredHeight, pixelFormat );
+/**
+ * @defgroup SkewKernels Blending of the pixels moved by the shear passes of RotateByShear().
+ *
+ * A skew moves each pixel by a whole number of pixels and lets a weighted
+ * part of it spill into the next pixel along. Each output pixel is its input
+ * pixel, less the part spilled out of it, plus the part spilled out of the one
+ * before. The spilled parts only depend on their own input pixel, so whole
+ * vectors of pixels can be blended at once.
+ * @{
+ */
 
-      // Add some pre-calculated offsets to the bitmap pointers so this is not done within a loop.
-      // The cropping is added to the source pointer, and the padding is added to the destination.
-      const auto bytesPerPixel = Pixel::GetBytesPerPixel( pixelFormat );
-      const PixelBuffer * const sourcePixels = bitmap.GetBuffer() + ( ( ( ( scanlinesToCrop / 2 ) * inputWidth ) + ( columnsToCrop / 2 ) ) * bytesPerPixel );
-      PixelBuffer * const targetPixels = croppedBitmap.GetBuffer();
-      PixelBuffer * const targetPixelsActive = targetPixels + ( ( ( ( scanlinesToPad / 2 ) * desiredWidth ) + ( columnsToPad / 2 ) ) * bytesPerPixel );
-      DALI_ASSERT_DEBUG( sourcePixels && targetPixels );
+/**
+ * @brief The part of a color component which spills into the next pixel of a skew.
+ * @param[in] component The color component.
+ * @param[in] weight The relative weight of the next pixel.
+ * @return The leftover.
+ */
+inline uint8_t SkewLeftover( uint8_t component, float weight )
+{
+  return static_cast<uint8_t>( static_cast<float>( component ) * weight );
+}
 
-      // Copy the image data to the new bitmap.
-      // Optimize to a single memcpy if the left and right edges don't need a crop or a pad.
-      unsigned int outputSpan( desiredWidth * bytesPerPixel );
-      if( columnsToCrop == 0 && columnsToPad == 0 )
-      {
-        memcpy( targetPixelsActive, sourcePixels, ( desiredHeight - scanlinesToPad ) * outputSpan );
-      }
-      else
-      {
-        // The width needs to change (due to either a crop or a pad), so we copy a scanline at a time.
-        // Precalculate any constants to optimize the inner loop.
-        const unsigned int inputSpan( inputWidth * bytesPerPixel );
-        const unsigned int copySpan( ( desiredWidth - columnsToPad ) * bytesPerPixel );
-        const unsigned int scanlinesToCopy( desiredHeight - scanlinesToPad );
+/**
+ * @brief Blend some skewed bytes with constant weight, starting at the second pixel.
+ * @param[in] pixelsIn The scanline being skewed. Byte j is blended with byte j - pixelSize.
+ * @param[in] begin The first byte to blend. At least @p pixelSize.
+ * @param[in] end One past the last byte to blend.
+ * @param[in] pixelSize The size of the pixel.
+ * @param[in] weight The relative weight of the next pixel.
+ * @param[out] pixelsOut Where to write byte @p begin onwards.
+ * @return The byte the kernel stopped at. The caller blends the remaining ones.
+ */
+typedef unsigned int (*SkewScanlineFunction)( const uint8_t* pixelsIn, unsigned int begin, unsigned int end, unsigned int pixelSize, float weight, uint8_t* pixelsOut );
 
-        for( unsigned int y = 0; y < scanlinesToCopy; ++y )
-        {
-          memcpy( &targetPixelsActive[ y * outputSpan ], &sourcePixels[ y * inputSpan ], copySpan );
-        }
-      }
+/**
+ * @brief Blend some bytes of a skewed scanline of columns, each with its own weight.
+ * @param[in] pixelsIn The source scanline being skewed.
+ * @param[in] previousPixelsIn The source scanline above, which spills into this one.
+ * @param[in] weights The weight of each byte.
+ * @param[in] numBytes The number of bytes to blend.
+ * @param[out] pixelsOut The blended bytes.
+ * @return The number of bytes blended. The caller blends the remaining ones.
+ */
+typedef unsigned int (*SkewColumnsFunction)( const uint8_t* pixelsIn, const uint8_t* previousPixelsIn, const float* weights, unsigned int numBytes, uint8_t* pixelsOut );
 
-      // Add vertical or horizontal borders to the final image (if required).
-      desiredDimensions.SetWidth( desiredWidth );
-      desiredDimensions.SetHeight( desiredHeight );
-      AddBorders( croppedBitmap.GetBuffer(), bytesPerPixel, desiredDimensions, ImageDimensions( columnsToPad, scanlinesToPad ) );
-      // Overwrite the loaded bitmap with the cropped version
-      bitmap = croppedBitmap;
-    }
-  }
+#if defined(DALI_IMAGE_OPERATIONS_X86_SIMD)
 
-  return bitmap;
+/** @brief Work out the leftovers of 16 color components. */
+__attribute__((target("sse2"))) inline __m128i SkewLeftoversSse2( __m128i components, __m128 weight0, __m128 weight1, __m128 weight2, __m128 weight3 )
+{
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i low = _mm_unpacklo_epi8( components, zero );
+  const __m128i high = _mm_unpackhi_epi8( components, zero );
+
+  // Truncating the products gives the same result as the scalar cast. None of them can exceed 255:
+  const __m128i leftover0 = _mm_cvttps_epi32( _mm_mul_ps( _mm_cvtepi32_ps( _mm_unpacklo_epi16( low, zero ) ), weight0 ) );
+  const __m128i leftover1 = _mm_cvttps_epi32( _mm_mul_ps( _mm_cvtepi32_ps( _mm_unpackhi_epi16( low, zero ) ), weight1 ) );
+  const __m128i leftover2 = _mm_cvttps_epi32( _mm_mul_ps( _mm_cvtepi32_ps( _mm_unpacklo_epi16( high, zero ) ), weight2 ) );
+  const __m128i leftover3 = _mm_cvttps_epi32( _mm_mul_ps( _mm_cvtepi32_ps( _mm_unpackhi_epi16( high, zero ) ), weight3 ) );
+  return _mm_packus_epi16( _mm_packs_epi32( leftover0, leftover1 ), _mm_packs_epi32( leftover2, leftover3 ) );
 }
 
-void AddBorders( PixelBuffer *targetPixels, const unsigned int bytesPerPixel, const ImageDimensions targetDimensions, const ImageDimensions padDimensions )
+/** @copydoc SkewScanlineFunction */
+__attribute__((target("sse2"))) unsigned int SkewScanlineSse2( const uint8_t* pixelsIn, unsigned int begin, unsigned int end, unsigned int pixelSize, float weight, uint8_t* pixelsOut )
 {
-  // Assign ints for faster access.
-  unsigned int desiredWidth( targetDimensions.GetWidth() );
-  unsigned int desiredHeight( targetDimensions.GetHeight() );
-  unsigned int columnsToPad( padDimensions.GetWidth() );
-  unsigned int scanlinesToPad( padDimensions.GetHeight() );
-  unsigned int outputSpan( desiredWidth * bytesPerPixel );
+  const __m128 weights = _mm_set1_ps( weight );
+  unsigned int byte = begin;
+  for( ; byte + 16u <= end; byte += 16u )
+  {
+    const __m128i components = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixelsIn + byte ) );
+    const __m128i previous = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixelsIn + byte - pixelSize ) );
+    const __m128i leftovers = SkewLeftoversSse2( components, weights, weights, weights, weights );
+    const __m128i previousLeftovers = SkewLeftoversSse2( previous, weights, weights, weights, weights );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( pixelsOut + byte - begin ), _mm_add_epi8( _mm_sub_epi8( components, leftovers ), previousLeftovers ) );
+  }
+  return byte;
+}
 
-  // Add letterboxing (symmetrical borders) if needed.
-  if( scanlinesToPad > 0 )
+/** @copydoc SkewColumnsFunction */
+__attribute__((target("sse2"))) unsigned int SkewColumnsSse2( const uint8_t* pixelsIn, const uint8_t* previousPixelsIn, const float* weights, unsigned int numBytes, uint8_t* pixelsOut )
+{
+  unsigned int byte = 0u;
+  for( ; byte + 16u <= numBytes; byte += 16u )
   {
-    // Add a top border. Note: This is (deliberately) rounded down if padding is an odd number.
-    memset( targetPixels, BORDER_FILL_VALUE, ( scanlinesToPad / 2 ) * outputSpan );
+    const __m128 weight0 = _mm_loadu_ps( weights + byte );
+    const __m128 weight1 = _mm_loadu_ps( weights + byte + 4u );
+    const __m128 weight2 = _mm_loadu_ps( weights + byte + 8u );
+    const __m128 weight3 = _mm_loadu_ps( weights + byte + 12u );
+    const __m128i components = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixelsIn + byte ) );
+    const __m128i previous = _mm_loadu_si128( reinterpret_cast<const __m128i*>( previousPixelsIn + byte ) );
+    const __m128i leftovers = SkewLeftoversSse2( components, weight0, weight1, weight2, weight3 );
+    const __m128i previousLeftovers = SkewLeftoversSse2( previous, weight0, weight1, weight2, weight3 );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( pixelsOut + byte ), _mm_add_epi8( _mm_sub_epi8( components, leftovers ), previousLeftovers ) );
+  }
+  return byte;
+}
 
-    // We subtract scanlinesToPad/2 from scanlinesToPad so that we have the correct
-    // offset for odd numbers (as the top border is 1 pixel smaller in these cases.
-    unsigned int bottomBorderHeight = scanlinesToPad - ( scanlinesToPad / 2 );
+#endif // DALI_IMAGE_OPERATIONS_X86_SIMD
 
-    // Bottom border.
-    memset( &targetPixels[ ( desiredHeight - bottomBorderHeight ) * outputSpan ], BORDER_FILL_VALUE, bottomBorderHeight * outputSpan );
+#if defined(DALI_IMAGE_OPERATIONS_NEON)
+
+/** @brief Work out the leftovers of 16 color components. */
+inline uint8x16_t SkewLeftoversNeon( uint8x16_t components, float32x4_t weight0, float32x4_t weight1, float32x4_t weight2, float32x4_t weight3 )
+{
+  const uint16x8_t low = vmovl_u8( vget_low_u8( components ) );
+  const uint16x8_t high = vmovl_u8( vget_high_u8( components ) );
+
+  const uint32x4_t leftover0 = vcvtq_u32_f32( vmulq_f32( vcvtq_f32_u32( vmovl_u16( vget_low_u16( low ) ) ), weight0 ) );
+  const uint32x4_t leftover1 = vcvtq_u32_f32( vmulq_f32( vcvtq_f32_u32( vmovl_u16( vget_high_u16( low ) ) ), weight1 ) );
+  const uint32x4_t leftover2 = vcvtq_u32_f32( vmulq_f32( vcvtq_f32_u32( vmovl_u16( vget_low_u16( high ) ) ), weight2 ) );
+  const uint32x4_t leftover3 = vcvtq_u32_f32( vmulq_f32( vcvtq_f32_u32( vmovl_u16( vget_high_u16( high ) ) ), weight3 ) );
+  return vcombine_u8( vmovn_u16( vcombine_u16( vmovn_u32( leftover0 ), vmovn_u32( leftover1 ) ) ),
+                      vmovn_u16( vcombine_u16( vmovn_u32( leftover2 ), vmovn_u32( leftover3 ) ) ) );
+}
+
+/** @copydoc SkewScanlineFunction */
+unsigned int SkewScanlineNeon( const uint8_t* pixelsIn, unsigned int begin, unsigned int end, unsigned int pixelSize, float weight, uint8_t* pixelsOut )
+{
+  const float32x4_t weights = vdupq_n_f32( weight );
+  unsigned int byte = begin;
+  for( ; byte + 16u <= end; byte += 16u )
+  {
+    const uint8x16_t components = vld1q_u8( pixelsIn + byte );
+    const uint8x16_t previous = vld1q_u8( pixelsIn + byte - pixelSize );
+    const uint8x16_t leftovers = SkewLeftoversNeon( components, weights, weights, weights, weights );
+    const uint8x16_t previousLeftovers = SkewLeftoversNeon( previous, weights, weights, weights, weights );
+    vst1q_u8( pixelsOut + byte - begin, vaddq_u8( vsubq_u8( components, leftovers ), previousLeftovers ) );
   }
-  else if( columnsToPad > 0 )
+  return byte;
+}
+
+/** @copydoc SkewColumnsFunction */
+unsigned int SkewColumnsNeon( const uint8_t* pixelsIn, const uint8_t* previousPixelsIn, const float* weights, unsigned int numBytes, uint8_t* pixelsOut )
+{
+  unsigned int byte = 0u;
+  for( ; byte + 16u <= numBytes; byte += 16u )
   {
-    // Add a left and right border.
-    // Left:
-    // Pre-calculate span size outside of loop.
-    unsigned int leftBorderSpanWidth( ( columnsToPad / 2 ) * bytesPerPixel );
-    for( unsigned int y = 0; y < desiredHeight; ++y )
-    {
-      memset( &targetPixels[ y * outputSpan ], BORDER_FILL_VALUE, leftBorderSpanWidth );
-    }
+    const float32x4_t weight0 = vld1q_f32( weights + byte );
+    const float32x4_t weight1 = vld1q_f32( weights + byte + 4u );
+    const float32x4_t weight2 = vld1q_f32( weights + byte + 8u );
+    const float32x4_t weight3 = vld1q_f32( weights + byte + 12u );
+    const uint8x16_t components = vld1q_u8( pixelsIn + byte );
+    const uint8x16_t previous = vld1q_u8( previousPixelsIn + byte );
+    const uint8x16_t leftovers = SkewLeftoversNeon( components, weight0, weight1, weight2, weight3 );
+    const uint8x16_t previousLeftovers = SkewLeftoversNeon( previous, weight0, weight1, weight2, weight3 );
+    vst1q_u8( pixelsOut + byte, vaddq_u8( vsubq_u8( components, leftovers ), previousLeftovers ) );
+  }
+  return byte;
+}
 
-    // Right:
-    // Pre-calculate the initial x offset as it is always the same for a small optimization.
-    // We subtract columnsToPad/2 from columnsToPad so that we have the correct
-    // offset for odd numbers (as the left border is 1 pixel smaller in these cases.
-    unsigned int rightBorderWidth = columnsToPad - ( columnsToPad / 2 );
-    PixelBuffer * const destPixelsRightBorder( targetPixels + ( ( desiredWidth - rightBorderWidth ) * bytesPerPixel ) );
-    unsigned int rightBorderSpanWidth = rightBorderWidth * bytesPerPixel;
+#endif // DALI_IMAGE_OPERATIONS_NEON
 
-    for( unsigned int y = 0; y < desiredHeight; ++y )
-    {
-      memset( &destPixelsRightBorder[ y * outputSpan ], BORDER_FILL_VALUE, rightBorderSpanWidth );
-    }
+/**
+ * @brief Pick the vectorised scanline skew blending, if there is one.
+ * @return The kernel, or nullptr to blend every byte with the scalar code.
+ */
+SkewScanlineFunction GetSkewScanlineKernel()
+{
+#if defined(DALI_IMAGE_OPERATIONS_X86_SIMD)
+  if( HasCpuFeature( CPU_FEATURE_SSE2 ) )
+  {
+    return &SkewScanlineSse2;
+  }
+#elif defined(DALI_IMAGE_OPERATIONS_NEON)
+  if( HasCpuFeature( CPU_FEATURE_NEON ) )
+  {
+    return &SkewScanlineNeon;
   }
+#endif
+  return nullptr;
 }
 
-Dali::Devel::PixelBuffer DownscaleBitmap( Dali::Devel::PixelBuffer bitmap,
-                                        ImageDimensions desired,
-                                        FittingMode::Type fittingMode,
-                                        SamplingMode::Type samplingMode )
+/**
+ * @brief Pick the vectorised column skew blending, if there is one.
+ * @return The kernel, or nullptr to blend every byte with the scalar code.
+ */
+SkewColumnsFunction GetSkewColumnsKernel()
 {
-  // Source dimensions as loaded from resources (e.g. filesystem):
-  auto bitmapWidth  = bitmap.GetWidth();
-  auto bitmapHeight = bitmap.GetHeight();
-  // Desired dimensions (the rectangle to fit the source image to):
-  auto desiredWidth = desired.GetWidth();
-  auto desiredHeight = desired.GetHeight();
+#if defined(DALI_IMAGE_OPERATIONS_X86_SIMD)
+  if( HasCpuFeature( CPU_FEATURE_SSE2 ) )
+  {
+    return &SkewColumnsSse2;
+  }
+#elif defined(DALI_IMAGE_OPERATIONS_NEON)
+  if( HasCpuFeature( CPU_FEATURE_NEON ) )
+  {
+    return &SkewColumnsNeon;
+  }
+#endif
+  return nullptr;
+}
 
-  Dali::Devel::PixelBuffer outputBitmap { bitmap };
+/**
+ * @brief Skews a row horizontally (with filtered weights)
+ *
+ * @note Limited to 45 degree skewing only.
+ * @note Code got from https://www.codeproject.com/Articles/202/High-quality-image-rotation-rotate-by-shear by Eran Yariv.
+ *
+ * @param[in] srcBufferPtr Pointer to the input pixel buffer.
+ * @param[in] srcWidth The width of the input pixel buffer.
+ * @param[in] pixelSize The size of the pixel.
+ * @param[in,out] dstPixelBuffer Pointer to the output pixel buffer.
+ * @param[in] dstWidth The width of the output pixel buffer.
+ * @param[in] row The row index.
+ * @param[in] offset The skew offset.
+ * @param[in] weight The relative weight of right pixel.
+ * @param[in] kernel The vectorised blending to use, or nullptr.
+ */
+void HorizontalSkew( const uint8_t* const srcBufferPtr,
+                     int srcWidth,
+                     unsigned int pixelSize,
+                     uint8_t* const dstBufferPtr,
+                     int dstWidth,
+                     unsigned int row,
+                     int offset,
+                     float weight,
+                     SkewScanlineFunction kernel )
+{
+  const uint8_t* const srcRow = srcBufferPtr + row * pixelSize * srcWidth;
+  uint8_t* const dstRow = dstBufferPtr + row * pixelSize * dstWidth;
 
-  // If a different size than the raw one has been requested, resize the image:
-  if(
-      (desiredWidth > 0.0f) && (desiredHeight > 0.0f) &&
-      ((desiredWidth < bitmapWidth) || (desiredHeight < bitmapHeight)) )
+  if( offset > 0 )
   {
-    auto pixelFormat = bitmap.GetPixelFormat();
+    // Fill gap left of skew with background.
+    memset( dstRow, 0u, pixelSize * std::min( offset, dstWidth ) );
+  }
 
-    // Do the fast power of 2 iterated box filter to get to roughly the right side if the filter mode requests that:
-    unsigned int shrunkWidth = -1, shrunkHeight = -1;
-    DownscaleInPlacePow2( bitmap.GetBuffer(), pixelFormat, bitmapWidth, bitmapHeight, desiredWidth, desiredHeight, fittingMode, samplingMode, shrunkWidth, shrunkHeight );
+  // Blend the source pixels which land inside the destination row:
+  const unsigned int begin = pixelSize * static_cast<unsigned int>( std::max( 0, -offset ) );
+  const unsigned int end = pixelSize * static_cast<unsigned int>( std::max( 0, std::min( srcWidth, dstWidth - offset ) ) );
+  uint8_t* const dst = dstRow + static_cast<int>( begin ) + offset * static_cast<int>( pixelSize );
 
-    // Work out the dimensions of the downscaled bitmap, given the scaling mode and desired dimensions:
-    const ImageDimensions filteredDimensions = FitToScalingMode( ImageDimensions( desiredWidth, desiredHeight ), ImageDimensions( shrunkWidth, shrunkHeight ), fittingMode );
-    const unsigned int filteredWidth = filteredDimensions.GetWidth();
-    const unsigned int filteredHeight = filteredDimensions.GetHeight();
+  unsigned int byte = begin;
+  for( ; ( byte < end ) && ( byte < pixelSize ); ++byte )
+  {
+    // The first pixel has nothing spilled into it.
+    dst[byte - begin] = srcRow[byte] - SkewLeftover( srcRow[byte], weight );
+  }
+  if( kernel && ( byte < end ) )
+  {
+    byte = kernel( srcRow, byte, end, pixelSize, weight, dst + byte - begin );
+  }
+  for( ; byte < end; ++byte )
+  {
+    dst[byte - begin] = srcRow[byte] - SkewLeftover( srcRow[byte], weight ) + SkewLeftover( srcRow[byte - pixelSize], weight );
+  }
 
-    // Run a filter to scale down the bitmap if it needs it:
-    bool filtered = false;
-    if( filteredWidth < shrunkWidth || filteredHeight < shrunkHeight )
+  // Go to rightmost point of skew
+  const int i = srcWidth + offset;
+  if( i < dstWidth )
+  {
+    if( i >= 0 )
     {
-      if( samplingMode == SamplingMode::LINEAR || samplingMode == SamplingMode::BOX_THEN_LINEAR ||
-          samplingMode == SamplingMode::NEAREST || samplingMode == SamplingMode::BOX_THEN_NEAREST )
+      // If still in image bounds, put leftovers there
+      const uint8_t* const lastPixel = srcRow + pixelSize * ( srcWidth - 1 );
+      for( unsigned int channel = 0u; channel < pixelSize; ++channel )
       {
-        outputBitmap = Dali::Devel::PixelBuffer::New( filteredWidth, filteredHeight, pixelFormat );
-
-        if( outputBitmap )
-        {
-          if( samplingMode == SamplingMode::LINEAR || samplingMode == SamplingMode::BOX_THEN_LINEAR )
-          {
-            LinearSample( bitmap.GetBuffer(), ImageDimensions(shrunkWidth, shrunkHeight), pixelFormat, outputBitmap.GetBuffer(), filteredDimensions );
-          }
-          else
-          {
-            PointSample( bitmap.GetBuffer(), shrunkWidth, shrunkHeight, pixelFormat, outputBitmap.GetBuffer(), filteredWidth, filteredHeight );
-          }
-          filtered = true;
-        }
+        dstRow[pixelSize * i + channel] = SkewLeftover( lastPixel[channel], weight );
       }
     }
-    // Copy out the 2^x downscaled, box-filtered pixels if no secondary filter (point or linear) was applied:
-    if( filtered == false && ( shrunkWidth < bitmapWidth || shrunkHeight < bitmapHeight ) )
-    {
-      outputBitmap = MakePixelBuffer( bitmap.GetBuffer(), pixelFormat, shrunkWidth, shrunkHeight );
-    }
-  }
 
-  return outputBitmap;
+    // Clear to the right of the skewed line with background
+    const int clearBegin = std::max( i + 1, 0 );
+    memset( dstRow + pixelSize * clearBegin, 0u, pixelSize * ( dstWidth - clearBegin ) );
+  }
 }
 
-namespace
-{
 /**
- * @brief Returns whether to keep box filtering based on whether downscaled dimensions will overshoot the desired ones aty the next step.
- * @param test Which combination of the two dimensions matter for terminating the filtering.
- * @param scaledWidth The width of the current downscaled image.
- * @param scaledHeight The height of the current downscaled image.
- * @param desiredWidth The target width for the downscaling.
- * @param desiredHeight The target height for the downscaling.
+ * @brief Skews a band of columns vertically (with filtered weights)
+ *
+ * Each source scanline of the band is blended a whole band width at a time,
+ * then each run of columns with the same offset is copied to its destination
+ * scanline.
+ *
+ * @note Limited to 45 degree skewing only.
+ * @note Code got from https://www.codeproject.com/Articles/202/High-quality-image-rotation-rotate-by-shear by Eran Yariv.
+ *
+ * @param[in] srcBufferPtr Pointer to the input pixel buffer.
+ * @param[in] srcWidth The width of the input pixel buffer.
+ * @param[in] srcHeight The height of the input pixel buffer.
+ * @param[in] pixelSize The size of the pixel.
+ * @param[in,out] dstBufferPtr Pointer to the output pixel buffer. It is as wide as the input buffer.
+ * @param[in] dstHeight The height of the output pixel buffer.
+ * @param[in] offsets The skew offset of each column.
+ * @param[in] weights The relative weight of the lower pixel of each column, repeated for each byte of the pixel.
+ * @param[in] firstColumn The first column of the band.
+ * @param[in] endColumn One past the last column of the band.
+ * @param[in] kernel The vectorised blending to use, or nullptr.
  */
-bool ContinueScaling( BoxDimensionTest test, unsigned int scaledWidth, unsigned int scaledHeight, unsigned int desiredWidth, unsigned int desiredHeight )
+void VerticalSkew( const uint8_t* const srcBufferPtr,
+                   int srcWidth,
+                   int srcHeight,
+                   unsigned int pixelSize,
+                   uint8_t* const dstBufferPtr,
+                   int dstHeight,
+                   const int* offsets,
+                   const float* weights,
+                   unsigned int firstColumn,
+                   unsigned int endColumn,
+                   SkewColumnsFunction kernel )
 {
-  bool keepScaling = false;
-  const unsigned int nextWidth = scaledWidth >> 1u;
-  const unsigned int nextHeight = scaledHeight >> 1u;
+  const unsigned int stride = pixelSize * srcWidth;
+  const unsigned int bandOffset = pixelSize * firstColumn;
+  const unsigned int numBytes = pixelSize * ( endColumn - firstColumn );
+  const float* const bandWeights = weights + bandOffset;
+  std::vector<uint8_t> blended( numBytes );
 
-  if( nextWidth >= 1u && nextHeight >= 1u )
+  for( int y = 0; y < srcHeight; ++y )
   {
-    switch( test )
+    const uint8_t* const src = srcBufferPtr + y * stride + bandOffset;
+
+    unsigned int byte = 0u;
+    if( y == 0 )
     {
-      case BoxDimensionTestEither:
+      // The first scanline has nothing spilled into it.
+      for( ; byte < numBytes; ++byte )
       {
-        keepScaling = nextWidth >= desiredWidth || nextHeight >= desiredHeight;
-        break;
+        blended[byte] = src[byte] - SkewLeftover( src[byte], bandWeights[byte] );
       }
-      case BoxDimensionTestBoth:
-      {
-        keepScaling = nextWidth >= desiredWidth && nextHeight >= desiredHeight;
-        break;
+    }
+    else
+    {
+      const uint8_t* const previous = src - stride;
+      if( kernel )
+      {
+        byte = kernel( src, previous, bandWeights, numBytes, &blended[0] );
       }
-      case BoxDimensionTestX:
+      for( ; byte < numBytes; ++byte )
       {
-        keepScaling = nextWidth >= desiredWidth;
-        break;
+        blended[byte] = src[byte] - SkewLeftover( src[byte], bandWeights[byte] ) + SkewLeftover( previous[byte], bandWeights[byte] );
       }
-      case BoxDimensionTestY:
+    }
+
+    // Columns with the same offset are next to each other, so copy them in runs:
+    for( unsigned int column = firstColumn; column < endColumn; )
+    {
+      const int offset = offsets[column];
+      unsigned int runEnd = column + 1u;
+      while( ( runEnd < endColumn ) && ( offsets[runEnd] == offset ) )
       {
-        keepScaling = nextHeight >= desiredHeight;
-        break;
+        ++runEnd;
+      }
+
+      const int dstY = y + offset;
+      if( ( dstY >= 0 ) && ( dstY < dstHeight ) )
+      {
+        memcpy( dstBufferPtr + dstY * stride + pixelSize * column, &blended[pixelSize * ( column - firstColumn )], pixelSize * ( runEnd - column ) );
       }
+      column = runEnd;
     }
   }
 
-  return keepScaling;
+  for( unsigned int column = firstColumn; column < endColumn; ++column )
+  {
+    const int offset = offsets[column];
+    uint8_t* const dstColumn = dstBufferPtr + pixelSize * column;
+
+    // Fill gap above skew with background
+    for( int i = 0; i < std::min( offset, dstHeight ); ++i )
+    {
+      memset( dstColumn + i * stride, 0u, pixelSize );
+    }
+
+    // Go to bottom point of skew. The leftovers of the last pixel replace it rather than following it.
+    const int i = srcHeight - 1 + offset;
+    if( i < dstHeight )
+    {
+      if( i >= 0 )
+      {
+        // If still in image bounds, put leftovers there
+        const uint8_t* const lastPixel = srcBufferPtr + ( srcHeight - 1 ) * stride + pixelSize * column;
+        const float weight = weights[pixelSize * column];
+        for( unsigned int channel = 0u; channel < pixelSize; ++channel )
+        {
+          dstColumn[i * stride + channel] = SkewLeftover( lastPixel[channel], weight );
+        }
+      }
+
+      // Clear below skewed line with background
+      for( int y = std::max( i + 1, 0 ); y < dstHeight; ++y )
+      {
+        memset( dstColumn + y * stride, 0u, pixelSize );
+      }
+    }
+  }
 }
 
+/**@}*/
+
+std::atomic<bool> gParallelResamplingEnabled( true ); ///< Whether the resampling functions may use the worker pool.
+std::atomic<unsigned int> gParallelResamplingMinimumPixels( DEFAULT_PARALLEL_RESAMPLING_MINIMUM_PIXELS ); ///< The smallest output image resampled in parallel.
+
 /**
- * @brief A shared implementation of the overall iterative box filter
- * downscaling algorithm.
+ * @brief The number of bands of scanlines per thread when resampling in parallel.
  *
- * Specialise this for particular pixel formats by supplying the number of bytes
- * per pixel and two functions: one for averaging pairs of neighbouring pixels
- * on a single scanline, and a second for averaging pixels at corresponding
- * positions on different scanlines.
- **/
-template<
-  int BYTES_PER_PIXEL,
-  void (*HalveScanlineInPlace)( unsigned char * const pixels, const unsigned int width ),
-  void (*AverageScanlines) ( const unsigned char * const scanline1, const unsigned char * const __restrict__ scanline2, unsigned char* const outputScanline, const unsigned int width )
->
-void DownscaleInPlacePow2Generic( unsigned char * const pixels,
-                                  const unsigned int inputWidth,
-                                  const unsigned int inputHeight,
-                                  const unsigned int desiredWidth,
-                                  const unsigned int desiredHeight,
-                                  BoxDimensionTest dimensionTest,
-                                  unsigned& outWidth,
-                                  unsigned& outHeight )
+ * Using more bands than threads lets threads which finish early pick up the
+ * remaining work, e.g. when another image is being decoded at the same time.
+ */
+const unsigned int RESAMPLING_BANDS_PER_THREAD = 4u;
+
+/**
+ * @brief Work out how many parts to split a resampling into.
+ * @param[in] outputWidth The width of the output image.
+ * @param[in] outputHeight The height of the output image.
+ * @param[in] maximumParts The most parts the work can be split into.
+ * @return The number of parts, 1 if the output should be produced on the calling thread.
+ */
+unsigned int GetNumResamplingParts( unsigned int outputWidth, unsigned int outputHeight, unsigned int maximumParts )
 {
-  if( pixels == 0 )
+  if( !gParallelResamplingEnabled.load( std::memory_order_relaxed ) ||
+      static_cast<uint64_t>( outputWidth ) * outputHeight < gParallelResamplingMinimumPixels.load( std::memory_order_relaxed ) )
   {
-    return;
+    return 1u;
   }
-  ValidateScalingParameters( inputWidth, inputHeight, desiredWidth, desiredHeight );
+  return std::min( maximumParts, WorkerPool::Get().GetConcurrency() * RESAMPLING_BANDS_PER_THREAD );
+}
 
-  // Scale the image until it would be smaller than desired, stopping if the
-  // resulting height or width would be less than 1:
-  unsigned int scaledWidth = inputWidth, scaledHeight = inputHeight;
-  while( ContinueScaling( dimensionTest, scaledWidth, scaledHeight, desiredWidth, desiredHeight ) )
+/**
+ * @brief Run a resampling function over bands of output scanlines, in parallel if the output is large enough.
+ *
+ * The function must produce the scanlines [begin, end) of the output and
+ * only depend on the input image, so that bands are independent of each other.
+ * @param[in] outputWidth The width of the output image.
+ * @param[in] outputHeight The height of the output image.
+ * @param[in] resampleBand The function producing a band of output scanlines.
+ */
+void ResampleInBands( unsigned int outputWidth, unsigned int outputHeight, const WorkerPool::RangeTask& resampleBand )
+{
+  const unsigned int numBands = GetNumResamplingParts( outputWidth, outputHeight, outputHeight );
+  if( numBands > 1u )
   {
-    const unsigned int lastWidth = scaledWidth;
-    scaledWidth  >>= 1u;
-    scaledHeight >>= 1u;
+    WorkerPool::Get().ParallelFor( outputHeight, numBands, resampleBand );
+  }
+  else
+  {
+    resampleBand( 0u, outputHeight );
+  }
+}
 
-    DALI_LOG_INFO( gImageOpsLogFilter, Dali::Integration::Log::Verbose, "Scaling to %u\t%u.\n", scaledWidth, scaledHeight );
+} // namespace - unnamed
 
-    const unsigned int lastScanlinePair = scaledHeight - 1;
+ImageDimensions CalculateDesiredDimensions( ImageDimensions rawDimensions, ImageDimensions requestedDimensions )
+{
+  return CalculateDesiredDimensions( rawDimensions.GetWidth(), rawDimensions.GetHeight(), requestedDimensions.GetWidth(), requestedDimensions.GetHeight() ) ;
+}
 
-    // Scale pairs of scanlines until any spare one at the end is dropped:
-    for( unsigned int y = 0; y <= lastScanlinePair; ++y )
+void SetParallelResamplingEnabled( bool enabled )
+{
+  gParallelResamplingEnabled.store( enabled, std::memory_order_relaxed );
+}
+
+void SetParallelResamplingMinimumPixels( unsigned int minimumPixels )
+{
+  gParallelResamplingMinimumPixels.store( minimumPixels, std::memory_order_relaxed );
+}
+
+/**
+ * @brief Apply cropping and padding for specified fitting mode.
+ *
+ * Once the bitmap has been (optionally) downscaled to an appropriate size, this method performs alterations
+ * based on the fitting mode.
+ *
+ * This will add vertical or horizontal borders if necessary.
+ * Crop the source image data vertically or horizontally if necessary.
+ * The aspect of the source image is preserved.
+ * If the source image is smaller than the desired size, the algorithm will modify the the newly created
+ *   bitmaps dimensions to only be as large as necessary, as a memory saving optimization. This will cause
+ *   GPU scaling to be performed at render time giving the same result with less texture traversal.
+ *
+ * @param[in] bitmap            The source pixel buffer to perform modifications on.
+ * @param[in] desiredDimensions The target dimensions to aim to fill based on the fitting mode.
+ * @param[in] fittingMode       The fitting mode to use.
+ *
+ * @return                      A new bitmap with the padding and cropping required for fitting mode applied.
+ *                              If no modification is needed or possible, the passed in bitmap is returned.
+ */
+Dali::Devel::PixelBuffer CropAndPadForFittingMode( Dali::Devel::PixelBuffer& bitmap, ImageDimensions desiredDimensions, FittingMode::Type fittingMode );
+
+Dali::Devel::PixelBuffer ApplyAttributesToBitmap( Dali::Devel::PixelBuffer bitmap, ImageDimensions dimensions, FittingMode::Type fittingMode, SamplingMode::Type samplingMode )
+{
+  if( bitmap )
+  {
+    // Calculate the desired box, accounting for a possible zero component:
+    const ImageDimensions desiredDimensions  = CalculateDesiredDimensions( bitmap.GetWidth(), bitmap.GetHeight(), dimensions.GetWidth(), dimensions.GetHeight() );
+
+    // If a different size than the raw one has been requested, resize the image
+    // maximally using a repeated box filter without making it smaller than the
+    // requested size in either dimension:
+    bitmap = DownscaleBitmap( bitmap, desiredDimensions, fittingMode, samplingMode );
+
+    // Cut the bitmap according to the desired width and height so that the
+    // resulting bitmap has the same aspect ratio as the desired dimensions.
+    // Add crop and add borders if necessary depending on fitting mode.
+    if( bitmap )
     {
-      // Scale two scanlines horizontally:
-      HalveScanlineInPlace( &pixels[y * 2 * lastWidth * BYTES_PER_PIXEL], lastWidth );
-      HalveScanlineInPlace( &pixels[(y * 2 + 1) * lastWidth * BYTES_PER_PIXEL], lastWidth );
+      bitmap = CropAndPadForFittingMode( bitmap, desiredDimensions, fittingMode );
+    }
+  }
 
-      // Scale vertical pairs of pixels while the last two scanlines are still warm in
-      // the CPU cache(s):
-      // Note, better access patterns for cache-coherence are possible for very large
-      // images but even a 4k wide RGB888 image will use just 24kB of cache (4k pixels
-      // * 3 Bpp * 2 scanlines) for two scanlines on the first iteration.
-      AverageScanlines(
-          &pixels[y * 2 * lastWidth * BYTES_PER_PIXEL],
-          &pixels[(y * 2 + 1) * lastWidth * BYTES_PER_PIXEL],
-          &pixels[y * scaledWidth * BYTES_PER_PIXEL],
-          scaledWidth );
+  return bitmap;
+}
+
+bool CalculateCropForFittingMode( ImageDimensions inputDimensions, ImageDimensions desiredDimensions, FittingMode::Type fittingMode, FittingModeCrop& crop )
+{
+  const unsigned int inputWidth = inputDimensions.GetWidth();
+  const unsigned int inputHeight = inputDimensions.GetHeight();
+
+  if( desiredDimensions.GetWidth() < 1u || desiredDimensions.GetHeight() < 1u )
+  {
+    DALI_LOG_WARNING( "Image scaling aborted as desired dimensions too small (%u, %u).\n", desiredDimensions.GetWidth(), desiredDimensions.GetHeight() );
+    return false;
+  }
+
+  if( inputWidth == desiredDimensions.GetWidth() && inputHeight == desiredDimensions.GetHeight() )
+  {
+    return false;
+  }
+
+  // Calculate any padding or cropping that needs to be done based on the fitting mode.
+  // Note: If the desired size is larger than the original image, the desired size will be
+  // reduced while maintaining the aspect, in order to save unnecessary memory usage.
+  int scanlinesToCrop = 0;
+  int columnsToCrop = 0;
+
+  CalculateBordersFromFittingMode( inputDimensions, fittingMode, desiredDimensions, scanlinesToCrop, columnsToCrop );
+
+  unsigned int desiredWidth( desiredDimensions.GetWidth() );
+  unsigned int desiredHeight( desiredDimensions.GetHeight() );
+
+  if( scanlinesToCrop == 0 && columnsToCrop == 0 )
+  {
+    return false;
+  }
+
+  // Split the adding and removing of scanlines and columns into separate variables,
+  // so we can use one piece of generic code to action the changes.
+  unsigned int scanlinesToPad = 0;
+  unsigned int columnsToPad = 0;
+  if( scanlinesToCrop < 0 )
+  {
+    scanlinesToPad = -scanlinesToCrop;
+    scanlinesToCrop = 0;
+  }
+  if( columnsToCrop < 0 )
+  {
+    columnsToPad = -columnsToCrop;
+    columnsToCrop = 0;
+  }
+
+  // If there is no filtering, then the final image size can become very large, exit if larger than maximum.
+  if( ( desiredWidth > MAXIMUM_TARGET_BITMAP_SIZE ) || ( desiredHeight > MAXIMUM_TARGET_BITMAP_SIZE ) ||
+      ( columnsToPad > MAXIMUM_TARGET_BITMAP_SIZE ) || ( scanlinesToPad > MAXIMUM_TARGET_BITMAP_SIZE ) )
+  {
+    DALI_LOG_WARNING( "Image scaling aborted as final dimensions too large (%u, %u).\n", desiredWidth, desiredHeight );
+    return false;
+  }
+
+  // The cropping moves the source origin and the padding moves the target origin.
+  // Note: The top and left borders are (deliberately) rounded down if the padding is an odd number.
+  crop.outputDimensions = ImageDimensions( desiredWidth, desiredHeight );
+  crop.sourceOrigin = ImageDimensions( columnsToCrop / 2, scanlinesToCrop / 2 );
+  crop.targetOrigin = ImageDimensions( columnsToPad / 2, scanlinesToPad / 2 );
+  crop.copyDimensions = ImageDimensions( desiredWidth - columnsToPad, desiredHeight - scanlinesToPad );
+  return true;
+}
+
+void CropAndPadScanlines( const uint8_t* pixelsIn,
+                          unsigned int inputWidth,
+                          unsigned int bytesPerPixel,
+                          const FittingModeCrop& crop,
+                          unsigned int firstScanline,
+                          unsigned int endScanline,
+                          uint8_t* pixelsOut )
+{
+  // Precalculate any constants to optimize the inner loop.
+  const unsigned int inputSpan( inputWidth * bytesPerPixel );
+  const unsigned int outputSpan( crop.outputDimensions.GetWidth() * bytesPerPixel );
+  const unsigned int leftBorderSpan( crop.targetOrigin.GetWidth() * bytesPerPixel );
+  const unsigned int copySpan( crop.copyDimensions.GetWidth() * bytesPerPixel );
+  const unsigned int rightBorderSpan( outputSpan - leftBorderSpan - copySpan );
+  const unsigned int firstCopiedScanline( crop.targetOrigin.GetHeight() );
+  const unsigned int endCopiedScanline( firstCopiedScanline + crop.copyDimensions.GetHeight() );
+
+  // Add some pre-calculated offsets to the source pointer so this is not done within the loop.
+  const uint8_t* const sourcePixels = pixelsIn + ( crop.sourceOrigin.GetHeight() * inputWidth + crop.sourceOrigin.GetWidth() ) * bytesPerPixel;
+
+  for( unsigned int y = firstScanline; y < endScanline; ++y, pixelsOut += outputSpan )
+  {
+    if( y < firstCopiedScanline || y >= endCopiedScanline )
+    {
+      // Add a top or bottom border.
+      memset( pixelsOut, BORDER_FILL_VALUE, outputSpan );
+      continue;
     }
+
+    // Add any left and right borders either side of the copied pixels.
+    memset( pixelsOut, BORDER_FILL_VALUE, leftBorderSpan );
+    memcpy( pixelsOut + leftBorderSpan, sourcePixels + ( y - firstCopiedScanline ) * inputSpan, copySpan );
+    memset( pixelsOut + leftBorderSpan + copySpan, BORDER_FILL_VALUE, rightBorderSpan );
   }
+}
 
-  ///@note: we could finish off with one of two mutually exclusive passes, one squashing horizontally as far as possible, and the other vertically, if we knew a following cpu point or bilinear filter would restore the desired aspect ratio.
-  outWidth = scaledWidth;
-  outHeight = scaledHeight;
+Dali::Devel::PixelBuffer CropAndPadForFittingMode( Dali::Devel::PixelBuffer& bitmap, ImageDimensions desiredDimensions, FittingMode::Type fittingMode )
+{
+  const unsigned int inputWidth = bitmap.GetWidth();
+  const unsigned int inputHeight = bitmap.GetHeight();
+
+  // Action the changes by making a new bitmap with the central part of the loaded one if required.
+  FittingModeCrop crop;
+  if( CalculateCropForFittingMode( ImageDimensions( inputWidth, inputHeight ), desiredDimensions, fittingMode, crop ) )
+  {
+    // Create new PixelBuffer with the desired size.
+    const auto pixelFormat = bitmap.GetPixelFormat();
+    auto croppedBitmap = Devel::PixelBuffer::New( crop.outputDimensions.GetWidth(), crop.outputDimensions.GetHeight(), pixelFormat );
+    DALI_ASSERT_DEBUG( bitmap.GetBuffer() && croppedBitmap.GetBuffer() );
+
+    // Copy the image data to the new bitmap, adding vertical or horizontal borders to the final image (if required).
+    CropAndPadScanlines( bitmap.GetBuffer(), inputWidth, Pixel::GetBytesPerPixel( pixelFormat ), crop, 0u, crop.outputDimensions.GetHeight(), croppedBitmap.GetBuffer() );
+
+    // Overwrite the loaded bitmap with the cropped version
+    bitmap = croppedBitmap;
+  }
+
+  return bitmap;
+}
+
+Dali::Devel::PixelBuffer DownscaleBitmap( Dali::Devel::PixelBuffer bitmap,
+                                        ImageDimensions desired,
+                                        FittingMode::Type fittingMode,
+                                        SamplingMode::Type samplingMode )
+{
+  // Source dimensions as loaded from resources (e.g. filesystem):
+  auto bitmapWidth  = bitmap.GetWidth();
+  auto bitmapHeight = bitmap.GetHeight();
+  // Desired dimensions (the rectangle to fit the source image to):
+  auto desiredWidth = desired.GetWidth();
+  auto desiredHeight = desired.GetHeight();
+
+  Dali::Devel::PixelBuffer outputBitmap { bitmap };
+
+  // If a different size than the raw one has been requested, resize the image:
+  if(
+      (desiredWidth > 0.0f) && (desiredHeight > 0.0f) &&
+      ((desiredWidth < bitmapWidth) || (desiredHeight < bitmapHeight)) )
+  {
+    auto pixelFormat = bitmap.GetPixelFormat();
+
+    // Do the fast power of 2 iterated box filter to get to roughly the right side if the filter mode requests that:
+    unsigned int shrunkWidth = -1, shrunkHeight = -1;
+    DownscaleInPlacePow2( bitmap.GetBuffer(), pixelFormat, bitmapWidth, bitmapHeight, desiredWidth, desiredHeight, fittingMode, samplingMode, shrunkWidth, shrunkHeight );
+
+    // Work out the dimensions of the downscaled bitmap, given the scaling mode and desired dimensions:
+    const ImageDimensions filteredDimensions = FitToScalingMode( ImageDimensions( desiredWidth, desiredHeight ), ImageDimensions( shrunkWidth, shrunkHeight ), fittingMode );
+    const unsigned int filteredWidth = filteredDimensions.GetWidth();
+    const unsigned int filteredHeight = filteredDimensions.GetHeight();
+
+    // Run a filter to scale down the bitmap if it needs it:
+    bool filtered = false;
+    if( filteredWidth < shrunkWidth || filteredHeight < shrunkHeight )
+    {
+      if( samplingMode == SamplingMode::LINEAR || samplingMode == SamplingMode::BOX_THEN_LINEAR ||
+          samplingMode == SamplingMode::NEAREST || samplingMode == SamplingMode::BOX_THEN_NEAREST )
+      {
+        outputBitmap = Dali::Devel::PixelBuffer::New( filteredWidth, filteredHeight, pixelFormat );
+
+        if( outputBitmap )
+        {
+          if( samplingMode == SamplingMode::LINEAR || samplingMode == SamplingMode::BOX_THEN_LINEAR )
+          {
+            LinearSample( bitmap.GetBuffer(), ImageDimensions(shrunkWidth, shrunkHeight), pixelFormat, outputBitmap.GetBuffer(), filteredDimensions );
+          }
+          else
+          {
+            PointSample( bitmap.GetBuffer(), shrunkWidth, shrunkHeight, pixelFormat, outputBitmap.GetBuffer(), filteredWidth, filteredHeight );
+          }
+          filtered = true;
+        }
+      }
+    }
+    // Copy out the 2^x downscaled, box-filtered pixels if no secondary filter (point or linear) was applied:
+    if( filtered == false && ( shrunkWidth < bitmapWidth || shrunkHeight < bitmapHeight ) )
+    {
+      outputBitmap = MakePixelBuffer( bitmap.GetBuffer(), pixelFormat, shrunkWidth, shrunkHeight );
+    }
+  }
+
+  return outputBitmap;
+}
+
+namespace
+{
+/**
+ * @brief Returns whether to keep box filtering based on whether downscaled dimensions will overshoot the desired ones aty the next step.
+ * @param test Which combination of the two dimensions matter for terminating the filtering.
+ * @param scaledWidth The width of the current downscaled image.
+ * @param scaledHeight The height of the current downscaled image.
+ * @param desiredWidth The target width for the downscaling.
+ * @param desiredHeight The target height for the downscaling.
+ */
+bool ContinueScaling( BoxDimensionTest test, unsigned int scaledWidth, unsigned int scaledHeight, unsigned int desiredWidth, unsigned int desiredHeight )
+{
+  bool keepScaling = false;
+  const unsigned int nextWidth = scaledWidth >> 1u;
+  const unsigned int nextHeight = scaledHeight >> 1u;
+
+  if( nextWidth >= 1u && nextHeight >= 1u )
+  {
+    switch( test )
+    {
+      case BoxDimensionTestEither:
+      {
+        keepScaling = nextWidth >= desiredWidth || nextHeight >= desiredHeight;
+        break;
+      }
+      case BoxDimensionTestBoth:
+      {
+        keepScaling = nextWidth >= desiredWidth && nextHeight >= desiredHeight;
+        break;
+      }
+      case BoxDimensionTestX:
+      {
+        keepScaling = nextWidth >= desiredWidth;
+        break;
+      }
+      case BoxDimensionTestY:
+      {
+        keepScaling = nextHeight >= desiredHeight;
+        break;
+      }
+    }
+  }
+
+  return keepScaling;
+}
+
+/**
+ * @brief A shared implementation of the overall iterative box filter
+ * downscaling algorithm.
+ *
+ * Specialise this for particular pixel formats by supplying the number of bytes
+ * per pixel and two functions: one for averaging pairs of neighbouring pixels
+ * on a single scanline, and a second for averaging pixels at corresponding
+ * positions on different scanlines.
+ **/
+template<
+  int BYTES_PER_PIXEL,
+  void (*HalveScanlineInPlace)( unsigned char * const pixels, const unsigned int width ),
+  void (*AverageScanlines) ( const unsigned char * const scanline1, const unsigned char * const __restrict__ scanline2, unsigned char* const outputScanline, const unsigned int width )
+>
+void DownscaleInPlacePow2Generic( unsigned char * const pixels,
+                                  const unsigned int inputWidth,
+                                  const unsigned int inputHeight,
+                                  const unsigned int desiredWidth,
+                                  const unsigned int desiredHeight,
+                                  BoxDimensionTest dimensionTest,
+                                  unsigned& outWidth,
+                                  unsigned& outHeight )
+{
+  if( pixels == 0 )
+  {
+    return;
+  }
+  ValidateScalingParameters( inputWidth, inputHeight, desiredWidth, desiredHeight );
+
+  // Scale the image until it would be smaller than desired, stopping if the
+  // resulting height or width would be less than 1:
+  unsigned int scaledWidth = inputWidth, scaledHeight = inputHeight;
+  while( ContinueScaling( dimensionTest, scaledWidth, scaledHeight, desiredWidth, desiredHeight ) )
+  {
+    const unsigned int lastWidth = scaledWidth;
+    scaledWidth  >>= 1u;
+    scaledHeight >>= 1u;
+
+    DALI_LOG_INFO( gImageOpsLogFilter, Dali::Integration::Log::Verbose, "Scaling to %u\t%u.\n", scaledWidth, scaledHeight );
+
+    const unsigned int lastScanlinePair = scaledHeight - 1;
+
+    // Scale pairs of scanlines until any spare one at the end is dropped:
+    for( unsigned int y = 0; y <= lastScanlinePair; ++y )
+    {
+      // Scale two scanlines horizontally:
+      HalveScanlineInPlace( &pixels[y * 2 * lastWidth * BYTES_PER_PIXEL], lastWidth );
+      HalveScanlineInPlace( &pixels[(y * 2 + 1) * lastWidth * BYTES_PER_PIXEL], lastWidth );
+
+      // Scale vertical pairs of pixels while the last two scanlines are still warm in
+      // the CPU cache(s):
+      // Note, better access patterns for cache-coherence are possible for very large
+      // images but even a 4k wide RGB888 image will use just 24kB of cache (4k pixels
+      // * 3 Bpp * 2 scanlines) for two scanlines on the first iteration.
+      AverageScanlines(
+          &pixels[y * 2 * lastWidth * BYTES_PER_PIXEL],
+          &pixels[(y * 2 + 1) * lastWidth * BYTES_PER_PIXEL],
+          &pixels[y * scaledWidth * BYTES_PER_PIXEL],
+          scaledWidth );
+    }
+  }
+
+  ///@note: we could finish off with one of two mutually exclusive passes, one squashing horizontally as far as possible, and the other vertically, if we knew a following cpu point or bilinear filter would restore the desired aspect ratio.
+  outWidth = scaledWidth;
+  outHeight = scaledHeight;
+}
+
+}
+
+void HalveScanlineInPlaceRGB888( unsigned char * const pixels, const unsigned int width )
+{
+  DebugAssertScanlineParameters( pixels, width );
+
+  const unsigned int lastPair = EvenDown( width - 2 );
+
+  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+  {
+    // Load all the byte pixel components we need:
+    const unsigned int c11 = pixels[pixel * 3];
+    const unsigned int c12 = pixels[pixel * 3 + 1];
+    const unsigned int c13 = pixels[pixel * 3 + 2];
+    const unsigned int c21 = pixels[pixel * 3 + 3];
+    const unsigned int c22 = pixels[pixel * 3 + 4];
+    const unsigned int c23 = pixels[pixel * 3 + 5];
+
+    // Save the averaged byte pixel components:
+    pixels[outPixel * 3]     = static_cast<unsigned char>( AverageComponent( c11, c21 ) );
+    pixels[outPixel * 3 + 1] = static_cast<unsigned char>( AverageComponent( c12, c22 ) );
+    pixels[outPixel * 3 + 2] = static_cast<unsigned char>( AverageComponent( c13, c23 ) );
+  }
+}
+
+void HalveScanlineInPlaceRGBA8888( unsigned char * const pixels, const unsigned int width )
+{
+  DebugAssertScanlineParameters( pixels, width );
+  DALI_ASSERT_DEBUG( ((reinterpret_cast<ptrdiff_t>(pixels) & 3u) == 0u) && "Pointer should be 4-byte aligned for performance on some platforms." );
+
+  uint32_t* const alignedPixels = reinterpret_cast<uint32_t*>(pixels);
+
+  const unsigned int lastPair = EvenDown( width - 2 );
+
+  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+  {
+    const uint32_t averaged = AveragePixelRGBA8888( alignedPixels[pixel], alignedPixels[pixel + 1] );
+    alignedPixels[outPixel] = averaged;
+  }
+}
+
+void HalveScanlineInPlaceRGB565( unsigned char * pixels, unsigned int width )
+{
+  DebugAssertScanlineParameters( pixels, width );
+  DALI_ASSERT_DEBUG( ((reinterpret_cast<ptrdiff_t>(pixels) & 1u) == 0u) && "Pointer should be 2-byte aligned for performance on some platforms." );
+
+  uint16_t* const alignedPixels = reinterpret_cast<uint16_t*>(pixels);
+
+  const unsigned int lastPair = EvenDown( width - 2 );
+
+  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+  {
+    const uint32_t averaged = AveragePixelRGB565( alignedPixels[pixel], alignedPixels[pixel + 1] );
+    alignedPixels[outPixel] = averaged;
+  }
+}
+
+void HalveScanlineInPlace2Bytes( unsigned char * const pixels, const unsigned int width )
+{
+  DebugAssertScanlineParameters( pixels, width );
+
+  const unsigned int lastPair = EvenDown( width - 2 );
+
+  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+  {
+    // Load all the byte pixel components we need:
+    const unsigned int c11 = pixels[pixel * 2];
+    const unsigned int c12 = pixels[pixel * 2 + 1];
+    const unsigned int c21 = pixels[pixel * 2 + 2];
+    const unsigned int c22 = pixels[pixel * 2 + 3];
+
+    // Save the averaged byte pixel components:
+    pixels[outPixel * 2]     = static_cast<unsigned char>( AverageComponent( c11, c21 ) );
+    pixels[outPixel * 2 + 1] = static_cast<unsigned char>( AverageComponent( c12, c22 ) );
+  }
+}
+
+void HalveScanlineInPlace1Byte( unsigned char * const pixels, const unsigned int width )
+{
+  DebugAssertScanlineParameters( pixels, width );
+
+  const unsigned int lastPair = EvenDown( width - 2 );
+
+  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+  {
+    // Load all the byte pixel components we need:
+    const unsigned int c1 = pixels[pixel];
+    const unsigned int c2 = pixels[pixel + 1];
+
+    // Save the averaged byte pixel component:
+    pixels[outPixel] = static_cast<unsigned char>( AverageComponent( c1, c2 ) );
+  }
+}
+
+/**
+ * @ToDo: Optimise for ARM using a 4 bytes at a time loop wrapped around the single ARMV6 instruction: UHADD8  R4, R0, R5. Note, this is not neon. It runs in the normal integer pipeline so there is no downside like a stall moving between integer and copro, or extra power for clocking-up the idle copro.
+ * if (widthInComponents >= 7) { word32* aligned1 = scanline1 + 3 & 3; word32* aligned1_end = scanline1 + widthInPixels & 3; while(aligned1 < aligned1_end) { UHADD8  *aligned1++, *aligned2++, *alignedoutput++ } .. + 0 to 3 spare pixels at each end.
+ */
+void AverageScanlines1( const unsigned char * const scanline1,
+                        const unsigned char * const __restrict__ scanline2,
+                        unsigned char* const outputScanline,
+                        const unsigned int width )
+{
+  DebugAssertDualScanlineParameters( scanline1, scanline2, outputScanline, width );
+
+  for( unsigned int component = 0; component < width; ++component )
+  {
+    outputScanline[component] = static_cast<unsigned char>( AverageComponent( scanline1[component], scanline2[component] ) );
+  }
+}
+
+void AverageScanlines2( const unsigned char * const scanline1,
+                        const unsigned char * const __restrict__ scanline2,
+                        unsigned char* const outputScanline,
+                        const unsigned int width )
+{
+  DebugAssertDualScanlineParameters( scanline1, scanline2, outputScanline, width * 2 );
+
+  for( unsigned int component = 0; component < width * 2; ++component )
+  {
+    outputScanline[component] = static_cast<unsigned char>( AverageComponent( scanline1[component], scanline2[component] ) );
+  }
+}
+
+void AverageScanlines3( const unsigned char * const scanline1,
+                        const unsigned char * const __restrict__ scanline2,
+                        unsigned char* const outputScanline,
+                        const unsigned int width )
+{
+  DebugAssertDualScanlineParameters( scanline1, scanline2, outputScanline, width * 3 );
+
+  for( unsigned int component = 0; component < width * 3; ++component )
+  {
+    outputScanline[component] = static_cast<unsigned char>( AverageComponent( scanline1[component], scanline2[component] ) );
+  }
+}
+
+void AverageScanlinesRGBA8888( const unsigned char * const scanline1,
+                               const unsigned char * const __restrict__ scanline2,
+                               unsigned char * const outputScanline,
+                               const unsigned int width )
+{
+  DebugAssertDualScanlineParameters( scanline1, scanline2, outputScanline, width * 4 );
+  DALI_ASSERT_DEBUG( ((reinterpret_cast<ptrdiff_t>(scanline1) & 3u) == 0u) && "Pointer should be 4-byte aligned for performance on some platforms." );
+  DALI_ASSERT_DEBUG( ((reinterpret_cast<ptrdiff_t>(scanline2) & 3u) == 0u) && "Pointer should be 4-byte aligned for performance on some platforms." );
+  DALI_ASSERT_DEBUG( ((reinterpret_cast<ptrdiff_t>(outputScanline) & 3u) == 0u) && "Pointer should be 4-byte aligned for performance on some platforms." );
+
+  const uint32_t* const alignedScanline1 = reinterpret_cast<const uint32_t*>(scanline1);
+  const uint32_t* const alignedScanline2 = reinterpret_cast<const uint32_t*>(scanline2);
+  uint32_t* const alignedOutput = reinterpret_cast<uint32_t*>(outputScanline);
+
+  for( unsigned int pixel = 0; pixel < width; ++pixel )
+  {
+    alignedOutput[pixel] = AveragePixelRGBA8888( alignedScanline1[pixel], alignedScanline2[pixel] );
+  }
+}
+
+void AverageScanlinesRGB565( const unsigned char * const scanline1,
+                             const unsigned char * const __restrict__ scanline2,
+                             unsigned char * const outputScanline,
+                             const unsigned int width )
+{
+  DebugAssertDualScanlineParameters( scanline1, scanline2, outputScanline, width * 2 );
+  DALI_ASSERT_DEBUG( ((reinterpret_cast<ptrdiff_t>(scanline1) & 1u) == 0u) && "Pointer should be 2-byte aligned for performance on some platforms." );
+  DALI_ASSERT_DEBUG( ((reinterpret_cast<ptrdiff_t>(scanline2) & 1u) == 0u) && "Pointer should be 2-byte aligned for performance on some platforms." );
+  DALI_ASSERT_DEBUG( ((reinterpret_cast<ptrdiff_t>(outputScanline) & 1u) == 0u) && "Pointer should be 2-byte aligned for performance on some platforms." );
+
+  const uint16_t* const alignedScanline1 = reinterpret_cast<const uint16_t*>(scanline1);
+  const uint16_t* const alignedScanline2 = reinterpret_cast<const uint16_t*>(scanline2);
+  uint16_t* const alignedOutput = reinterpret_cast<uint16_t*>(outputScanline);
+
+  for( unsigned int pixel = 0; pixel < width; ++pixel )
+  {
+    alignedOutput[pixel] = AveragePixelRGB565( alignedScanline1[pixel], alignedScanline2[pixel] );
+  }
+}
+
+namespace
+{
+
+/**
+ * @defgroup VectorisedBoxFilterKernels Vectorised bodies of the scanline halving and averaging functions.
+ *
+ * Each kernel processes as many whole blocks of pixels as fit in the scanline
+ * and returns the number of output pixels it wrote. The caller finishes the
+ * remaining pixels with the scalar code, so the kernels never read or write
+ * past the end of a scanline. All kernels round down exactly like
+ * AverageComponent(), AveragePixelRGBA8888() and AveragePixelRGB565() so the
+ * output is bit-exact with the scalar reference functions.
+ * @{
+ */
+
+/** Mask of the bits of an RGB565 pixel which are not the lowest bit of a color field. */
+const uint16_t RGB565_FIELD_HIGH_BITS = 0xf7de;
+
+#if defined(DALI_IMAGE_OPERATIONS_X86_SIMD)
+
+/** @brief Average each pair of corresponding bytes, rounding down. */
+__attribute__((target("sse2"))) inline __m128i AverageBytesSse2( __m128i a, __m128i b )
+{
+  // _mm_avg_epu8 rounds halves up, so take off the carried low bit where the sum was odd:
+  return _mm_sub_epi8( _mm_avg_epu8( a, b ), _mm_and_si128( _mm_xor_si128( a, b ), _mm_set1_epi8( 1 ) ) );
+}
+
+/** @brief Average each pair of corresponding RGB565 pixels, field by field and rounding down. */
+__attribute__((target("sse2"))) inline __m128i AverageRGB565Sse2( __m128i a, __m128i b )
+{
+  // (a + b) / 2 == (a & b) + (a ^ b) / 2, with the halving done independently for each field:
+  const __m128i halfDifference = _mm_srli_epi16( _mm_and_si128( _mm_xor_si128( a, b ), _mm_set1_epi16( static_cast<short>( RGB565_FIELD_HIGH_BITS ) ) ), 1 );
+  return _mm_add_epi16( _mm_and_si128( a, b ), halfDifference );
+}
+
+/** @brief Pack the low 16 bits of each 32 bit lane of two vectors into one vector. */
+__attribute__((target("sse2"))) inline __m128i PackLow16Sse2( __m128i a, __m128i b )
+{
+  // Sign extend so the signed saturating pack reproduces the low 16 bits exactly:
+  a = _mm_srai_epi32( _mm_slli_epi32( a, 16 ), 16 );
+  b = _mm_srai_epi32( _mm_slli_epi32( b, 16 ), 16 );
+  return _mm_packs_epi32( a, b );
+}
+
+__attribute__((target("sse2"))) unsigned int AverageBytesKernelSse2( const uint8_t* scanline1, const uint8_t* scanline2, uint8_t* output, unsigned int count )
+{
+  unsigned int i = 0;
+  for( ; i + 16u <= count; i += 16u )
+  {
+    const __m128i a = _mm_loadu_si128( reinterpret_cast<const __m128i*>( scanline1 + i ) );
+    const __m128i b = _mm_loadu_si128( reinterpret_cast<const __m128i*>( scanline2 + i ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( output + i ), AverageBytesSse2( a, b ) );
+  }
+  return i;
+}
+
+__attribute__((target("sse2"))) unsigned int AverageRGB565KernelSse2( const uint16_t* scanline1, const uint16_t* scanline2, uint16_t* output, unsigned int width )
+{
+  unsigned int i = 0;
+  for( ; i + 8u <= width; i += 8u )
+  {
+    const __m128i a = _mm_loadu_si128( reinterpret_cast<const __m128i*>( scanline1 + i ) );
+    const __m128i b = _mm_loadu_si128( reinterpret_cast<const __m128i*>( scanline2 + i ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( output + i ), AverageRGB565Sse2( a, b ) );
+  }
+  return i;
+}
+
+__attribute__((target("sse2"))) unsigned int HalveScanline1ByteKernelSse2( uint8_t* pixels, unsigned int outputWidth )
+{
+  const __m128i lowByteMask = _mm_set1_epi16( 0x00ff );
+  unsigned int i = 0;
+  for( ; i + 16u <= outputWidth; i += 16u )
+  {
+    const __m128i a = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + i * 2u ) );
+    const __m128i b = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + i * 2u + 16u ) );
+    // Neighbouring pixels share a 16 bit lane, so their sum can't overflow it:
+    const __m128i averageA = _mm_srli_epi16( _mm_add_epi16( _mm_and_si128( a, lowByteMask ), _mm_srli_epi16( a, 8 ) ), 1 );
+    const __m128i averageB = _mm_srli_epi16( _mm_add_epi16( _mm_and_si128( b, lowByteMask ), _mm_srli_epi16( b, 8 ) ), 1 );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( pixels + i ), _mm_packus_epi16( averageA, averageB ) );
+  }
+  return i;
+}
+
+__attribute__((target("sse2"))) unsigned int HalveScanline2BytesKernelSse2( uint8_t* pixels, unsigned int outputWidth )
+{
+  unsigned int i = 0;
+  for( ; i + 8u <= outputWidth; i += 8u )
+  {
+    const __m128i a = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + i * 4u ) );
+    const __m128i b = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + i * 4u + 16u ) );
+    // Each 32 bit lane holds a pair of pixels: average the low pixel with the high one:
+    const __m128i averageA = AverageBytesSse2( a, _mm_srli_epi32( a, 16 ) );
+    const __m128i averageB = AverageBytesSse2( b, _mm_srli_epi32( b, 16 ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( pixels + i * 2u ), PackLow16Sse2( averageA, averageB ) );
+  }
+  return i;
+}
+
+__attribute__((target("sse2"))) unsigned int HalveScanlineRGB565KernelSse2( uint16_t* pixels, unsigned int outputWidth )
+{
+  unsigned int i = 0;
+  for( ; i + 8u <= outputWidth; i += 8u )
+  {
+    const __m128i a = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + i * 2u ) );
+    const __m128i b = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + i * 2u + 8u ) );
+    const __m128i averageA = AverageRGB565Sse2( a, _mm_srli_epi32( a, 16 ) );
+    const __m128i averageB = AverageRGB565Sse2( b, _mm_srli_epi32( b, 16 ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( pixels + i ), PackLow16Sse2( averageA, averageB ) );
+  }
+  return i;
+}
+
+__attribute__((target("sse2"))) unsigned int HalveScanlineRGBA8888KernelSse2( uint32_t* pixels, unsigned int outputWidth )
+{
+  unsigned int i = 0;
+  for( ; i + 4u <= outputWidth; i += 4u )
+  {
+    const __m128 a = _mm_castsi128_ps( _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + i * 2u ) ) );
+    const __m128 b = _mm_castsi128_ps( _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + i * 2u + 4u ) ) );
+    const __m128i even = _mm_castps_si128( _mm_shuffle_ps( a, b, _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+    const __m128i odd  = _mm_castps_si128( _mm_shuffle_ps( a, b, _MM_SHUFFLE( 3, 1, 3, 1 ) ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( pixels + i ), AverageBytesSse2( even, odd ) );
+  }
+  return i;
+}
+
+__attribute__((target("ssse3"))) unsigned int HalveScanlineRGB888KernelSsse3( uint8_t* pixels, unsigned int outputWidth )
+{
+  // Gather the first and the second pixel of each of four pairs from two overlapping loads.
+  // Indices with the top bit set zero the destination byte.
+  const __m128i firstFromLow   = _mm_setr_epi8( 0, 1, 2, 6, 7, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 );
+  const __m128i secondFromLow  = _mm_setr_epi8( 3, 4, 5, 9, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 );
+  const __m128i firstFromHigh  = _mm_setr_epi8( -1, -1, -1, -1, -1, -1, 4, 5, 6, 10, 11, 12, -1, -1, -1, -1 );
+  const __m128i secondFromHigh = _mm_setr_epi8( -1, -1, -1, -1, -1, -1, 7, 8, 9, 13, 14, 15, -1, -1, -1, -1 );
+
+  unsigned int i = 0;
+  for( ; i + 4u <= outputWidth; i += 4u )
+  {
+    const __m128i low  = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + i * 6u ) );
+    const __m128i high = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pixels + i * 6u + 8u ) );
+    const __m128i first  = _mm_or_si128( _mm_shuffle_epi8( low, firstFromLow ), _mm_shuffle_epi8( high, firstFromHigh ) );
+    const __m128i second = _mm_or_si128( _mm_shuffle_epi8( low, secondFromLow ), _mm_shuffle_epi8( high, secondFromHigh ) );
+
+    // The 12 averaged bytes are followed by 4 bytes of padding. The padding
+    // lands in the input pixels consumed by this iteration so is harmless:
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( pixels + i * 3u ), AverageBytesSse2( first, second ) );
+  }
+  return i;
+}
+
+/** @copydoc AverageBytesSse2 */
+__attribute__((target("avx2"))) inline __m256i AverageBytesAvx2( __m256i a, __m256i b )
+{
+  return _mm256_sub_epi8( _mm256_avg_epu8( a, b ), _mm256_and_si256( _mm256_xor_si256( a, b ), _mm256_set1_epi8( 1 ) ) );
+}
+
+/** @copydoc AverageRGB565Sse2 */
+__attribute__((target("avx2"))) inline __m256i AverageRGB565Avx2( __m256i a, __m256i b )
+{
+  const __m256i halfDifference = _mm256_srli_epi16( _mm256_and_si256( _mm256_xor_si256( a, b ), _mm256_set1_epi16( static_cast<short>( RGB565_FIELD_HIGH_BITS ) ) ), 1 );
+  return _mm256_add_epi16( _mm256_and_si256( a, b ), halfDifference );
+}
+
+/**
+ * @brief Pack the low 16 bits of each 32 bit lane of two vectors into one vector.
+ * @note The AVX2 pack instructions work within 128 bit halves so the 64 bit blocks are put back in order afterwards.
+ */
+__attribute__((target("avx2"))) inline __m256i PackLow16Avx2( __m256i a, __m256i b )
+{
+  a = _mm256_srai_epi32( _mm256_slli_epi32( a, 16 ), 16 );
+  b = _mm256_srai_epi32( _mm256_slli_epi32( b, 16 ), 16 );
+  return _mm256_permute4x64_epi64( _mm256_packs_epi32( a, b ), _MM_SHUFFLE( 3, 1, 2, 0 ) );
+}
+
+__attribute__((target("avx2"))) unsigned int AverageBytesKernelAvx2( const uint8_t* scanline1, const uint8_t* scanline2, uint8_t* output, unsigned int count )
+{
+  unsigned int i = 0;
+  for( ; i + 32u <= count; i += 32u )
+  {
+    const __m256i a = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( scanline1 + i ) );
+    const __m256i b = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( scanline2 + i ) );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( output + i ), AverageBytesAvx2( a, b ) );
+  }
+  return i;
+}
+
+__attribute__((target("avx2"))) unsigned int AverageRGB565KernelAvx2( const uint16_t* scanline1, const uint16_t* scanline2, uint16_t* output, unsigned int width )
+{
+  unsigned int i = 0;
+  for( ; i + 16u <= width; i += 16u )
+  {
+    const __m256i a = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( scanline1 + i ) );
+    const __m256i b = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( scanline2 + i ) );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( output + i ), AverageRGB565Avx2( a, b ) );
+  }
+  return i;
+}
+
+__attribute__((target("avx2"))) unsigned int HalveScanline1ByteKernelAvx2( uint8_t* pixels, unsigned int outputWidth )
+{
+  const __m256i lowByteMask = _mm256_set1_epi16( 0x00ff );
+  unsigned int i = 0;
+  for( ; i + 32u <= outputWidth; i += 32u )
+  {
+    const __m256i a = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( pixels + i * 2u ) );
+    const __m256i b = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( pixels + i * 2u + 32u ) );
+    const __m256i averageA = _mm256_srli_epi16( _mm256_add_epi16( _mm256_and_si256( a, lowByteMask ), _mm256_srli_epi16( a, 8 ) ), 1 );
+    const __m256i averageB = _mm256_srli_epi16( _mm256_add_epi16( _mm256_and_si256( b, lowByteMask ), _mm256_srli_epi16( b, 8 ) ), 1 );
+    const __m256i packed = _mm256_permute4x64_epi64( _mm256_packus_epi16( averageA, averageB ), _MM_SHUFFLE( 3, 1, 2, 0 ) );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( pixels + i ), packed );
+  }
+  return i;
+}
+
+__attribute__((target("avx2"))) unsigned int HalveScanline2BytesKernelAvx2( uint8_t* pixels, unsigned int outputWidth )
+{
+  unsigned int i = 0;
+  for( ; i + 16u <= outputWidth; i += 16u )
+  {
+    const __m256i a = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( pixels + i * 4u ) );
+    const __m256i b = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( pixels + i * 4u + 32u ) );
+    const __m256i averageA = AverageBytesAvx2( a, _mm256_srli_epi32( a, 16 ) );
+    const __m256i averageB = AverageBytesAvx2( b, _mm256_srli_epi32( b, 16 ) );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( pixels + i * 2u ), PackLow16Avx2( averageA, averageB ) );
+  }
+  return i;
+}
+
+__attribute__((target("avx2"))) unsigned int HalveScanlineRGB565KernelAvx2( uint16_t* pixels, unsigned int outputWidth )
+{
+  unsigned int i = 0;
+  for( ; i + 16u <= outputWidth; i += 16u )
+  {
+    const __m256i a = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( pixels + i * 2u ) );
+    const __m256i b = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( pixels + i * 2u + 16u ) );
+    const __m256i averageA = AverageRGB565Avx2( a, _mm256_srli_epi32( a, 16 ) );
+    const __m256i averageB = AverageRGB565Avx2( b, _mm256_srli_epi32( b, 16 ) );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( pixels + i ), PackLow16Avx2( averageA, averageB ) );
+  }
+  return i;
+}
+
+__attribute__((target("avx2"))) unsigned int HalveScanlineRGBA8888KernelAvx2( uint32_t* pixels, unsigned int outputWidth )
+{
+  unsigned int i = 0;
+  for( ; i + 8u <= outputWidth; i += 8u )
+  {
+    const __m256 a = _mm256_castsi256_ps( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( pixels + i * 2u ) ) );
+    const __m256 b = _mm256_castsi256_ps( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( pixels + i * 2u + 8u ) ) );
+    const __m256i even = _mm256_castps_si256( _mm256_shuffle_ps( a, b, _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+    const __m256i odd  = _mm256_castps_si256( _mm256_shuffle_ps( a, b, _MM_SHUFFLE( 3, 1, 3, 1 ) ) );
+    // The shuffles work within 128 bit halves, so restore the pixel order:
+    const __m256i averaged = _mm256_permute4x64_epi64( AverageBytesAvx2( even, odd ), _MM_SHUFFLE( 3, 1, 2, 0 ) );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( pixels + i ), averaged );
+  }
+  return i;
+}
+
+#endif // DALI_IMAGE_OPERATIONS_X86_SIMD
+
+#if defined(DALI_IMAGE_OPERATIONS_NEON)
+
+/** @brief Average each pair of corresponding RGB565 pixels, field by field and rounding down. */
+inline uint16x8_t AverageRGB565Neon( uint16x8_t a, uint16x8_t b )
+{
+  const uint16x8_t halfDifference = vshrq_n_u16( vandq_u16( veorq_u16( a, b ), vdupq_n_u16( RGB565_FIELD_HIGH_BITS ) ), 1 );
+  return vaddq_u16( vandq_u16( a, b ), halfDifference );
+}
+
+/** @brief Average adjacent pairs of bytes, rounding down. */
+inline uint8x8_t HalvePairsNeon( uint8x16_t pixels )
+{
+  return vshrn_n_u16( vpaddlq_u8( pixels ), 1 );
+}
+
+unsigned int AverageBytesKernelNeon( const uint8_t* scanline1, const uint8_t* scanline2, uint8_t* output, unsigned int count )
+{
+  unsigned int i = 0;
+  for( ; i + 16u <= count; i += 16u )
+  {
+    vst1q_u8( output + i, vhaddq_u8( vld1q_u8( scanline1 + i ), vld1q_u8( scanline2 + i ) ) );
+  }
+  return i;
+}
+
+unsigned int AverageRGB565KernelNeon( const uint16_t* scanline1, const uint16_t* scanline2, uint16_t* output, unsigned int width )
+{
+  unsigned int i = 0;
+  for( ; i + 8u <= width; i += 8u )
+  {
+    vst1q_u16( output + i, AverageRGB565Neon( vld1q_u16( scanline1 + i ), vld1q_u16( scanline2 + i ) ) );
+  }
+  return i;
+}
+
+unsigned int HalveScanline1ByteKernelNeon( uint8_t* pixels, unsigned int outputWidth )
+{
+  unsigned int i = 0;
+  for( ; i + 8u <= outputWidth; i += 8u )
+  {
+    const uint8x8_t averaged = HalvePairsNeon( vld1q_u8( pixels + i * 2u ) );
+    vst1_u8( pixels + i, averaged );
+  }
+  return i;
+}
+
+unsigned int HalveScanline2BytesKernelNeon( uint8_t* pixels, unsigned int outputWidth )
+{
+  unsigned int i = 0;
+  for( ; i + 8u <= outputWidth; i += 8u )
+  {
+    const uint8x16x2_t in = vld2q_u8( pixels + i * 4u );
+    uint8x8x2_t out;
+    out.val[0] = HalvePairsNeon( in.val[0] );
+    out.val[1] = HalvePairsNeon( in.val[1] );
+    vst2_u8( pixels + i * 2u, out );
+  }
+  return i;
+}
+
+unsigned int HalveScanlineRGB888KernelNeon( uint8_t* pixels, unsigned int outputWidth )
+{
+  unsigned int i = 0;
+  for( ; i + 8u <= outputWidth; i += 8u )
+  {
+    const uint8x16x3_t in = vld3q_u8( pixels + i * 6u );
+    uint8x8x3_t out;
+    out.val[0] = HalvePairsNeon( in.val[0] );
+    out.val[1] = HalvePairsNeon( in.val[1] );
+    out.val[2] = HalvePairsNeon( in.val[2] );
+    vst3_u8( pixels + i * 3u, out );
+  }
+  return i;
+}
+
+unsigned int HalveScanlineRGBA8888KernelNeon( uint32_t* pixels, unsigned int outputWidth )
+{
+  uint8_t* const bytes = reinterpret_cast<uint8_t*>( pixels );
+  unsigned int i = 0;
+  for( ; i + 8u <= outputWidth; i += 8u )
+  {
+    const uint8x16x4_t in = vld4q_u8( bytes + i * 8u );
+    uint8x8x4_t out;
+    out.val[0] = HalvePairsNeon( in.val[0] );
+    out.val[1] = HalvePairsNeon( in.val[1] );
+    out.val[2] = HalvePairsNeon( in.val[2] );
+    out.val[3] = HalvePairsNeon( in.val[3] );
+    vst4_u8( bytes + i * 4u, out );
+  }
+  return i;
+}
+
+unsigned int HalveScanlineRGB565KernelNeon( uint16_t* pixels, unsigned int outputWidth )
+{
+  unsigned int i = 0;
+  for( ; i + 8u <= outputWidth; i += 8u )
+  {
+    const uint16x8x2_t in = vld2q_u16( pixels + i * 2u );
+    vst1q_u16( pixels + i, AverageRGB565Neon( in.val[0], in.val[1] ) );
+  }
+  return i;
+}
+
+#endif // DALI_IMAGE_OPERATIONS_NEON
+
+/**
+ * @brief Average corresponding bytes of two buffers with the best kernel available.
+ * @return The number of bytes which were averaged. The caller deals with any remainder.
+ */
+unsigned int AverageBytesVectorised( const uint8_t* scanline1, const uint8_t* scanline2, uint8_t* output, unsigned int count )
+{
+#if defined(DALI_IMAGE_OPERATIONS_X86_SIMD)
+  const unsigned int features = GetCpuFeatures();
+  if( features & CPU_FEATURE_AVX2 )
+  {
+    return AverageBytesKernelAvx2( scanline1, scanline2, output, count );
+  }
+  if( features & CPU_FEATURE_SSE2 )
+  {
+    return AverageBytesKernelSse2( scanline1, scanline2, output, count );
+  }
+#elif defined(DALI_IMAGE_OPERATIONS_NEON)
+  if( HasCpuFeature( CPU_FEATURE_NEON ) )
+  {
+    return AverageBytesKernelNeon( scanline1, scanline2, output, count );
+  }
+#endif
+  return 0u;
 }
 
+/**
+ * @brief Implementation shared by the vectorised AverageScanlines1/2/3/RGBA8888 functions.
+ *
+ * All of the byte-per-component formats average each byte independently so
+ * they differ only in the number of bytes on a scanline.
+ */
+void AverageScanlineBytesVectorised( const uint8_t* scanline1, const uint8_t* scanline2, uint8_t* outputScanline, unsigned int count )
+{
+  for( unsigned int component = AverageBytesVectorised( scanline1, scanline2, outputScanline, count ); component < count; ++component )
+  {
+    outputScanline[component] = static_cast<uint8_t>( AverageComponent( scanline1[component], scanline2[component] ) );
+  }
 }
 
-void HalveScanlineInPlaceRGB888( unsigned char * const pixels, const unsigned int width )
+/**@}*/
+
+} // unnamed namespace
+
+void HalveScanlineInPlaceRGB888Vectorised( unsigned char * const pixels, const unsigned int width )
 {
   DebugAssertScanlineParameters( pixels, width );
 
-  const unsigned int lastPair = EvenDown( width - 2 );
+  const unsigned int outputWidth = width / 2u;
+  unsigned int outPixel = 0u;
 
-  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+#if defined(DALI_IMAGE_OPERATIONS_X86_SIMD)
+  if( HasCpuFeature( CPU_FEATURE_SSSE3 ) )
   {
-    // Load all the byte pixel components we need:
+    outPixel = HalveScanlineRGB888KernelSsse3( pixels, outputWidth );
+  }
+#elif defined(DALI_IMAGE_OPERATIONS_NEON)
+  if( HasCpuFeature( CPU_FEATURE_NEON ) )
+  {
+    outPixel = HalveScanlineRGB888KernelNeon( pixels, outputWidth );
+  }
+#endif
+
+  for( ; outPixel < outputWidth; ++outPixel )
+  {
+    const unsigned int pixel = outPixel * 2u;
     const unsigned int c11 = pixels[pixel * 3];
     const unsigned int c12 = pixels[pixel * 3 + 1];
     const unsigned int c13 = pixels[pixel * 3 + 2];
@@ -1267,149 +2503,183 @@ void HalveScanlineInPlaceRGB888( unsigned char * const pixels, const unsigned in
     const unsigned int c22 = pixels[pixel * 3 + 4];
     const unsigned int c23 = pixels[pixel * 3 + 5];
 
-    // Save the averaged byte pixel components:
     pixels[outPixel * 3]     = static_cast<unsigned char>( AverageComponent( c11, c21 ) );
     pixels[outPixel * 3 + 1] = static_cast<unsigned char>( AverageComponent( c12, c22 ) );
     pixels[outPixel * 3 + 2] = static_cast<unsigned char>( AverageComponent( c13, c23 ) );
   }
 }
 
-void HalveScanlineInPlaceRGBA8888( unsigned char * const pixels, const unsigned int width )
+void HalveScanlineInPlaceRGBA8888Vectorised( unsigned char * const pixels, const unsigned int width )
 {
   DebugAssertScanlineParameters( pixels, width );
   DALI_ASSERT_DEBUG( ((reinterpret_cast<ptrdiff_t>(pixels) & 3u) == 0u) && "Pointer should be 4-byte aligned for performance on some platforms." );
 
   uint32_t* const alignedPixels = reinterpret_cast<uint32_t*>(pixels);
+  const unsigned int outputWidth = width / 2u;
+  unsigned int outPixel = 0u;
 
-  const unsigned int lastPair = EvenDown( width - 2 );
+#if defined(DALI_IMAGE_OPERATIONS_X86_SIMD)
+  const unsigned int features = GetCpuFeatures();
+  if( features & CPU_FEATURE_AVX2 )
+  {
+    outPixel = HalveScanlineRGBA8888KernelAvx2( alignedPixels, outputWidth );
+  }
+  else if( features & CPU_FEATURE_SSE2 )
+  {
+    outPixel = HalveScanlineRGBA8888KernelSse2( alignedPixels, outputWidth );
+  }
+#elif defined(DALI_IMAGE_OPERATIONS_NEON)
+  if( HasCpuFeature( CPU_FEATURE_NEON ) )
+  {
+    outPixel = HalveScanlineRGBA8888KernelNeon( alignedPixels, outputWidth );
+  }
+#endif
 
-  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+  for( ; outPixel < outputWidth; ++outPixel )
   {
-    const uint32_t averaged = AveragePixelRGBA8888( alignedPixels[pixel], alignedPixels[pixel + 1] );
-    alignedPixels[outPixel] = averaged;
+    alignedPixels[outPixel] = AveragePixelRGBA8888( alignedPixels[outPixel * 2u], alignedPixels[outPixel * 2u + 1u] );
   }
 }
 
-void HalveScanlineInPlaceRGB565( unsigned char * pixels, unsigned int width )
+void HalveScanlineInPlaceRGB565Vectorised( unsigned char * pixels, unsigned int width )
 {
   DebugAssertScanlineParameters( pixels, width );
   DALI_ASSERT_DEBUG( ((reinterpret_cast<ptrdiff_t>(pixels) & 1u) == 0u) && "Pointer should be 2-byte aligned for performance on some platforms." );
 
   uint16_t* const alignedPixels = reinterpret_cast<uint16_t*>(pixels);
+  const unsigned int outputWidth = width / 2u;
+  unsigned int outPixel = 0u;
 
-  const unsigned int lastPair = EvenDown( width - 2 );
+#if defined(DALI_IMAGE_OPERATIONS_X86_SIMD)
+  const unsigned int features = GetCpuFeatures();
+  if( features & CPU_FEATURE_AVX2 )
+  {
+    outPixel = HalveScanlineRGB565KernelAvx2( alignedPixels, outputWidth );
+  }
+  else if( features & CPU_FEATURE_SSE2 )
+  {
+    outPixel = HalveScanlineRGB565KernelSse2( alignedPixels, outputWidth );
+  }
+#elif defined(DALI_IMAGE_OPERATIONS_NEON)
+  if( HasCpuFeature( CPU_FEATURE_NEON ) )
+  {
+    outPixel = HalveScanlineRGB565KernelNeon( alignedPixels, outputWidth );
+  }
+#endif
 
-  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+  for( ; outPixel < outputWidth; ++outPixel )
   {
-    const uint32_t averaged = AveragePixelRGB565( alignedPixels[pixel], alignedPixels[pixel + 1] );
-    alignedPixels[outPixel] = averaged;
+    alignedPixels[outPixel] = AveragePixelRGB565( alignedPixels[outPixel * 2u], alignedPixels[outPixel * 2u + 1u] );
   }
 }
 
-void HalveScanlineInPlace2Bytes( unsigned char * const pixels, const unsigned int width )
+void HalveScanlineInPlace2BytesVectorised( unsigned char * const pixels, const unsigned int width )
 {
   DebugAssertScanlineParameters( pixels, width );
 
-  const unsigned int lastPair = EvenDown( width - 2 );
+  const unsigned int outputWidth = width / 2u;
+  unsigned int outPixel = 0u;
 
-  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+#if defined(DALI_IMAGE_OPERATIONS_X86_SIMD)
+  const unsigned int features = GetCpuFeatures();
+  if( features & CPU_FEATURE_AVX2 )
   {
-    // Load all the byte pixel components we need:
+    outPixel = HalveScanline2BytesKernelAvx2( pixels, outputWidth );
+  }
+  else if( features & CPU_FEATURE_SSE2 )
+  {
+    outPixel = HalveScanline2BytesKernelSse2( pixels, outputWidth );
+  }
+#elif defined(DALI_IMAGE_OPERATIONS_NEON)
+  if( HasCpuFeature( CPU_FEATURE_NEON ) )
+  {
+    outPixel = HalveScanline2BytesKernelNeon( pixels, outputWidth );
+  }
+#endif
+
+  for( ; outPixel < outputWidth; ++outPixel )
+  {
+    const unsigned int pixel = outPixel * 2u;
     const unsigned int c11 = pixels[pixel * 2];
     const unsigned int c12 = pixels[pixel * 2 + 1];
     const unsigned int c21 = pixels[pixel * 2 + 2];
     const unsigned int c22 = pixels[pixel * 2 + 3];
 
-    // Save the averaged byte pixel components:
     pixels[outPixel * 2]     = static_cast<unsigned char>( AverageComponent( c11, c21 ) );
     pixels[outPixel * 2 + 1] = static_cast<unsigned char>( AverageComponent( c12, c22 ) );
   }
 }
 
-void HalveScanlineInPlace1Byte( unsigned char * const pixels, const unsigned int width )
+void HalveScanlineInPlace1ByteVectorised( unsigned char * const pixels, const unsigned int width )
 {
   DebugAssertScanlineParameters( pixels, width );
 
-  const unsigned int lastPair = EvenDown( width - 2 );
+  const unsigned int outputWidth = width / 2u;
+  unsigned int outPixel = 0u;
 
-  for( unsigned int pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel )
+#if defined(DALI_IMAGE_OPERATIONS_X86_SIMD)
+  const unsigned int features = GetCpuFeatures();
+  if( features & CPU_FEATURE_AVX2 )
   {
-    // Load all the byte pixel components we need:
-    const unsigned int c1 = pixels[pixel];
-    const unsigned int c2 = pixels[pixel + 1];
+    outPixel = HalveScanline1ByteKernelAvx2( pixels, outputWidth );
+  }
+  else if( features & CPU_FEATURE_SSE2 )
+  {
+    outPixel = HalveScanline1ByteKernelSse2( pixels, outputWidth );
+  }
+#elif defined(DALI_IMAGE_OPERATIONS_NEON)
+  if( HasCpuFeature( CPU_FEATURE_NEON ) )
+  {
+    outPixel = HalveScanline1ByteKernelNeon( pixels, outputWidth );
+  }
+#endif
 
-    // Save the averaged byte pixel component:
-    pixels[outPixel] = static_cast<unsigned char>( AverageComponent( c1, c2 ) );
+  for( ; outPixel < outputWidth; ++outPixel )
+  {
+    pixels[outPixel] = static_cast<unsigned char>( AverageComponent( pixels[outPixel * 2u], pixels[outPixel * 2u + 1u] ) );
   }
 }
 
-/**
- * @ToDo: Optimise for ARM using a 4 bytes at a time loop wrapped around the single ARMV6 instruction: UHADD8  R4, R0, R5. Note, this is not neon. It runs in the normal integer pipeline so there is no downside like a stall moving between integer and copro, or extra power for clocking-up the idle copro.
- * if (widthInComponents >= 7) { word32* aligned1 = scanline1 + 3 & 3; word32* aligned1_end = scanline1 + widthInPixels & 3; while(aligned1 < aligned1_end) { UHADD8  *aligned1++, *aligned2++, *alignedoutput++ } .. + 0 to 3 spare pixels at each end.
- */
-void AverageScanlines1( const unsigned char * const scanline1,
-                        const unsigned char * const __restrict__ scanline2,
-                        unsigned char* const outputScanline,
-                        const unsigned int width )
+void AverageScanlines1Vectorised( const unsigned char * const scanline1,
+                                  const unsigned char * const __restrict__ scanline2,
+                                  unsigned char* const outputScanline,
+                                  const unsigned int width )
 {
   DebugAssertDualScanlineParameters( scanline1, scanline2, outputScanline, width );
-
-  for( unsigned int component = 0; component < width; ++component )
-  {
-    outputScanline[component] = static_cast<unsigned char>( AverageComponent( scanline1[component], scanline2[component] ) );
-  }
+  AverageScanlineBytesVectorised( scanline1, scanline2, outputScanline, width );
 }
 
-void AverageScanlines2( const unsigned char * const scanline1,
-                        const unsigned char * const __restrict__ scanline2,
-                        unsigned char* const outputScanline,
-                        const unsigned int width )
+void AverageScanlines2Vectorised( const unsigned char * const scanline1,
+                                  const unsigned char * const __restrict__ scanline2,
+                                  unsigned char* const outputScanline,
+                                  const unsigned int width )
 {
   DebugAssertDualScanlineParameters( scanline1, scanline2, outputScanline, width * 2 );
-
-  for( unsigned int component = 0; component < width * 2; ++component )
-  {
-    outputScanline[component] = static_cast<unsigned char>( AverageComponent( scanline1[component], scanline2[component] ) );
-  }
+  AverageScanlineBytesVectorised( scanline1, scanline2, outputScanline, width * 2 );
 }
 
-void AverageScanlines3( const unsigned char * const scanline1,
-                        const unsigned char * const __restrict__ scanline2,
-                        unsigned char* const outputScanline,
-                        const unsigned int width )
+void AverageScanlines3Vectorised( const unsigned char * const scanline1,
+                                  const unsigned char * const __restrict__ scanline2,
+                                  unsigned char* const outputScanline,
+                                  const unsigned int width )
 {
   DebugAssertDualScanlineParameters( scanline1, scanline2, outputScanline, width * 3 );
-
-  for( unsigned int component = 0; component < width * 3; ++component )
-  {
-    outputScanline[component] = static_cast<unsigned char>( AverageComponent( scanline1[component], scanline2[component] ) );
-  }
+  AverageScanlineBytesVectorised( scanline1, scanline2, outputScanline, width * 3 );
 }
 
-void AverageScanlinesRGBA8888( const unsigned char * const scanline1,
-                               const unsigned char * const __restrict__ scanline2,
-                               unsigned char * const outputScanline,
-                               const unsigned int width )
+void AverageScanlinesRGBA8888Vectorised( const unsigned char * const scanline1,
+                                         const unsigned char * const __restrict__ scanline2,
+                                         unsigned char * const outputScanline,
+                                         const unsigned int width )
 {
   DebugAssertDualScanlineParameters( scanline1, scanline2, outputScanline, width * 4 );
-  DALI_ASSERT_DEBUG( ((reinterpret_cast<ptrdiff_t>(scanline1) & 3u) == 0u) && "Pointer should be 4-byte aligned for performance on some platforms." );
-  DALI_ASSERT_DEBUG( ((reinterpret_cast<ptrdiff_t>(scanline2) & 3u) == 0u) && "Pointer should be 4-byte aligned for performance on some platforms." );
-  DALI_ASSERT_DEBUG( ((reinterpret_cast<ptrdiff_t>(outputScanline) & 3u) == 0u) && "Pointer should be 4-byte aligned for performance on some platforms." );
-
-  const uint32_t* const alignedScanline1 = reinterpret_cast<const uint32_t*>(scanline1);
-  const uint32_t* const alignedScanline2 = reinterpret_cast<const uint32_t*>(scanline2);
-  uint32_t* const alignedOutput = reinterpret_cast<uint32_t*>(outputScanline);
-
-  for( unsigned int pixel = 0; pixel < width; ++pixel )
-  {
-    alignedOutput[pixel] = AveragePixelRGBA8888( alignedScanline1[pixel], alignedScanline2[pixel] );
-  }
+  AverageScanlineBytesVectorised( scanline1, scanline2, outputScanline, width * 4 );
 }
 
-void AverageScanlinesRGB565( const unsigned char * const scanline1,
-                             const unsigned char * const __restrict__ scanline2,
-                             unsigned char * const outputScanline,
-                             const unsigned int width )
+void AverageScanlinesRGB565Vectorised( const unsigned char * const scanline1,
+                                       const unsigned char * const __restrict__ scanline2,
+                                       unsigned char * const outputScanline,
+                                       const unsigned int width )
 {
   DebugAssertDualScanlineParameters( scanline1, scanline2, outputScanline, width * 2 );
   DALI_ASSERT_DEBUG( ((reinterpret_cast<ptrdiff_t>(scanline1) & 1u) == 0u) && "Pointer should be 2-byte aligned for performance on some platforms." );
@@ -1419,8 +2689,26 @@ void AverageScanlinesRGB565( const unsigned char * const scanline1,
   const uint16_t* const alignedScanline1 = reinterpret_cast<const uint16_t*>(scanline1);
   const uint16_t* const alignedScanline2 = reinterpret_cast<const uint16_t*>(scanline2);
   uint16_t* const alignedOutput = reinterpret_cast<uint16_t*>(outputScanline);
+  unsigned int pixel = 0u;
 
-  for( unsigned int pixel = 0; pixel < width; ++pixel )
+#if defined(DALI_IMAGE_OPERATIONS_X86_SIMD)
+  const unsigned int features = GetCpuFeatures();
+  if( features & CPU_FEATURE_AVX2 )
+  {
+    pixel = AverageRGB565KernelAvx2( alignedScanline1, alignedScanline2, alignedOutput, width );
+  }
+  else if( features & CPU_FEATURE_SSE2 )
+  {
+    pixel = AverageRGB565KernelSse2( alignedScanline1, alignedScanline2, alignedOutput, width );
+  }
+#elif defined(DALI_IMAGE_OPERATIONS_NEON)
+  if( HasCpuFeature( CPU_FEATURE_NEON ) )
+  {
+    pixel = AverageRGB565KernelNeon( alignedScanline1, alignedScanline2, alignedOutput, width );
+  }
+#endif
+
+  for( ; pixel < width; ++pixel )
   {
     alignedOutput[pixel] = AveragePixelRGB565( alignedScanline1[pixel], alignedScanline2[pixel] );
   }
@@ -1489,7 +2777,7 @@ void DownscaleInPlacePow2RGB888( unsigned char *pixels,
                                  unsigned& outWidth,
                                  unsigned& outHeight )
 {
-  DownscaleInPlacePow2Generic<3, HalveScanlineInPlaceRGB888, AverageScanlines3>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
+  DownscaleInPlacePow2Generic<3, HalveScanlineInPlaceRGB888Vectorised, AverageScanlines3Vectorised>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
 }
 
 void DownscaleInPlacePow2RGBA8888( unsigned char * pixels,
@@ -1502,7 +2790,7 @@ void DownscaleInPlacePow2RGBA8888( unsigned char * pixels,
                                    unsigned& outHeight )
 {
   DALI_ASSERT_DEBUG( ((reinterpret_cast<ptrdiff_t>(pixels) & 3u) == 0u) && "Pointer should be 4-byte aligned for performance on some platforms." );
-  DownscaleInPlacePow2Generic<4, HalveScanlineInPlaceRGBA8888, AverageScanlinesRGBA8888>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
+  DownscaleInPlacePow2Generic<4, HalveScanlineInPlaceRGBA8888Vectorised, AverageScanlinesRGBA8888Vectorised>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
 }
 
 void DownscaleInPlacePow2RGB565( unsigned char * pixels,
@@ -1514,7 +2802,7 @@ void DownscaleInPlacePow2RGB565( unsigned char * pixels,
                                  unsigned int& outWidth,
                                  unsigned int& outHeight )
 {
-  DownscaleInPlacePow2Generic<2, HalveScanlineInPlaceRGB565, AverageScanlinesRGB565>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
+  DownscaleInPlacePow2Generic<2, HalveScanlineInPlaceRGB565Vectorised, AverageScanlinesRGB565Vectorised>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
 }
 
 /**
@@ -1531,7 +2819,7 @@ void DownscaleInPlacePow2ComponentPair( unsigned char *pixels,
                                         unsigned& outWidth,
                                         unsigned& outHeight )
 {
-  DownscaleInPlacePow2Generic<2, HalveScanlineInPlace2Bytes, AverageScanlines2>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
+  DownscaleInPlacePow2Generic<2, HalveScanlineInPlace2BytesVectorised, AverageScanlines2Vectorised>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
 }
 
 void DownscaleInPlacePow2SingleBytePerPixel( unsigned char * pixels,
@@ -1543,12 +2831,186 @@ void DownscaleInPlacePow2SingleBytePerPixel( unsigned char * pixels,
                                              unsigned int& outWidth,
                                              unsigned int& outHeight )
 {
-  DownscaleInPlacePow2Generic<1, HalveScanlineInPlace1Byte, AverageScanlines1>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
+  DownscaleInPlacePow2Generic<1, HalveScanlineInPlace1ByteVectorised, AverageScanlines1Vectorised>( pixels, inputWidth, inputHeight, desiredWidth, desiredHeight, dimensionTest, outWidth, outHeight );
+}
+
+unsigned int CalculatePow2Downscale( Pixel::Format pixelFormat,
+                                     unsigned int inputWidth,
+                                     unsigned int inputHeight,
+                                     unsigned int desiredWidth,
+                                     unsigned int desiredHeight,
+                                     FittingMode::Type fittingMode,
+                                     SamplingMode::Type samplingMode,
+                                     unsigned int& outWidth,
+                                     unsigned int& outHeight )
+{
+  outWidth = inputWidth;
+  outHeight = inputHeight;
+
+  // Mirror the conditions of DownscaleInPlacePow2():
+  unsigned int halvings = 0u;
+  if( ( samplingMode == SamplingMode::BOX || samplingMode == SamplingMode::BOX_THEN_NEAREST || samplingMode == SamplingMode::BOX_THEN_LINEAR ) &&
+      ( pixelFormat == Pixel::RGBA8888 || pixelFormat == Pixel::RGB888 || pixelFormat == Pixel::RGB565 || pixelFormat == Pixel::LA88 || pixelFormat == Pixel::L8 || pixelFormat == Pixel::A8 ) )
+  {
+    const BoxDimensionTest dimensionTest = DimensionTestForScalingMode( fittingMode );
+    while( ContinueScaling( dimensionTest, outWidth, outHeight, desiredWidth, desiredHeight ) )
+    {
+      outWidth >>= 1u;
+      outHeight >>= 1u;
+      ++halvings;
+    }
+  }
+  return halvings;
+}
+
+Pow2ScanlineDownscaler::Pow2ScanlineDownscaler( Pixel::Format pixelFormat, unsigned int inputWidth, unsigned int inputHeight, unsigned int halvings, unsigned char* outputPixels )
+: mHalveScanline( HalveScanlineInPlace1ByteVectorised ),
+  mAverageScanlines( AverageScanlines1Vectorised ),
+  mBytesPerPixel( Pixel::GetBytesPerPixel( pixelFormat ) ),
+  mHalvings( halvings ),
+  mWidths( halvings + 1u ),
+  mScanlines( halvings ),
+  mScanlineWaiting( halvings, false ),
+  mOutputPixels( outputPixels ),
+  mOutputRow( 0u ),
+  mOutputHeight( inputHeight >> halvings )
+{
+  switch( pixelFormat )
+  {
+    case Pixel::RGBA8888:
+    {
+      mHalveScanline = HalveScanlineInPlaceRGBA8888Vectorised;
+      mAverageScanlines = AverageScanlinesRGBA8888Vectorised;
+      break;
+    }
+    case Pixel::RGB888:
+    {
+      mHalveScanline = HalveScanlineInPlaceRGB888Vectorised;
+      mAverageScanlines = AverageScanlines3Vectorised;
+      break;
+    }
+    case Pixel::RGB565:
+    {
+      mHalveScanline = HalveScanlineInPlaceRGB565Vectorised;
+      mAverageScanlines = AverageScanlinesRGB565Vectorised;
+      break;
+    }
+    case Pixel::LA88:
+    {
+      mHalveScanline = HalveScanlineInPlace2BytesVectorised;
+      mAverageScanlines = AverageScanlines2Vectorised;
+      break;
+    }
+    default:
+    {
+      DALI_ASSERT_DEBUG( ( pixelFormat == Pixel::L8 || pixelFormat == Pixel::A8 ) && "Unsupported pixel format." );
+      break;
+    }
+  }
+
+  mWidths[0] = inputWidth;
+  for( unsigned int halving = 0u; halving < halvings; ++halving )
+  {
+    mWidths[halving + 1u] = mWidths[halving] >> 1u;
+    mScanlines[halving].resize( mWidths[halving + 1u] * mBytesPerPixel );
+  }
+}
+
+void Pow2ScanlineDownscaler::PushScanline( unsigned char* scanline )
+{
+  PushScanline( 0u, scanline );
+}
+
+void Pow2ScanlineDownscaler::PushScanline( unsigned int halving, unsigned char* scanline )
+{
+  if( halving == mHalvings )
+  {
+    // Any spare scanline at the bottom is dropped, as DownscaleInPlacePow2() drops it:
+    if( mOutputRow < mOutputHeight )
+    {
+      const unsigned int outputStride = mWidths[halving] * mBytesPerPixel;
+      std::copy( scanline, scanline + outputStride, mOutputPixels + mOutputRow * outputStride );
+      ++mOutputRow;
+    }
+    return;
+  }
+
+  mHalveScanline( scanline, mWidths[halving] );
+
+  std::vector<unsigned char>& waitingScanline = mScanlines[halving];
+  if( !mScanlineWaiting[halving] )
+  {
+    std::copy( scanline, scanline + waitingScanline.size(), waitingScanline.begin() );
+    mScanlineWaiting[halving] = true;
+  }
+  else
+  {
+    // Average the pair into the first of them and pass it on to the next halving:
+    mAverageScanlines( waitingScanline.data(), scanline, waitingScanline.data(), mWidths[halving + 1u] );
+    mScanlineWaiting[halving] = false;
+    PushScanline( halving + 1u, waitingScanline.data() );
+  }
 }
 
 namespace
 {
 
+/**
+ * @brief Whether two pixel buffers are distinct, so that bands of one can be written while the other is read from anywhere.
+ */
+inline bool BuffersAreDisjoint( const uint8_t * inPixels, size_t inSize, const uint8_t * outPixels, size_t outSize )
+{
+  return outPixels >= inPixels + inSize || inPixels >= outPixels + outSize;
+}
+
+/**
+ * @brief Point sample a band of scanlines of an image to a new resolution.
+ *
+ * @param[in] firstOutY The first output scanline to produce.
+ * @param[in] endOutY One past the last output scanline to produce.
+ */
+template<typename PIXEL>
+inline void PointSampleAddressablePixelsBand( const uint8_t * inPixels,
+                                              unsigned int inputWidth,
+                                              unsigned int inputHeight,
+                                              uint8_t * outPixels,
+                                              unsigned int desiredWidth,
+                                              unsigned int desiredHeight,
+                                              unsigned int firstOutY,
+                                              unsigned int endOutY )
+{
+  const PIXEL* const inAligned = reinterpret_cast<const PIXEL*>(inPixels);
+  PIXEL* const       outAligned = reinterpret_cast<PIXEL*>(outPixels);
+  const unsigned int deltaX = (inputWidth  << 16u) / desiredWidth;
+  const unsigned int deltaY = (inputHeight << 16u) / desiredHeight;
+
+  // The same value stepping from the first scanline would reach, so bands match the serial output exactly:
+  unsigned int inY = firstOutY * deltaY;
+  for( unsigned int outY = firstOutY; outY < endOutY; ++outY )
+  {
+    // Round fixed point y coordinate to nearest integer:
+    const unsigned int integerY = (inY + (1u << 15u)) >> 16u;
+    const PIXEL* const inScanline = &inAligned[inputWidth * integerY];
+    PIXEL* const outScanline = &outAligned[desiredWidth * outY];
+
+    DALI_ASSERT_DEBUG( integerY < inputHeight );
+    DALI_ASSERT_DEBUG( reinterpret_cast<const uint8_t*>(inScanline) < ( inPixels + inputWidth * inputHeight * sizeof(PIXEL) ) );
+    DALI_ASSERT_DEBUG( reinterpret_cast<uint8_t*>(outScanline) < ( outPixels + desiredWidth * desiredHeight * sizeof(PIXEL) ) );
+
+    unsigned int inX = 0;
+    for( unsigned int outX = 0; outX < desiredWidth; ++outX )
+    {
+      // Round the fixed-point x coordinate to an integer:
+      const unsigned int integerX = (inX + (1u << 15u)) >> 16u;
+      const PIXEL* const inPixelAddress = &inScanline[integerX];
+      const PIXEL pixel = *inPixelAddress;
+      outScanline[outX] = pixel;
+      inX += deltaX;
+    }
+    inY += deltaY;
+  }
+}
+
 /**
  * @brief Point sample an image to a new resolution (like GL_NEAREST).
  *
@@ -1574,33 +3036,74 @@ inline void PointSampleAddressablePixels( const uint8_t * inPixels,
   {
     return;
   }
-  const PIXEL* const inAligned = reinterpret_cast<const PIXEL*>(inPixels);
-  PIXEL* const       outAligned = reinterpret_cast<PIXEL*>(outPixels);
+
+  // An in-place downscale relies on each scanline being read before it is overwritten so has to stay serial:
+  if( BuffersAreDisjoint( inPixels, inputWidth * inputHeight * sizeof(PIXEL), outPixels, desiredWidth * desiredHeight * sizeof(PIXEL) ) )
+  {
+    ResampleInBands( desiredWidth, desiredHeight, [&]( unsigned int firstOutY, unsigned int endOutY )
+    {
+      PointSampleAddressablePixelsBand<PIXEL>( inPixels, inputWidth, inputHeight, outPixels, desiredWidth, desiredHeight, firstOutY, endOutY );
+    } );
+  }
+  else
+  {
+    PointSampleAddressablePixelsBand<PIXEL>( inPixels, inputWidth, inputHeight, outPixels, desiredWidth, desiredHeight, 0u, desiredHeight );
+  }
+}
+
+/**
+ * @brief Point sample a band of scanlines of an RGB888 image.
+ *
+ * @param[in] firstOutY The first output scanline to produce.
+ * @param[in] endOutY One past the last output scanline to produce.
+ */
+void PointSample3BPPBand( const uint8_t * inPixels,
+                          unsigned int inputWidth,
+                          unsigned int inputHeight,
+                          uint8_t * outPixels,
+                          unsigned int desiredWidth,
+                          unsigned int desiredHeight,
+                          unsigned int firstOutY,
+                          unsigned int endOutY )
+{
+  const unsigned int BYTES_PER_PIXEL = 3;
+
+  // Generate fixed-point 16.16 deltas in input image coordinates:
   const unsigned int deltaX = (inputWidth  << 16u) / desiredWidth;
   const unsigned int deltaY = (inputHeight << 16u) / desiredHeight;
 
-  unsigned int inY = 0;
-  for( unsigned int outY = 0; outY < desiredHeight; ++outY )
+  // Step through output image in whole integer pixel steps while tracking the
+  // corresponding locations in the input image using 16.16 fixed-point
+  // coordinates:
+  unsigned int inY = firstOutY * deltaY; //< 16.16 fixed-point input image y-coord.
+  for( unsigned int outY = firstOutY; outY < endOutY; ++outY )
   {
-    // Round fixed point y coordinate to nearest integer:
     const unsigned int integerY = (inY + (1u << 15u)) >> 16u;
-    const PIXEL* const inScanline = &inAligned[inputWidth * integerY];
-    PIXEL* const outScanline = &outAligned[desiredWidth * outY];
-
-    DALI_ASSERT_DEBUG( integerY < inputHeight );
-    DALI_ASSERT_DEBUG( reinterpret_cast<const uint8_t*>(inScanline) < ( inPixels + inputWidth * inputHeight * sizeof(PIXEL) ) );
-    DALI_ASSERT_DEBUG( reinterpret_cast<uint8_t*>(outScanline) < ( outPixels + desiredWidth * desiredHeight * sizeof(PIXEL) ) );
+    const uint8_t* const inScanline = &inPixels[inputWidth * integerY * BYTES_PER_PIXEL];
+    uint8_t* const outScanline = &outPixels[desiredWidth * outY * BYTES_PER_PIXEL];
+    unsigned int inX = 0; //< 16.16 fixed-point input image x-coord.
 
-    unsigned int inX = 0;
-    for( unsigned int outX = 0; outX < desiredWidth; ++outX )
+    for( unsigned int outX = 0; outX < desiredWidth * BYTES_PER_PIXEL; outX += BYTES_PER_PIXEL )
     {
-      // Round the fixed-point x coordinate to an integer:
+      // Round the fixed-point input coordinate to the address of the input pixel to sample:
       const unsigned int integerX = (inX + (1u << 15u)) >> 16u;
-      const PIXEL* const inPixelAddress = &inScanline[integerX];
-      const PIXEL pixel = *inPixelAddress;
-      outScanline[outX] = pixel;
+      const uint8_t* const inPixelAddress = &inScanline[integerX * BYTES_PER_PIXEL];
+
+      // Issue loads for all pixel color components up-front:
+      const unsigned int c0 = inPixelAddress[0];
+      const unsigned int c1 = inPixelAddress[1];
+      const unsigned int c2 = inPixelAddress[2];
+      ///@ToDo: Optimise - Benchmark one 32bit load that will be unaligned 2/3 of the time + 3 rotate and masks, versus these three aligned byte loads, versus using an RGB packed, aligned(1) struct and letting compiler pick a strategy.
+
+      // Output the pixel components:
+      outScanline[outX]     = static_cast<uint8_t>( c0 );
+      outScanline[outX + 1] = static_cast<uint8_t>( c1 );
+      outScanline[outX + 2] = static_cast<uint8_t>( c2 );
+
+      // Increment the fixed-point input coordinate:
       inX += deltaX;
     }
+
     inY += deltaY;
   }
 }
@@ -1654,45 +3157,18 @@ void PointSample3BPP( const uint8_t * inPixels,
   {
     return;
   }
-  const unsigned int BYTES_PER_PIXEL = 3;
-
-  // Generate fixed-point 16.16 deltas in input image coordinates:
-  const unsigned int deltaX = (inputWidth  << 16u) / desiredWidth;
-  const unsigned int deltaY = (inputHeight << 16u) / desiredHeight;
 
-  // Step through output image in whole integer pixel steps while tracking the
-  // corresponding locations in the input image using 16.16 fixed-point
-  // coordinates:
-  unsigned int inY = 0; //< 16.16 fixed-point input image y-coord.
-  for( unsigned int outY = 0; outY < desiredHeight; ++outY )
+  const unsigned int BYTES_PER_PIXEL = 3;
+  if( BuffersAreDisjoint( inPixels, inputWidth * inputHeight * BYTES_PER_PIXEL, outPixels, desiredWidth * desiredHeight * BYTES_PER_PIXEL ) )
   {
-    const unsigned int integerY = (inY + (1u << 15u)) >> 16u;
-    const uint8_t* const inScanline = &inPixels[inputWidth * integerY * BYTES_PER_PIXEL];
-    uint8_t* const outScanline = &outPixels[desiredWidth * outY * BYTES_PER_PIXEL];
-    unsigned int inX = 0; //< 16.16 fixed-point input image x-coord.
-
-    for( unsigned int outX = 0; outX < desiredWidth * BYTES_PER_PIXEL; outX += BYTES_PER_PIXEL )
+    ResampleInBands( desiredWidth, desiredHeight, [&]( unsigned int firstOutY, unsigned int endOutY )
     {
-      // Round the fixed-point input coordinate to the address of the input pixel to sample:
-      const unsigned int integerX = (inX + (1u << 15u)) >> 16u;
-      const uint8_t* const inPixelAddress = &inScanline[integerX * BYTES_PER_PIXEL];
-
-      // Issue loads for all pixel color components up-front:
-      const unsigned int c0 = inPixelAddress[0];
-      const unsigned int c1 = inPixelAddress[1];
-      const unsigned int c2 = inPixelAddress[2];
-      ///@ToDo: Optimise - Benchmark one 32bit load that will be unaligned 2/3 of the time + 3 rotate and masks, versus these three aligned byte loads, versus using an RGB packed, aligned(1) struct and letting compiler pick a strategy.
-
-      // Output the pixel components:
-      outScanline[outX]     = static_cast<uint8_t>( c0 );
-      outScanline[outX + 1] = static_cast<uint8_t>( c1 );
-      outScanline[outX + 2] = static_cast<uint8_t>( c2 );
-
-      // Increment the fixed-point input coordinate:
-      inX += deltaX;
-    }
-
-    inY += deltaY;
+      PointSample3BPPBand( inPixels, inputWidth, inputHeight, outPixels, desiredWidth, desiredHeight, firstOutY, endOutY );
+    } );
+  }
+  else
+  {
+    PointSample3BPPBand( inPixels, inputWidth, inputHeight, outPixels, desiredWidth, desiredHeight, 0u, desiredHeight );
   }
 }
 
@@ -1786,45 +3262,35 @@ inline Pixel4Bytes BilinearFilter4Bytes( Pixel4Bytes tl, Pixel4Bytes tr, Pixel4B
 }
 
 /**
- * @brief Generic version of bilinear sampling image resize function.
- * @note Limited to one compilation unit and exposed through type-specific
- * wrapper functions below.
+ * @brief Bilinear sample a band of scanlines of an image to a new resolution.
+ *
+ * @param[in] firstOutY The first output scanline to produce.
+ * @param[in] endOutY One past the last output scanline to produce.
  */
 template<
   typename PIXEL,
-  PIXEL (*BilinearFilter) ( PIXEL tl, PIXEL tr, PIXEL bl, PIXEL br, unsigned int fractBlendHorizontal, unsigned int fractBlendVertical ),
-  bool DEBUG_ASSERT_ALIGNMENT
+  PIXEL (*BilinearFilter) ( PIXEL tl, PIXEL tr, PIXEL bl, PIXEL br, unsigned int fractBlendHorizontal, unsigned int fractBlendVertical )
 >
-inline void LinearSampleGeneric( const unsigned char * __restrict__ inPixels,
-                       ImageDimensions inputDimensions,
-                       unsigned char * __restrict__ outPixels,
-                       ImageDimensions desiredDimensions )
+inline void LinearSampleBand( const unsigned char * __restrict__ inPixels,
+                              ImageDimensions inputDimensions,
+                              unsigned char * __restrict__ outPixels,
+                              ImageDimensions desiredDimensions,
+                              unsigned int firstOutY,
+                              unsigned int endOutY )
 {
   const unsigned int inputWidth = inputDimensions.GetWidth();
   const unsigned int inputHeight = inputDimensions.GetHeight();
   const unsigned int desiredWidth = desiredDimensions.GetWidth();
   const unsigned int desiredHeight = desiredDimensions.GetHeight();
 
-  DALI_ASSERT_DEBUG( ((outPixels >= inPixels + inputWidth   * inputHeight   * sizeof(PIXEL)) ||
-                      (inPixels >= outPixels + desiredWidth * desiredHeight * sizeof(PIXEL))) &&
-                     "Input and output buffers cannot overlap.");
-  if( DEBUG_ASSERT_ALIGNMENT )
-  {
-    DALI_ASSERT_DEBUG( reinterpret_cast< uint64_t >( inPixels )  % sizeof(PIXEL) == 0 && "Pixel pointers need to be aligned to the size of the pixels (E.g., 4 bytes for RGBA, 2 bytes for RGB565, ...)." );
-    DALI_ASSERT_DEBUG( reinterpret_cast< uint64_t >( outPixels) % sizeof(PIXEL) == 0 && "Pixel pointers need to be aligned to the size of the pixels (E.g., 4 bytes for RGBA, 2 bytes for RGB565, ...)." );
-  }
-
-  if( inputWidth < 1u || inputHeight < 1u || desiredWidth < 1u || desiredHeight < 1u )
-  {
-    return;
-  }
   const PIXEL* const inAligned = reinterpret_cast<const PIXEL*>(inPixels);
   PIXEL* const       outAligned = reinterpret_cast<PIXEL*>(outPixels);
   const unsigned int deltaX = (inputWidth  << 16u) / desiredWidth;
   const unsigned int deltaY = (inputHeight << 16u) / desiredHeight;
 
-  unsigned int inY = 0;
-  for( unsigned int outY = 0; outY < desiredHeight; ++outY )
+  // The same value stepping from the first scanline would reach, so bands match the serial output exactly:
+  unsigned int inY = firstOutY * deltaY;
+  for( unsigned int outY = firstOutY; outY < endOutY; ++outY )
   {
     PIXEL* const outScanline = &outAligned[desiredWidth * outY];
 
@@ -1863,6 +3329,46 @@ inline void LinearSampleGeneric( const unsigned char * __restrict__ inPixels,
   }
 }
 
+/**
+ * @brief Generic version of bilinear sampling image resize function.
+ * @note Limited to one compilation unit and exposed through type-specific
+ * wrapper functions below.
+ */
+template<
+  typename PIXEL,
+  PIXEL (*BilinearFilter) ( PIXEL tl, PIXEL tr, PIXEL bl, PIXEL br, unsigned int fractBlendHorizontal, unsigned int fractBlendVertical ),
+  bool DEBUG_ASSERT_ALIGNMENT
+>
+inline void LinearSampleGeneric( const unsigned char * __restrict__ inPixels,
+                       ImageDimensions inputDimensions,
+                       unsigned char * __restrict__ outPixels,
+                       ImageDimensions desiredDimensions )
+{
+  const unsigned int inputWidth = inputDimensions.GetWidth();
+  const unsigned int inputHeight = inputDimensions.GetHeight();
+  const unsigned int desiredWidth = desiredDimensions.GetWidth();
+  const unsigned int desiredHeight = desiredDimensions.GetHeight();
+
+  DALI_ASSERT_DEBUG( ((outPixels >= inPixels + inputWidth   * inputHeight   * sizeof(PIXEL)) ||
+                      (inPixels >= outPixels + desiredWidth * desiredHeight * sizeof(PIXEL))) &&
+                     "Input and output buffers cannot overlap.");
+  if( DEBUG_ASSERT_ALIGNMENT )
+  {
+    DALI_ASSERT_DEBUG( reinterpret_cast< uint64_t >( inPixels )  % sizeof(PIXEL) == 0 && "Pixel pointers need to be aligned to the size of the pixels (E.g., 4 bytes for RGBA, 2 bytes for RGB565, ...)." );
+    DALI_ASSERT_DEBUG( reinterpret_cast< uint64_t >( outPixels) % sizeof(PIXEL) == 0 && "Pixel pointers need to be aligned to the size of the pixels (E.g., 4 bytes for RGBA, 2 bytes for RGB565, ...)." );
+  }
+
+  if( inputWidth < 1u || inputHeight < 1u || desiredWidth < 1u || desiredHeight < 1u )
+  {
+    return;
+  }
+
+  ResampleInBands( desiredWidth, desiredHeight, [&]( unsigned int firstOutY, unsigned int endOutY )
+  {
+    LinearSampleBand<PIXEL, BilinearFilter>( inPixels, inputDimensions, outPixels, desiredDimensions, firstOutY, endOutY );
+  } );
+}
+
 }
 
 // Format-specific linear scaling instantiations:
@@ -1908,27 +3414,20 @@ void LinearSample4BPP( const unsigned char * __restrict__ inPixels,
 }
 
 
-void Resample( const unsigned char * __restrict__ inPixels,
-               ImageDimensions inputDimensions,
-               unsigned char * __restrict__ outPixels,
-               ImageDimensions desiredDimensions,
-               Resampler::Filter filterType,
-               int numChannels, bool hasAlpha )
+namespace
 {
-  // Got from the test.cpp of the ImageResampler lib.
-  const float ONE_DIV_255 = 1.0f / 255.0f;
-  const int MAX_UNSIGNED_CHAR = std::numeric_limits<uint8_t>::max();
-  const int LINEAR_TO_SRGB_TABLE_SIZE = 4096;
-  const int ALPHA_CHANNEL = hasAlpha ? (numChannels-1) : 0;
 
-  static bool loadColorSpaces = true;
-  static float srgbToLinear[MAX_UNSIGNED_CHAR + 1];
-  static unsigned char linearToSrgb[LINEAR_TO_SRGB_TABLE_SIZE];
+const float ONE_DIV_255 = 1.0f / 255.0f;
+const int MAX_UNSIGNED_CHAR = std::numeric_limits<uint8_t>::max();
+const int LINEAR_TO_SRGB_TABLE_SIZE = 4096;
 
-  if( loadColorSpaces ) // Only create the color space conversions on the first execution
+/**
+ * @brief Lookup tables between 8 bit gamma encoded and linear color components, used by Resample().
+ */
+struct ColorSpaceTables
+{
+  ColorSpaceTables()
   {
-    loadColorSpaces = false;
-
     for( int i = 0; i <= MAX_UNSIGNED_CHAR; ++i )
     {
       srgbToLinear[i] = pow( static_cast<float>( i ) * ONE_DIV_255, DEFAULT_SOURCE_GAMMA );
@@ -1952,131 +3451,367 @@ void Resample( const unsigned char * __restrict__ inPixels,
     }
   }
 
+  float srgbToLinear[MAX_UNSIGNED_CHAR + 1];
+  unsigned char linearToSrgb[LINEAR_TO_SRGB_TABLE_SIZE];
+};
+
+/**
+ * @brief Get the color space tables, building them on first use.
+ *
+ * Initialisation of the function-local static is thread-safe, so the
+ * resampling threads can't see partially built tables.
+ */
+const ColorSpaceTables& GetColorSpaceTables()
+{
+  static const ColorSpaceTables tables;
+  return tables;
+}
+
+/**
+ * @brief Resample one color channel of an image.
+ *
+ * The channels of an image are resampled independently so they can run on different threads.
+ * @param[in] resampler The resampler for this channel.
+ * @param[in] channel The index of the channel within a pixel.
+ * @param[in] isAlphaChannel Whether the channel holds linear alpha rather than a gamma encoded color.
+ */
+void ResampleChannel( const unsigned char * __restrict__ inPixels,
+                      ImageDimensions inputDimensions,
+                      unsigned char * __restrict__ outPixels,
+                      ImageDimensions desiredDimensions,
+                      int numChannels,
+                      Resampler& resampler,
+                      int channel,
+                      bool isAlphaChannel )
+{
+  const ColorSpaceTables& tables = GetColorSpaceTables();
+
+  const int srcWidth = inputDimensions.GetWidth();
+  const int srcHeight = inputDimensions.GetHeight();
+  const int dstWidth = desiredDimensions.GetWidth();
+  const int dstHeight = desiredDimensions.GetHeight();
+  const int srcPitch = srcWidth * numChannels;
+  const int dstPitch = dstWidth * numChannels;
+
+  // Each thread keeps its scanline of samples between calls rather than allocating one per channel per image:
+  static thread_local std::vector<float> samples;
+  samples.resize( srcWidth );
+  int dstY = 0;
+
+  for( int srcY = 0; srcY < srcHeight; ++srcY )
+  {
+    const unsigned char* pSrc = &inPixels[srcY * srcPitch + channel];
+
+    for( int x = 0; x < srcWidth; ++x )
+    {
+      if( isAlphaChannel )
+      {
+        samples[x] = *pSrc * ONE_DIV_255;
+      }
+      else
+      {
+        samples[x] = tables.srgbToLinear[*pSrc];
+      }
+      pSrc += numChannels;
+    }
+
+    if( !resampler.put_line( &samples[0] ) )
+    {
+      DALI_ASSERT_DEBUG( !"Out of memory" );
+    }
+
+    for( const float* pOutputSamples = resampler.get_line(); pOutputSamples; pOutputSamples = resampler.get_line() )
+    {
+      DALI_ASSERT_DEBUG( dstY < dstHeight );
+      unsigned char* pDst = &outPixels[dstY * dstPitch + channel];
+
+      for( int x = 0; x < dstWidth; ++x )
+      {
+        if( isAlphaChannel )
+        {
+          int c = static_cast<int>( 255.0f * pOutputSamples[x] + 0.5f );
+          if( c < 0 )
+          {
+            c = 0;
+          }
+          else if( c > MAX_UNSIGNED_CHAR )
+          {
+            c = MAX_UNSIGNED_CHAR;
+          }
+          *pDst = static_cast<unsigned char>( c );
+        }
+        else
+        {
+          int j = static_cast<int>( LINEAR_TO_SRGB_TABLE_SIZE * pOutputSamples[x] + 0.5f );
+          if( j < 0 )
+          {
+            j = 0;
+          }
+          else if( j >= LINEAR_TO_SRGB_TABLE_SIZE )
+          {
+            j = LINEAR_TO_SRGB_TABLE_SIZE - 1;
+          }
+          *pDst = tables.linearToSrgb[j];
+        }
+
+        pDst += numChannels;
+      }
+
+      ++dstY;
+    }
+  }
+}
+
+/**
+ * @brief The filter contributor list for one axis of a resampling, owned by the cache and the resamplers using it.
+ */
+class ContributorList
+{
+public:
+
+  /**
+   * @brief Build the list.
+   * @param[in] srcSize The size of the source image along the axis.
+   * @param[in] dstSize The size of the destination image along the axis.
+   * @param[in] filterType The resampling filter.
+   */
+  ContributorList( int srcSize, int dstSize, Resampler::Filter filterType )
+  : mList( Resampler::create_clist( srcSize, dstSize, Resampler::BOUNDARY_CLAMP, filterType, FILTER_SCALE ) ),
+    mMemoryUsage( 0u )
+  {
+    if( mList )
+    {
+      mMemoryUsage = dstSize * sizeof( Resampler::Contrib_List );
+      for( int i = 0; i < dstSize; ++i )
+      {
+        mMemoryUsage += mList[i].n * sizeof( Resampler::Contrib );
+      }
+    }
+  }
+
+  ~ContributorList()
+  {
+    Resampler::free_clist( mList );
+  }
+
+  /**
+   * @brief The list, or NULL if it couldn't be built.
+   */
+  Resampler::Contrib_List* Get() const
+  {
+    return mList;
+  }
+
+  /**
+   * @brief The number of bytes of heap the list takes up.
+   */
+  std::size_t GetMemoryUsage() const
+  {
+    return mMemoryUsage;
+  }
+
+private:
+
+  // Undefined
+  ContributorList( const ContributorList& );
+  ContributorList& operator=( const ContributorList& );
+
+private:
+
+  Resampler::Contrib_List* mList;
+  std::size_t mMemoryUsage;
+};
+
+typedef std::shared_ptr< ContributorList > ContributorListPtr;
+
+/**
+ * @brief A least recently used cache of contributor lists, bounded by the memory they take up.
+ *
+ * Thumbnails are made from the same few camera resolutions to the same few
+ * sizes over and over, so the lists for each axis are kept rather than
+ * rebuilt for every image. Lists are shared, so one evicted while a
+ * resampling is using it stays alive until that resampling finishes.
+ */
+class ContributorListCache
+{
+public:
+
+  ContributorListCache()
+  : mEntries(),
+    mMemoryUsage( 0u ),
+    mMemoryLimit( DEFAULT_RESAMPLE_CACHE_MEMORY_LIMIT ),
+    mMutex()
+  {
+  }
+
+  /**
+   * @brief Get the list for an axis, building it if it isn't cached.
+   * @param[in] srcSize The size of the source image along the axis.
+   * @param[in] dstSize The size of the destination image along the axis.
+   * @param[in] filterType The resampling filter.
+   * @return The list, which may hold NULL if it couldn't be built.
+   */
+  ContributorListPtr Get( int srcSize, int dstSize, Resampler::Filter filterType )
+  {
+    {
+      std::lock_guard< std::mutex > lock( mMutex );
+      for( auto iter = mEntries.begin(); iter != mEntries.end(); ++iter )
+      {
+        if( iter->srcSize == srcSize && iter->dstSize == dstSize && iter->filterType == filterType )
+        {
+          // Move it to the front as the most recently used:
+          mEntries.splice( mEntries.begin(), mEntries, iter );
+          return mEntries.front().list;
+        }
+      }
+    }
+
+    // Build outside the lock so other threads' cache hits aren't held up:
+    ContributorListPtr list( new ContributorList( srcSize, dstSize, filterType ) );
+    if( list->Get() )
+    {
+      std::lock_guard< std::mutex > lock( mMutex );
+      if( list->GetMemoryUsage() <= mMemoryLimit )
+      {
+        Entry entry = { srcSize, dstSize, filterType, list };
+        mEntries.push_front( entry );
+        mMemoryUsage += list->GetMemoryUsage();
+        Trim();
+      }
+    }
+    return list;
+  }
+
+  /**
+   * @brief Change the memory limit, evicting lists until the cache is within it.
+   */
+  void SetMemoryLimit( std::size_t memoryLimit )
+  {
+    std::lock_guard< std::mutex > lock( mMutex );
+    mMemoryLimit = memoryLimit;
+    Trim();
+  }
+
+  /**
+   * @brief The number of bytes taken up by the cached lists.
+   */
+  std::size_t GetMemoryUsage()
+  {
+    std::lock_guard< std::mutex > lock( mMutex );
+    return mMemoryUsage;
+  }
+
+private:
+
+  /**
+   * @brief Evict the least recently used lists until the cache is within its limit. The mutex must be held.
+   */
+  void Trim()
+  {
+    while( mMemoryUsage > mMemoryLimit && !mEntries.empty() )
+    {
+      mMemoryUsage -= mEntries.back().list->GetMemoryUsage();
+      mEntries.pop_back();
+    }
+  }
+
+  struct Entry
+  {
+    int srcSize;
+    int dstSize;
+    Resampler::Filter filterType;
+    ContributorListPtr list;
+  };
+
+  std::list< Entry > mEntries;     ///< The cached lists, most recently used first. There are only ever a few.
+  std::size_t        mMemoryUsage; ///< The total memory usage of the cached lists.
+  std::size_t        mMemoryLimit; ///< The most memory the cached lists may use.
+  std::mutex         mMutex;       ///< Protects the cache, which is used from the image loading and worker threads.
+};
+
+/**
+ * @brief Get the process-wide contributor list cache.
+ */
+ContributorListCache& GetContributorListCache()
+{
+  static ContributorListCache cache;
+  return cache;
+}
+
+} // unnamed namespace
+
+void SetResampleCacheMemoryLimit( std::size_t memoryLimit )
+{
+  GetContributorListCache().SetMemoryLimit( memoryLimit );
+}
+
+std::size_t GetResampleCacheMemoryUsage()
+{
+  return GetContributorListCache().GetMemoryUsage();
+}
+
+void Resample( const unsigned char * __restrict__ inPixels,
+               ImageDimensions inputDimensions,
+               unsigned char * __restrict__ outPixels,
+               ImageDimensions desiredDimensions,
+               Resampler::Filter filterType,
+               int numChannels, bool hasAlpha )
+{
+  // Got from the test.cpp of the ImageResampler lib.
+  const int ALPHA_CHANNEL = hasAlpha ? (numChannels-1) : 0;
+
   std::vector<Resampler*> resamplers( numChannels );
-  std::vector<Vector<float>> samples(numChannels);
 
   const int srcWidth = inputDimensions.GetWidth();
   const int srcHeight = inputDimensions.GetHeight();
   const int dstWidth = desiredDimensions.GetWidth();
   const int dstHeight = desiredDimensions.GetHeight();
 
-  // Now create a Resampler instance for each component to process. The first instance will create new contributor tables, which are shared by the resamplers
-  // used for the other components (a memory and slight cache efficiency optimization).
-  resamplers[0] = new Resampler( srcWidth,
-                                 srcHeight,
-                                 dstWidth,
-                                 dstHeight,
-                                 Resampler::BOUNDARY_CLAMP,
-                                 0.0f,           // sample_low,
-                                 1.0f,           // sample_high. Clamp output samples to specified range, or disable clamping if sample_low >= sample_high.
-                                 filterType,    // The type of filter.
-                                 NULL,           // Pclist_x,
-                                 NULL,           // Pclist_y. Optional pointers to contributor lists from another instance of a Resampler.
-                                 FILTER_SCALE,   // src_x_ofs,
-                                 FILTER_SCALE ); // src_y_ofs. Offset input image by specified amount (fractional values okay).
-  samples[0].Resize( srcWidth );
-  for( int i = 1; i < numChannels; ++i )
+  // The contributor tables are shared by the resamplers for all the components, and by calls with the same sizes:
+  ContributorListCache& cache = GetContributorListCache();
+  const ContributorListPtr contributorsX = cache.Get( srcWidth, dstWidth, filterType );
+  const ContributorListPtr contributorsY = cache.Get( srcHeight, dstHeight, filterType );
+  if( !contributorsX->Get() || !contributorsY->Get() )
+  {
+    DALI_LOG_ERROR( "Unable to build the resampling filter contributors\n" );
+    return;
+  }
+
+  // Now create a Resampler instance for each component to process.
+  for( int i = 0; i < numChannels; ++i )
   {
     resamplers[i] = new Resampler( srcWidth,
                                    srcHeight,
                                    dstWidth,
                                    dstHeight,
                                    Resampler::BOUNDARY_CLAMP,
-                                   0.0f,
-                                   1.0f,
-                                   filterType,
-                                   resamplers[0]->get_clist_x(),
-                                   resamplers[0]->get_clist_y(),
-                                   FILTER_SCALE,
-                                   FILTER_SCALE );
-    samples[i].Resize( srcWidth );
+                                   0.0f,           // sample_low,
+                                   1.0f,           // sample_high. Clamp output samples to specified range, or disable clamping if sample_low >= sample_high.
+                                   filterType,     // The type of filter.
+                                   contributorsX->Get(), // Pclist_x,
+                                   contributorsY->Get(), // Pclist_y. Optional pointers to contributor lists shared between Resamplers.
+                                   FILTER_SCALE,   // filter_x_scale,
+                                   FILTER_SCALE ); // filter_y_scale.
   }
 
-  const int srcPitch = srcWidth * numChannels;
-  const int dstPitch = dstWidth * numChannels;
-  int dstY = 0;
-
-  for( int srcY = 0; srcY < srcHeight; ++srcY )
+  // The shared contributor tables are only read once built, so each channel can be resampled on its own thread:
+  const auto resampleChannels = [&]( unsigned int firstChannel, unsigned int endChannel )
   {
-    const unsigned char* pSrc = &inPixels[srcY * srcPitch];
-
-    for( int x = 0; x < srcWidth; ++x )
-    {
-      for( int c = 0; c < numChannels; ++c )
-      {
-        if( c == ALPHA_CHANNEL && hasAlpha )
-        {
-          samples[c][x] = *pSrc++ * ONE_DIV_255;
-        }
-        else
-        {
-          samples[c][x] = srgbToLinear[*pSrc++];
-        }
-      }
-    }
-
-    for( int c = 0; c < numChannels; ++c )
+    for( unsigned int c = firstChannel; c < endChannel; ++c )
     {
-      if( !resamplers[c]->put_line( &samples[c][0] ) )
-      {
-        DALI_ASSERT_DEBUG( !"Out of memory" );
-      }
+      const bool isAlphaChannel = ( static_cast<int>( c ) == ALPHA_CHANNEL && hasAlpha );
+      ResampleChannel( inPixels, inputDimensions, outPixels, desiredDimensions, numChannels, *resamplers[c], static_cast<int>( c ), isAlphaChannel );
     }
+  };
 
-    for(;;)
-    {
-      int compIndex;
-      for( compIndex = 0; compIndex < numChannels; ++compIndex )
-      {
-        const float* pOutputSamples = resamplers[compIndex]->get_line();
-        if( !pOutputSamples )
-        {
-          break;
-        }
-
-        const bool isAlphaChannel = ( compIndex == ALPHA_CHANNEL && hasAlpha );
-        DALI_ASSERT_DEBUG( dstY < dstHeight );
-        unsigned char* pDst = &outPixels[dstY * dstPitch + compIndex];
-
-        for( int x = 0; x < dstWidth; ++x )
-        {
-          if( isAlphaChannel )
-          {
-            int c = static_cast<int>( 255.0f * pOutputSamples[x] + 0.5f );
-            if( c < 0 )
-            {
-              c = 0;
-            }
-            else if( c > MAX_UNSIGNED_CHAR )
-            {
-              c = MAX_UNSIGNED_CHAR;
-            }
-            *pDst = static_cast<unsigned char>( c );
-          }
-          else
-          {
-            int j = static_cast<int>( LINEAR_TO_SRGB_TABLE_SIZE * pOutputSamples[x] + 0.5f );
-            if( j < 0 )
-            {
-              j = 0;
-            }
-            else if( j >= LINEAR_TO_SRGB_TABLE_SIZE )
-            {
-              j = LINEAR_TO_SRGB_TABLE_SIZE - 1;
-            }
-            *pDst = linearToSrgb[j];
-          }
-
-          pDst += numChannels;
-        }
-      }
-      if( compIndex < numChannels )
-      {
-        break;
-      }
-
-      ++dstY;
-    }
+  const unsigned int numParts = GetNumResamplingParts( dstWidth, dstHeight, static_cast<unsigned int>( numChannels ) );
+  if( numParts > 1u )
+  {
+    WorkerPool::Get().ParallelFor( static_cast<unsigned int>( numChannels ), numParts, resampleChannels );
+  }
+  else
+  {
+    resampleChannels( 0u, static_cast<unsigned int>( numChannels ) );
   }
 
   // Delete the resamplers.
@@ -2144,124 +3879,241 @@ void LinearSample( const unsigned char * __restrict__ inPixels,
   }
 }
 
-void RotateByShear( const uint8_t* const pixelsIn,
-                    unsigned int widthIn,
-                    unsigned int heightIn,
-                    unsigned int pixelSize,
-                    float radians,
-                    uint8_t*& pixelsOut,
-                    unsigned int& widthOut,
-                    unsigned int& heightOut )
+bool TransformPixels( const uint8_t* const pixelsIn,
+                      unsigned int widthIn,
+                      unsigned int heightIn,
+                      unsigned int pixelSize,
+                      PixelTransform transform,
+                      uint8_t* const pixelsOut )
 {
-  // @note Code got from https://www.codeproject.com/Articles/202/High-quality-image-rotation-rotate-by-shear by Eran Yariv.
-
-  // Do first the fast rotations to transform the angle into a (-45..45] range.
-
-  float fastRotationPerformed = false;
-  if( ( radians > Math::PI_4 ) && ( radians <= RAD_135 ) )
+  if( pixelSize == 0u )
   {
-    // Angle in (45.0 .. 135.0]
-    // Rotate image by 90 degrees into temporary image,
-    // so it requires only an extra rotation angle
-    // of -45.0 .. +45.0 to complete rotation.
-    fastRotationPerformed = Rotate90( pixelsIn,
-                                      widthIn,
-                                      heightIn,
-                                      pixelSize,
-                                      pixelsOut,
-                                      widthOut,
-                                      heightOut );
+    DALI_LOG_ERROR( "Can't transform pixels of no size.\n" );
+    return false;
+  }
 
-    if( !fastRotationPerformed )
+  switch( transform )
+  {
+    case PixelTransformRotate90:
+    {
+      TransposePixels( pixelsIn, widthIn, heightIn, pixelSize, true, false, pixelsOut );
+      break;
+    }
+    case PixelTransformRotate180:
+    {
+      Rotate180Pixels( pixelsIn, widthIn, heightIn, pixelSize, pixelsOut );
+      break;
+    }
+    case PixelTransformRotate270:
+    {
+      TransposePixels( pixelsIn, widthIn, heightIn, pixelSize, false, true, pixelsOut );
+      break;
+    }
+    case PixelTransformTranspose:
+    {
+      TransposePixels( pixelsIn, widthIn, heightIn, pixelSize, false, false, pixelsOut );
+      break;
+    }
+    case PixelTransformTransverse:
     {
-      DALI_LOG_INFO(gImageOpsLogFilter, Dali::Integration::Log::Verbose, "fast rotation failed\n");
-      // The fast rotation failed.
-      return;
+      TransposePixels( pixelsIn, widthIn, heightIn, pixelSize, true, true, pixelsOut );
+      break;
     }
+  }
 
-    radians -= Math::PI_2;
+  return true;
+}
+
+bool TransformPixelsInPlace( uint8_t* const pixels,
+                             unsigned int width,
+                             unsigned int height,
+                             unsigned int pixelSize,
+                             PixelTransform transform )
+{
+  if( pixelSize == 0u )
+  {
+    DALI_LOG_ERROR( "Can't transform pixels of no size.\n" );
+    return false;
   }
-  else if( ( radians > RAD_135 ) && ( radians <= RAD_225 ) )
+
+  if( transform == PixelTransformRotate180 )
   {
-    // Angle in (135.0 .. 225.0]
-    // Rotate image by 180 degrees into temporary image,
-    // so it requires only an extra rotation angle
-    // of -45.0 .. +45.0 to complete rotation.
+    Rotate180PixelsInPlace( pixels, width, height, pixelSize );
+    return true;
+  }
+
+  if( width != height )
+  {
+    // Without a second buffer the scanlines of the output would overlap the input ones still to be read.
+    return false;
+  }
 
-    fastRotationPerformed = Rotate180( pixelsIn,
-                                       widthIn,
-                                       heightIn,
-                                       pixelSize,
-                                       pixelsOut );
+  // The other transforms are all a transpose followed by a flip:
+  TransposePixelsInPlace( pixels, width, pixelSize );
 
-    if( !fastRotationPerformed )
+  const unsigned int stride = width * pixelSize;
+  switch( transform )
+  {
+    case PixelTransformRotate90:
+    {
+      // Flip vertically.
+      for( unsigned int y = 0u; y < height / 2u; ++y )
+      {
+        std::swap_ranges( pixels + y * stride, pixels + ( y + 1u ) * stride, pixels + ( height - 1u - y ) * stride );
+      }
+      break;
+    }
+    case PixelTransformRotate270:
+    {
+      // Flip horizontally.
+      const ReversePixelsFunction kernel = GetReversePixelsKernel( pixelSize );
+      std::vector<uint8_t> scanline( stride );
+      for( unsigned int y = 0u; y < height; ++y )
+      {
+        memcpy( &scanline[0], pixels + y * stride, stride );
+        ReverseScanline( &scanline[0], pixels + y * stride, width, pixelSize, kernel );
+      }
+      break;
+    }
+    case PixelTransformTransverse:
+    {
+      Rotate180PixelsInPlace( pixels, width, height, pixelSize );
+      break;
+    }
+    case PixelTransformTranspose:
+    case PixelTransformRotate180:
     {
-      DALI_LOG_INFO(gImageOpsLogFilter, Dali::Integration::Log::Verbose, "fast rotation failed\n");
-      // The fast rotation failed.
-      return;
+      break;
     }
+  }
+
+  return true;
+}
+
+namespace
+{
+
+/**
+ * @brief Rotates by shear, keeping the intermediate images in a scratch buffer.
+ *
+ * Shared by both overloads of RotateByShear().
+ * @tparam ScratchBuffer A Dali::Vector<uint8_t>, or a PooledBuffer.
+ */
+template< typename ScratchBuffer >
+void RotateByShearWithScratch( const uint8_t* const pixelsIn,
+                               unsigned int widthIn,
+                               unsigned int heightIn,
+                               unsigned int pixelSize,
+                               float radians,
+                               uint8_t*& pixelsOut,
+                               unsigned int& widthOut,
+                               unsigned int& heightOut,
+                               ScratchBuffer& scratch )
+{
+  // @note Code got from https://www.codeproject.com/Articles/202/High-quality-image-rotation-rotate-by-shear by Eran Yariv.
+
+  // Do first the fast rotations to transform the angle into a (-45..45] range.
 
+  bool fastRotationPerformed = false;
+  PixelTransform fastRotation = PixelTransformRotate180;
+  if( ( radians > Math::PI_4 ) && ( radians <= RAD_135 ) )
+  {
+    // Angle in (45.0 .. 135.0]
+    // Rotate image by 90 degrees, so it requires only an extra
+    // rotation angle of -45.0 .. +45.0 to complete rotation.
+    fastRotationPerformed = true;
+    fastRotation = PixelTransformRotate90;
+    radians -= Math::PI_2;
+  }
+  else if( ( radians > RAD_135 ) && ( radians <= RAD_225 ) )
+  {
+    // Angle in (135.0 .. 225.0]
+    fastRotationPerformed = true;
+    fastRotation = PixelTransformRotate180;
     radians -= Math::PI;
-    widthOut = widthIn;
-    heightOut = heightIn;
   }
   else if( ( radians > RAD_225 ) && ( radians <= RAD_315 ) )
   {
     // Angle in (225.0 .. 315.0]
-    // Rotate image by 270 degrees into temporary image,
-    // so it requires only an extra rotation angle
-    // of -45.0 .. +45.0 to complete rotation.
-
-    fastRotationPerformed = Rotate270( pixelsIn,
-                                       widthIn,
-                                       heightIn,
-                                       pixelSize,
-                                       pixelsOut,
-                                       widthOut,
-                                       heightOut );
-
-    if( !fastRotationPerformed )
-    {
-      DALI_LOG_INFO(gImageOpsLogFilter, Dali::Integration::Log::Verbose, "fast rotation failed\n");
-      // The fast rotation failed.
-      return;
-    }
-
+    fastRotationPerformed = true;
+    fastRotation = PixelTransformRotate270;
     radians -= RAD_270;
   }
 
+  const unsigned int rotatedWidth = ( fastRotationPerformed && ( fastRotation != PixelTransformRotate180 ) ) ? heightIn : widthIn;
+  const unsigned int rotatedHeight = ( fastRotationPerformed && ( fastRotation != PixelTransformRotate180 ) ) ? widthIn : heightIn;
+
   if( fabs( radians ) < Dali::Math::MACHINE_EPSILON_10 )
   {
     // Nothing else to do if the angle is zero.
-    // The rotation angle was 90, 180 or 270.
+    // The rotation angle was 90, 180 or 270, so rotate straight into the output.
+    if( fastRotationPerformed )
+    {
+      pixelsOut = BufferPool::Get().Allocate( widthIn * heightIn * pixelSize );
+      if( ( nullptr == pixelsOut ) || !TransformPixels( pixelsIn, widthIn, heightIn, pixelSize, fastRotation, pixelsOut ) )
+      {
+        DALI_LOG_INFO(gImageOpsLogFilter, Dali::Integration::Log::Verbose, "fast rotation failed\n");
+        BufferPool::Get().Release( pixelsOut );
+        pixelsOut = nullptr;
+        widthOut = 0u;
+        heightOut = 0u;
+        return;
+      }
+      widthOut = rotatedWidth;
+      heightOut = rotatedHeight;
+    }
 
     // @note Allocated memory by 'Fast Rotations', if any, has to be freed by the called to this function.
     return;
   }
 
-  const uint8_t* const firstHorizontalSkewPixelsIn = fastRotationPerformed ? pixelsOut : pixelsIn;
-  std::unique_ptr<uint8_t, void(*)(void*)> tmpPixelsInPtr( ( fastRotationPerformed ? pixelsOut : nullptr ), free );
+  // Only two buffers are used by the three shears. The output buffer takes the 1st and 3rd shears
+  // and the scratch buffer takes the fast rotation, then the 2nd shear.
+  try
+  {
+    if( fastRotationPerformed )
+    {
+      scratch.Clear();
+      scratch.Resize( widthIn * heightIn * pixelSize );
+      if( !TransformPixels( pixelsIn, widthIn, heightIn, pixelSize, fastRotation, scratch.Begin() ) )
+      {
+        DALI_LOG_INFO(gImageOpsLogFilter, Dali::Integration::Log::Verbose, "fast rotation failed\n");
+        widthOut = 0u;
+        heightOut = 0u;
+        return;
+      }
+    }
+  }
+  catch( ... )
+  {
+    DALI_LOG_INFO(gImageOpsLogFilter, Dali::Integration::Log::Verbose, "failed to allocate memory for the fast rotation\n");
+    widthOut = 0u;
+    heightOut = 0u;
+    return;
+  }
+
+  const uint8_t* const firstHorizontalSkewPixelsIn = fastRotationPerformed ? scratch.Begin() : pixelsIn;
 
   // Reset the input/output
-  widthIn = widthOut;
-  heightIn = heightOut;
+  widthIn = rotatedWidth;
+  heightIn = rotatedHeight;
   pixelsOut = nullptr;
 
   const float angleSinus = sin( radians );
   const float angleCosinus = cos( radians );
   const float angleTangent = tan( 0.5f * radians );
 
-  ///////////////////////////////////////
-  // Perform 1st shear (horizontal)
-  ///////////////////////////////////////
-
-  // Calculate first shear (horizontal) destination image dimensions
+  // Calculate the destination image dimensions of each shear.
+  const unsigned int firstShearWidth = widthIn + static_cast<unsigned int>( fabs( angleTangent ) * static_cast<float>( heightIn ) );
+  const unsigned int firstShearHeight = heightIn;
+  const unsigned int secondShearHeight = static_cast<unsigned int>( static_cast<float>( widthIn ) * fabs( angleSinus ) + static_cast<float>( heightIn ) * angleCosinus );
+  const unsigned int thirdShearWidth = static_cast<unsigned int>( static_cast<float>( heightIn ) * fabs( angleSinus ) + static_cast<float>( widthIn ) * angleCosinus ) + 1u;
 
-  widthOut = widthIn + static_cast<unsigned int>( fabs( angleTangent ) * static_cast<float>( heightIn ) );
-  heightOut = heightIn;
+  const size_t firstShearSize = static_cast<size_t>( firstShearWidth ) * firstShearHeight * pixelSize;
+  const size_t thirdShearSize = static_cast<size_t>( thirdShearWidth ) * secondShearHeight * pixelSize;
 
-  // Allocate the buffer for the 1st shear
-  pixelsOut = static_cast<uint8_t*>( malloc( widthOut * heightOut * pixelSize ) );
+  // Allocate the buffer for the 1st and 3rd shears
+  pixelsOut = BufferPool::Get().Allocate( std::max( firstShearSize, thirdShearSize ) );
 
   if( nullptr == pixelsOut )
   {
@@ -2269,98 +4121,138 @@ void RotateByShear( const uint8_t* const pixelsIn,
     heightOut = 0u;
 
     DALI_LOG_INFO(gImageOpsLogFilter, Dali::Integration::Log::Verbose, "malloc failed to allocate memory\n");
-
-    // The deleter of the tmpPixelsInPtr unique pointer is called freeing the memory allocated by the 'Fast rotations'.
-    // Nothing else to do if the memory allocation fails.
     return;
   }
 
-  for( unsigned int y = 0u; y < heightOut; ++y )
-  {
-    const float shear = angleTangent * ( ( angleTangent >= 0.f ) ? ( 0.5f + static_cast<float>( y ) ) : ( 0.5f + static_cast<float>( y ) - static_cast<float>( heightOut ) ) );
+  const SkewScanlineFunction skewScanlineKernel = GetSkewScanlineKernel();
 
-    const int intShear = static_cast<int>( floor( shear ) );
-    HorizontalSkew( firstHorizontalSkewPixelsIn, widthIn, pixelSize, pixelsOut, widthOut, y, intShear, shear - static_cast<float>( intShear ) );
-  }
+  ///////////////////////////////////////
+  // Perform 1st shear (horizontal)
+  ///////////////////////////////////////
 
-  // Reset the 'pixel in' pointer with the output of the 'First Horizontal Skew' and free the memory allocated by the 'Fast Rotations'.
-  tmpPixelsInPtr.reset( pixelsOut );
-  unsigned int tmpWidthIn = widthOut;
-  unsigned int tmpHeightIn = heightOut;
+  ResampleInBands( firstShearWidth, firstShearHeight, [&]( unsigned int begin, unsigned int end )
+  {
+    for( unsigned int y = begin; y < end; ++y )
+    {
+      const float shear = angleTangent * ( ( angleTangent >= 0.f ) ? ( 0.5f + static_cast<float>( y ) ) : ( 0.5f + static_cast<float>( y ) - static_cast<float>( firstShearHeight ) ) );
 
-  // Reset the input/output
-  pixelsOut = nullptr;
+      const int intShear = static_cast<int>( floor( shear ) );
+      HorizontalSkew( firstHorizontalSkewPixelsIn, widthIn, pixelSize, pixelsOut, firstShearWidth, y, intShear, shear - static_cast<float>( intShear ), skewScanlineKernel );
+    }
+  } );
 
   ///////////////////////////////////////
   // Perform 2nd shear (vertical)
   ///////////////////////////////////////
 
-  // Calc 2nd shear (vertical) destination image dimensions
-  heightOut = static_cast<unsigned int>( static_cast<float>( widthIn ) * fabs( angleSinus ) + static_cast<float>( heightIn ) * angleCosinus );
-
-  // Allocate the buffer for the 2nd shear
-  pixelsOut = static_cast<uint8_t*>( malloc( widthOut * heightOut * pixelSize ) );
+  // The offsets are accumulated column by column, so work them out up front for the bands to share:
+  std::vector<int> columnOffsets( firstShearWidth );
+  std::vector<float> columnWeights( firstShearWidth * pixelSize );
+  float offset = angleSinus * ( ( angleSinus > 0.f ) ? static_cast<float>( widthIn - 1u ) : -( static_cast<float>( widthIn ) - static_cast<float>( firstShearWidth ) ) );
+  for( unsigned int column = 0u; column < firstShearWidth; ++column, offset -= angleSinus )
+  {
+    const int shear = static_cast<int>( floor( offset ) );
+    columnOffsets[column] = shear;
+    std::fill_n( columnWeights.begin() + column * pixelSize, pixelSize, offset - static_cast<float>( shear ) );
+  }
 
-  if( nullptr == pixelsOut )
+  try
   {
+    scratch.Clear();
+    scratch.Resize( firstShearWidth * secondShearHeight * pixelSize );
+  }
+  catch( ... )
+  {
+    BufferPool::Get().Release( pixelsOut );
+    pixelsOut = nullptr;
     widthOut = 0u;
     heightOut = 0u;
 
-    DALI_LOG_INFO(gImageOpsLogFilter, Dali::Integration::Log::Verbose, "malloc failed to allocate memory\n");
-    // The deleter of the tmpPixelsInPtr unique pointer is called freeing the memory allocated by the 'First Horizontal Skew'.
-    // Nothing else to do if the memory allocation fails.
+    DALI_LOG_INFO(gImageOpsLogFilter, Dali::Integration::Log::Verbose, "failed to allocate memory for the vertical shear\n");
     return;
   }
+  uint8_t* const secondShearPixels = scratch.Begin();
 
-  // Variable skew offset
-  float offset = angleSinus * ( ( angleSinus > 0.f ) ? static_cast<float>( widthIn - 1u ) : -( static_cast<float>( widthIn ) - static_cast<float>( widthOut ) ) );
-
-  unsigned int column = 0u;
-  for( column = 0u; column < widthOut; ++column, offset -= angleSinus )
+  const SkewColumnsFunction skewColumnsKernel = GetSkewColumnsKernel();
+  const WorkerPool::RangeTask skewColumns = [&]( unsigned int begin, unsigned int end )
   {
-    const int shear = static_cast<int>( floor( offset ) );
-    VerticalSkew( tmpPixelsInPtr.get(), tmpWidthIn, tmpHeightIn, pixelSize, pixelsOut, widthOut, heightOut, column, shear, offset - static_cast<float>( shear ) );
+    VerticalSkew( pixelsOut, firstShearWidth, firstShearHeight, pixelSize, secondShearPixels, secondShearHeight, &columnOffsets[0], &columnWeights[0], begin, end, skewColumnsKernel );
+  };
+  const unsigned int numColumnBands = GetNumResamplingParts( firstShearWidth, secondShearHeight, firstShearWidth );
+  if( numColumnBands > 1u )
+  {
+    WorkerPool::Get().ParallelFor( firstShearWidth, numColumnBands, skewColumns );
+  }
+  else
+  {
+    skewColumns( 0u, firstShearWidth );
   }
-  // Reset the 'pixel in' pointer with the output of the 'Vertical Skew' and free the memory allocated by the 'First Horizontal Skew'.
-  // Reset the input/output
-  tmpPixelsInPtr.reset( pixelsOut );
-  tmpWidthIn = widthOut;
-  tmpHeightIn = heightOut;
-  pixelsOut = nullptr;
 
   ///////////////////////////////////////
   // Perform 3rd shear (horizontal)
   ///////////////////////////////////////
 
-  // Calc 3rd shear (horizontal) destination image dimensions
-  widthOut = static_cast<unsigned int>( static_cast<float>( heightIn ) * fabs( angleSinus ) + static_cast<float>( widthIn ) * angleCosinus ) + 1u;
-
-  // Allocate the buffer for the 3rd shear
-  pixelsOut = static_cast<uint8_t*>( malloc( widthOut * heightOut * pixelSize ) );
-
-  if( nullptr == pixelsOut )
+  std::vector<float> rowOffsets( secondShearHeight );
+  offset = ( angleSinus >= 0.f ) ? -angleSinus * angleTangent * static_cast<float>( widthIn - 1u ) : angleTangent * ( static_cast<float>( widthIn - 1u ) * -angleSinus + ( 1.f - static_cast<float>( secondShearHeight ) ) );
+  for( unsigned int y = 0u; y < secondShearHeight; ++y, offset += angleTangent )
   {
-    widthOut = 0u;
-    heightOut = 0u;
-
-    DALI_LOG_INFO(gImageOpsLogFilter, Dali::Integration::Log::Verbose, "malloc failed to allocate memory\n");
-    // The deleter of the tmpPixelsInPtr unique pointer is called freeing the memory allocated by the 'Vertical Skew'.
-    // Nothing else to do if the memory allocation fails.
-    return;
+    rowOffsets[y] = offset;
   }
 
-  offset =  ( angleSinus >= 0.f ) ? -angleSinus * angleTangent * static_cast<float>( widthIn - 1u ) : angleTangent * ( static_cast<float>( widthIn - 1u ) * -angleSinus + ( 1.f - static_cast<float>( heightOut ) ) );
+  ResampleInBands( thirdShearWidth, secondShearHeight, [&]( unsigned int begin, unsigned int end )
+  {
+    for( unsigned int y = begin; y < end; ++y )
+    {
+      const int shear = static_cast<int>( floor( rowOffsets[y] ) );
+      HorizontalSkew( secondShearPixels, firstShearWidth, pixelSize, pixelsOut, thirdShearWidth, y, shear, rowOffsets[y] - static_cast<float>( shear ), skewScanlineKernel );
+    }
+  } );
+
+  widthOut = thirdShearWidth;
+  heightOut = secondShearHeight;
 
-  for( unsigned int y = 0u; y < heightOut; ++y, offset += angleTangent )
+  if( ( firstShearSize > thirdShearSize ) && !BufferPool::Get().IsPooled( pixelsOut ) )
   {
-    const int shear = static_cast<int>( floor( offset ) );
-    HorizontalSkew( tmpPixelsInPtr.get(), tmpWidthIn, pixelSize, pixelsOut, widthOut, y, shear, offset - static_cast<float>( shear ) );
+    // Give back the memory only the 1st shear needed, unless the buffer will go back to the pool whole.
+    // Shrinking can't fail in practice, but keep the larger buffer if it does.
+    uint8_t* const shrunk = static_cast<uint8_t*>( realloc( pixelsOut, thirdShearSize ) );
+    if( nullptr != shrunk )
+    {
+      pixelsOut = shrunk;
+    }
   }
 
-  // The deleter of the tmpPixelsInPtr unique pointer is called freeing the memory allocated by the 'Vertical Skew'.
   // @note Allocated memory by the last 'Horizontal Skew' has to be freed by the caller to this function.
 }
 
+} // unnamed namespace
+
+void RotateByShear( const uint8_t* const pixelsIn,
+                    unsigned int widthIn,
+                    unsigned int heightIn,
+                    unsigned int pixelSize,
+                    float radians,
+                    uint8_t*& pixelsOut,
+                    unsigned int& widthOut,
+                    unsigned int& heightOut )
+{
+  PooledBuffer scratch;
+  RotateByShearWithScratch( pixelsIn, widthIn, heightIn, pixelSize, radians, pixelsOut, widthOut, heightOut, scratch );
+}
+
+void RotateByShear( const uint8_t* const pixelsIn,
+                    unsigned int widthIn,
+                    unsigned int heightIn,
+                    unsigned int pixelSize,
+                    float radians,
+                    uint8_t*& pixelsOut,
+                    unsigned int& widthOut,
+                    unsigned int& heightOut,
+                    Dali::Vector<uint8_t>& scratch )
+{
+  RotateByShearWithScratch( pixelsIn, widthIn, heightIn, pixelSize, radians, pixelsOut, widthOut, heightOut, scratch );
+}
+
 void HorizontalShear( const uint8_t* const pixelsIn,
                       unsigned int widthIn,
                       unsigned int heightIn,
@@ -2388,7 +4280,7 @@ void HorizontalShear( const uint8_t* const pixelsIn,
   heightOut = heightIn;
 
   // Allocate the buffer for the shear.
-  pixelsOut = static_cast<uint8_t*>( malloc( widthOut * heightOut * pixelSize ) );
+  pixelsOut = BufferPool::Get().Allocate( widthOut * heightOut * pixelSize );
 
   if( nullptr == pixelsOut )
   {
@@ -2399,13 +4291,21 @@ void HorizontalShear( const uint8_t* const pixelsIn,
     return;
   }
 
-  for( unsigned int y = 0u; y < heightOut; ++y )
+  const SkewScanlineFunction skewScanlineKernel = GetSkewScanlineKernel();
+  const unsigned int shearWidth = widthOut;
+  const unsigned int shearHeight = heightOut;
+  uint8_t* const shearPixels = pixelsOut;
+
+  ResampleInBands( shearWidth, shearHeight, [&]( unsigned int begin, unsigned int end )
   {
-    const float shear = radians * ( ( radians >= 0.f ) ? ( 0.5f + static_cast<float>( y ) ) : ( 0.5f + static_cast<float>( y ) - static_cast<float>( heightOut ) ) );
+    for( unsigned int y = begin; y < end; ++y )
+    {
+      const float shear = radians * ( ( radians >= 0.f ) ? ( 0.5f + static_cast<float>( y ) ) : ( 0.5f + static_cast<float>( y ) - static_cast<float>( shearHeight ) ) );
 
-    const int intShear = static_cast<int>( floor( shear ) );
-    HorizontalSkew( pixelsIn, widthIn, pixelSize, pixelsOut, widthOut, y, intShear, shear - static_cast<float>( intShear ) );
-  }
+      const int intShear = static_cast<int>( floor( shear ) );
+      HorizontalSkew( pixelsIn, widthIn, pixelSize, shearPixels, shearWidth, y, intShear, shear - static_cast<float>( intShear ), skewScanlineKernel );
+    }
+  } );
 }
 
 } /* namespace Platform */
@@ -20,9 +20,12 @@
 
 // EXTERNAL INCLUDES
 #include <stdint.h>
+#include <cstddef>
+#include <vector>
 
 // INTERNAL INCLUDES
 #include <dali/integration-api/bitmap.h>
+#include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/images/image-operations.h>
 #include <third-party/resampler/resampler.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
@@ -45,6 +48,20 @@ enum BoxDimensionTest
   BoxDimensionTestY
 };
 
+/**
+ * @brief The rearrangements of an image's pixels which TransformPixels() can apply.
+ *
+ * All but PixelTransformRotate180 swap the width and height of the image.
+ */
+enum PixelTransform
+{
+  PixelTransformRotate90,   ///< Rotate 90 degrees counter clockwise.
+  PixelTransformRotate180,  ///< Rotate 180 degrees.
+  PixelTransformRotate270,  ///< Rotate 270 degrees counter clockwise (90 degrees clockwise).
+  PixelTransformTranspose,  ///< Mirror across the top-left to bottom-right diagonal.
+  PixelTransformTransverse  ///< Mirror across the top-right to bottom-left diagonal.
+};
+
 /**
  * @brief The integer dimensions of an image or a region of an image packed into
  *        16 bits per component.
@@ -91,6 +108,107 @@ Dali::Devel::PixelBuffer DownscaleBitmap( Dali::Devel::PixelBuffer bitmap,
                                           ImageDimensions desired,
                                           FittingMode::Type fittingMode,
                                           SamplingMode::Type samplingMode );
+
+/**
+ * @brief The part of an image kept by the crop and pad for a fitting mode, and where it goes.
+ *
+ * Everything in the output outside the copied block is border.
+ */
+struct FittingModeCrop
+{
+  ImageDimensions outputDimensions; ///< The size of the cropped and padded image.
+  ImageDimensions sourceOrigin;     ///< The top left pixel of the input which is kept.
+  ImageDimensions targetOrigin;     ///< Where that pixel goes in the output.
+  ImageDimensions copyDimensions;   ///< The size of the block copied from the input.
+};
+
+/**
+ * @brief Work out the crop and pad that the fitting mode applies to an image after it has been downscaled.
+ *
+ * @param[in] inputDimensions The size of the downscaled image.
+ * @param[in] desiredDimensions The target dimensions to aim to fill based on the fitting mode.
+ * @param[in] fittingMode The fitting mode to use.
+ * @param[out] crop The crop and pad. Only set if true is returned.
+ * @return true if the image needs cropping or padding, false if it is used as it is.
+ */
+bool CalculateCropForFittingMode( ImageDimensions inputDimensions, ImageDimensions desiredDimensions, FittingMode::Type fittingMode, FittingModeCrop& crop );
+
+/**
+ * @brief Write some scanlines of a cropped and padded image.
+ *
+ * @param[in] pixelsIn The input image.
+ * @param[in] inputWidth The width of the input image.
+ * @param[in] bytesPerPixel The size of the pixel.
+ * @param[in] crop The crop and pad, from CalculateCropForFittingMode().
+ * @param[in] firstScanline The first output scanline to write.
+ * @param[in] endScanline One past the last output scanline to write.
+ * @param[out] pixelsOut The first scanline to write. It is @p crop.outputDimensions wide.
+ */
+void CropAndPadScanlines( const uint8_t* pixelsIn,
+                          unsigned int inputWidth,
+                          unsigned int bytesPerPixel,
+                          const FittingModeCrop& crop,
+                          unsigned int firstScanline,
+                          unsigned int endScanline,
+                          uint8_t* pixelsOut );
+/**@}*/
+
+/**
+ * @defgroup ParallelResampling Control of multi-threaded resampling.
+ * @{
+ */
+
+/**
+ * @brief The default smallest output image, in pixels, which is resampled on more than one thread.
+ */
+const unsigned int DEFAULT_PARALLEL_RESAMPLING_MINIMUM_PIXELS = 256u * 256u;
+
+/**
+ * @brief Enable or disable splitting the point, linear and Lanczos resampling functions across a pool of worker threads.
+ *
+ * Point and linear sampling split the output image into horizontal bands of
+ * scanlines. Lanczos resampling processes each color channel on its own thread.
+ * The shears of RotateByShear() and HorizontalShear() are split into bands of
+ * scanlines, or of columns for the vertical shear.
+ * The output is identical to that of the single-threaded path.
+ * Parallel resampling is enabled by default.
+ * @param[in] enabled Whether resampling may use more than one thread.
+ */
+void SetParallelResamplingEnabled( bool enabled );
+
+/**
+ * @brief Set the smallest output image which is resampled in parallel.
+ *
+ * Smaller images are processed on the calling thread, where handing the work
+ * to other threads would cost more than it saves.
+ * @param[in] minimumPixels The minimum number of output pixels, DEFAULT_PARALLEL_RESAMPLING_MINIMUM_PIXELS by default.
+ */
+void SetParallelResamplingMinimumPixels( unsigned int minimumPixels );
+
+/**
+ * @brief The default memory limit of the cache of Lanczos filter contributor lists, in bytes.
+ *
+ * Enough for the lists of a few typical camera resolution to thumbnail resizes.
+ */
+const std::size_t DEFAULT_RESAMPLE_CACHE_MEMORY_LIMIT = 1024u * 1024u;
+
+/**
+ * @brief Set the most memory Resample() may keep in its cache of filter contributor lists.
+ *
+ * The filter contributors for each axis depend only on the source and
+ * destination size along it, so they are kept between calls and reused by
+ * later images of the same size. The least recently used lists are dropped
+ * to stay within the limit.
+ * @param[in] memoryLimit The limit in bytes, DEFAULT_RESAMPLE_CACHE_MEMORY_LIMIT by default. Zero disables the cache.
+ */
+void SetResampleCacheMemoryLimit( std::size_t memoryLimit );
+
+/**
+ * @brief Get the memory taken up by the cache of filter contributor lists.
+ * @return The size of the cached lists in bytes.
+ */
+std::size_t GetResampleCacheMemoryUsage();
+
 /**@}*/
 
 /**
@@ -201,6 +319,77 @@ void DownscaleInPlacePow2SingleBytePerPixel( unsigned char * pixels,
                                              unsigned int& outWidth,
                                              unsigned int& outHeight );
 
+/**
+ * @brief Work out the size DownscaleInPlacePow2() shrinks an image to, without touching its pixels.
+ * @param[in]  pixelFormat The format of the image.
+ * @param[in]  inputWidth The width of the input image.
+ * @param[in]  inputHeight The height of the input image.
+ * @param[in]  desiredWidth The width the client is requesting.
+ * @param[in]  desiredHeight The height the client is requesting.
+ * @param[in]  fittingMode The fitting mode the image is shrunk for.
+ * @param[in]  samplingMode The sampling mode, which must be one of the box modes for any shrinking to happen.
+ * @param[out] outWidth The width after downscaling.
+ * @param[out] outHeight The height after downscaling.
+ * @return The number of times the image is halved.
+ */
+unsigned int CalculatePow2Downscale( Pixel::Format pixelFormat,
+                                     unsigned int inputWidth,
+                                     unsigned int inputHeight,
+                                     unsigned int desiredWidth,
+                                     unsigned int desiredHeight,
+                                     FittingMode::Type fittingMode,
+                                     SamplingMode::Type samplingMode,
+                                     unsigned int& outWidth,
+                                     unsigned int& outHeight );
+
+/**
+ * @brief The box filter of DownscaleInPlacePow2(), fed one scanline at a time.
+ *
+ * A decoder can push the scanlines of an image through this as it decodes
+ * them, so that only the downscaled image and one scanline for each halving
+ * are ever held. The pixels are the same as those DownscaleInPlacePow2() gives.
+ */
+class Pow2ScanlineDownscaler
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param[in] pixelFormat The format of the image, one which DownscaleInPlacePow2() supports.
+   * @param[in] inputWidth The width of the scanlines pushed.
+   * @param[in] inputHeight The number of scanlines pushed.
+   * @param[in] halvings The number of times to halve the image, as returned by CalculatePow2Downscale().
+   * @param[out] outputPixels The downscaled image, which must have room for the width and height CalculatePow2Downscale() gave.
+   */
+  Pow2ScanlineDownscaler( Pixel::Format pixelFormat, unsigned int inputWidth, unsigned int inputHeight, unsigned int halvings, unsigned char* outputPixels );
+
+  /**
+   * @brief Downscale the next scanline of the image.
+   * @param[in,out] scanline The scanline, which is overwritten.
+   */
+  void PushScanline( unsigned char* scanline );
+
+private:
+
+  void PushScanline( unsigned int halving, unsigned char* scanline );
+
+private:
+
+  using HalveScanlineFunction = void (*)( unsigned char * pixels, unsigned int width );
+  using AverageScanlinesFunction = void (*)( const unsigned char * scanline1, const unsigned char * __restrict__ scanline2, unsigned char* outputScanline, unsigned int width );
+
+  HalveScanlineFunction mHalveScanline;                   ///< Halves a scanline of the format in place.
+  AverageScanlinesFunction mAverageScanlines;             ///< Averages two scanlines of the format.
+  unsigned int mBytesPerPixel;
+  unsigned int mHalvings;
+  std::vector<unsigned int> mWidths;                      ///< The width of the scanlines before each halving, and of the output.
+  std::vector< std::vector<unsigned char> > mScanlines;   ///< The halved scanline waiting for its pair at each halving.
+  std::vector<bool> mScanlineWaiting;                     ///< Whether a scanline is waiting at each halving.
+  unsigned char* mOutputPixels;
+  unsigned int mOutputRow;
+  unsigned int mOutputHeight;
+};
+
 /**
  * @brief Rescales an input image into the exact output dimensions passed-in.
  *
@@ -380,6 +569,52 @@ void Resample( const unsigned char * __restrict__ inPixels,
                Resampler::Filter filterType,
                int numChannels, bool hasAlpha );
 
+/**
+ * @brief Rotates or transposes an image into a separate buffer.
+ *
+ * The image is walked in small square blocks, each transposed in registers
+ * where the CPU allows it, so that neither buffer is accessed a whole
+ * scanline apart on every pixel.
+ *
+ * @pre @p pixelsIn must not alias @p pixelsOut.
+ *
+ * @param[in] pixelsIn The input buffer.
+ * @param[in] widthIn The width of the input buffer.
+ * @param[in] heightIn The height of the input buffer.
+ * @param[in] pixelSize The size of the pixel. Pixels of 1, 2 and 4 bytes are moved in vectors where the CPU allows it.
+ * @param[in] transform The transform to apply.
+ * @param[out] pixelsOut The output buffer, widthIn * heightIn * pixelSize bytes in size.
+ * Its width and height are swapped unless @p transform is PixelTransformRotate180.
+ *
+ * @return Whether the image was transformed. It fails for a pixel size of zero.
+ */
+bool TransformPixels( const uint8_t* const pixelsIn,
+                      unsigned int widthIn,
+                      unsigned int heightIn,
+                      unsigned int pixelSize,
+                      PixelTransform transform,
+                      uint8_t* const pixelsOut );
+
+/**
+ * @brief Rotates or transposes an image without allocating a second image.
+ *
+ * A 180 degree rotation can be done in place for any size of image. The
+ * transforms which swap the width and height need a square image.
+ *
+ * @param[in,out] pixels The buffer to transform.
+ * @param[in] width The width of the buffer.
+ * @param[in] height The height of the buffer.
+ * @param[in] pixelSize The size of the pixel. Pixels of 1, 2 and 4 bytes are moved in vectors where the CPU allows it.
+ * @param[in] transform The transform to apply.
+ *
+ * @return Whether the image was transformed. It fails for a pixel size of zero, or
+ * for a non square image if @p transform would swap the width and height.
+ */
+bool TransformPixelsInPlace( uint8_t* const pixels,
+                             unsigned int width,
+                             unsigned int height,
+                             unsigned int pixelSize,
+                             PixelTransform transform );
 
 /**
  * @brief Rotates the input image with an implementation of the 'Rotate by Shear' algorithm.
@@ -387,7 +622,7 @@ void Resample( const unsigned char * __restrict__ inPixels,
  * @pre @p pixelsIn must not alias @p pixelsOut. The input image should be a totally
  * separate buffer from the output buffer.
  *
- * @note This function allocates memory in @p pixelsOut which has to be released by calling @e free()
+ * @note This function allocates memory in @p pixelsOut which has to be released by calling BufferPool::Release()
  *
  * @param[in] pixelsIn The input buffer.
  * @param[in] widthIn The width of the input buffer.
@@ -407,6 +642,37 @@ void RotateByShear( const uint8_t* const pixelsIn,
                     unsigned int& widthOut,
                     unsigned int& heightOut );
 
+/**
+ * @brief Rotates the input image by shear, keeping the intermediate images in a caller provided buffer.
+ *
+ * The three shears only need the output buffer and one scratch buffer between them, so
+ * a caller rotating many images can pass the same @p scratch each time to avoid
+ * allocating it again.
+ *
+ * @pre @p pixelsIn must not alias @p pixelsOut or @p scratch.
+ *
+ * @note This function allocates memory in @p pixelsOut which has to be released by calling BufferPool::Release()
+ *
+ * @param[in] pixelsIn The input buffer.
+ * @param[in] widthIn The width of the input buffer.
+ * @param[in] heightIn The height of the input buffer.
+ * @param[in] pixelSize The size of the pixel.
+ * @param[in] radians The rotation angle in radians.
+ * @param[out] pixelsOut The rotated output buffer.
+ * @param[out] widthOut The width of the output buffer.
+ * @param[out] heightOut The height of the output buffer.
+ * @param[in,out] scratch The buffer for the intermediate images. It is resized as needed and its contents are undefined on return.
+ */
+void RotateByShear( const uint8_t* const pixelsIn,
+                    unsigned int widthIn,
+                    unsigned int heightIn,
+                    unsigned int pixelSize,
+                    float radians,
+                    uint8_t*& pixelsOut,
+                    unsigned int& widthOut,
+                    unsigned int& heightOut,
+                    Dali::Vector<uint8_t>& scratch );
+
 /**
  * @brief Applies to the input image a horizontal shear transformation.
  *
@@ -414,7 +680,7 @@ void RotateByShear( const uint8_t* const pixelsIn,
  * separate buffer from the output buffer.
  * @pre The maximun/minimum shear angle is +/-45 degrees (PI/4 around 0.79 radians).
  *
- * @note This function allocates memory in @p pixelsOut which has to be released by calling @e free()
+ * @note This function allocates memory in @p pixelsOut which has to be released by calling BufferPool::Release()
  *
  * @param[in] pixelsIn The input buffer.
  * @param[in] widthIn The width of the input buffer.
@@ -516,6 +782,83 @@ void AverageScanlinesRGB565( const unsigned char * scanline1,
                              const unsigned char * scanline2,
                              unsigned char* outputScanline,
                              unsigned int width );
+
+/**
+ * @brief Vectorised equivalent of HalveScanlineInPlaceRGB888.
+ *
+ * Uses SSE2/SSSE3/AVX2 or NEON kernels when the CPU supports them (see GetCpuFeatures())
+ * and produces output which is bit-exact with the scalar function.
+ * @param[in,out] pixels The array of pixels to work on.
+ * @param[i]      width  The number of pixels in the array passed-in.
+ */
+void HalveScanlineInPlaceRGB888Vectorised( unsigned char * pixels, unsigned int width );
+
+/**
+ * @copydoc HalveScanlineInPlaceRGB888Vectorised
+ */
+void HalveScanlineInPlaceRGBA8888Vectorised( unsigned char * pixels, unsigned int width );
+
+/**
+ * @copydoc HalveScanlineInPlaceRGB888Vectorised
+ */
+void HalveScanlineInPlaceRGB565Vectorised( unsigned char * pixels, unsigned int width );
+
+/**
+ * @copydoc HalveScanlineInPlaceRGB888Vectorised
+ */
+void HalveScanlineInPlace2BytesVectorised( unsigned char * pixels, unsigned int width );
+
+/**
+ * @copydoc HalveScanlineInPlaceRGB888Vectorised
+ */
+void HalveScanlineInPlace1ByteVectorised( unsigned char * pixels, unsigned int width );
+
+/**
+ * @brief Vectorised equivalent of AverageScanlines1.
+ *
+ * Produces output which is bit-exact with the scalar function.
+ * outputScanline is allowed to alias scanline1.
+ * @param[in] scanline1 First scanline of pixels to average.
+ * @param[in] scanline2 Second scanline of pixels to average.
+ * @param[out] outputScanline Destination for the averaged pixels.
+ * @param[in] width The widths of all the scanlines passed-in.
+ */
+void AverageScanlines1Vectorised( const unsigned char * scanline1,
+                                  const unsigned char * scanline2,
+                                  unsigned char* outputScanline,
+                                  unsigned int width );
+
+/**
+ * @copydoc AverageScanlines1Vectorised
+ */
+void AverageScanlines2Vectorised( const unsigned char * scanline1,
+                                  const unsigned char * scanline2,
+                                  unsigned char* outputScanline,
+                                  unsigned int width );
+
+/**
+ * @copydoc AverageScanlines1Vectorised
+ */
+void AverageScanlines3Vectorised( const unsigned char * scanline1,
+                                  const unsigned char * scanline2,
+                                  unsigned char* outputScanline,
+                                  unsigned int width );
+
+/**
+ * @copydoc AverageScanlines1Vectorised
+ */
+void AverageScanlinesRGBA8888Vectorised( const unsigned char * scanline1,
+                                         const unsigned char * scanline2,
+                                         unsigned char * outputScanline,
+                                         unsigned int width );
+
+/**
+ * @copydoc AverageScanlines1Vectorised
+ */
+void AverageScanlinesRGB565Vectorised( const unsigned char * scanline1,
+                                       const unsigned char * scanline2,
+                                       unsigned char* outputScanline,
+                                       unsigned int width );
 /**@}*/
 
 /**
@@ -20,10 +20,12 @@
 
 // EXTERNAL INCLUDES
 #include <cstring>
+#include <memory>
 #include <dali/public-api/common/compile-time-assert.h>
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/images/pixel.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/internal/imaging/common/mapped-file.h>
 #include <dali/internal/imaging/common/pixel-buffer-impl.h>
 
 namespace Dali
@@ -197,6 +199,24 @@ bool LoadBitmapFromAstc( const Dali::ImageLoader::Input& input, Dali::Devel::Pix
     return false;
   }
 
+  // The compressed data is uploaded as it is, so leave it in the page cache rather than read it:
+  std::shared_ptr<Internal::Platform::MappedFile> mappedFile( new Internal::Platform::MappedFile );
+  if( mappedFile->Map( filePointer ) )
+  {
+    // Data size is file size - header size.
+    const size_t imageByteCount = mappedFile->GetSize() - sizeof( AstcFileHeader );
+    if( ( imageByteCount > MAX_IMAGE_DATA_SIZE ) || ( imageByteCount > ( ( static_cast< size_t >( width ) * height ) << 1 ) ) )
+    {
+      DALI_LOG_ERROR( "ASTC file has too large image-data field.\n" );
+      return false;
+    }
+
+    Internal::Adaptor::PixelBufferPtr pixelBuffer = Internal::Adaptor::PixelBuffer::New( mappedFile, sizeof( AstcFileHeader ), imageByteCount,
+                                                                                         width, height, pixelFormat );
+    bitmap = Dali::Devel::PixelBuffer( pixelBuffer.Get() );
+    return true;
+  }
+
   // Retrieve the file size.
   if( fseek( filePointer, 0L, SEEK_END ) )
   {
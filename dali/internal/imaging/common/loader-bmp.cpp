@@ -17,9 +17,12 @@
 
 #include <dali/internal/imaging/common/loader-bmp.h>
 
+#include <cstring>
 #include <dali/public-api/common/vector-wrapper.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 #include <dali/integration-api/debug.h>
+#include <dali/internal/imaging/common/mapped-file.h>
+#include <dali/internal/imaging/common/pixel-format-conversion.h>
 
 namespace Dali
 {
@@ -116,698 +119,345 @@ bool LoadBmpHeader(FILE *fp, unsigned int &width, unsigned int &height, BmpFileH
 }
 
 /**
- * function to decode format BI_RGB & bpp = 24 & bmp version5.
- * @param[in]  fp      The file to read from
- * @param[out] pixels  The pointer that  we want to store bmp data  in
- * @param[in]  width   bmp width
- * @param[in]  height  bmp height
- * @param[in]  offset  offset from bmp header to bmp image data
- * @param[in]  topDown indicate image data is read from bottom or from top
- * @param[in]  padding padded to a u_int32 boundary for each line
- * @return true, if decode successful, false otherwise
+ * Get the whole of the file into memory, mapping it if possible, or else reading it in one go.
+ * @param[in]  fp         The file to read from
+ * @param[out] mappedFile The mapping of the file, if it can be mapped
+ * @param[out] buffer     The buffer the file is read into, if it can't be mapped
+ * @param[out] file       The start of the file in memory
+ * @param[out] fileSize   The size of the file in bytes
+ * @return true if the file is in memory, false otherwise
  */
-bool DecodeRGB24V5(FILE *fp,
-                   unsigned char* pixels,
-                   unsigned int width,
-                   unsigned int height,
-                   unsigned int offset,
-                   bool topDown,
-                   unsigned int rowStride,
-                   unsigned int padding)
+bool ReadBmpFile( FILE* fp, Internal::Platform::MappedFile& mappedFile, std::vector<unsigned char>& buffer,
+                  const unsigned char*& file, std::size_t& fileSize )
 {
-  if(fp == NULL || pixels == NULL)
+  if( mappedFile.Map( fp ) )
+  {
+    file = mappedFile.GetData();
+    fileSize = mappedFile.GetSize();
+    return true;
+  }
+
+  if( fseek( fp, 0, SEEK_END ) )
   {
-    DALI_LOG_ERROR("Error decoding BMP_RGB24V5 format\n");
+    DALI_LOG_ERROR("Error seeking to end of BMP file\n");
     return false;
   }
-  if ( fseek(fp, offset, SEEK_SET) )
+  const long positionIndicator = ftell( fp );
+  if( positionIndicator <= 0L || fseek( fp, 0, SEEK_SET ) )
   {
-    DALI_LOG_ERROR("Error seeking BMP_RGB24V5 data\n");
+    DALI_LOG_ERROR("Error seeking to start of BMP file\n");
     return false;
   }
 
-  for(unsigned int yPos = 0; yPos < height; yPos ++)
+  fileSize = static_cast<std::size_t>( positionIndicator );
+  buffer.resize( fileSize );
+  if( fread( buffer.data(), 1, fileSize, fp ) != fileSize )
   {
-    unsigned char* pixelsPtr = NULL;
-    if(topDown)
-    {
-      pixelsPtr = pixels + ( yPos * rowStride);
-    }
-    else
-    {
-      pixelsPtr = pixels + (((height-1)-yPos) * rowStride);
-    }
-    if (fread(pixelsPtr, 1, rowStride, fp) != rowStride)
-    {
-      DALI_LOG_ERROR("Error reading the BMP image\n");
-      return false;
-    }
-    for(unsigned int i = 0; i < rowStride; i += 3)
-    {
-      unsigned char temp = pixelsPtr[i];
-      pixelsPtr[i] = pixelsPtr[i + 2];
-      pixelsPtr[i + 2] = temp;
-    }
-
-    if (padding)
-    {
-      // move past the padding.
-      if( fseek(fp, padding, SEEK_CUR) )
-      {
-        DALI_LOG_ERROR("Error moving past BMP_RGB24V5 padding\n");
-      }
-    }
+    DALI_LOG_ERROR("Error reading the BMP file\n");
+    return false;
   }
+  file = buffer.data();
   return true;
 }
 
 /**
- * function to decode format BI_BITFIELDS & bpp = 32 & bmp version4.
- * @param[in]  fp        The file to read from
- * @param[out] pixels    The pointer that  we want to store bmp data  in
- * @param[in]  width     bmp width
- * @param[in]  height    bmp height
- * @param[in]  offset    offset from bmp header to bmp image data
- * @param[in]  topDown   indicate image data is read from bottom or from top
- * @param[in]  rowStride bits span for each line
- * @param[in]  padding   padded to a u_int32 boundary for each line
- * @return true, if decode successful, false otherwise
+ * Check that a range of bytes lies inside the file.
+ * @param[in] fileSize The size of the file in bytes
+ * @param[in] offset   The offset of the range from the start of the file
+ * @param[in] length   The number of bytes in the range
+ * @return true if the whole range is in the file
  */
-bool DecodeBF32V4(FILE *fp,
-                  unsigned char* pixels,
-                  unsigned int width,
-                  unsigned int height,
-                  unsigned int offset,
-                  bool topDown,
-                  unsigned int rowStride,
-                  unsigned int padding)
+inline bool IsInFile( std::size_t fileSize, std::size_t offset, std::size_t length )
 {
-  if(fp == NULL || pixels == NULL)
-  {
-    DALI_LOG_ERROR("Error decoding BMP_BITFIELDS32V4 format\n");
-    return false;
-  }
-  if( fseek(fp, offset, SEEK_SET) )
+  return offset <= fileSize && length <= fileSize - offset;
+}
+
+/**
+ * Convert a colour table, whose entries are stored as BGRX, to RGB triplets.
+ * @param[in]  table     The colour table in the file
+ * @param[in]  numColors The number of entries in the table
+ * @param[out] rgb       Space for numColors RGB triplets
+ */
+void ReadColorTable( const unsigned char* table, unsigned int numColors, unsigned char* rgb )
+{
+  for( unsigned int i = 0; i < numColors; ++i )
   {
-    DALI_LOG_ERROR("Error seeking BMP_BITFIELDS32V4 data\n");
-    return false;
+    rgb[3 * i]     = table[4 * i + 2];
+    rgb[3 * i + 1] = table[4 * i + 1];
+    rgb[3 * i + 2] = table[4 * i];
   }
+}
 
-  for(unsigned int yPos = 0; yPos < height; yPos ++)
+/**
+ * Expand a row of packed colour indices to RGB888 through a colour table.
+ * @param[in]  indices      The packed indices, most significant bits first
+ * @param[in]  bitsPerIndex The size of an index: 1, 4 or 8 bits
+ * @param[in]  numPixels    The number of pixels in the row
+ * @param[in]  rgb          The colour table, as RGB triplets, with an entry for every possible index
+ * @param[out] pixels       The RGB888 row
+ */
+void ExpandColorIndices( const unsigned char* indices, unsigned int bitsPerIndex, unsigned int numPixels, const unsigned char* rgb, unsigned char* pixels )
+{
+  switch( bitsPerIndex )
   {
-    unsigned char* pixelsPtr = NULL;
-    if(topDown)
-    {
-      pixelsPtr = pixels + ( yPos * rowStride);
-    }
-    else
-    {
-      pixelsPtr = pixels + (((height-1)-yPos) * rowStride);
-    }
-    if (fread(pixelsPtr, 1, rowStride, fp) != rowStride)
+    case 1:
     {
-      DALI_LOG_ERROR("Error reading the BMP image\n");
-      return false;
+      for( unsigned int i = 0; i < numPixels; ++i )
+      {
+        memcpy( pixels + 3 * i, rgb + 3 * ( ( indices[i >> 3] >> ( 7 - ( i & 7 ) ) ) & 0x01 ), 3 );
+      }
+      break;
     }
-    for(unsigned int i = 0; i < rowStride; i += 4)
+    case 4:
     {
-      unsigned char temp = pixelsPtr[i];
-      pixelsPtr[i] = pixelsPtr[i + 2];
-      pixelsPtr[i + 2] = temp;
+      for( unsigned int i = 0; i < numPixels; ++i )
+      {
+        memcpy( pixels + 3 * i, rgb + 3 * ( ( indices[i >> 1] >> ( ( i & 1 ) ? 0 : 4 ) ) & 0x0F ), 3 );
+      }
+      break;
     }
-    if (padding)
+    default:
     {
-      // move past the padding.
-      if( fseek(fp, padding, SEEK_CUR) )
+      for( unsigned int i = 0; i < numPixels; ++i )
       {
-        DALI_LOG_ERROR("Error moving past BMP_BITFIELDS32V4 padding\n");
+        memcpy( pixels + 3 * i, rgb + 3 * indices[i], 3 );
       }
+      break;
     }
-
   }
-  return true;
 }
 
 /**
- * function to decode format BI_BITFIELDS & bpp = 32
- * @param[in]  fp        The file to read from
- * @param[out] pixels    The pointer that  we want to store bmp data  in
- * @param[in]  width     bmp width
- * @param[in]  height    bmp height
- * @param[in]  offset    offset from bmp header to bmp image data
- * @param[in]  topDown   indicate image data is read from bottom or from top
- * @param[in]  rowStride bits span for each line
- * @param[in]  padding   padded to a u_int32 boundary for each line
- * @return true, if decode successful, false otherwise
+ * Copy the rows of the pixel array to the pixel buffer, flipping a bottom-up
+ * image by where each row is written, and convert each one in place.
+ * @param[in]  file       The BMP file
+ * @param[in]  fileSize   The size of the file in bytes
+ * @param[out] pixels     The pixel buffer
+ * @param[in]  height     bmp height
+ * @param[in]  offset     offset from the start of the file to the first row
+ * @param[in]  topDown    indicate image data is read from bottom or from top
+ * @param[in]  rowStride  bytes of pixels in each row of the file and of the pixel buffer
+ * @param[in]  padding    bytes after each row of the file, padding it to a u_int32 boundary
+ * @param[in]  convertRow function to convert a row of the pixel buffer in place, or nullptr
+ * @return The number of rows copied, which is less than height if the file is truncated
  */
-bool DecodeBF32(FILE *fp,
-                unsigned char* pixels,
-                unsigned int width,
-                unsigned int height,
-                unsigned int offset,
-                bool topDown,
-                unsigned int rowStride,
-                unsigned int padding)
+unsigned int CopyRows( const unsigned char* file,
+                       std::size_t fileSize,
+                       unsigned char* pixels,
+                       unsigned int height,
+                       std::size_t offset,
+                       bool topDown,
+                       unsigned int rowStride,
+                       unsigned int padding,
+                       void (*convertRow)( unsigned char* row, unsigned int rowStride ) )
 {
-  if(fp == NULL || pixels == NULL)
+  for( unsigned int yPos = 0; yPos < height; yPos++ )
   {
-    DALI_LOG_ERROR("Error decoding BMP_BITFIELDS32 format\n");
-    return false;
-  }
-  if( fseek(fp, offset, SEEK_SET) )
-  {
-    DALI_LOG_ERROR("Error seeking BMP_BITFIELDS32 data\n");
-    return false;
-  }
-
-  for (unsigned int yPos = 0; yPos < height; yPos++)
-  {
-    unsigned char* pixelsPtr;
-    if (topDown)
-    {
-      // the data in the file is top down, and we store the data top down
-      pixelsPtr = pixels + ( yPos * rowStride);
-    }
-    else
-    {
-      // the data in the file is bottom up, and we store the data top down
-      pixelsPtr = pixels + (((height-1)-yPos) * rowStride);
-    }
-
-    if (fread(pixelsPtr, 1, rowStride, fp) != rowStride)
+    // the data in the file may be bottom up, but we store the data top down
+    unsigned char* const pixelsPtr = pixels + ( topDown ? yPos : ( height - 1 ) - yPos ) * rowStride;
+    if( !IsInFile( fileSize, offset, rowStride ) )
     {
+      // Keep what there is of a truncated row, as reading the file a row at a time did:
+      if( offset < fileSize )
+      {
+        memcpy( pixelsPtr, file + offset, fileSize - offset );
+      }
       DALI_LOG_ERROR("Error reading the BMP image\n");
-      return false;
-    }
-    for(unsigned int i = 0; i < rowStride; i += 4)
-    {
-      unsigned char temp = pixelsPtr[i];
-      pixelsPtr[i] = pixelsPtr[i + 2];
-      pixelsPtr[i + 2] = temp;
+      return yPos;
     }
 
-    if (padding)
+    memcpy( pixelsPtr, file + offset, rowStride );
+    if( convertRow )
     {
-      // move past the padding.
-      if( fseek(fp, padding, SEEK_CUR) )
-      {
-        DALI_LOG_ERROR("Error moving past BMP_BITFIELDS32 padding\n");
-      }
+      convertRow( pixelsPtr, rowStride );
     }
+    offset += rowStride + padding;
   }
-  return true;
+  return height;
 }
 
 /**
- * function to decode format BI_BITFIELDS & bpp = 16 & R:G:B = 5:6:5
- * @param[in]  fp      The file to read from
- * @param[out] pixels  The pointer that  we want to store bmp data  in
- * @param[in]  width   bmp width
- * @param[in]  height  bmp height
- * @param[in]  offset  offset from bmp header to bmp image data
- * @param[in]  topDown indicate image data is read from bottom or from top
- * @return true, if decode successful, false otherwise
+ * Swap the blue and red of a row of 24 bit pixels, as BGR888 isn't supported by dali-core.
  */
-bool DecodeBF565(FILE *fp,
-                 unsigned char* pixels,
-                 unsigned int width,
-                 unsigned int height,
-                 unsigned int offset,
-                 bool topDown)
+void SwapRedAndBlue24( unsigned char* row, unsigned int rowStride )
 {
-  if(fp == NULL || pixels == NULL)
-  {
-    DALI_LOG_ERROR("Error decoding RGB565 format\n");
-    return false;
-  }
-  if( fseek(fp, offset, SEEK_SET) )
-  {
-    DALI_LOG_ERROR("Error seeking RGB565 data\n");
-    return false;
-  }
-
-  width = ((width & 3) != 0) ? width + 4 - (width & 3) : width;
-  unsigned int rowStride = width * 2;
-
-  for(unsigned int i = 0; i < height; i++)
-  {
-    unsigned char* pixelsPtr = NULL;
-    if (topDown)
-    {
-      // the data in the file is top down, and we store the data top down
-      pixelsPtr = pixels + ( i * rowStride);
-    }
-    else
-    {
-      // the data in the file is bottom up, and we store the data top down
-      pixelsPtr = pixels + (((height - 1) - i) * rowStride);
-    }
-    if(fread(pixelsPtr, 1, rowStride, fp) != rowStride)
-    {
-      return false;
-    }
-  }
+  Internal::Adaptor::SwapRedAndBlue( row, 3u, rowStride / 3u );
+}
 
-  return true;
+/**
+ * Swap the blue and red of a row of 32 bit pixels.
+ */
+void SwapRedAndBlue32( unsigned char* row, unsigned int rowStride )
+{
+  Internal::Adaptor::SwapRedAndBlue( row, 4u, rowStride / 4u );
 }
 
 /**
- * function to decode format BI_BITFIELDS & bpp = 16 & R:G:B = 5:5:5
- * @param[in]  fp      The file to read from
- * @param[out] pixels  The pointer that  we want to store bmp data  in
- * @param[in]  width   bmp width
- * @param[in]  height  bmp height
- * @param[in]  offset  offset from bmp header to bmp image data
- * @param[in]  topDown indicate image data is read from bottom or from top
+ * function to decode format BI_BITFIELDS & bpp = 16 & R:G:B = 5:6:5
+ * @param[in]  file     The BMP file
+ * @param[in]  fileSize The size of the file in bytes
+ * @param[out] pixels   The pointer that  we want to store bmp data  in
+ * @param[in]  width    bmp width
+ * @param[in]  height   bmp height
+ * @param[in]  offset   offset from bmp header to bmp image data
+ * @param[in]  topDown  indicate image data is read from bottom or from top
  * @return true, if decode successful, false otherwise
  */
-bool DecodeBF555(FILE *fp,
+bool DecodeBF565(const unsigned char* file,
+                 std::size_t fileSize,
                  unsigned char* pixels,
                  unsigned int width,
                  unsigned int height,
                  unsigned int offset,
                  bool topDown)
 {
-  if(fp == NULL || pixels == NULL)
-  {
-    DALI_LOG_ERROR("Error decoding BMP_BITFIELDS555 format\n");
-    return false;
-  }
-
-  if( fseek(fp, offset, SEEK_SET) )
-  {
-    DALI_LOG_ERROR("Error seeking BMP_BITFIELDS555 data\n");
-    return false;
-  }
-
   width = ((width & 3) != 0) ? width + 4 - (width & 3) : width;
+  unsigned int rowStride = width * 2;
 
-  std::vector<char> raw(width * height * 2);
-  unsigned int rawStride = width * 2;
-  unsigned int rowStride = width * 3;
-
-  char *rawPtr = NULL;
-  for(unsigned int j = 0; j <  height; j ++)
-  {
-    rawPtr = &raw[0] + ( j * rawStride);
-    if(fread(rawPtr, 1, rawStride, fp) != rawStride)
-    {
-      return false;
-    }
-  }
-
-  for (unsigned int yPos = 0; yPos < height; yPos++)
-  {
-    unsigned char* pixelsPtr = NULL;
-    if (topDown)
-    {
-      // the data in the file is top down, and we store the data top down
-      pixelsPtr = pixels + ( yPos * rowStride);
-    }
-    else
-    {
-      // the data in the file is bottom up, and we store the data top down
-      pixelsPtr = pixels + (((height-1)-yPos) * rowStride);
-    }
-
-    for(unsigned int k = 0; k < width; k ++)
-    {
-      int index = yPos * rawStride + 2 * k;
-      pixelsPtr[3 * k] = ((raw[ index + 1] >> 2) & 0x1F) * 0xFF / 0x1F;
-      pixelsPtr[3 * k + 1] = (((raw[index + 1] & 0x03) << 3) | (raw[ index] >> 5))  * 0xFF/ 0x1F;
-      pixelsPtr[3 * k + 2] = (raw[ index] & 0x1F) * 0xFF / 0x1F;
-    }
-  }
-  return true;
+  return CopyRows( file, fileSize, pixels, height, offset, topDown, rowStride, 0u, nullptr ) == height;
 }
 
 /**
- * function to decode format BI_RGB & bpp = 16 & R:G:B = 5:5:5
- * @param[in]  fp      The file to read from
- * @param[out] pixels  The pointer that  we want to store bmp data  in
- * @param[in]  width   bmp width
- * @param[in]  height  bmp height
- * @param[in]  offset  offset from bmp header to bmp image data
- * @param[in]  topDown indicate image data is read from bottom or from top
+ * function to decode format BI_RGB or BI_BITFIELDS & bpp = 16 & R:G:B = 5:5:5
+ * @param[in]  file     The BMP file
+ * @param[in]  fileSize The size of the file in bytes
+ * @param[out] pixels   The pointer that  we want to store bmp data  in
+ * @param[in]  width    bmp width
+ * @param[in]  height   bmp height
+ * @param[in]  offset   offset from bmp header to bmp image data
+ * @param[in]  topDown  indicate image data is read from bottom or from top
  * @return true, if decode successful, false otherwise
  */
-bool DecodeRGB555(FILE *fp,
+bool DecodeRGB555(const unsigned char* file,
+                  std::size_t fileSize,
                   unsigned char* pixels,
                   unsigned int width,
                   unsigned int height,
                   unsigned int offset,
                   bool topDown)
 {
-  if(fp == NULL || pixels == NULL)
-  {
-    DALI_LOG_ERROR("Error decoding BMP_RGB555 format\n");
-    return false;
-  }
-  if( fseek(fp, offset, SEEK_SET) )
-  {
-    DALI_LOG_ERROR("Error seeking BMP_RGB555 data\n");
-    return false;
-  }
-
   width = ((width & 3) != 0) ? width + 4 - (width & 3) : width;
-  std::vector<char> raw(width * height * 2);
   unsigned int rawStride = width * 2;
   unsigned int rowStride = width * 3;
 
-  char *rawPtr = NULL;
-  for(unsigned int j = 0; j <  height; j ++)
-  {
-    rawPtr = &raw[0] + ( j * rawStride);
-    if(fread(rawPtr, 1, rawStride, fp) != rawStride)
-    {
-      return false;
-    }
-  }
-  for(unsigned int i = 0; i < height; i++)
-  {
-    unsigned char* pixelsPtr = NULL;
-    if (topDown)
-    {
-      // the data in the file is top down, and we store the data top down
-      pixelsPtr = pixels + ( i * rowStride);
-    }
-    else
-    {
-      // the data in the file is bottom up, and we store the data top down
-      pixelsPtr = pixels + (((height - 1) - i) * rowStride);
-    }
-    for(unsigned int k = 0; k < width; k ++)
-    {
-      int index = i * rawStride + 2 * k;
-      pixelsPtr[3 * k] = ((raw[ index + 1] >> 2) & 0x1F) * 0xFF / 0x1F;
-      pixelsPtr[3 * k + 1] = (((raw[index + 1] & 0x03) << 3) | (raw[ index] >> 5))  * 0xFF/ 0x1F;
-      pixelsPtr[3 * k + 2] = (raw[ index] & 0x1F) * 0xFF / 0x1F;
-    }
-
-  }
-  return true;
-}
-
-/**
- * function to decode format BI_RGB & bpp = 1
- * @param[in]  fp      The file to read from
- * @param[out] pixels  The pointer that  we want to store bmp data  in
- * @param[in]  width   bmp width
- * @param[in]  height  bmp height
- * @param[in]  offset  offset from bmp header to bmp palette data
- * @param[in]  topDown indicate image data is read from bottom or from top
- * @return true, if decode successful, false otherwise
- */
-bool DecodeRGB1(FILE *fp,
-                unsigned char* pixels,
-                unsigned int width,
-                unsigned int height,
-                unsigned int offset,
-                bool topDown)
-{
-  if(fp == NULL || pixels == NULL)
-  {
-    DALI_LOG_ERROR("Error decoding BMP_RGB1 format\n");
-    return false;
-  }
-  if( fseek(fp, offset, SEEK_SET) )
-  {
-    DALI_LOG_ERROR("Error seeking BMP_RGB1 data\n");
-    return false;
-  }
-
-  unsigned char colorTable[8] = {0};
-  char cmd;
-  unsigned int fillw = ((width & 63) != 0) ? width + 64 - (width & 63) : width;
-  std::vector<char> colorIndex(fillw * height);
-  unsigned int rowStride = fillw * 3; // RGB
-
-
-  if(fread(colorTable, 1, 8, fp) != 8)
+  if( !IsInFile( fileSize, offset, static_cast<std::size_t>( rawStride ) * height ) )
   {
+    DALI_LOG_ERROR("Error reading the BMP image\n");
     return false;
   }
 
-  for(unsigned int i = 0; i < fillw * height; i += 8)
+  for(unsigned int yPos = 0; yPos < height; yPos++)
   {
-    if(fread(&cmd, 1, 1, fp) != 1)
-    {
-      return false;
-    }
-
-    colorIndex[i]     = (cmd >> 7) & 0x01;
-    colorIndex[i + 1] = (cmd >> 6) & 0x01;
-    colorIndex[i + 2] = (cmd >> 5) & 0x01;
-    colorIndex[i + 3] = (cmd >> 4) & 0x01;
-    colorIndex[i + 4] = (cmd >> 3) & 0x01;
-    colorIndex[i + 5] = (cmd >> 2) & 0x01;
-    colorIndex[i + 6] = (cmd >> 1) & 0x01;
-    colorIndex[i + 7] = (cmd & 0x01);
-  }
-
-  for(unsigned int index = 0; index < height; index = index + 1)
-  {
-    unsigned char* pixelsPtr = NULL;
-    if (topDown)
-    {
-      // the data in the file is top down, and we store the data top down
-      pixelsPtr = pixels + ( index * rowStride);
-    }
-    else
-    {
-      // the data in the file is bottom up, and we store the data top down
-      pixelsPtr = pixels + (((height - 1) - index) * rowStride);
-    }
-    for(unsigned int j = 0; j < fillw; j ++)
-    {
-      unsigned int ctIndex = 0;
-      if((fillw * index + j ) < (fillw * height))
-      {
-        ctIndex = colorIndex[ fillw * index + j ];
-      }
-      else
-      {
-        break;
-      }
-      // temp solution for PLM bug P130411-5268, there is one mono bmp that cause DecodeRGB1 API crash.
-      if( ((3 * j + 2) < height * fillw * 3) && (ctIndex < 2))
-      {
-        pixelsPtr[ 3 * j ] = colorTable[4 * ctIndex + 2];
-        pixelsPtr[3 * j + 1] = colorTable[4 * ctIndex + 1];
-        pixelsPtr[3 * j + 2] = colorTable[4 * ctIndex ];
-      }
-    }
+    // the data in the file may be bottom up, but we store the data top down
+    unsigned char* const pixelsPtr = pixels + ( topDown ? yPos : ( height - 1 ) - yPos ) * rowStride;
+    Internal::Adaptor::ConvertRGB555ToRGB888( file + offset + yPos * rawStride, pixelsPtr, width );
   }
   return true;
 }
 
 /**
- * function to decode format BI_RGB & bpp = 4
- * @param[in]  fp      The file to read from
- * @param[out] pixels  The pointer that  we want to store bmp data  in
- * @param[in]  width   bmp width
- * @param[in]  height  bmp height
- * @param[in]  offset  offset from bmp header to bmp palette data
- * @param[in]  topDown indicate image data is read from bottom or from top
+ * function to decode formats BI_RGB & bpp = 1, 4 or 8, whose colour table is followed by the colour indices.
+ * @param[in]  file         The BMP file
+ * @param[in]  fileSize     The size of the file in bytes
+ * @param[out] pixels       The pointer that  we want to store bmp data  in
+ * @param[in]  width        bmp width, padded to the width of the pixel buffer
+ * @param[in]  height       bmp height
+ * @param[in]  offset       offset from bmp header to bmp palette data
+ * @param[in]  topDown      indicate image data is read from bottom or from top
+ * @param[in]  bitsPerIndex bits per colour index: 1, 4 or 8
  * @return true, if decode successful, false otherwise
  */
-bool DecodeRGB4(FILE *fp,
-                unsigned char* pixels,
-                unsigned int width,
-                unsigned int height,
-                unsigned int offset,
-                bool topDown)
+bool DecodeColorIndices(const unsigned char* file,
+                        std::size_t fileSize,
+                        unsigned char* pixels,
+                        unsigned int width,
+                        unsigned int height,
+                        unsigned int offset,
+                        bool topDown,
+                        unsigned int bitsPerIndex)
 {
-  if(fp == NULL || pixels == NULL)
-  {
-    DALI_LOG_ERROR("Error decoding BMP_RGB4 format\n");
-    return false;
-  }
-  if( fseek(fp, offset, SEEK_SET) )
-  {
-    DALI_LOG_ERROR("Error seeking BMP_RGB4 data\n");
-    return false;
-  }
-
-  char colorTable[64];
-  char cmd;
-  unsigned int fillw = ((width & 3) != 0) ? width + 4 - (width & 3) : width;
-  std::vector<char> colorIndex(fillw * height);
-  unsigned int rowStride = fillw  * 3;
+  const unsigned int numColors = 1u << bitsPerIndex;
+  const unsigned int indexStride = width * bitsPerIndex / 8;
+  unsigned int rowStride = width * 3; // RGB
 
-  if(fread(colorTable, 1, 64, fp) != 64)
+  if( !IsInFile( fileSize, offset, numColors * 4 + static_cast<std::size_t>( indexStride ) * height ) )
   {
+    DALI_LOG_ERROR("Error reading the BMP image\n");
     return false;
   }
 
-  for(unsigned int i = 0; i < fillw * height; i += 2)
-  {
-    if (fread(&cmd, 1, 1, fp) != 1)
-    {
-      return false;
-    }
-
-    colorIndex[i] = cmd >> 4;
-    colorIndex[i + 1] = cmd & (0x0F);
-  }
-  unsigned int ctIndex = 0;
+  unsigned char colorTable[256 * 3];
+  ReadColorTable( file + offset, numColors, colorTable );
+  const unsigned char* const indices = file + offset + numColors * 4;
 
-  for(unsigned int index = 0; index < height; index = index + 1)
+  for(unsigned int index = 0; index < height; index++)
   {
-    unsigned char* pixelsPtr = NULL;
-    if (topDown)
-    {
-      // the data in the file is top down, and we store the data top down
-      pixelsPtr = pixels + ( index * rowStride);
-    }
-    else
-    {
-      // the data in the file is bottom up, and we store the data top down
-      pixelsPtr = pixels + (((height - 1) - index) * rowStride);
-    }
-    for(unsigned int j = 0; j < fillw; j ++)
-    {
-      ctIndex = colorIndex[ fillw * index + j ];
-      pixelsPtr[ 3 * j ] = colorTable[4 * ctIndex + 2];
-      pixelsPtr[(3 * j + 1)] = colorTable[4 * ctIndex + 1];
-      pixelsPtr[(3 * j + 2)] = colorTable[4 * ctIndex ];
-    }
+    // the data in the file may be bottom up, but we store the data top down
+    unsigned char* const pixelsPtr = pixels + ( topDown ? index : ( height - 1 ) - index ) * rowStride;
+    ExpandColorIndices( indices + index * indexStride, bitsPerIndex, width, colorTable, pixelsPtr );
   }
-
   return true;
 }
 
 /**
- * function to decode format BI_RGB & bpp = 8
- * @param[in]  fp      The file to read from
- * @param[out] pixels  The pointer that  we want to store bmp data  in
- * @param[in]  width   bmp width
- * @param[in]  height  bmp height
- * @param[in]  offset  offset from bmp header to bmp palette data
- * @param[in]  topDown indicate image data is read from bottom or from top
+ * function to decode format BI_RLE4 & bpp = 4
+ * @param[in]  file     The BMP file
+ * @param[in]  fileSize The size of the file in bytes
+ * @param[out] pixels   The pointer that  we want to store bmp data  in
+ * @param[in]  width    bmp width
+ * @param[in]  height   bmp height
+ * @param[in]  offset   offset from bmp header to bmp palette data
  * @return true, if decode successful, false otherwise
  */
-bool DecodeRGB8(FILE *fp,
+bool DecodeRLE4(const unsigned char* file,
+                std::size_t fileSize,
                 unsigned char* pixels,
                 unsigned int width,
                 unsigned int height,
-                unsigned int offset,
-                bool topDown)
+                unsigned int offset)
 {
-  if(fp == NULL || pixels == NULL)
-  {
-    DALI_LOG_ERROR("Error decoding BMP_RGB8 format\n");
-    return false;
-  }
-  if( fseek(fp, offset, SEEK_SET) )
-  {
-    DALI_LOG_ERROR("Error seeking BMP_RGB8 data\n");
-    return false;
-  }
-
-  std::vector<char> colorTable(1024);
   width = ((width & 3) != 0) ? width + 4 - (width & 3) : width;
-  char cmd;
-  std::vector<char> colorIndex(width * height);
-  unsigned int rowStride = width * 3;//RGB8->RGB24
+  const unsigned int pixelWidth = width;
+  std::vector<unsigned char> colorIndex(width * height >> 1);
+  unsigned int x = 0;
+  unsigned int y = 0;
+  width += (width & 1);
+  width = width >> 1;
 
-  if(fread(&colorTable[0], 1, 1024, fp) != 1024)
-  {
-    return false;
-  }
-  for(unsigned int i = 0; i < width * height; i ++)
+  // Runs which would be written outside the image are dropped:
+  auto setIndexByte = [&]( unsigned int position, unsigned char value )
   {
-    if (fread(&cmd, 1, 1, fp) != 1)
+    if( position < colorIndex.size() )
     {
-      return false;
+      colorIndex[position] = value;
     }
-
-    colorIndex[i] = cmd;
-  }
-  unsigned int ctIndex = 0;
-  for(unsigned int index = 0; index < height; index = index + 1)
+  };
+  auto orIndexByte = [&]( unsigned int position, unsigned char value )
   {
-    unsigned char* pixelsPtr = NULL;
-    if (topDown)
-    {
-      // the data in the file is top down, and we store the data top down
-      pixelsPtr = pixels + ( index * rowStride);
-    }
-    else
+    if( position < colorIndex.size() )
     {
-      // the data in the file is bottom up, and we store the data top down
-      pixelsPtr = pixels + (((height - 1) - index) * rowStride);
+      colorIndex[position] |= value;
     }
-    for(unsigned int j = 0; j < width; j ++)
-    {
-      ctIndex = colorIndex[ width * index + j ];
-      pixelsPtr[ 3 * j ] = colorTable[4 * ctIndex + 2];
-      pixelsPtr[(3 * j + 1)] = colorTable[4 * ctIndex + 1];
-      pixelsPtr[(3 * j + 2)] = colorTable[4 * ctIndex ];
-    }
-  }
-  return true;
-}
+  };
 
-/**
- * function to decode format BI_RLE4 & bpp = 4
- * @param[in]  fp      The file to read from
- * @param[out] pixels  The pointer that  we want to store bmp data  in
- * @param[in]  width   bmp width
- * @param[in]  height  bmp height
- * @param[in]  offset  offset from bmp header to bmp palette data
- * @param[in]  topDown indicate image data is read from bottom or from top
- * @return true, if decode successful, false otherwise
- */
-bool DecodeRLE4(FILE *fp,
-                unsigned char* pixels,
-                unsigned int width,
-                unsigned int height,
-                unsigned int offset,
-                bool topDown)
-{
-  if(fp == NULL || pixels == NULL)
+  if( !IsInFile( fileSize, offset, 64 ) )
   {
-    DALI_LOG_ERROR("Error decoding BMP_RLE4 format\n");
     return false;
   }
-  unsigned char* pixelsPtr = pixels;
-  width = ((width & 3) != 0) ? width + 4 - (width & 3) : width;
-  char cmd[2];
-  unsigned int cmdStride = 2;
-  char colorTable[64];
-  std::vector<char> colorIndex(width * height >> 1);
-  std::vector<char> run;
-  unsigned int x = 0;
-  unsigned int y = 0;
-  unsigned int dx = 0;
-  unsigned int dy = 0;
-  width += (width & 1);
-  width = width >> 1;
+  unsigned char colorTable[16 * 3];
+  ReadColorTable( file + offset, 16, colorTable );
+  std::size_t position = offset + 64;
 
   bool finish = false;
-
-  if( fseek(fp, offset, SEEK_SET) )
-  {
-    DALI_LOG_ERROR("Error seeking BMP_RLE4 data\n");
-    return false;
-  }
-
-  if (fread(colorTable, 1, 64, fp) != 64)
-  {
-    return false;
-  }
-
-  while((x >> 1) + y * width < width * height)
+  while(!finish && (x >> 1) + y * width < width * height)
   {
-    if (finish)
-    {
-      break;
-    }
-    if (fread(cmd, 1, cmdStride, fp) != cmdStride)
+    if( !IsInFile( fileSize, position, 2 ) )
     {
       return false;
     }
+    const unsigned char* const cmd = file + position;
+    position += 2;
+
     if(cmd[0] == 0) // ESCAPE
     {
       switch(cmd[1])
@@ -820,37 +470,40 @@ bool DecodeRLE4(FILE *fp,
           y ++;
           break;
         case 2: // delta
-          if (fread(cmd, 1, cmdStride, fp) != cmdStride)
+          if( !IsInFile( fileSize, position, 2 ) )
           {
             DALI_LOG_ERROR("Error reading the BMP image\n");
             return false;
           }
-          dx = cmd[0] & (0xFF);
-          dy = cmd[1] & (0xFF);
-          x += dx;
-          y += dy;
+          x += file[position];
+          y += file[position + 1];
+          position += 2;
           break;
         default:
+        {
           // decode a literal run
-          unsigned int length = cmd[1] & (0xFF);
+          unsigned int length = cmd[1];
           //size of run, which is word aligned
           unsigned int bytesize = length;
           bytesize += (bytesize & 1);
           bytesize >>= 1;
           bytesize += (bytesize & 1);
-          run.resize(bytesize);
-          if(fread(&run[0], 1, bytesize, fp) != bytesize)
+          if( !IsInFile( fileSize, position, bytesize ) )
           {
             DALI_LOG_ERROR("Error reading the BMP image\n");
             return false;
           }
+          const unsigned char* const run = file + position;
+          position += bytesize;
+
+          const unsigned int rowStart = width * (height - y - 1);
           if((x & 1) == 0)
           {
             length += (length & 1);
             length >>= 1;
             for(unsigned int i = 0; i < length; i += 1)
             {
-              colorIndex[(x >> 1) + width * (height - y - 1) + i] = run[i];
+              setIndexByte( (x >> 1) + rowStart + i, run[i] );
             }
           }
           else
@@ -859,28 +512,30 @@ bool DecodeRLE4(FILE *fp,
             {
               if((i & 1) == 0)//copy high to low
               {
-                colorIndex[((x + i) >> 1) + width * (height - y - 1)] |= ((run[i >> 1] & 0xF0) >> 4);
+                orIndexByte( ((x + i) >> 1) + rowStart, (run[i >> 1] & 0xF0) >> 4 );
               }
               else //copy low to high
               {
-                colorIndex[((x + i) >> 1) + width * (height - y - 1)] |= ((run[i >> 1] & 0x0F) << 4);
+                orIndexByte( ((x + i) >> 1) + rowStart, (run[i >> 1] & 0x0F) << 4 );
               }
             }
           }
-          x += cmd[1] & (0xFF);
+          x += cmd[1];
           break;
+        }
       }
     }
     else
     {
-      unsigned int length = cmd[0] & (0xFF);
+      unsigned int length = cmd[0];
+      const unsigned int rowStart = width * (height - y - 1);
       if((x & 1) == 0)
       {
         length += (length & 1);
         length >>= 1;
         for(unsigned int i = 0; i < length; i ++)
         {
-          colorIndex[(height-y-1)*width + i + (x >> 1)] = cmd[1];
+          setIndexByte( rowStart + i + (x >> 1), cmd[1] );
         }
       }
       else
@@ -889,93 +544,71 @@ bool DecodeRLE4(FILE *fp,
         {
           if((i & 1) == 0)
           {
-            colorIndex[((x + i) >> 1) + width * (height - y - 1)] |= ((cmd[1] & 0xF0) >> 4);
+            orIndexByte( ((x + i) >> 1) + rowStart, (cmd[1] & 0xF0) >> 4 );
           }
           else
           {
-            colorIndex[((x + i) >> 1) + width * (height - y - 1)] |= ((cmd[1] & 0x0F) << 4);
+            orIndexByte( ((x + i) >> 1) + rowStart, (cmd[1] & 0x0F) << 4 );
           }
         }
       }
-      x += cmd[0] & (0xFF);
+      x += cmd[0];
     }
   }
 
-  int ctIndexHigh = 0;
-  int ctIndexLow = 0;
-  for(unsigned int index = 0; index < (width * height ); index = index + 1)
-  {
-    ctIndexHigh = colorIndex[ index] >> 4;
-    ctIndexLow = colorIndex[index] & (0x0F);
-    pixelsPtr[6 * index ] = colorTable[4 * ctIndexHigh + 2];
-    pixelsPtr[6 * index + 1] = colorTable[4 * ctIndexHigh + 1];
-    pixelsPtr[6 * index + 2] = colorTable[4 * ctIndexHigh ];
-    pixelsPtr[6 * index + 3] = colorTable[4 * ctIndexLow + 2];
-    pixelsPtr[6 * index + 4] = colorTable[4 * ctIndexLow + 1];
-    pixelsPtr[6 * index + 5] = colorTable[4 * ctIndexLow ];
-  }
+  ExpandColorIndices( colorIndex.data(), 4, pixelWidth * height, colorTable, pixels );
   return true;
 }
 
 /**
  * function to decode format BI_RLE8 & bpp = 8
- * @param[in]  fp      The file to read from
- * @param[out] pixels  The pointer that  we want to store bmp data  in
- * @param[in]  width   bmp width
- * @param[in]  height  bmp height
- * @param[in]  offset  offset from bmp header to bmp palette data
- * @param[in]  topDown indicate image data is read from bottom or from top
+ * @param[in]  file     The BMP file
+ * @param[in]  fileSize The size of the file in bytes
+ * @param[out] pixels   The pointer that  we want to store bmp data  in
+ * @param[in]  width    bmp width
+ * @param[in]  height   bmp height
+ * @param[in]  offset   offset from bmp header to bmp palette data
  * @return true, if decode successful, false otherwise
  */
-bool DecodeRLE8(FILE *fp,
+bool DecodeRLE8(const unsigned char* file,
+                std::size_t fileSize,
                 unsigned char* pixels,
                 unsigned int width,
                 unsigned int height,
-                unsigned int offset,
-                bool topDown)
+                unsigned int offset)
 {
-  if(fp == NULL || pixels == NULL)
-  {
-    DALI_LOG_ERROR("Error decoding BMP_RLE8 format\n");
-    return false;
-  }
-  unsigned char* pixelsPtr = pixels;
   unsigned int x = 0;
   unsigned int y = 0;
-  unsigned int cmdStride = 2;
 
   width = ((width & 3) != 0) ? width + 4 - (width & 3) : width;
-  std::vector<char> colorTable(1024);
-  char cmd[2];
-  std::vector<char> colorIndex(width * height);
+  std::vector<unsigned char> colorIndex(width * height);
 
-  if( fseek(fp, offset, SEEK_SET) )
+  // Runs which would be written outside the image are dropped:
+  auto setIndex = [&]( unsigned int position, unsigned char value )
   {
-    DALI_LOG_ERROR("Error seeking BMP_RLE8 data\n");
-    return false;
-  }
+    if( position < colorIndex.size() )
+    {
+      colorIndex[position] = value;
+    }
+  };
 
-  if (fread(&colorTable[0], 1, 1024, fp) != 1024)
+  if( !IsInFile( fileSize, offset, 1024 ) )
   {
     return false;
   }
+  unsigned char colorTable[256 * 3];
+  ReadColorTable( file + offset, 256, colorTable );
+  std::size_t position = offset + 1024;
 
-  unsigned int dx = 0;
-  unsigned int dy = 0;
   bool finish = false;
-  unsigned int length = 0;
-  unsigned int copylength = 0;
-  std::vector<char> run;
-  while((x + y * width) < width * height )
+  while(!finish && (x + y * width) < width * height )
   {
-    if (finish)
-    {
-      break;
-    }
-    if (fread(cmd, 1, cmdStride, fp) != cmdStride)
+    if( !IsInFile( fileSize, position, 2 ) )
     {
       return false;
     }
+    const unsigned char* const cmd = file + position;
+    position += 2;
 
     if(cmd[0] == 0)//ESCAPE
     {
@@ -989,24 +622,22 @@ bool DecodeRLE8(FILE *fp,
           y ++;
           break;
         case 2: // delta
-          if (fread(cmd, 1, cmdStride, fp) != cmdStride)
+          if( !IsInFile( fileSize, position, 2 ) )
           {
             DALI_LOG_ERROR("Error reading the BMP image\n");
             return false;
           }
-          dx = cmd[0] & (0xFF);
-          dy = cmd[1] & (0xFF);
-          x += dx;
-          y += dy;
+          x += file[position];
+          y += file[position + 1];
+          position += 2;
           break;
         default:
+        {
           //decode a literal run
-          length = cmd[1] & (0xFF);
-          copylength = length;
+          const unsigned int copylength = cmd[1];
           //absolute mode must be word-aligned
-          length += (length & 1);
-          run.resize(length);
-          if(fread(&run[0], 1, length, fp) != length)
+          const unsigned int length = copylength + (copylength & 1);
+          if( !IsInFile( fileSize, position, length ) )
           {
             DALI_LOG_ERROR("Error reading the BMP image\n");
             return false;
@@ -1014,30 +645,26 @@ bool DecodeRLE8(FILE *fp,
 
           for(unsigned int i = 0; i < length; i += 1)
           {
-            colorIndex[x + width * (height - y - 1) + i] = run[i];
+            setIndex( x + width * (height - y - 1) + i, file[position + i] );
           }
+          position += length;
           x += copylength;
           break;
+        }
       }
     }// end if cmd[0] ==
     else
     {
-      length = cmd[0] & (0xFF);
+      const unsigned int length = cmd[0];
       for(unsigned int i = 0; i < length; i ++)
       {
-        colorIndex[(height - y - 1) * width + x] = cmd[1];
+        setIndex( (height - y - 1) * width + x, cmd[1] );
         x++;
       }
     }
   }
-  int ctIndex = 0;
-  for(unsigned int index = 0; index < width * height; index = index + 1)
-  {
-    ctIndex = colorIndex[ index];
-    pixelsPtr[3 * index ] = colorTable[4 * ctIndex + 2];
-    pixelsPtr[3 * index + 1] = colorTable[4 * ctIndex + 1];
-    pixelsPtr[3 * index + 2] = colorTable[4 * ctIndex ];
-  }
+
+  ExpandColorIndices( colorIndex.data(), 8, width * height, colorTable, pixels );
   return true;
 }
 
@@ -1074,6 +701,16 @@ bool LoadBitmapFromBmp( const Dali::ImageLoader::Input& input, Dali::Devel::Pixe
       return false;
   }
 
+  // Decode from the whole file in memory rather than reading it a row or a byte at a time:
+  Internal::Platform::MappedFile mappedFile;
+  std::vector<unsigned char> fileBuffer;
+  const unsigned char* file = nullptr;
+  std::size_t fileSize = 0u;
+  if( !ReadBmpFile( fp, mappedFile, fileBuffer, file, fileSize ) )
+  {
+    return false;
+  }
+
   Pixel::Format pixelFormat = Pixel::RGB888;
   switch(infoHeader.compression)
   {
@@ -1135,16 +772,12 @@ bool LoadBitmapFromBmp( const Dali::ImageLoader::Input& input, Dali::Devel::Pixe
     {
       if(infoHeader.bitsPerPixel == 16)
       {
-        if( fseek(fp, 14 + infoHeader.infoHeaderSize + 1, SEEK_SET) )
+        if( !IsInFile( fileSize, 14 + infoHeader.infoHeaderSize + 1, 1 ) )
         {
           return false;
         }
 
-        char mask;
-        if(fread(&mask, 1, 1, fp) != 1)
-        {
-          return false;
-        }
+        const unsigned char mask = file[14 + infoHeader.infoHeaderSize + 1];
 
         if((mask & 0x80) == MaskForBFRGB565) // mask is 0xF8
         {
@@ -1253,109 +886,66 @@ bool LoadBitmapFromBmp( const Dali::ImageLoader::Input& input, Dali::Devel::Pixe
   bitmap = Dali::Devel::PixelBuffer::New(pixelBufferW, pixelBufferH, newPixelFormat);
   auto pixels = bitmap.GetBuffer();
 
-  // Read the raw bitmap data
-  decltype(pixels) pixelsIterator = nullptr;
-
+  // Decode the raw bitmap data
+  const unsigned int paletteOffset = 14 + infoHeader.infoHeaderSize;
   bool decodeResult(false);
   switch(customizedFormat)
   {
     case BMP_RGB1:
     {
-      decodeResult = DecodeRGB1( fp, pixels, infoHeader.width, abs(infoHeader.height), 14 + infoHeader.infoHeaderSize, topDown);
+      decodeResult = DecodeColorIndices(file, fileSize, pixels, pixelBufferW, height, paletteOffset, topDown, 1);
       break;
     }
     case BMP_RGB4:
     {
-      decodeResult = DecodeRGB4(fp, pixels, infoHeader.width, abs(infoHeader.height), 14 + infoHeader.infoHeaderSize, topDown);
+      decodeResult = DecodeColorIndices(file, fileSize, pixels, pixelBufferW, height, paletteOffset, topDown, 4);
       break;
     }
-    case BMP_RLE4:
+    case BMP_RGB8:
     {
-      decodeResult = DecodeRLE4( fp, pixels, infoHeader.width, abs(infoHeader.height), 14 + infoHeader.infoHeaderSize, topDown);
+      decodeResult = DecodeColorIndices(file, fileSize, pixels, pixelBufferW, height, paletteOffset, topDown, 8);
       break;
     }
-    case BMP_BITFIELDS32:
+    case BMP_RLE4:
     {
-      decodeResult = DecodeBF32(fp, pixels, infoHeader.width,  abs(infoHeader.height), fileHeader.offset, topDown, rowStride, padding);
+      decodeResult = DecodeRLE4(file, fileSize, pixels, infoHeader.width, height, paletteOffset);
       break;
     }
-    case BMP_BITFIELDS555:
+    case BMP_RLE8:
     {
-      decodeResult = DecodeBF555(fp, pixels,infoHeader.width,  abs(infoHeader.height), fileHeader.offset, topDown);
+      decodeResult = DecodeRLE8(file, fileSize, pixels, infoHeader.width, height, paletteOffset);
       break;
     }
+    case BMP_BITFIELDS555:
     case BMP_RGB555:
     {
-      decodeResult = DecodeRGB555(fp, pixels, infoHeader.width, abs(infoHeader.height), fileHeader.offset, topDown);
-      break;
-    }
-    case BMP_RGB8:
-    {
-      decodeResult = DecodeRGB8(fp, pixels, infoHeader.width, abs(infoHeader.height), 14 + infoHeader.infoHeaderSize, topDown);
-      break;
-    }
-    case BMP_RLE8:
-    {
-      decodeResult = DecodeRLE8(fp, pixels, infoHeader.width, abs(infoHeader.height), 14 + infoHeader.infoHeaderSize, topDown);
+      decodeResult = DecodeRGB555(file, fileSize, pixels, infoHeader.width, height, fileHeader.offset, topDown);
       break;
     }
     case BMP_RGB24V5:
     {
-      decodeResult = DecodeRGB24V5(fp, pixels, infoHeader.width, abs(infoHeader.height), fileHeader.offset, topDown, rowStride, padding);
+      decodeResult = CopyRows(file, fileSize, pixels, height, fileHeader.offset, topDown, rowStride, padding, &SwapRedAndBlue24) == height;
       break;
     }
+    case BMP_BITFIELDS32:
     case BMP_BITFIELDS32V4:
     {
-      decodeResult = DecodeBF32V4(fp, pixels, infoHeader.width, abs(infoHeader.height), fileHeader.offset, topDown, rowStride, padding);
+      decodeResult = CopyRows(file, fileSize, pixels, height, fileHeader.offset, topDown, rowStride, padding, &SwapRedAndBlue32) == height;
       break;
     }
     default:
     {
       if(pixelFormat == Pixel::RGB565)
       {
-        decodeResult = DecodeBF565(fp, pixels, infoHeader.width, abs(infoHeader.height), fileHeader.offset,  topDown);
+        decodeResult = DecodeBF565(file, fileSize, pixels, infoHeader.width, height, fileHeader.offset, topDown);
       }
       else
       {
-        for (unsigned int yPos = 0; yPos < height; yPos++)
-        {
-          if (topDown)
-          {
-            // the data in the file is top down, and we store the data top down
-            pixelsIterator = pixels + ( yPos * rowStride);
-          }
-          else
-          {
-            // the data in the file is bottom up, and we store the data top down
-            pixelsIterator = pixels + (((height-1)-yPos) * rowStride);
-          }
-
-          if (fread(pixelsIterator, 1, rowStride, fp) != rowStride)
-          {
-            DALI_LOG_ERROR("Error reading the BMP image\n");
-            break;
-          }
-
-          // If 24 bit mode then swap Blue and Red pixels
-          // BGR888 doesn't seem to be supported by dali-core
-          if (infoHeader.bitsPerPixel == 24 )
-          {
-            for(unsigned int i = 0; i < rowStride; i += 3)
-            {
-              unsigned char temp = pixelsIterator[i];
-              pixelsIterator[i] = pixelsIterator[i+2];
-              pixelsIterator[i+2] = temp;
-            }
-          }
-
-          if (padding)
-          {
-            if( fseek(fp, padding, SEEK_CUR) )  // move past the padding.
-            {
-              DALI_LOG_ERROR("Error moving past BMP padding\n");
-            }
-          }
-        }
+        // If 24 bit mode then swap Blue and Red pixels
+        // BGR888 doesn't seem to be supported by dali-core
+        // A truncated file leaves the rows after the last whole one unset, as it always has:
+        CopyRows(file, fileSize, pixels, height, fileHeader.offset, topDown, rowStride, padding,
+                 infoHeader.bitsPerPixel == 24 ? &SwapRedAndBlue24 : nullptr);
         decodeResult = true;
       }
       break;
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/common/loader-dpk.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/internal/imaging/common/image-archive.h>
+#include <dali/internal/imaging/common/pixel-buffer-impl.h>
+
+namespace Dali
+{
+
+namespace TizenPlatform
+{
+
+// File loading API entry-point:
+bool LoadDpkHeader( const Dali::ImageLoader::Input& input, unsigned int& width, unsigned int& height )
+{
+  if( input.entryName.empty() )
+  {
+    // Probing for the format, there is no image to get the size of:
+    width = 0u;
+    height = 0u;
+    return Internal::Platform::ImageArchive::ReadHeader( input.file );
+  }
+
+  std::shared_ptr<const Internal::Platform::ImageArchive> archive = Internal::Platform::ImageArchive::Get( input.file );
+  Internal::Platform::ImageArchive::Entry entry;
+  if( !archive || !archive->Find( input.entryName, entry ) )
+  {
+    return false;
+  }
+
+  width = entry.width;
+  height = entry.height;
+  return true;
+}
+
+// File loading API entry-point:
+bool LoadBitmapFromDpk( const Dali::ImageLoader::Input& input, Dali::Devel::PixelBuffer& bitmap )
+{
+  std::shared_ptr<const Internal::Platform::ImageArchive> archive = Internal::Platform::ImageArchive::Get( input.file );
+  if( !archive )
+  {
+    DALI_LOG_ERROR( "Invalid image archive, or one which can't be mapped.\n" );
+    return false;
+  }
+
+  return LoadBitmapFromImageArchive( *archive, input.entryName, bitmap );
+}
+
+bool LoadBitmapFromImageArchive( const Internal::Platform::ImageArchive& archive, const std::string& entryName, Dali::Devel::PixelBuffer& bitmap )
+{
+  Internal::Platform::ImageArchive::Entry entry;
+  if( !archive.Find( entryName, entry ) )
+  {
+    DALI_LOG_ERROR( "Image archive has no image named %s\n", entryName.c_str() );
+    return false;
+  }
+
+  // The pixels are used in place, the archive stays mapped while they are:
+  Internal::Adaptor::PixelBufferPtr pixelBuffer = Internal::Adaptor::PixelBuffer::New( archive.GetMappedFile(), entry.offset, entry.size,
+                                                                                       entry.width, entry.height, entry.pixelFormat );
+  bitmap = Dali::Devel::PixelBuffer( pixelBuffer.Get() );
+  return true;
+}
+
+} // namespace TizenPlatform
+
+} // namespace Dali
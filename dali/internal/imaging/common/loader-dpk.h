@@ -0,0 +1,82 @@
+#ifndef DALI_TIZEN_PLATFORM_LOADER_DPK_H
+#define DALI_TIZEN_PLATFORM_LOADER_DPK_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdio>
+#include <string>
+#include <dali/devel-api/adaptor-framework/image-loader-input.h>
+
+namespace Dali
+{
+namespace Devel
+{
+class PixelBuffer;
+}
+
+namespace Internal
+{
+namespace Platform
+{
+class ImageArchive;
+}
+}
+
+namespace TizenPlatform
+{
+
+namespace Dpk
+{
+const unsigned char MAGIC_BYTE_1 = 'D';
+const unsigned char MAGIC_BYTE_2 = 'P';
+} // namespace Dpk
+
+/**
+ * Loads an image from an image archive, without decoding it.
+ * The image is the one named by Input::entryName. Its pixels aren't copied,
+ * the bitmap points into the archive, which is mapped.
+ * @param[in]  input  Information about the input image (including file pointer)
+ * @param[out] bitmap The bitmap class where the image will be stored
+ * @return  true if file loaded successfully, false otherwise
+ */
+bool LoadBitmapFromDpk( const Dali::ImageLoader::Input& input, Dali::Devel::PixelBuffer& bitmap );
+
+/**
+ * Loads the size of the image named by Input::entryName from an image archive.
+ * Without a name, only checks the file is an image archive.
+ * @param[in]   input   Information about the input image (including file pointer)
+ * @param[out]  width   Is set with the width of the image
+ * @param[out]  height  Is set with the height of the image
+ * @return true if the file's header was read successully, false otherwise
+ */
+bool LoadDpkHeader( const Dali::ImageLoader::Input& input, unsigned int& width, unsigned int& height );
+
+/**
+ * Loads an image from an image archive which is already open.
+ * @param[in]  archive   The archive
+ * @param[in]  entryName The name of the image in the archive
+ * @param[out] bitmap    The bitmap class where the image will be stored
+ * @return  true if the image loaded successfully, false otherwise
+ */
+bool LoadBitmapFromImageArchive( const Internal::Platform::ImageArchive& archive, const std::string& entryName, Dali::Devel::PixelBuffer& bitmap );
+
+} // namespace TizenPlatform
+
+} // namespace Dali
+
+#endif // DALI_TIZEN_PLATFORM_LOADER_DPK_H
@@ -21,6 +21,7 @@
 
 #include <dali/integration-api/debug.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/internal/imaging/common/buffer-pool.h>
 #include <memory>
 
 // We need to check if giflib has the new open and close API (including error parameter).
@@ -197,9 +198,8 @@ bool HandleImageDescriptionRecordType( Dali::Devel::PixelBuffer& bitmap, GifFile
   SavedImage* image( &gifInfo->SavedImages[ gifInfo->ImageCount - 1 ] );
   const GifImageDesc& desc( image->ImageDesc );
 
-  auto decodedData = new unsigned char[ width * height * sizeof( GifPixelType ) ];
-
-  std::unique_ptr<unsigned char[]> ptr{ decodedData };
+  Internal::Platform::PooledBuffer decodedBuffer( width * height * sizeof( GifPixelType ) );
+  unsigned char* const decodedData = decodedBuffer.Begin();
 
   const unsigned int bytesPerRow( width * sizeof( GifPixelType ) );
   const unsigned int actualWidth( desc.Width );
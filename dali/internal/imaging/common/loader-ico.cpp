@@ -57,6 +57,8 @@
 // INTERNAL INCLUDES
 #include <dali/integration-api/debug.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/internal/imaging/common/pixel-format-conversion.h>
+#include <dali/internal/imaging/common/pixel-manipulation.h>
 
 namespace Dali
 {
@@ -498,18 +500,14 @@ bool LoadBitmapFromIco( const Dali::ImageLoader::Input& input, Dali::Devel::Pixe
   {
     case 32:
     {
+      // The pixels are stored as BGRA:
       unsigned char* p = &map[position];
-      pix = &surface[0] + ( ( h - 1 ) * w );
 
       for( unsigned int i = 0; i < h; i++ )
       {
-        for( unsigned int j = 0; j < w; j++ )
-        {
-          *pix++ = ARGB_JOIN( p[3], p[0], p[1], p[2] );
-          p += 4;
-        }
-        // Move the output up 1 line (we subtract 2 lines because we moved forward one line while copying).
-        pix -= ( w * 2 );
+        pix = &surface[0] + ( ( h - 1 - i ) * w );
+        Internal::Adaptor::ConvertPixels( p, Pixel::BGRA8888, reinterpret_cast< unsigned char* >( pix ), Pixel::RGBA8888, w );
+        p += w * 4;
       }
       break;
     }
@@ -523,12 +521,9 @@ bool LoadBitmapFromIco( const Dali::ImageLoader::Input& input, Dali::Devel::Pixe
         {
           return false;
         }
-        unsigned char* p = &pixbuf[0];
-        for( unsigned int j = 0; j < w; j++ )
-        {
-          *pix++ = ARGB_JOIN( 0xff, p[0], p[1], p[2] );
-          p += 3;
-        }
+        // The pixels are stored as BGR, which has no pixel format of its own:
+        Internal::Adaptor::SwapRedAndBlue( &pixbuf[0], 3u, w );
+        Internal::Adaptor::ConvertPixels( &pixbuf[0], Pixel::RGB888, reinterpret_cast< unsigned char* >( pix ), Pixel::RGBA8888, w );
       }
       break;
     }
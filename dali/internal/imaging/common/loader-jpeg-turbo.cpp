@@ -19,10 +19,12 @@
 #include <dali/internal/imaging/common/loader-jpeg.h>
 
 // EXTERNAL HEADERS
+#include <algorithm>
 #include <functional>
 #include <array>
 #include <utility>
 #include <memory>
+#include <vector>
 #include <libexif/exif-data.h>
 #include <libexif/exif-loader.h>
 #include <libexif/exif-tag.h>
@@ -38,7 +40,9 @@
 
 // INTERNAL HEADERS
 #include <dali/internal/legacy/tizen/platform-capabilities.h>
+#include <dali/internal/imaging/common/buffer-pool.h>
 #include <dali/internal/imaging/common/image-operations.h>
+#include <dali/internal/imaging/common/mapped-file.h>
 #include <dali/devel-api/adaptor-framework/image-loading.h>
 #include <dali/internal/imaging/common/pixel-buffer-impl.h>
 
@@ -122,11 +126,235 @@ ExifHandle MakeNullExifData()
   return ExifHandle{nullptr, exif_data_free};
 }
 
-ExifHandle MakeExifDataFromData(unsigned char* data, unsigned int size)
+ExifHandle MakeExifDataFromData(const unsigned char* data, unsigned int size)
 {
   return ExifHandle{exif_data_new_from_data(data, size), exif_data_free};
 }
 
+// The EXIF block is kept by the bitmap until its metadata is asked for
+using ExifBlock = std::shared_ptr< std::vector<unsigned char> >;
+
+const unsigned char EXIF_HEADER[] = { 'E', 'x', 'i', 'f', 0, 0 };
+const unsigned int EXIF_HEADER_SIZE = sizeof( EXIF_HEADER );
+
+/**
+ * @brief Find the EXIF block of a JPEG file without decoding anything.
+ *
+ * Walks the marker segments in front of the image data looking for an APP1
+ * segment which starts with the EXIF header.
+ * @param[in] jpeg The JPEG file.
+ * @param[in] jpegSize The size of the file in bytes.
+ * @param[out] exif The start of the EXIF block, including its header.
+ * @param[out] exifSize The size of the EXIF block in bytes.
+ * @return true if the file has an EXIF block.
+ */
+bool FindExifBlock( const unsigned char* jpeg, unsigned int jpegSize, const unsigned char*& exif, unsigned int& exifSize )
+{
+  if( jpegSize < 4u || jpeg[0] != 0xFF || jpeg[1] != 0xD8 )
+  {
+    return false;
+  }
+
+  unsigned int position = 2u;
+  while( position + 4u <= jpegSize )
+  {
+    if( jpeg[position] != 0xFF )
+    {
+      return false;
+    }
+    const unsigned char marker = jpeg[position + 1u];
+    if( marker == 0xFF )
+    {
+      // Fill byte:
+      ++position;
+      continue;
+    }
+    if( marker == 0xDA || marker == 0xD9 )
+    {
+      // The metadata all comes before the start of scan:
+      return false;
+    }
+
+    const unsigned int segmentSize = ( jpeg[position + 2u] << 8 ) | jpeg[position + 3u];
+    if( segmentSize < 2u || position + 2u + segmentSize > jpegSize )
+    {
+      return false;
+    }
+
+    const unsigned char* const segment = jpeg + position + 4u;
+    const unsigned int payloadSize = segmentSize - 2u;
+    if( marker == 0xE1 && payloadSize > EXIF_HEADER_SIZE && memcmp( segment, EXIF_HEADER, EXIF_HEADER_SIZE ) == 0 )
+    {
+      exif = segment;
+      exifSize = payloadSize;
+      return true;
+    }
+    position += 2u + segmentSize;
+  }
+  return false;
+}
+
+unsigned int ReadExifValue( const unsigned char* data, unsigned int bytes, bool bigEndian )
+{
+  unsigned int value = 0u;
+  for( unsigned int i = 0u; i < bytes; ++i )
+  {
+    const unsigned int byte = data[bigEndian ? i : bytes - 1u - i];
+    value = ( value << 8 ) | byte;
+  }
+  return value;
+}
+
+/**
+ * @brief Find the TIFF header of an EXIF block, which the offsets in the block are relative to.
+ * @param[in] exif The EXIF block, including its header.
+ * @param[in] exifSize The size of the EXIF block in bytes.
+ * @param[out] tiff The TIFF header.
+ * @param[out] tiffSize The size of the block from the TIFF header on.
+ * @param[out] bigEndian Whether the values in the block are big endian.
+ * @param[out] ifdOffset The offset of the first IFD.
+ * @return false if the block isn't valid.
+ */
+bool ReadTiffHeader( const unsigned char* exif, unsigned int exifSize, const unsigned char*& tiff, unsigned int& tiffSize, bool& bigEndian, unsigned int& ifdOffset )
+{
+  if( exifSize < EXIF_HEADER_SIZE + 8u )
+  {
+    return false;
+  }
+
+  tiff = exif + EXIF_HEADER_SIZE;
+  tiffSize = exifSize - EXIF_HEADER_SIZE;
+
+  if( tiff[0] == 'M' && tiff[1] == 'M' )
+  {
+    bigEndian = true;
+  }
+  else if( tiff[0] == 'I' && tiff[1] == 'I' )
+  {
+    bigEndian = false;
+  }
+  else
+  {
+    return false;
+  }
+
+  if( ReadExifValue( tiff + 2u, 2u, bigEndian ) != 42u )
+  {
+    return false;
+  }
+
+  ifdOffset = ReadExifValue( tiff + 4u, 4u, bigEndian );
+  return ifdOffset <= tiffSize - 2u;
+}
+
+const unsigned int EXIF_ENTRY_SIZE = 12u;
+
+/**
+ * @brief Read the orientation tag from an EXIF block, leaving every other field alone.
+ * @param[in] exif The EXIF block, including its header.
+ * @param[in] exifSize The size of the EXIF block in bytes.
+ * @return The orientation, or 0 if the block has none.
+ */
+int ReadExifOrientation( const unsigned char* exif, unsigned int exifSize )
+{
+  const unsigned char* tiff = nullptr;
+  unsigned int tiffSize = 0u;
+  bool bigEndian = false;
+  unsigned int ifdOffset = 0u;
+  if( !ReadTiffHeader( exif, exifSize, tiff, tiffSize, bigEndian, ifdOffset ) )
+  {
+    return 0;
+  }
+
+  const unsigned int entryCount = ReadExifValue( tiff + ifdOffset, 2u, bigEndian );
+  for( unsigned int i = 0u; i < entryCount; ++i )
+  {
+    const unsigned int entryOffset = ifdOffset + 2u + i * EXIF_ENTRY_SIZE;
+    if( entryOffset + EXIF_ENTRY_SIZE > tiffSize )
+    {
+      break;
+    }
+    const unsigned char* const entry = tiff + entryOffset;
+    if( ReadExifValue( entry, 2u, bigEndian ) == EXIF_TAG_ORIENTATION )
+    {
+      if( ReadExifValue( entry + 2u, 2u, bigEndian ) != EXIF_FORMAT_SHORT )
+      {
+        return 0;
+      }
+      // A single short is stored at the start of the value field:
+      return static_cast<int>( ReadExifValue( entry + 8u, 2u, bigEndian ) );
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief Find the JPEG thumbnail which cameras embed in the EXIF block.
+ *
+ * The thumbnail is described by the second IFD, which follows the entries of the first.
+ * @param[in] exif The EXIF block, including its header.
+ * @param[in] exifSize The size of the EXIF block in bytes.
+ * @param[out] thumbnail The start of the thumbnail, a JPEG file of its own.
+ * @param[out] thumbnailSize The size of the thumbnail in bytes.
+ * @return true if the block has a JPEG thumbnail.
+ */
+bool FindExifThumbnail( const unsigned char* exif, unsigned int exifSize, const unsigned char*& thumbnail, unsigned int& thumbnailSize )
+{
+  const unsigned char* tiff = nullptr;
+  unsigned int tiffSize = 0u;
+  bool bigEndian = false;
+  unsigned int ifdOffset = 0u;
+  if( !ReadTiffHeader( exif, exifSize, tiff, tiffSize, bigEndian, ifdOffset ) )
+  {
+    return false;
+  }
+
+  const unsigned int entryCount = ReadExifValue( tiff + ifdOffset, 2u, bigEndian );
+  const unsigned int nextIfdPosition = ifdOffset + 2u + entryCount * EXIF_ENTRY_SIZE;
+  if( nextIfdPosition + 4u > tiffSize )
+  {
+    return false;
+  }
+
+  const unsigned int thumbnailIfdOffset = ReadExifValue( tiff + nextIfdPosition, 4u, bigEndian );
+  if( thumbnailIfdOffset == 0u || thumbnailIfdOffset > tiffSize - 2u )
+  {
+    return false;
+  }
+
+  unsigned int offset = 0u;
+  unsigned int size = 0u;
+  const unsigned int thumbnailEntryCount = ReadExifValue( tiff + thumbnailIfdOffset, 2u, bigEndian );
+  for( unsigned int i = 0u; i < thumbnailEntryCount; ++i )
+  {
+    const unsigned int entryOffset = thumbnailIfdOffset + 2u + i * EXIF_ENTRY_SIZE;
+    if( entryOffset + EXIF_ENTRY_SIZE > tiffSize )
+    {
+      break;
+    }
+    const unsigned char* const entry = tiff + entryOffset;
+    const unsigned int tag = ReadExifValue( entry, 2u, bigEndian );
+    if( tag == EXIF_TAG_JPEG_INTERCHANGE_FORMAT )
+    {
+      offset = ReadExifValue( entry + 8u, 4u, bigEndian );
+    }
+    else if( tag == EXIF_TAG_JPEG_INTERCHANGE_FORMAT_LENGTH )
+    {
+      size = ReadExifValue( entry + 8u, 4u, bigEndian );
+    }
+  }
+
+  if( size < 4u || offset > tiffSize || size > tiffSize - offset ||
+      tiff[offset] != 0xFF || tiff[offset + 1u] != 0xD8 )
+  {
+    return false;
+  }
+
+  thumbnail = tiff + offset;
+  thumbnailSize = size;
+  return true;
+}
+
 // Helpers for safe Jpeg memory handling
 using JpegHandle = std::unique_ptr<void /*tjhandle*/, decltype(tjDestroy)*>;
 
@@ -295,6 +523,36 @@ void AddExifFieldPropertyMap( Dali::Property::Map& out, const ExifEntry& entry,
   }
 }
 
+/**
+ * @brief Make the metadata map of a bitmap from its EXIF block.
+ * @param[in] exif The EXIF block, including its header.
+ * @param[in] exifSize The size of the EXIF block in bytes.
+ * @return A map of the EXIF fields, which is empty if the block couldn't be parsed.
+ */
+std::unique_ptr<Dali::Property::Map> MakeExifPropertyMap( const unsigned char* exif, unsigned int exifSize )
+{
+  std::unique_ptr<Dali::Property::Map> exifMap( new Dali::Property::Map() );
+
+  auto exifData = MakeExifDataFromData( exif, exifSize );
+  if( exifData )
+  {
+    for( auto k = 0u; k < EXIF_IFD_COUNT; ++k )
+    {
+      auto content = exifData->ifd[k];
+      for (auto i = 0u; i < content->count; ++i)
+      {
+        auto       &&tag      = content->entries[i];
+        const char *shortName = exif_tag_get_name_in_ifd(tag->tag, static_cast<ExifIfd>(k));
+        if(shortName)
+        {
+          AddExifFieldPropertyMap(*exifMap, *tag, static_cast<ExifIfd>(k));
+        }
+      }
+    }
+  }
+  return exifMap;
+}
+
 /// @brief Apply a transform to a buffer
 bool Transform(const TransformFunctionArray& transformFunctions,
                PixelArray buffer,
@@ -317,22 +575,6 @@ struct PixelType
   char _[N];
 };
 
-template<size_t N>
-void FlipVertical(PixelArray buffer, int width, int height)
-{
-  // Destination pixel, set as the first pixel of screen
-  auto to = reinterpret_cast<PixelType<N>*>( buffer );
-
-  // Source pixel, as the image is flipped horizontally and vertically,
-  // the source pixel is the end of the buffer of size width * height
-  auto from = reinterpret_cast<PixelType<N>*>(buffer) + width * height - 1;
-
-  for (auto ix = 0, endLoop = (width * height) / 2; ix < endLoop; ++ix, ++to, --from)
-  {
-    std::swap(*from, *to);
-  }
-}
-
 template<size_t N>
 void FlipHorizontal(PixelArray buffer, int width, int height)
 {
@@ -364,114 +606,316 @@ void Transpose(PixelArray buffer, int width, int height)
   }
 }
 
-template<size_t N>
-void Transverse(PixelArray buffer, int width, int height)
+/**
+ * @brief Find the image operation which applies an orientation that moves pixels between scanlines.
+ * @param[in] transform The orientation to apply.
+ * @param[out] pixelTransform The equivalent image operation.
+ * @return Whether there is one. The flips within scanlines or columns are done by the functions above.
+ */
+bool GetPixelTransform( JpegTransform transform, Dali::Internal::Platform::PixelTransform& pixelTransform )
 {
-  using PixelT = PixelType<N>;
-  Vector<PixelT> data;
-  data.Resize( width * height );
-  auto dataPtr = data.Begin();
+  using namespace Dali::Internal::Platform;
 
-  auto original = reinterpret_cast<PixelT*>(buffer);
-  std::copy(original, original + width * height, dataPtr);
-
-  auto to = original;
-  for( auto iy = 0; iy < width; ++iy )
+  switch( transform )
   {
-    for( auto ix = 0; ix < height; ++ix, ++to )
+    case JpegTransform::FLIP_VERTICAL:
+    {
+      // Orientation 3 turns the image upside down.
+      pixelTransform = PixelTransformRotate180;
+      return true;
+    }
+    case JpegTransform::TRANSVERSE:
+    {
+      // Orientation 5.
+      pixelTransform = PixelTransformTranspose;
+      return true;
+    }
+    case JpegTransform::ROTATE_90:
+    {
+      // Orientation 6 is a clockwise quarter turn.
+      pixelTransform = PixelTransformRotate270;
+      return true;
+    }
+    case JpegTransform::ROTATE_180:
+    {
+      // Orientation 7.
+      pixelTransform = PixelTransformTransverse;
+      return true;
+    }
+    case JpegTransform::ROTATE_270:
+    {
+      // Orientation 8 is a counter clockwise quarter turn.
+      pixelTransform = PixelTransformRotate90;
+      return true;
+    }
+    default:
     {
-      auto from = dataPtr + ix * width + iy;
-      *to = *from;
+      return false;
     }
   }
 }
 
-
-template<size_t N>
-void Rotate90(PixelArray buffer, int width, int height)
+/**
+ * @brief Get the whole of a JPEG file in memory.
+ *
+ * A local file is decoded straight from the page cache. Only streams without a
+ * file behind them, such as downloaded images, are read into a buffer.
+ * @param[in] fp The file, which is left at its start.
+ * @param[out] mappedFile Maps the file if it can be mapped.
+ * @param[out] jpegBuffer Holds the file if it can't be mapped.
+ * @param[out] jpegBufferPtr Set to the start of the file.
+ * @param[out] jpegBufferSize Set to the size of the file in bytes.
+ * @return false if the file couldn't be read.
+ */
+bool ReadJpegFile( FILE* fp, Dali::Internal::Platform::MappedFile& mappedFile, Dali::Vector<unsigned char>& jpegBuffer,
+                   unsigned char*& jpegBufferPtr, unsigned int& jpegBufferSize )
 {
-  using PixelT = PixelType<N>;
-  Vector<PixelT> data;
-  data.Resize(width * height);
-  auto dataPtr = data.Begin();
+  if( mappedFile.Map( fp ) )
+  {
+    // Older versions of TurboJPEG take a non-const buffer, though they only read from it:
+    jpegBufferPtr = const_cast<unsigned char*>( mappedFile.GetData() );
+    jpegBufferSize = static_cast<unsigned int>( mappedFile.GetSize() );
+    return true;
+  }
 
-  auto original = reinterpret_cast<PixelT*>(buffer);
-  std::copy(original, original + width * height, dataPtr);
+  if( fseek(fp,0,SEEK_END) )
+  {
+    DALI_LOG_ERROR("Error seeking to end of file\n");
+    return false;
+  }
 
-  std::swap(width, height);
-  auto hw = width * height;
-  hw = - hw - 1;
+  jpegBufferSize = 0u;
+  long positionIndicator = ftell(fp);
+  if( positionIndicator > -1L )
+  {
+    jpegBufferSize = static_cast<unsigned int>(positionIndicator);
+  }
 
-  auto to = original + width - 1;
-  auto from = dataPtr;
+  if( 0u == jpegBufferSize )
+  {
+    return false;
+  }
 
-  for(auto ix = width; --ix >= 0;)
+  if( fseek(fp, 0, SEEK_SET) )
   {
-    for(auto iy = height; --iy >= 0; ++from)
-    {
-      *to = *from;
-      to += width;
-    }
-    to += hw;
+    DALI_LOG_ERROR("Error seeking to start of file\n");
+    return false;
+  }
+
+  try
+  {
+    jpegBuffer.Resize( jpegBufferSize );
   }
+  catch(...)
+  {
+    DALI_LOG_ERROR( "Could not allocate temporary memory to hold JPEG file of size %uMB.\n", jpegBufferSize / 1048576U );
+    return false;
+  }
+
+  // Pull the compressed JPEG image bytes out of a file and into memory:
+  if( fread( jpegBuffer.Begin(), 1, jpegBufferSize, fp ) != jpegBufferSize )
+  {
+    DALI_LOG_WARNING("Error on image file read.\n");
+    return false;
+  }
+
+  if( fseek(fp, 0, SEEK_SET) )
+  {
+    DALI_LOG_ERROR("Error seeking to start of file\n");
+  }
+  jpegBufferPtr = jpegBuffer.Begin();
+  return true;
 }
 
-template<size_t N>
-void Rotate180(PixelArray buffer, int width, int height)
+// Decoding a region needs libjpeg-turbo 1.5. As for tjDecompressHeader3(), the Ubuntu profile builds against an older version:
+#ifndef DALI_PROFILE_UBUNTU
+
+/**
+ * @brief Work out how much of an image the crop of a fitting mode keeps.
+ *
+ * SCALE_TO_FILL crops the sides, or the top and bottom, which overflow the
+ * requested aspect ratio. FIT_WIDTH crops the top and bottom of an image too tall
+ * for it and FIT_HEIGHT the sides of an image too wide. The crop is centred.
+ * The other fitting modes pad rather than crop, so keep all of the image.
+ *
+ * The part kept is a pixel larger when that leaves the same number of pixels
+ * either side, so that it stays in the same place however the image is
+ * oriented. The crop after the downscale trims the extra pixel.
+ * @param[in] fittingMode The fitting mode.
+ * @param[in] requestedDimensions The size the image is fitted to. Nothing is cropped if either is zero.
+ * @param[in] width The width of the image.
+ * @param[in] height The height of the image.
+ * @param[out] keptWidth The width of the centre of the image which is kept.
+ * @param[out] keptHeight The height of the centre of the image which is kept.
+ * @return true if the crop removes some of the image.
+ */
+bool CalculateFittingModeCrop( Dali::FittingMode::Type fittingMode, Dali::ImageDimensions requestedDimensions,
+                               int width, int height, int& keptWidth, int& keptHeight )
 {
-  using PixelT = PixelType<N>;
-  Vector<PixelT> data;
-  data.Resize(width * height);
-  auto dataPtr = data.Begin();
+  keptWidth = width;
+  keptHeight = height;
+  if( requestedDimensions.GetWidth() == 0u || requestedDimensions.GetHeight() == 0u )
+  {
+    // The missing dimension follows the aspect ratio of the image:
+    return false;
+  }
 
-  auto original = reinterpret_cast<PixelT*>(buffer);
-  std::copy(original, original + width * height, dataPtr);
+  // As CalculateBordersFromFittingMode() does after the downscale:
+  const float targetAspect = static_cast<float>( requestedDimensions.GetWidth() ) / static_cast<float>( requestedDimensions.GetHeight() );
+  const float sourceAspect = static_cast<float>( width ) / static_cast<float>( height );
+  const bool cropSides = ( fittingMode == Dali::FittingMode::FIT_HEIGHT ) ||
+                         ( fittingMode == Dali::FittingMode::SCALE_TO_FILL && sourceAspect > targetAspect );
+  const bool cropTopAndBottom = ( fittingMode == Dali::FittingMode::FIT_WIDTH ) ||
+                                ( fittingMode == Dali::FittingMode::SCALE_TO_FILL && sourceAspect <= targetAspect );
+  if( cropSides )
+  {
+    keptWidth = std::max( 1, std::min( width, static_cast<int>( static_cast<float>( height ) * targetAspect ) ) );
+    keptWidth += ( width - keptWidth ) & 1;
+  }
+  else if( cropTopAndBottom )
+  {
+    keptHeight = std::max( 1, std::min( height, static_cast<int>( static_cast<float>( width ) / targetAspect ) ) );
+    keptHeight += ( height - keptHeight ) & 1;
+  }
+  return keptWidth < width || keptHeight < height;
+}
 
-  auto to = original;
-  for( auto iy = 0; iy < width; iy++ )
+/**
+ * @brief Find the scaling factor which TurboJPEG uses to decode an image at a size.
+ * @param[in] width The width of the image.
+ * @param[in] height The height of the image.
+ * @param[in] scaledWidth The width to decode at.
+ * @param[in] scaledHeight The height to decode at.
+ * @param[out] scalingFactor The scaling factor.
+ * @return false if no scaling factor gives that size.
+ */
+bool GetJpegScalingFactor( int width, int height, int scaledWidth, int scaledHeight, tjscalingfactor& scalingFactor )
+{
+  int numFactors = 0;
+  const tjscalingfactor* factors = tjGetScalingFactors( &numFactors );
+  for( int i = 0; factors && i < numFactors; ++i )
   {
-    for( auto ix = 0; ix < height; ix++ )
+    if( TJSCALED( width, factors[i] ) == scaledWidth && TJSCALED( height, factors[i] ) == scaledHeight )
     {
-      auto from = dataPtr + (height - ix) * width - 1 - iy;
-      *to = *from;
-      ++to;
+      scalingFactor = factors[i];
+      return true;
     }
   }
+  return false;
 }
 
-
-template<size_t N>
-void Rotate270(PixelArray buffer, int width, int height)
+/**
+ * @brief Decode a region of a JPEG image.
+ *
+ * Uses the libjpeg API of libjpeg-turbo: the scanlines above the region are
+ * skipped without running the inverse DCT or the colour conversion, and so are
+ * the iMCU columns either side of it. Decoding stops after the last scanline of
+ * the region. The pixels are the same as those of the whole image decoded at
+ * the same scale.
+ * @param[in] jpegBuffer The JPEG file.
+ * @param[in] jpegBufferSize The size of the file in bytes.
+ * @param[in] scalingFactor The DCT scaling to decode with.
+ * @param[in] colorSpace The colour space to decode to.
+ * @param[in] scaledWidth The width of the whole image, once scaled.
+ * @param[in] scaledHeight The height of the whole image, once scaled.
+ * @param[in] regionX The left of the region in the scaled image.
+ * @param[in] regionY The top of the region in the scaled image.
+ * @param[in] regionWidth The width of the region.
+ * @param[in] regionHeight The height of the region.
+ * @param[in] pixelSize The size of a decoded pixel in bytes.
+ * @param[out] pixels The region, regionWidth * regionHeight pixels.
+ * @return false if the image couldn't be decoded.
+ */
+bool DecodeJpegRegion( unsigned char* jpegBuffer, unsigned int jpegBufferSize,
+                       const tjscalingfactor& scalingFactor, J_COLOR_SPACE colorSpace,
+                       int scaledWidth, int scaledHeight,
+                       int regionX, int regionY, int regionWidth, int regionHeight,
+                       unsigned int pixelSize, unsigned char* pixels )
 {
-  using PixelT = PixelType<N>;
-  Vector<PixelT> data;
-  data.Resize(width * height);
-  auto dataPtr = data.Begin();
+  // Made before the setjmp so nothing needs freeing on the way out of an error:
+  std::vector<unsigned char> scanline( scaledWidth * pixelSize );
+
+  struct jpeg_decompress_struct cinfo;
+  struct JpegErrorState jerr;
+  cinfo.err = jpeg_std_error( &jerr.errorManager );
+
+  jerr.errorManager.output_message = JpegOutputMessageHandler;
+  jerr.errorManager.error_exit = JpegErrorHandler;
+
+  // On error exit from the JPEG lib, control will pass via JpegErrorHandler
+  // into this branch body for cleanup and error return:
+  if( setjmp( jerr.jumpBuffer ) )
+  {
+    jpeg_destroy_decompress( &cinfo );
+    return false;
+  }
 
-  auto original = reinterpret_cast<PixelT*>(buffer);
-  std::copy(original, original + width * height, dataPtr);
+// jpeg_create_decompress internally uses C casts
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+  jpeg_create_decompress( &cinfo );
+#pragma GCC diagnostic pop
 
-  auto w = height;
-  std::swap(width, height);
-  auto hw = width * height;
+  jpeg_mem_src( &cinfo, jpegBuffer, jpegBufferSize );
 
-  auto* to = original + hw  - width;
-  auto* from = dataPtr;
+  if( jpeg_read_header( &cinfo, TRUE ) != JPEG_HEADER_OK )
+  {
+    jpeg_destroy_decompress( &cinfo );
+    return false;
+  }
 
-  w = -w;
-  hw =  hw + 1;
-  for(auto ix = width; --ix >= 0;)
+  cinfo.scale_num = scalingFactor.num;
+  cinfo.scale_denom = scalingFactor.denom;
+  cinfo.out_color_space = colorSpace;
+  jpeg_start_decompress( &cinfo );
+
+  if( static_cast<int>( cinfo.output_width ) != scaledWidth || static_cast<int>( cinfo.output_height ) != scaledHeight ||
+      static_cast<unsigned int>( cinfo.output_components ) != pixelSize )
+  {
+    DALI_LOG_ERROR( "JPEG region decode gave a %ux%u image of %d components, expected %dx%d of %u.\n",
+                    cinfo.output_width, cinfo.output_height, cinfo.output_components, scaledWidth, scaledHeight, pixelSize );
+    jpeg_destroy_decompress( &cinfo );
+    return false;
+  }
+
+  // The decoder widens the columns out to whole iMCUs, and smooths the chroma of
+  // the edge pixels of what it decodes differently, so decode a pixel either side
+  // of the region and a scanline above it too:
+  JDIMENSION cropX = std::max( regionX - 1, 0 );
+  JDIMENSION cropWidth = std::min( regionX + regionWidth + 1, scaledWidth ) - cropX;
+  jpeg_crop_scanline( &cinfo, &cropX, &cropWidth );
+  const unsigned int scanlineOffset = ( regionX - cropX ) * pixelSize;
+  const unsigned int regionSpan = regionWidth * pixelSize;
+
+  const int firstScanline = std::max( regionY - 1, 0 );
+  if( firstScanline > 0 && jpeg_skip_scanlines( &cinfo, firstScanline ) != static_cast<JDIMENSION>( firstScanline ) )
+  {
+    jpeg_destroy_decompress( &cinfo );
+    return false;
+  }
+
+  for( int y = firstScanline; y < regionY + regionHeight; ++y )
   {
-    for(auto iy = height; --iy >= 0;)
+    JSAMPROW row = &scanline[0];
+    if( jpeg_read_scanlines( &cinfo, &row, 1 ) != 1 )
+    {
+      jpeg_destroy_decompress( &cinfo );
+      return false;
+    }
+    if( y >= regionY )
     {
-      *to = *from;
-      ++from;
-      to += w;
+      memcpy( pixels + ( y - regionY ) * regionSpan, &scanline[scanlineOffset], regionSpan );
     }
-    to += hw;
   }
+
+  // Nothing below the region is needed, so stop without decoding it:
+  jpeg_abort_decompress( &cinfo );
+  jpeg_destroy_decompress( &cinfo );
+  return true;
 }
 
+#endif // DALI_PROFILE_UBUNTU
+
 } // namespace
 
 namespace Dali
@@ -481,6 +925,9 @@ namespace TizenPlatform
 {
 
 JpegTransform ConvertExifOrientation(ExifData* exifData);
+JpegTransform ConvertExifOrientation(int orientation);
+bool DecodeJpeg( unsigned char* jpegBufferPtr, unsigned int jpegBufferSize, const Dali::ImageLoader::Input& input,
+                 JpegTransform transform, const ExifBlock& exifBlock, Dali::Devel::PixelBuffer& bitmap );
 bool TransformSize( int requiredWidth, int requiredHeight,
                     FittingMode::Type fittingMode, SamplingMode::Type samplingMode,
                     JpegTransform transform,
@@ -530,57 +977,59 @@ bool LoadJpegHeader( FILE *fp, unsigned int &width, unsigned int &height )
 
 bool LoadBitmapFromJpeg( const Dali::ImageLoader::Input& input, Dali::Devel::PixelBuffer& bitmap )
 {
-  const int flags= 0;
   FILE* const fp = input.file;
 
-  if( fseek(fp,0,SEEK_END) )
-  {
-    DALI_LOG_ERROR("Error seeking to end of file\n");
-    return false;
-  }
-
-  long positionIndicator = ftell(fp);
+  // Decode a local file straight from the page cache. Only streams without a
+  // file behind them, such as downloaded images, are read into a buffer:
+  Internal::Platform::MappedFile mappedFile;
+  Vector<unsigned char> jpegBuffer;
+  unsigned char* jpegBufferPtr = nullptr;
   unsigned int jpegBufferSize = 0u;
-  if( positionIndicator > -1L )
-  {
-    jpegBufferSize = static_cast<unsigned int>(positionIndicator);
-  }
 
-  if( 0u == jpegBufferSize )
+  if( !ReadJpegFile( fp, mappedFile, jpegBuffer, jpegBufferPtr, jpegBufferSize ) )
   {
     return false;
   }
 
-  if( fseek(fp, 0, SEEK_SET) )
-  {
-    DALI_LOG_ERROR("Error seeking to start of file\n");
-    return false;
-  }
+  auto transform = JpegTransform::NONE;
 
-  Vector<unsigned char> jpegBuffer;
-  try
-  {
-    jpegBuffer.Resize( jpegBufferSize );
-  }
-  catch(...)
-  {
-    DALI_LOG_ERROR( "Could not allocate temporary memory to hold JPEG file of size %uMB.\n", jpegBufferSize / 1048576U );
-    return false;
-  }
-  unsigned char * const jpegBufferPtr = jpegBuffer.Begin();
+  // Only the orientation is needed to decode, so parsing the rest of the exif
+  // data, which can be tens of kilobytes on camera photos, is left until the
+  // metadata is asked for:
+  const unsigned char* exif = nullptr;
+  unsigned int exifSize = 0u;
+  const bool hasExif = FindExifBlock( jpegBufferPtr, jpegBufferSize, exif, exifSize );
 
-  // Pull the compressed JPEG image bytes out of a file and into memory:
-  if( fread( jpegBufferPtr, 1, jpegBufferSize, fp ) != jpegBufferSize )
+  if( hasExif && input.reorientationRequested )
   {
-    DALI_LOG_WARNING("Error on image file read.\n");
-    return false;
+    transform = ConvertExifOrientation( ReadExifOrientation( exif, exifSize ) );
   }
 
-  if( fseek(fp, 0, SEEK_SET) )
+  // The file buffer doesn't outlive this function, so keep a copy of the exif block:
+  ExifBlock exifBlock;
+  if( hasExif && input.metadataRequested )
   {
-    DALI_LOG_ERROR("Error seeking to start of file\n");
+    exifBlock = std::make_shared< std::vector<unsigned char> >( exif, exif + exifSize );
   }
 
+  return DecodeJpeg( jpegBufferPtr, jpegBufferSize, input, transform, exifBlock, bitmap );
+}
+
+/**
+ * @brief Decode a JPEG file in memory.
+ * @param[in] jpegBufferPtr The JPEG file.
+ * @param[in] jpegBufferSize The size of the file in bytes.
+ * @param[in] input The scaling to decode with and whether metadata was asked for.
+ * @param[in] transform The orientation to apply.
+ * @param[in] exifBlock The exif block to load the metadata from, if any.
+ * @param[out] bitmap The decoded image.
+ * @return true if the file was decoded.
+ */
+bool DecodeJpeg( unsigned char* jpegBufferPtr, unsigned int jpegBufferSize, const Dali::ImageLoader::Input& input,
+                 JpegTransform transform, const ExifBlock& exifBlock, Dali::Devel::PixelBuffer& bitmap )
+{
+  const int flags= 0;
+
   auto jpeg = MakeJpegDecompressor();
 
   if(!jpeg)
@@ -589,33 +1038,6 @@ bool LoadBitmapFromJpeg( const Dali::ImageLoader::Input& input, Dali::Devel::Pix
     return false;
   }
 
-  auto transform = JpegTransform::NONE;
-
-  // extract exif data
-  auto exifData = MakeExifDataFromData(jpegBufferPtr, jpegBufferSize);
-
-  if( exifData && input.reorientationRequested )
-  {
-    transform = ConvertExifOrientation(exifData.get());
-  }
-
-  std::unique_ptr<Property::Map> exifMap;
-  exifMap.reset( new Property::Map() );
-
-  for( auto k = 0u; k < EXIF_IFD_COUNT; ++k )
-  {
-    auto content = exifData->ifd[k];
-    for (auto i = 0u; i < content->count; ++i)
-    {
-      auto       &&tag      = content->entries[i];
-      const char *shortName = exif_tag_get_name_in_ifd(tag->tag, static_cast<ExifIfd>(k));
-      if(shortName)
-      {
-        AddExifFieldPropertyMap(*exifMap, *tag, static_cast<ExifIfd>(k));
-      }
-    }
-  }
-
   // Push jpeg data in memory buffer through TurboJPEG decoder to make a raw pixel array:
   int chrominanceSubsampling = -1;
   int preXformImageWidth = 0, preXformImageHeight = 0;
@@ -670,6 +1092,7 @@ bool LoadBitmapFromJpeg( const Dali::ImageLoader::Input& input, Dali::Devel::Pix
   TJPF pixelLibJpegType = TJPF_RGB;
   Pixel::Format pixelFormat = Pixel::RGB888;
 #ifndef DALI_PROFILE_UBUNTU
+  J_COLOR_SPACE libJpegColorSpace = JCS_RGB;
   switch (jpegColorspace)
   {
     case TJCS_RGB:
@@ -678,12 +1101,14 @@ bool LoadBitmapFromJpeg( const Dali::ImageLoader::Input& input, Dali::Devel::Pix
     case TJCS_YCbCr:
     {
       pixelLibJpegType = TJPF_RGB;
+      libJpegColorSpace = JCS_RGB;
       pixelFormat = Pixel::RGB888;
       break;
     }
     case TJCS_GRAY:
     {
       pixelLibJpegType = TJPF_GRAY;
+      libJpegColorSpace = JCS_GRAYSCALE;
       pixelFormat = Pixel::L8;
       break;
     }
@@ -691,26 +1116,104 @@ bool LoadBitmapFromJpeg( const Dali::ImageLoader::Input& input, Dali::Devel::Pix
     case TJCS_YCCK:
     {
       pixelLibJpegType = TJPF_CMYK;
+      libJpegColorSpace = JCS_CMYK;
       pixelFormat = Pixel::RGBA8888;
       break;
     }
     default:
     {
       pixelLibJpegType = TJPF_RGB;
+      libJpegColorSpace = JCS_RGB;
       pixelFormat = Pixel::RGB888;
       break;
     }
   }
 #endif
+
+  // The part of the scaled image to decode, in the orientation of the file. The
+  // crop of the fitting mode throws the rest away, so only decode what it keeps:
+  int regionWidth = scaledPreXformWidth;
+  int regionHeight = scaledPreXformHeight;
+  bool decodeRegion = false;
+#ifndef DALI_PROFILE_UBUNTU
+  int regionX = 0;
+  int regionY = 0;
+  tjscalingfactor scalingFactor = { 1, 1 };
+  int keptWidth = 0;
+  int keptHeight = 0;
+  if( CalculateFittingModeCrop( input.scalingParameters.scalingMode, input.scalingParameters.dimensions, scaledPostXformWidth, scaledPostXformHeight, keptWidth, keptHeight ) &&
+      GetJpegScalingFactor( preXformImageWidth, preXformImageHeight, scaledPreXformWidth, scaledPreXformHeight, scalingFactor ) )
+  {
+    decodeRegion = true;
+    scaledPostXformWidth = keptWidth;
+    scaledPostXformHeight = keptHeight;
+
+    // The region is centred, so it stays in place through the orientation, only its width and height may swap:
+    const bool swapDimensions = ( transform == JpegTransform::ROTATE_90 || transform == JpegTransform::ROTATE_270 || transform == JpegTransform::ROTATE_180 || transform == JpegTransform::TRANSVERSE );
+    regionWidth = swapDimensions ? keptHeight : keptWidth;
+    regionHeight = swapDimensions ? keptWidth : keptHeight;
+    regionX = ( scaledPreXformWidth - regionWidth ) / 2;
+    regionY = ( scaledPreXformHeight - regionHeight ) / 2;
+  }
+#endif
+
   // Allocate a bitmap and decompress the jpeg buffer into its pixel buffer:
   bitmap = Dali::Devel::PixelBuffer::New(scaledPostXformWidth, scaledPostXformHeight, pixelFormat);
 
   // set metadata
-  GetImplementation(bitmap).SetMetadata( std::move(exifMap) );
+  if( exifBlock )
+  {
+    GetImplementation(bitmap).SetMetadataLoader( [exifBlock]()
+    {
+      return MakeExifPropertyMap( exifBlock->data(), static_cast<unsigned int>( exifBlock->size() ) );
+    } );
+  }
+  else if( input.metadataRequested )
+  {
+    GetImplementation(bitmap).SetMetadata( std::unique_ptr<Property::Map>( new Property::Map() ) );
+  }
 
   auto bitmapPixelBuffer = bitmap.GetBuffer();
 
-  if( tjDecompress2( jpeg.get(), jpegBufferPtr, jpegBufferSize, reinterpret_cast<unsigned char*>( bitmapPixelBuffer ), scaledPreXformWidth, 0, scaledPreXformHeight, pixelLibJpegType, flags ) == -1 )
+  const unsigned int  bufferWidth  = GetTextureDimension( regionWidth );
+  const unsigned int  bufferHeight = GetTextureDimension( regionHeight );
+  const unsigned int  pixelSize    = Pixel::GetBytesPerPixel( pixelFormat );
+
+  // Rotations and transpositions can only be applied in place to a square image or by
+  // turning it upside down. Otherwise decode into a separate buffer and transform into the bitmap:
+  auto pixelTransform = Internal::Platform::PixelTransformRotate180;
+  const bool transformPixels = GetPixelTransform( transform, pixelTransform );
+  const bool transformInPlace = transformPixels && ( ( bufferWidth == bufferHeight ) || ( pixelTransform == Internal::Platform::PixelTransformRotate180 ) );
+
+  Internal::Platform::PooledBuffer decodedPixels;
+  unsigned char* decodeBuffer = bitmapPixelBuffer;
+  if( transformPixels && !transformInPlace )
+  {
+    try
+    {
+      decodedPixels.Resize( bufferWidth * bufferHeight * pixelSize );
+    }
+    catch(...)
+    {
+      DALI_LOG_ERROR( "Could not allocate temporary memory to rotate JPEG image of size %ux%u.\n", bufferWidth, bufferHeight );
+      return false;
+    }
+    decodeBuffer = decodedPixels.Begin();
+  }
+
+  if( decodeRegion )
+  {
+#ifndef DALI_PROFILE_UBUNTU
+    if( !DecodeJpegRegion( jpegBufferPtr, jpegBufferSize, scalingFactor, libJpegColorSpace,
+                           scaledPreXformWidth, scaledPreXformHeight, regionX, regionY, regionWidth, regionHeight,
+                           pixelSize, decodeBuffer ) )
+    {
+      DALI_LOG_ERROR( "Failed to decode a %dx%d region of a JPEG image.\n", regionWidth, regionHeight );
+      return false;
+    }
+#endif
+  }
+  else if( tjDecompress2( jpeg.get(), jpegBufferPtr, jpegBufferSize, decodeBuffer, scaledPreXformWidth, 0, scaledPreXformHeight, pixelLibJpegType, flags ) == -1 )
   {
     std::string errorString = tjGetErrorStr();
 
@@ -725,8 +1228,14 @@ bool LoadBitmapFromJpeg( const Dali::ImageLoader::Input& input, Dali::Devel::Pix
     }
   }
 
-  const unsigned int  bufferWidth  = GetTextureDimension( scaledPreXformWidth );
-  const unsigned int  bufferHeight = GetTextureDimension( scaledPreXformHeight );
+  if( transformInPlace )
+  {
+    return Internal::Platform::TransformPixelsInPlace( bitmapPixelBuffer, bufferWidth, bufferHeight, pixelSize, pixelTransform );
+  }
+  if( transformPixels )
+  {
+    return Internal::Platform::TransformPixels( decodeBuffer, bufferWidth, bufferHeight, pixelSize, pixelTransform, bitmapPixelBuffer );
+  }
 
   bool result = false;
   switch(transform)
@@ -736,47 +1245,6 @@ bool LoadBitmapFromJpeg( const Dali::ImageLoader::Input& input, Dali::Devel::Pix
       result = true;
       break;
     }
-    // 3 orientation changes for a camera held perpendicular to the ground or upside-down:
-    case JpegTransform::ROTATE_180:
-    {
-      static auto rotate180Functions = TransformFunctionArray {
-        &Rotate180<1>,
-        &Rotate180<3>,
-        &Rotate180<4>,
-      };
-      result = Transform(rotate180Functions, bitmapPixelBuffer, bufferWidth, bufferHeight, pixelFormat );
-      break;
-    }
-    case JpegTransform::ROTATE_270:
-    {
-      static auto rotate270Functions = TransformFunctionArray {
-        &Rotate270<1>,
-        &Rotate270<3>,
-        &Rotate270<4>,
-      };
-      result = Transform(rotate270Functions, bitmapPixelBuffer, bufferWidth, bufferHeight, pixelFormat );
-      break;
-    }
-    case JpegTransform::ROTATE_90:
-    {
-      static auto rotate90Functions = TransformFunctionArray {
-        &Rotate90<1>,
-        &Rotate90<3>,
-        &Rotate90<4>,
-      };
-      result = Transform(rotate90Functions, bitmapPixelBuffer, bufferWidth, bufferHeight, pixelFormat );
-      break;
-    }
-    case JpegTransform::FLIP_VERTICAL:
-    {
-      static auto flipVerticalFunctions = TransformFunctionArray {
-        &FlipVertical<1>,
-        &FlipVertical<3>,
-        &FlipVertical<4>,
-      };
-      result = Transform(flipVerticalFunctions, bitmapPixelBuffer, bufferWidth, bufferHeight, pixelFormat );
-      break;
-    }
     // Less-common orientation changes, since they don't correspond to a camera's physical orientation:
     case JpegTransform::FLIP_HORIZONTAL:
     {
@@ -798,16 +1266,6 @@ bool LoadBitmapFromJpeg( const Dali::ImageLoader::Input& input, Dali::Devel::Pix
       result = Transform(transposeFunctions, bitmapPixelBuffer, bufferWidth, bufferHeight, pixelFormat );
       break;
     }
-    case JpegTransform::TRANSVERSE:
-    {
-      static auto transverseFunctions = TransformFunctionArray {
-        &Transverse<1>,
-        &Transverse<3>,
-        &Transverse<4>,
-      };
-      result = Transform(transverseFunctions, bitmapPixelBuffer, bufferWidth, bufferHeight, pixelFormat );
-      break;
-    }
     default:
     {
       DALI_LOG_ERROR( "Unsupported JPEG Orientation transformation: %x.\n", transform );
@@ -818,6 +1276,149 @@ bool LoadBitmapFromJpeg( const Dali::ImageLoader::Input& input, Dali::Devel::Pix
   return result;
 }
 
+bool LoadPlanesFromJpeg( const Dali::ImageLoader::Input& input, std::vector<Dali::Devel::PixelBuffer>& pixelBuffers )
+{
+  pixelBuffers.clear();
+
+  // Decoding to planes needs tjDecompressToYUVPlanes(), which is newer than the TurboJPEG of the Ubuntu profile:
+#ifndef DALI_PROFILE_UBUNTU
+  Internal::Platform::MappedFile mappedFile;
+  Vector<unsigned char> jpegBuffer;
+  unsigned char* jpegBufferPtr = nullptr;
+  unsigned int jpegBufferSize = 0u;
+
+  if( !ReadJpegFile( input.file, mappedFile, jpegBuffer, jpegBufferPtr, jpegBufferSize ) )
+  {
+    return false;
+  }
+
+  auto jpeg = MakeJpegDecompressor();
+
+  if(!jpeg)
+  {
+    DALI_LOG_ERROR("%s\n", tjGetErrorStr());
+    return false;
+  }
+
+  int chrominanceSubsampling = -1;
+  int jpegColorspace = -1;
+  int preXformImageWidth = 0, preXformImageHeight = 0;
+  if( tjDecompressHeader3( jpeg.get(), jpegBufferPtr, jpegBufferSize, &preXformImageWidth, &preXformImageHeight, &chrominanceSubsampling, &jpegColorspace ) == -1 )
+  {
+    // Leave any error to the RGB decode below:
+    chrominanceSubsampling = -1;
+  }
+
+  auto transform = JpegTransform::NONE;
+  const unsigned char* exif = nullptr;
+  unsigned int exifSize = 0u;
+  if( input.reorientationRequested && FindExifBlock( jpegBufferPtr, jpegBufferSize, exif, exifSize ) )
+  {
+    transform = ConvertExifOrientation( ReadExifOrientation( exif, exifSize ) );
+  }
+
+  int scaledPreXformWidth   = preXformImageWidth;
+  int scaledPreXformHeight  = preXformImageHeight;
+  int scaledPostXformWidth  = preXformImageWidth;
+  int scaledPostXformHeight = preXformImageHeight;
+
+  TransformSize( input.scalingParameters.dimensions.GetWidth(), input.scalingParameters.dimensions.GetHeight(),
+                 input.scalingParameters.scalingMode,
+                 input.scalingParameters.samplingMode,
+                 transform,
+                 scaledPreXformWidth, scaledPreXformHeight,
+                 scaledPostXformWidth, scaledPostXformHeight );
+
+  // The planes are handed over as they are decoded, so only decode to planes
+  // when the DCT scaling gives the requested size and nothing is left for the
+  // pipeline to turn, scale or crop:
+  const ImageDimensions scaledDimensions( scaledPreXformWidth, scaledPreXformHeight );
+  const bool decodePlanes = ( jpegColorspace == TJCS_YCbCr ) &&
+                            ( chrominanceSubsampling >= 0 ) && ( chrominanceSubsampling != TJSAMP_GRAY ) &&
+                            ( transform == JpegTransform::NONE ) &&
+                            ( preXformImageWidth > 0 ) && ( preXformImageHeight > 0 ) &&
+                            ( Internal::Platform::CalculateDesiredDimensions( scaledDimensions, input.scalingParameters.dimensions ) == scaledDimensions );
+
+  if( decodePlanes )
+  {
+    unsigned char* planes[3];
+    for( int component = 0; component < 3; ++component )
+    {
+      const int planeWidth = tjPlaneWidth( component, scaledPreXformWidth, chrominanceSubsampling );
+      const int planeHeight = tjPlaneHeight( component, scaledPreXformHeight, chrominanceSubsampling );
+      Dali::Devel::PixelBuffer plane = Dali::Devel::PixelBuffer::New( planeWidth, planeHeight, Pixel::L8 );
+      planes[component] = plane.GetBuffer();
+      pixelBuffers.push_back( plane );
+    }
+
+    if( tjDecompressToYUVPlanes( jpeg.get(), jpegBufferPtr, jpegBufferSize, planes, scaledPreXformWidth, nullptr, scaledPreXformHeight, 0 ) == -1 )
+    {
+      std::string errorString = tjGetErrorStr();
+
+      if( IsJpegErrorFatal( errorString ) )
+      {
+        DALI_LOG_ERROR("%s\n", errorString.c_str() );
+        pixelBuffers.clear();
+        return false;
+      }
+      else
+      {
+        DALI_LOG_WARNING("%s\n", errorString.c_str() );
+      }
+    }
+    return true;
+  }
+#endif
+
+  // Otherwise decode to RGB as usual:
+  Dali::Devel::PixelBuffer bitmap;
+  if( !LoadBitmapFromJpeg( input, bitmap ) )
+  {
+    return false;
+  }
+  pixelBuffers.push_back( bitmap );
+  return true;
+}
+
+bool LoadPreviewFromJpeg( const Dali::ImageLoader::Input& input, Dali::Devel::PixelBuffer& bitmap )
+{
+  Internal::Platform::MappedFile mappedFile;
+  Vector<unsigned char> jpegBuffer;
+  unsigned char* jpegBufferPtr = nullptr;
+  unsigned int jpegBufferSize = 0u;
+
+  if( !ReadJpegFile( input.file, mappedFile, jpegBuffer, jpegBufferPtr, jpegBufferSize ) )
+  {
+    return false;
+  }
+
+  auto transform = JpegTransform::NONE;
+  const unsigned char* exif = nullptr;
+  unsigned int exifSize = 0u;
+  const bool hasExif = FindExifBlock( jpegBufferPtr, jpegBufferSize, exif, exifSize );
+  if( hasExif && input.reorientationRequested )
+  {
+    transform = ConvertExifOrientation( ReadExifOrientation( exif, exifSize ) );
+  }
+
+  // The thumbnail is stored the same way up as the image, so takes the same orientation:
+  const Dali::ImageLoader::Input previewInput( input.file, Dali::ImageLoader::ScalingParameters(), input.reorientationRequested, false );
+  const unsigned char* thumbnail = nullptr;
+  unsigned int thumbnailSize = 0u;
+  if( hasExif && FindExifThumbnail( exif, exifSize, thumbnail, thumbnailSize ) &&
+      DecodeJpeg( const_cast<unsigned char*>( thumbnail ), thumbnailSize, previewInput, transform, ExifBlock(), bitmap ) )
+  {
+    return true;
+  }
+
+  // Otherwise decode the image at its smallest scale, 1/8, where each block
+  // becomes a single pixel from its DC coefficient. Asking for a single pixel
+  // makes the decoder pick that scale:
+  const Dali::ImageLoader::ScalingParameters smallestScale( ImageDimensions( 1u, 1u ), FittingMode::SHRINK_TO_FIT, SamplingMode::BOX );
+  const Dali::ImageLoader::Input scaledInput( input.file, smallestScale, input.reorientationRequested, false );
+  return DecodeJpeg( jpegBufferPtr, jpegBufferSize, scaledInput, transform, ExifBlock(), bitmap );
+}
+
 bool EncodeToJpeg( const unsigned char* const pixelBuffer, Vector< unsigned char >& encodedPixels,
                    const std::size_t width, const std::size_t height, const Pixel::Format pixelFormat, unsigned quality )
 {
@@ -907,12 +1508,20 @@ bool EncodeToJpeg( const unsigned char* const pixelBuffer, Vector< unsigned char
 
 JpegTransform ConvertExifOrientation(ExifData* exifData)
 {
-  auto transform = JpegTransform::NONE;
   ExifEntry * const entry = exif_data_get_entry(exifData, EXIF_TAG_ORIENTATION);
   int orientation = 0;
   if( entry )
   {
     orientation = exif_get_short(entry->data, exif_data_get_byte_order(entry->parent->parent));
+  }
+  return ConvertExifOrientation( orientation );
+}
+
+JpegTransform ConvertExifOrientation(int orientation)
+{
+  auto transform = JpegTransform::NONE;
+  if( orientation != 0 )
+  {
     switch( orientation )
     {
       case 1:
@@ -958,7 +1567,7 @@ JpegTransform ConvertExifOrientation(ExifData* exifData)
       default:
       {
         // Try to keep loading the file, but let app developer know there was something fishy:
-        DALI_LOG_WARNING( "Incorrect/Unknown Orientation setting found in EXIF header of JPEG image (%x). Orientation setting will be ignored.\n", entry );
+        DALI_LOG_WARNING( "Incorrect/Unknown Orientation setting found in EXIF header of JPEG image (%x). Orientation setting will be ignored.\n", orientation );
         break;
       }
     }
@@ -19,6 +19,7 @@
  */
 
 #include <stdio.h>
+#include <vector>
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/images/pixel.h>
 #include <dali/internal/legacy/tizen/image-encoder.h>
@@ -52,6 +53,31 @@ const unsigned char MAGIC_BYTE_2 = 0xD8;
  */
 bool LoadBitmapFromJpeg( const Dali::ImageLoader::Input& input, Dali::Devel::PixelBuffer& bitmap );
 
+/**
+ * Loads a JPEG file as its Y, Cb and Cr planes, leaving the conversion to RGB to
+ * whoever draws them. Each plane is an L8 buffer; the chroma planes are smaller
+ * than the luma plane if the file subsamples them.
+ *
+ * The planes are only decoded if the scaling asked for by the input is one that
+ * the DCT can do and no reorientation is needed. Otherwise, and for files which
+ * aren't YCbCr, the image is decoded as by LoadBitmapFromJpeg into a single buffer.
+ * @param[in]  input         Information about the input image (including file pointer)
+ * @param[out] pixelBuffers  Set to the three planes, or to the single decoded bitmap
+ * @return  true if file decoded successfully, false otherwise
+ */
+bool LoadPlanesFromJpeg( const Dali::ImageLoader::Input& input, std::vector<Dali::Devel::PixelBuffer>& pixelBuffers );
+
+/**
+ * Loads a small preview of a JPEG file, which takes a fraction of the time of
+ * loading the whole image. The thumbnail embedded in the EXIF data is decoded
+ * if the file has one, otherwise the image is decoded at 1/8 scale. The scaling
+ * parameters of the input are ignored and the preview has no metadata.
+ * @param[in]  input   Information about the input image (including file pointer)
+ * @param[out] bitmap  The bitmap class where the preview will be stored
+ * @return  true if file decoded successfully, false otherwise
+ */
+bool LoadPreviewFromJpeg( const Dali::ImageLoader::Input& input, Dali::Devel::PixelBuffer& bitmap );
+
 /**
  * Loads the header of a JPEG file and fills in the width and height appropriately.
  * If the width and height are set on entry, it will set the width and height
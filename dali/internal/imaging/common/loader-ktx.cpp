@@ -19,10 +19,13 @@
 #include <dali/internal/imaging/common/loader-ktx.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <cstring>
+#include <memory>
 #include <dali/public-api/common/compile-time-assert.h>
 #include <dali/integration-api/debug.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/internal/imaging/common/mapped-file.h>
 #include <dali/internal/imaging/common/pixel-buffer-impl.h>
 
 namespace Dali
@@ -41,6 +44,10 @@ const unsigned MAX_IMAGE_DATA_SIZE = MAX_TEXTURE_DIMENSION * MAX_TEXTURE_DIMENSI
 /** We don't read any of this but limit it to a resonable amount in order to be
  * friendly to files from random tools. */
 const unsigned MAX_BYTES_OF_KEYVALUE_DATA = 65536U;
+/** Max mipmap levels, enough for a full chain down from MAX_TEXTURE_DIMENSION. */
+const unsigned MAX_MIPMAP_LEVELS = 13U;
+/** Max array layers, as many as GL implementations commonly allow. */
+const unsigned MAX_ARRAY_ELEMENTS = 2048U;
 
 typedef uint8_t Byte;
 
@@ -183,6 +190,17 @@ struct KtxFileHeader
 // Packed attribute stops the structure from being aligned to compiler defaults
 // so we can be sure of reading the whole thing from file in one call to fread.
 
+/**
+ * Where one image of a mipmap level or array layer is in a KTX file.
+ */
+struct KtxImage
+{
+  long int     offset; ///< The offset of the image data from the start of the file
+  uint32_t     size;   ///< The size of the image data in bytes
+  unsigned int width;  ///< The width of the image in pixels
+  unsigned int height; ///< The height of the image in pixels
+};
+
 /**
  * Function to read from the file directly into our structure.
  * @param[in]  fp     The file to read from
@@ -485,14 +503,14 @@ bool LoadKtxHeader( FILE * const fp, unsigned int& width, unsigned int& height,
   const bool glInternalFormatIsSupportedCompressedTex = ValidInternalFormat(fileHeader.glInternalFormat);
   // Ignore glBaseInternalFormat
   const bool textureIsNot3D                           = fileHeader.pixelDepth == 0 || fileHeader.pixelDepth == 1;
-  const bool textureIsNotAnArray                      = fileHeader.numberOfArrayElements == 0 || fileHeader.numberOfArrayElements == 1;
+  const bool arrayElementsSupported                   = fileHeader.numberOfArrayElements <= MAX_ARRAY_ELEMENTS;
   const bool textureIsNotACubemap                     = fileHeader.numberOfFaces == 0 || fileHeader.numberOfFaces == 1;
-  const bool textureHasNoMipmapLevels                 = fileHeader.numberOfMipmapLevels == 0 || fileHeader.numberOfMipmapLevels == 1;
+  const bool mipmapLevelsSupported                    = fileHeader.numberOfMipmapLevels <= MAX_MIPMAP_LEVELS;
   const bool keyValueDataNotTooLarge                  = fileHeader.bytesOfKeyValueData <= MAX_BYTES_OF_KEYVALUE_DATA;
 
   bool headerIsValid = signatureGood && fileEndiannessMatchesSystemEndianness &&
-                     glTypeSizeCompatibleWithCompressedTex && textureIsNot3D && textureIsNotAnArray &&
-                     textureIsNotACubemap && textureHasNoMipmapLevels && keyValueDataNotTooLarge;
+                     glTypeSizeCompatibleWithCompressedTex && textureIsNot3D && arrayElementsSupported &&
+                     textureIsNotACubemap && mipmapLevelsSupported && keyValueDataNotTooLarge;
 
   if( !glTypeIsCompressed )  // check for uncompressed Alpha
   {
@@ -507,7 +525,7 @@ bool LoadKtxHeader( FILE * const fp, unsigned int& width, unsigned int& height,
 
   if( !headerIsValid )
   {
-     DALI_LOG_ERROR( "KTX file invalid or using unsupported features. Header tests: sig: %d, endian: %d, gl_type: %d, gl_type_size: %d, gl_format: %d, internal_format: %d, depth: %d, array: %d, faces: %d, mipmap: %d, vey-vals: %d.\n", 0+signatureGood, 0+fileEndiannessMatchesSystemEndianness, 0+glTypeIsCompressed, 0+glTypeSizeCompatibleWithCompressedTex, 0+glFormatCompatibleWithCompressedTex, 0+glInternalFormatIsSupportedCompressedTex, 0+textureIsNot3D, 0+textureIsNotAnArray, 0+textureIsNotACubemap, 0+textureHasNoMipmapLevels, 0+keyValueDataNotTooLarge);
+     DALI_LOG_ERROR( "KTX file invalid or using unsupported features. Header tests: sig: %d, endian: %d, gl_type: %d, gl_type_size: %d, gl_format: %d, internal_format: %d, depth: %d, array: %d, faces: %d, mipmap: %d, vey-vals: %d.\n", 0+signatureGood, 0+fileEndiannessMatchesSystemEndianness, 0+glTypeIsCompressed, 0+glTypeSizeCompatibleWithCompressedTex, 0+glFormatCompatibleWithCompressedTex, 0+glInternalFormatIsSupportedCompressedTex, 0+textureIsNot3D, 0+arrayElementsSupported, 0+textureIsNotACubemap, 0+mipmapLevelsSupported, 0+keyValueDataNotTooLarge);
   }
 
   // Warn if there is space wasted in the file:
@@ -519,21 +537,82 @@ bool LoadKtxHeader( FILE * const fp, unsigned int& width, unsigned int& height,
   return headerIsValid;
 }
 
+/**
+ * Finds where the images of the mipmap levels and array layers are in a KTX file.
+ * Only the size of each level is read, the images themselves aren't touched.
+ * @param[in]  fp         The file, with a valid header
+ * @param[in]  fileHeader The header of the file
+ * @param[in]  allImages  Whether to find every image, or only the first one
+ * @param[out] images     Set to the images, ordered by mipmap level and then by array layer
+ * @return true if the images were found, false if the file is invalid
+ */
+bool FindKtxImages( FILE * const fp, const KtxFileHeader& fileHeader, bool allImages, std::vector<KtxImage>& images )
+{
+  const uint32_t numberOfLevels = std::max( fileHeader.numberOfMipmapLevels, 1u );
+  const uint32_t numberOfLayers = std::max( fileHeader.numberOfArrayElements, 1u );
 
-} // unnamed namespace
+  // Skip the key-values:
+  long int imageSizeOffset = sizeof(KtxFileHeader) + fileHeader.bytesOfKeyValueData;
 
-// File loading API entry-point:
-bool LoadKtxHeader( const Dali::ImageLoader::Input& input, unsigned int& width, unsigned int& height )
-{
-  KtxFileHeader fileHeader;
-  FILE* const fp = input.file;
+  images.clear();
+  for( uint32_t level = 0u; level < numberOfLevels; ++level )
+  {
+    if( fseek( fp, imageSizeOffset, SEEK_SET ) )
+    {
+      DALI_LOG_ERROR( "Seek to image size in KTX compressed bitmap file failed.\n" );
+      return false;
+    }
 
-  bool ret = LoadKtxHeader(fp, width, height, fileHeader);
-  return ret;
+    // Load the size of the image data. For an array it is the size of every layer of the level together:
+    uint32_t imageByteCount = 0;
+    if ( fread( &imageByteCount, 1, 4, fp ) != 4 )
+    {
+      DALI_LOG_ERROR( "Read of image size failed.\n" );
+      return false;
+    }
+
+    const unsigned int width = std::max( fileHeader.pixelWidth >> level, 1u );
+    const unsigned int height = std::max( fileHeader.pixelHeight >> level, 1u );
+    const uint32_t layerByteCount = imageByteCount / numberOfLayers;
+
+    // Sanity-check the image size:
+    if( imageByteCount % numberOfLayers != 0u ||
+        layerByteCount > MAX_IMAGE_DATA_SIZE ||
+        // A compressed texture should certainly be less than 2 bytes per texel, counting the
+        // texels of the smallest levels as whole 4x4 blocks:
+        layerByteCount > std::max( width, 4u ) * std::max( height, 4u ) * 2 )
+    {
+      DALI_LOG_ERROR( "KTX file with too-large image-data field.\n" );
+      return false;
+    }
+
+    for( uint32_t layer = 0u; layer < numberOfLayers; ++layer )
+    {
+      images.push_back( KtxImage{ imageSizeOffset + 4 + static_cast<long int>( layer * layerByteCount ), layerByteCount, width, height } );
+      if( !allImages )
+      {
+        return true;
+      }
+    }
+
+    // Levels start on a 4 byte boundary:
+    imageSizeOffset += 4 + ( ( imageByteCount + 3u ) & ~3u );
+  }
+
+  return true;
 }
 
-// File loading API entry-point:
-bool LoadBitmapFromKtx( const Dali::ImageLoader::Input& input, Dali::Devel::PixelBuffer& bitmap )
+/**
+ * Loads the images of the mipmap levels and array layers of a KTX file.
+ * If the file can be mapped, the pixel buffers point into the mapping, which stays
+ * mapped until they are all gone. Otherwise each image is read into a buffer of its own.
+ * @param[in]  input          Information about the input image (including file pointer)
+ * @param[in]  allImages      Whether to load every image, or only the first one
+ * @param[out] bitmaps        Set to the images, ordered by mipmap level and then by array layer
+ * @param[out] numberOfLayers Set to the number of array layers of each level
+ * @return true if the images were loaded, false otherwise
+ */
+bool LoadKtxImages( const Dali::ImageLoader::Input& input, bool allImages, std::vector<Dali::Devel::PixelBuffer>& bitmaps, unsigned int& numberOfLayers )
 {
   DALI_COMPILE_TIME_ASSERT( sizeof(Byte) == 1);
   DALI_COMPILE_TIME_ASSERT( sizeof(uint32_t) == 4);
@@ -554,64 +633,123 @@ bool LoadBitmapFromKtx( const Dali::ImageLoader::Input& input, Dali::Devel::Pixe
       return false;
   }
 
-  // Skip the key-values:
-  const long int imageSizeOffset = sizeof(KtxFileHeader) + fileHeader.bytesOfKeyValueData;
-  if(fseek(fp, imageSizeOffset, SEEK_SET))
+  Pixel::Format pixelFormat;
+  const bool pixelFormatKnown = ConvertPixelFormat(fileHeader.glInternalFormat, pixelFormat);
+  if(!pixelFormatKnown)
   {
-    DALI_LOG_ERROR( "Seek past key/vals in KTX compressed bitmap file failed.\n" );
+    DALI_LOG_ERROR( "No internal pixel format supported for KTX file pixel format.\n" );
     return false;
   }
 
-  // Load the size of the image data:
-  uint32_t imageByteCount = 0;
-  if ( fread( &imageByteCount, 1, 4, fp ) != 4 )
+  std::vector<KtxImage> images;
+  if( !FindKtxImages( fp, fileHeader, allImages, images ) )
   {
-    DALI_LOG_ERROR( "Read of image size failed.\n" );
     return false;
   }
-  // Sanity-check the image size:
-  if( imageByteCount > MAX_IMAGE_DATA_SIZE ||
-      // A compressed texture should certainly be less than 2 bytes per texel:
-      imageByteCount > width * height * 2)
+
+  // Uncompressed images must be tightly packed, as the buffer is used as it is:
+  const unsigned int bytesPerPixel = Pixel::GetBytesPerPixel( pixelFormat );
+  for( const KtxImage& image : images )
   {
-    DALI_LOG_ERROR( "KTX file with too-large image-data field.\n" );
-    return false;
+    if( bytesPerPixel > 0u && image.size != image.width * image.height * bytesPerPixel )
+    {
+      DALI_LOG_ERROR( "KTX file with uncompressed image-data of the wrong size.\n" );
+      return false;
+    }
   }
 
-  Pixel::Format pixelFormat;
-  const bool pixelFormatKnown = ConvertPixelFormat(fileHeader.glInternalFormat, pixelFormat);
-  if(!pixelFormatKnown)
+  // The compressed data is uploaded as it is, so leave it in the page cache rather than read it:
+  std::shared_ptr<Internal::Platform::MappedFile> mappedFile( new Internal::Platform::MappedFile );
+  if( !mappedFile->Map( fp ) )
   {
-    DALI_LOG_ERROR( "No internal pixel format supported for KTX file pixel format.\n" );
-    return false;
+    mappedFile.reset();
   }
 
-  // Load up the image bytes:
-  bitmap = Dali::Devel::PixelBuffer::New(width, height, pixelFormat);
-
-  // Compressed format won't allocate the buffer
-  auto pixels = bitmap.GetBuffer();
-  if( !pixels )
+  bitmaps.clear();
+  bitmaps.reserve( images.size() );
+  for( const KtxImage& image : images )
   {
-    // allocate buffer manually
-    auto &impl = GetImplementation(bitmap);
-    impl.AllocateFixedSize(imageByteCount);
-    pixels = bitmap.GetBuffer();
+    Dali::Devel::PixelBuffer bitmap;
+    if( mappedFile )
+    {
+      if( static_cast<std::size_t>( image.offset ) + image.size > mappedFile->GetSize() )
+      {
+        DALI_LOG_ERROR( "Read of image pixel data failed.\n" );
+        return false;
+      }
+      Internal::Adaptor::PixelBufferPtr pixelBuffer = Internal::Adaptor::PixelBuffer::New( mappedFile, image.offset, image.size,
+                                                                                           image.width, image.height, pixelFormat );
+      bitmap = Dali::Devel::PixelBuffer( pixelBuffer.Get() );
+    }
+    else
+    {
+      // Load up the image bytes:
+      bitmap = Dali::Devel::PixelBuffer::New( image.width, image.height, pixelFormat );
+
+      // Compressed format won't allocate the buffer
+      auto pixels = bitmap.GetBuffer();
+      if( !pixels )
+      {
+        // allocate buffer manually
+        auto &impl = GetImplementation(bitmap);
+        impl.AllocateFixedSize( image.size );
+        pixels = bitmap.GetBuffer();
+      }
+
+      if( !pixels )
+      {
+        DALI_LOG_ERROR( "Unable to reserve a pixel buffer to load the requested bitmap into.\n" );
+        return false;
+      }
+
+      if( fseek( fp, image.offset, SEEK_SET ) || fread( pixels, 1, image.size, fp ) != image.size )
+      {
+        DALI_LOG_ERROR( "Read of image pixel data failed.\n" );
+        return false;
+      }
+    }
+    bitmaps.push_back( bitmap );
   }
 
-  if(!pixels)
+  numberOfLayers = std::max( fileHeader.numberOfArrayElements, 1u );
+  return true;
+}
+
+} // unnamed namespace
+
+// File loading API entry-point:
+bool LoadKtxHeader( const Dali::ImageLoader::Input& input, unsigned int& width, unsigned int& height )
+{
+  KtxFileHeader fileHeader;
+  FILE* const fp = input.file;
+
+  bool ret = LoadKtxHeader(fp, width, height, fileHeader);
+  return ret;
+}
+
+// File loading API entry-point:
+bool LoadBitmapFromKtx( const Dali::ImageLoader::Input& input, Dali::Devel::PixelBuffer& bitmap )
+{
+  // Only the first mipmap level and array layer is loaded:
+  std::vector<Dali::Devel::PixelBuffer> bitmaps;
+  unsigned int numberOfLayers = 0u;
+  if( !LoadKtxImages( input, false, bitmaps, numberOfLayers ) )
   {
-    DALI_LOG_ERROR( "Unable to reserve a pixel buffer to load the requested bitmap into.\n" );
     return false;
   }
 
-  const size_t bytesRead = fread(pixels, 1, imageByteCount, fp);
-  if(bytesRead != imageByteCount)
+  bitmap = bitmaps[0];
+  return true;
+}
+
+// File loading API entry-point:
+bool LoadLevelsFromKtx( const Dali::ImageLoader::Input& input, std::vector<Dali::Devel::PixelBuffer>& bitmaps, unsigned int& numberOfLayers )
+{
+  if( !LoadKtxImages( input, true, bitmaps, numberOfLayers ) )
   {
-    DALI_LOG_ERROR( "Read of image pixel data failed.\n" );
+    bitmaps.clear();
     return false;
   }
-
   return true;
 }
 
@@ -19,6 +19,7 @@
  */
 
 #include <cstdio>
+#include <vector>
 #include <dali/devel-api/adaptor-framework/image-loader-input.h>
 
 namespace Dali
@@ -49,6 +50,16 @@ const unsigned char MAGIC_BYTE_2 = 0x4B;
  */
 bool LoadBitmapFromKtx( const Dali::ImageLoader::Input& input, Dali::Devel::PixelBuffer& bitmap );
 
+/**
+ * Loads every mipmap level and array layer of a compressed texture from a KTX file without decoding it.
+ * When the file can be mapped, the images aren't read, the bitmaps point into the mapping instead.
+ * @param[in]  input          Information about the input image (including file pointer)
+ * @param[out] bitmaps        Set to the images, ordered by mipmap level and then by array layer
+ * @param[out] numberOfLayers Set to the number of array layers of each level, 1 if the texture isn't an array
+ * @return  true if file loaded successfully, false otherwise
+ */
+bool LoadLevelsFromKtx( const Dali::ImageLoader::Input& input, std::vector<Dali::Devel::PixelBuffer>& bitmaps, unsigned int& numberOfLayers );
+
 /**
  * Loads the header of a KTX file and fills in the width and height appropriately.
  * @param[in]   fp      Pointer to the Image file
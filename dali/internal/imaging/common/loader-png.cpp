@@ -17,7 +17,11 @@
 
 #include <dali/internal/imaging/common/loader-png.h>
 
+#include <algorithm>
+#include <cstdlib>
 #include <cstring>
+#include <utility>
+#include <vector>
 
 #include <zlib.h>
 #include <png.h>
@@ -26,6 +30,8 @@
 #include <dali/public-api/images/image.h>
 #include <dali/internal/legacy/tizen/platform-capabilities.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/internal/imaging/common/image-operations.h>
+#include <dali/internal/imaging/common/worker-pool.h>
 
 namespace Dali
 {
@@ -108,6 +114,30 @@ bool LoadPngHeader(FILE *fp, unsigned int &width, unsigned int &height, png_stru
   return true;
 }
 
+/**
+ * @brief Decode the rows of a PNG image one at a time, shrinking them as they come.
+ * @param[in] png The PNG read structure, with the header read.
+ * @param[in] height The height of the image.
+ * @param[in] row A buffer for a decoded row.
+ * @param[in] downscaler Shrinks the rows into the bitmap.
+ * @return false if the image couldn't be decoded.
+ */
+bool DecodeRowsDownscaled( png_structp png, unsigned int height, png_bytep row, Internal::Platform::Pow2ScanlineDownscaler& downscaler )
+{
+  if(setjmp(png_jmpbuf(png)))
+  {
+    DALI_LOG_WARNING("error during png_read_row\n");
+    return false;
+  }
+
+  for( unsigned int y = 0; y < height; ++y )
+  {
+    png_read_row( png, row, NULL );
+    downscaler.PushScanline( row );
+  }
+  return true;
+}
+
 } // namespace - anonymous
 
 bool LoadPngHeader( const Dali::ImageLoader::Input& input, unsigned int& width, unsigned int& height )
@@ -303,6 +333,32 @@ bool LoadBitmapFromPng( const Dali::ImageLoader::Input& input, Dali::Devel::Pixe
 
   }
 
+  // If the image is going to be box filtered down, shrink it row by row as it
+  // is decoded, so the whole of it is never held. The pipeline finishes the
+  // scaling just as it would have done from the whole image. Interlaced images
+  // are decoded in passes over the whole image, so they are still decoded whole:
+  const ImageDimensions desiredDimensions = Internal::Platform::CalculateDesiredDimensions( ImageDimensions( width, height ), input.scalingParameters.dimensions );
+  unsigned int shrunkWidth = width;
+  unsigned int shrunkHeight = height;
+  unsigned int halvings = 0u;
+  if( png_get_interlace_type( png, info ) == PNG_INTERLACE_NONE &&
+      bufferWidth == width && bufferHeight == height && rowBytes == width * bpp &&
+      ( desiredDimensions.GetWidth() < width || desiredDimensions.GetHeight() < height ) )
+  {
+    halvings = Internal::Platform::CalculatePow2Downscale( pixelFormat, width, height, desiredDimensions.GetWidth(), desiredDimensions.GetHeight(),
+                                                           input.scalingParameters.scalingMode, input.scalingParameters.samplingMode, shrunkWidth, shrunkHeight );
+  }
+
+  // The pipeline must work out the same size from the shrunk image as from the whole one:
+  if( halvings > 0u &&
+      Internal::Platform::CalculateDesiredDimensions( ImageDimensions( shrunkWidth, shrunkHeight ), input.scalingParameters.dimensions ) == desiredDimensions )
+  {
+    bitmap = Dali::Devel::PixelBuffer::New( shrunkWidth, shrunkHeight, pixelFormat );
+    Internal::Platform::Pow2ScanlineDownscaler downscaler( pixelFormat, width, height, halvings, bitmap.GetBuffer() );
+    std::vector<png_byte> row( rowBytes );
+    return DecodeRowsDownscaled( png, height, row.data(), downscaler );
+  }
+
   // decode the whole image into bitmap buffer
   auto pixels = (bitmap = Dali::Devel::PixelBuffer::New(bufferWidth, bufferHeight, pixelFormat)).GetBuffer();
 
@@ -391,6 +447,328 @@ namespace
   }
 }
 
+namespace
+{
+
+const unsigned char PNG_SIGNATURE[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+
+/// The size of the strips which are deflated separately, as pigz's blocks. It doesn't depend on the number of cores, so
+/// every machine writes the same file, and it is big enough that the strips' flush markers cost little.
+const std::size_t STRIP_BYTES = 128u * 1024u;
+
+/// Each strip's deflate stream is primed with this much of the data before it, so matches can reach back over the seam.
+const std::size_t DEFLATE_WINDOW_BYTES = 32u * 1024u;
+
+/// A zlib header for a deflate stream with a 32K window at the fastest compression level.
+const unsigned char ZLIB_HEADER[] = { 0x78, 0x01 };
+
+/// The largest length that a PNG chunk can hold.
+const std::size_t MAXIMUM_CHUNK_LENGTH = 0x7fffffffu;
+
+void AppendBigEndian32( Vector<unsigned char>& encoded, uint32_t value )
+{
+  const unsigned char bytes[] = { static_cast<unsigned char>( value >> 24 ), static_cast<unsigned char>( value >> 16 ),
+                                  static_cast<unsigned char>( value >> 8 ), static_cast<unsigned char>( value ) };
+  const Vector<unsigned char>::SizeType offset = encoded.Count();
+  encoded.Resize( offset + sizeof( bytes ) );
+  memcpy( encoded.Begin() + offset, bytes, sizeof( bytes ) );
+}
+
+/**
+ * @brief Append a PNG chunk whose data is the concatenation of some pieces.
+ */
+void AppendChunk( Vector<unsigned char>& encoded, const char* type, const std::vector< std::pair<const unsigned char*, std::size_t> >& pieces )
+{
+  std::size_t length = 0u;
+  for( const auto& piece : pieces )
+  {
+    length += piece.second;
+  }
+  AppendBigEndian32( encoded, static_cast<uint32_t>( length ) );
+
+  const Vector<unsigned char>::SizeType typeOffset = encoded.Count();
+  encoded.Resize( typeOffset + 4u + length );
+  unsigned char* out = encoded.Begin() + typeOffset;
+  memcpy( out, type, 4u );
+  out += 4u;
+  for( const auto& piece : pieces )
+  {
+    memcpy( out, piece.first, piece.second );
+    out += piece.second;
+  }
+
+  // The CRC covers the type and the data:
+  const uLong crc = crc32( crc32( 0L, Z_NULL, 0 ), encoded.Begin() + typeOffset, static_cast<uInt>( 4u + length ) );
+  AppendBigEndian32( encoded, static_cast<uint32_t>( crc ) );
+}
+
+inline unsigned char PaethPredictor( int left, int above, int aboveLeft )
+{
+  const int estimate = left + above - aboveLeft;
+  const int distanceLeft = std::abs( estimate - left );
+  const int distanceAbove = std::abs( estimate - above );
+  const int distanceAboveLeft = std::abs( estimate - aboveLeft );
+  if( distanceLeft <= distanceAbove && distanceLeft <= distanceAboveLeft )
+  {
+    return static_cast<unsigned char>( left );
+  }
+  return static_cast<unsigned char>( distanceAbove <= distanceAboveLeft ? above : aboveLeft );
+}
+
+/**
+ * @brief Filter one row with each of the five PNG filters and keep the one
+ * with the smallest sum of absolute signed differences, as libpng does.
+ * @param[in] row The row to filter, in RGB(A) order.
+ * @param[in] previous The row above, or a row of zeros for the first row.
+ * @param[in] rowBytes The number of bytes in a row.
+ * @param[in] pixelBytes The number of bytes in a pixel.
+ * @param[out] filtered Space for the filter type byte and rowBytes filtered bytes.
+ * @param[in] scratch Space for rowBytes bytes.
+ */
+void FilterRow( const unsigned char* row, const unsigned char* previous, std::size_t rowBytes, unsigned int pixelBytes,
+                unsigned char* filtered, unsigned char* scratch )
+{
+  // Signed bytes further from zero are less likely to compress well:
+  auto cost = []( const unsigned char* bytes, std::size_t count )
+  {
+    std::size_t sum = 0u;
+    for( std::size_t i = 0u; i < count; ++i )
+    {
+      sum += bytes[i] < 128u ? bytes[i] : 256u - bytes[i];
+    }
+    return sum;
+  };
+
+  unsigned char* const best = filtered + 1u;
+  filtered[0] = PNG_FILTER_VALUE_NONE;
+  memcpy( best, row, rowBytes );
+  std::size_t bestCost = cost( best, rowBytes );
+
+  auto keepIfBest = [&]( unsigned char filter )
+  {
+    const std::size_t scratchCost = cost( scratch, rowBytes );
+    if( scratchCost < bestCost )
+    {
+      bestCost = scratchCost;
+      filtered[0] = filter;
+      memcpy( best, scratch, rowBytes );
+    }
+  };
+
+  // The first pixel has nothing to its left:
+  for( std::size_t i = 0u; i < pixelBytes; ++i )
+  {
+    scratch[i] = row[i];
+  }
+  for( std::size_t i = pixelBytes; i < rowBytes; ++i )
+  {
+    scratch[i] = static_cast<unsigned char>( row[i] - row[i - pixelBytes] );
+  }
+  keepIfBest( PNG_FILTER_VALUE_SUB );
+
+  for( std::size_t i = 0u; i < rowBytes; ++i )
+  {
+    scratch[i] = static_cast<unsigned char>( row[i] - previous[i] );
+  }
+  keepIfBest( PNG_FILTER_VALUE_UP );
+
+  for( std::size_t i = 0u; i < pixelBytes; ++i )
+  {
+    scratch[i] = static_cast<unsigned char>( row[i] - ( previous[i] >> 1 ) );
+  }
+  for( std::size_t i = pixelBytes; i < rowBytes; ++i )
+  {
+    scratch[i] = static_cast<unsigned char>( row[i] - ( ( row[i - pixelBytes] + previous[i] ) >> 1 ) );
+  }
+  keepIfBest( PNG_FILTER_VALUE_AVG );
+
+  for( std::size_t i = 0u; i < pixelBytes; ++i )
+  {
+    scratch[i] = static_cast<unsigned char>( row[i] - previous[i] );
+  }
+  for( std::size_t i = pixelBytes; i < rowBytes; ++i )
+  {
+    scratch[i] = static_cast<unsigned char>( row[i] - PaethPredictor( row[i - pixelBytes], previous[i], previous[i - pixelBytes] ) );
+  }
+  keepIfBest( PNG_FILTER_VALUE_PAETH );
+}
+
+/**
+ * @brief Deflate one strip of the filtered image as raw deflate data.
+ *
+ * Every strip but the last ends with a full flush, which byte-aligns the
+ * output without ending the stream, so the strips can be concatenated into
+ * one deflate stream.
+ * @param[in] dictionary The filtered data just before the strip, or nullptr for the first strip.
+ * @param[in] dictionarySize The number of bytes of dictionary.
+ * @param[in] data The filtered data of the strip.
+ * @param[in] size The number of bytes of data.
+ * @param[in] last Whether this is the last strip of the image.
+ * @param[out] deflated The deflated strip.
+ * @return true if the strip was deflated.
+ */
+bool DeflateStrip( const unsigned char* dictionary, std::size_t dictionarySize, const unsigned char* data, std::size_t size, bool last,
+                   std::vector<unsigned char>& deflated )
+{
+  z_stream stream;
+  memset( &stream, 0, sizeof( stream ) );
+  if( deflateInit2( &stream, Z_BEST_SPEED, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY ) != Z_OK )
+  {
+    return false;
+  }
+
+  bool success = !dictionary || deflateSetDictionary( &stream, dictionary, static_cast<uInt>( dictionarySize ) ) == Z_OK;
+
+  // Leave room for the flush marker on top of the worst case:
+  deflated.resize( deflateBound( &stream, static_cast<uLong>( size ) ) + 16u );
+  stream.next_in = const_cast<Bytef*>( data );
+  stream.avail_in = static_cast<uInt>( size );
+  const int flush = last ? Z_FINISH : Z_FULL_FLUSH;
+  while( success )
+  {
+    stream.next_out = deflated.data() + stream.total_out;
+    stream.avail_out = static_cast<uInt>( deflated.size() - stream.total_out );
+    const int result = deflate( &stream, flush );
+    if( result == Z_STREAM_END || ( !last && result == Z_OK && stream.avail_out > 0u ) )
+    {
+      break;
+    }
+    // Otherwise the output ran out of room before the flush completed:
+    success = ( result == Z_OK || result == Z_BUF_ERROR );
+    if( success )
+    {
+      deflated.resize( deflated.size() * 2u );
+    }
+  }
+
+  deflated.resize( stream.total_out );
+  deflateEnd( &stream );
+  return success;
+}
+
+/**
+ * @brief Encode a PNG by filtering and deflating horizontal strips of it in parallel.
+ *
+ * The strips' deflate data is concatenated into one zlib stream in a single
+ * IDAT chunk, as pigz does for gzip files.
+ * @return true if the image was encoded, false if it is too small to split or deflating failed.
+ */
+bool EncodeToPngInStrips( const unsigned char* pixelBuffer, Vector<unsigned char>& encodedPixels, std::size_t width, std::size_t height,
+                          int pngPixelFormat, unsigned int pixelBytes, bool rgbaOrder )
+{
+  using Internal::Platform::WorkerPool;
+
+  const std::size_t rowBytes = width * pixelBytes;
+  const std::size_t filteredRowBytes = rowBytes + 1u;
+  const std::size_t filteredBytes = filteredRowBytes * height;
+  const std::size_t rowsPerStrip = std::max( STRIP_BYTES / filteredRowBytes, static_cast<std::size_t>( 1u ) );
+  const std::size_t numStrips = ( height + rowsPerStrip - 1u ) / rowsPerStrip;
+  if( numStrips < 2u || width > MAXIMUM_CHUNK_LENGTH / pixelBytes || height > MAXIMUM_CHUNK_LENGTH )
+  {
+    return false;
+  }
+  WorkerPool& workerPool = WorkerPool::Get();
+
+  // Filter the rows. Each row's filter only looks at the unfiltered rows, so the bands are independent:
+  std::vector<unsigned char> filtered( filteredBytes );
+  workerPool.ParallelFor( static_cast<unsigned int>( height ), static_cast<unsigned int>( numStrips ), [&]( unsigned int begin, unsigned int end )
+  {
+    std::vector<unsigned char> rows( rowBytes * 3u, 0u );
+    unsigned char* previous = rows.data();
+    unsigned char* current = previous + rowBytes;
+    unsigned char* const scratch = current + rowBytes;
+
+    auto readRow = [&]( unsigned int y, unsigned char* out )
+    {
+      const unsigned char* const in = pixelBuffer + y * rowBytes;
+      memcpy( out, in, rowBytes );
+      if( !rgbaOrder )
+      {
+        for( std::size_t i = 0u; i < rowBytes; i += pixelBytes )
+        {
+          std::swap( out[i], out[i + 2u] );
+        }
+      }
+    };
+
+    if( begin > 0u )
+    {
+      readRow( begin - 1u, previous );
+    }
+    for( unsigned int y = begin; y < end; ++y )
+    {
+      readRow( y, current );
+      FilterRow( current, previous, rowBytes, pixelBytes, &filtered[y * filteredRowBytes], scratch );
+      std::swap( previous, current );
+    }
+  } );
+
+  // Deflate the strips, each primed with the end of the one before:
+  std::vector< std::vector<unsigned char> > deflated( numStrips );
+  std::vector<uLong> adlers( numStrips );
+  std::vector<char> succeeded( numStrips, 0 );
+  workerPool.ParallelFor( static_cast<unsigned int>( numStrips ), static_cast<unsigned int>( numStrips ), [&]( unsigned int begin, unsigned int end )
+  {
+    for( unsigned int strip = begin; strip < end; ++strip )
+    {
+      const std::size_t start = std::min( strip * rowsPerStrip, height ) * filteredRowBytes;
+      const std::size_t stop = std::min( ( strip + 1u ) * rowsPerStrip, height ) * filteredRowBytes;
+      const std::size_t dictionarySize = std::min( start, DEFLATE_WINDOW_BYTES );
+      succeeded[strip] = DeflateStrip( strip > 0u ? &filtered[start - dictionarySize] : nullptr, dictionarySize,
+                                       &filtered[start], stop - start, strip + 1u == numStrips, deflated[strip] );
+      adlers[strip] = adler32( adler32( 0L, Z_NULL, 0 ), &filtered[start], static_cast<uInt>( stop - start ) );
+    }
+  } );
+
+  // Stitch the strips into one zlib stream, combining their checksums:
+  std::size_t idatLength = sizeof( ZLIB_HEADER ) + 4u;
+  uLong adler = adler32( 0L, Z_NULL, 0 );
+  for( std::size_t strip = 0u; strip < numStrips; ++strip )
+  {
+    if( !succeeded[strip] )
+    {
+      return false;
+    }
+    const std::size_t start = std::min( strip * rowsPerStrip, height ) * filteredRowBytes;
+    const std::size_t stop = std::min( ( strip + 1u ) * rowsPerStrip, height ) * filteredRowBytes;
+    adler = adler32_combine( adler, adlers[strip], static_cast<z_off_t>( stop - start ) );
+    idatLength += deflated[strip].size();
+  }
+  if( idatLength > MAXIMUM_CHUNK_LENGTH )
+  {
+    return false;
+  }
+  const unsigned char adlerBytes[] = { static_cast<unsigned char>( adler >> 24 ), static_cast<unsigned char>( adler >> 16 ),
+                                       static_cast<unsigned char>( adler >> 8 ), static_cast<unsigned char>( adler ) };
+
+  const Vector<unsigned char>::SizeType signatureOffset = encodedPixels.Count();
+  encodedPixels.Reserve( signatureOffset + sizeof( PNG_SIGNATURE ) + 25u + idatLength + 12u + 12u );
+  encodedPixels.Resize( signatureOffset + sizeof( PNG_SIGNATURE ) );
+  memcpy( encodedPixels.Begin() + signatureOffset, PNG_SIGNATURE, sizeof( PNG_SIGNATURE ) );
+
+  const unsigned char header[] = { static_cast<unsigned char>( width >> 24 ), static_cast<unsigned char>( width >> 16 ),
+                                   static_cast<unsigned char>( width >> 8 ), static_cast<unsigned char>( width ),
+                                   static_cast<unsigned char>( height >> 24 ), static_cast<unsigned char>( height >> 16 ),
+                                   static_cast<unsigned char>( height >> 8 ), static_cast<unsigned char>( height ),
+                                   8u, static_cast<unsigned char>( pngPixelFormat ),
+                                   PNG_COMPRESSION_TYPE_BASE, PNG_FILTER_TYPE_BASE, PNG_INTERLACE_NONE };
+  AppendChunk( encodedPixels, "IHDR", { { header, sizeof( header ) } } );
+
+  std::vector< std::pair<const unsigned char*, std::size_t> > pieces;
+  pieces.emplace_back( ZLIB_HEADER, sizeof( ZLIB_HEADER ) );
+  for( const auto& strip : deflated )
+  {
+    pieces.emplace_back( strip.data(), strip.size() );
+  }
+  pieces.emplace_back( adlerBytes, sizeof( adlerBytes ) );
+  AppendChunk( encodedPixels, "IDAT", pieces );
+
+  AppendChunk( encodedPixels, "IEND", {} );
+  return true;
+}
+
+} // unnamed namespace
+
 /**
  * Potential improvements:
  * 1. Detect <= 256 colours and write in palette mode.
@@ -403,7 +781,7 @@ namespace
  * 7. If caller asks for no compression, bypass libpng and blat raw data to
  *    disk, topped and tailed with header/tail blocks.
  */
-bool EncodeToPng( const unsigned char* const pixelBuffer, Vector<unsigned char>& encodedPixels, std::size_t width, std::size_t height, Pixel::Format pixelFormat )
+bool EncodeToPng( const unsigned char* const pixelBuffer, Vector<unsigned char>& encodedPixels, std::size_t width, std::size_t height, Pixel::Format pixelFormat, bool parallel )
 {
   // Translate pixel format enum:
   int pngPixelFormat = -1;
@@ -437,6 +815,13 @@ bool EncodeToPng( const unsigned char* const pixelBuffer, Vector<unsigned char>&
     }
   }
 
+  // Big images can be split into strips and encoded on several cores.
+  // Otherwise, or if that fails, fall back to libpng:
+  if( parallel && EncodeToPngInStrips( pixelBuffer, encodedPixels, width, height, pngPixelFormat, pixelBytes, rgbaOrder ) )
+  {
+    return true;
+  }
+
   const int interlace = PNG_INTERLACE_NONE;
 
   png_structp png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
@@ -68,8 +68,10 @@ bool LoadPngHeader( const Dali::ImageLoader::Input& input, unsigned int& width,
  * @param[in]  width          Image width
  * @param[in]  height         Image height
  * @param[in]  pixelFormat    Input pixel format (must be Pixel::RGB888)
+ * @param[in]  parallel       Whether to filter and compress strips of a big image on several threads.
+ *                            Small images, and any which fail to encode this way, are encoded with libpng.
  */
-bool EncodeToPng( const unsigned char* pixelBuffer, Vector<unsigned char>& encodedPixels, std::size_t width, std::size_t height, Pixel::Format pixelFormat );
+bool EncodeToPng( const unsigned char* pixelBuffer, Vector<unsigned char>& encodedPixels, std::size_t width, std::size_t height, Pixel::Format pixelFormat, bool parallel = false );
 
 } // namespace TizenPlatform
 
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/common/mapped-file.h>
+
+// EXTERNAL INCLUDES
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+MappedFile::MappedFile()
+: mData( nullptr ),
+  mSize( 0u )
+{
+}
+
+MappedFile::~MappedFile()
+{
+  Unmap();
+}
+
+bool MappedFile::Map( FILE* file )
+{
+  Unmap();
+
+  // Streams over memory have no file descriptor:
+  const int fileDescriptor = file ? fileno( file ) : -1;
+  if( fileDescriptor < 0 )
+  {
+    return false;
+  }
+
+  struct stat fileStat;
+  if( fstat( fileDescriptor, &fileStat ) != 0 || !S_ISREG( fileStat.st_mode ) || fileStat.st_size <= 0 )
+  {
+    return false;
+  }
+
+  const std::size_t size = static_cast< std::size_t >( fileStat.st_size );
+  void* const address = mmap( nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0 );
+
+// MAP_FAILED is a macro with C cast
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+  if( address == MAP_FAILED )
+  {
+    return false;
+  }
+#pragma GCC diagnostic pop
+
+  // Decoders read the file from start to end, so let the kernel read ahead:
+  madvise( address, size, MADV_SEQUENTIAL );
+
+  mData = static_cast< const uint8_t* >( address );
+  mSize = size;
+  return true;
+}
+
+void MappedFile::Unmap()
+{
+  if( mData )
+  {
+    munmap( const_cast< uint8_t* >( mData ), mSize );
+    mData = nullptr;
+    mSize = 0u;
+  }
+}
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Dali
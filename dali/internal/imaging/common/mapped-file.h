@@ -0,0 +1,110 @@
+#ifndef DALI_INTERNAL_PLATFORM_MAPPED_FILE_H
+#define DALI_INTERNAL_PLATFORM_MAPPED_FILE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+/**
+ * @brief A read-only view of the whole of a file, mapped into memory.
+ *
+ * Loaders which need the entire encoded image in memory can decode straight
+ * from the page cache instead of reading the file into a buffer of their own,
+ * which saves an allocation the size of the file as well as the copy.
+ *
+ * Only regular files can be mapped. Streams over memory, such as images
+ * downloaded from the network, and pipes fail to map, and should be read into
+ * a buffer as before.
+ *
+ * @note If the file is truncated while it is mapped, reading the pages past the
+ * new end raises SIGBUS, so only map files which aren't being written to.
+ */
+class MappedFile
+{
+public:
+
+  /**
+   * @brief Create an empty mapping.
+   */
+  MappedFile();
+
+  /**
+   * @brief Destructor. Unmaps the file.
+   */
+  ~MappedFile();
+
+  /**
+   * @brief Map the whole of the file a stream reads, whatever its position.
+   *
+   * Any previous mapping is unmapped first. The stream is left as it was and
+   * may be closed while the file is mapped.
+   * @param[in] file The stream.
+   * @return true if the file was mapped, false if it isn't a regular file, is empty or couldn't be mapped.
+   */
+  bool Map( FILE* file );
+
+  /**
+   * @brief Unmap the file, leaving this empty.
+   */
+  void Unmap();
+
+  /**
+   * @brief Get the contents of the file.
+   * @return The start of the file, or nullptr if nothing is mapped.
+   */
+  const uint8_t* GetData() const
+  {
+    return mData;
+  }
+
+  /**
+   * @brief Get the size of the file.
+   * @return The size in bytes, or zero if nothing is mapped.
+   */
+  std::size_t GetSize() const
+  {
+    return mSize;
+  }
+
+private:
+
+  // Undefined
+  MappedFile( const MappedFile& );
+  MappedFile& operator=( const MappedFile& );
+
+private:
+
+  const uint8_t* mData; ///< The mapping, or nullptr.
+  std::size_t    mSize; ///< The size of the mapping in bytes.
+};
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Dali
+
+#endif // DALI_INTERNAL_PLATFORM_MAPPED_FILE_H
@@ -20,13 +20,16 @@
 
 // EXTERNAL INCLUDES
 #include <stdlib.h>
+#include <cmath>
 #include <cstring>
 
 // INTERNAL INCLUDES
 #include <dali/internal/imaging/common/pixel-manipulation.h>
 #include <dali/internal/imaging/common/alpha-mask.h>
+#include <dali/internal/imaging/common/buffer-pool.h>
 #include <dali/internal/imaging/common/gaussian-blur.h>
 #include <dali/internal/imaging/common/image-operations.h>
+#include <dali/internal/imaging/common/mapped-file.h>
 
 namespace Dali
 {
@@ -40,6 +43,34 @@ namespace Adaptor
 namespace
 {
 const float TWO_PI = 2.f * Math::PI; ///< 360 degrees in radians
+const float RAD_270 = 3.f * Math::PI_2; ///< 270 degrees in radians
+
+/**
+ * @brief Find whether an angle is a whole number of quarter turns.
+ * @param[in] radians The angle, in the range [0..2PI].
+ * @param[out] transform The rotation the angle is equivalent to.
+ * @return Whether it is a 90, 180 or 270 degree rotation.
+ */
+bool GetQuarterTurn( float radians, Platform::PixelTransform& transform )
+{
+  if( fabsf( radians - Math::PI_2 ) < Dali::Math::MACHINE_EPSILON_10 )
+  {
+    transform = Platform::PixelTransformRotate90;
+    return true;
+  }
+  if( fabsf( radians - Math::PI ) < Dali::Math::MACHINE_EPSILON_10 )
+  {
+    transform = Platform::PixelTransformRotate180;
+    return true;
+  }
+  if( fabsf( radians - RAD_270 ) < Dali::Math::MACHINE_EPSILON_10 )
+  {
+    transform = Platform::PixelTransformRotate270;
+    return true;
+  }
+  return false;
+}
+
 } // namespace
 
 PixelBuffer::PixelBuffer( unsigned char* buffer,
@@ -48,7 +79,10 @@ PixelBuffer::PixelBuffer( unsigned char* buffer,
                           unsigned int height,
                           Dali::Pixel::Format pixelFormat )
 : mMetadata(),
+  mMetadataLoader(),
   mBuffer( buffer ),
+  mSharedPixelData(),
+  mMappedFile(),
   mBufferSize( bufferSize ),
   mWidth( width ),
   mHeight( height ),
@@ -70,7 +104,7 @@ PixelBufferPtr PixelBuffer::New( unsigned int width,
   unsigned char* buffer = NULL;
   if( bufferSize > 0 )
   {
-    buffer = static_cast<unsigned char*>( malloc ( bufferSize ) );
+    buffer = Platform::BufferPool::Get().Allocate( bufferSize );
   }
   return new PixelBuffer( buffer, bufferSize, width, height, pixelFormat );
 }
@@ -84,14 +118,25 @@ PixelBufferPtr PixelBuffer::New( unsigned char* buffer,
   return new PixelBuffer( buffer, bufferSize, width, height, pixelFormat );
 }
 
+PixelBufferPtr PixelBuffer::New( std::shared_ptr<const Platform::MappedFile> mappedFile,
+                                 std::size_t offset,
+                                 unsigned int bufferSize,
+                                 unsigned int width,
+                                 unsigned int height,
+                                 Dali::Pixel::Format pixelFormat )
+{
+  // The mapping is read-only, GetBuffer() copies the pixels before handing out a pointer to write to:
+  unsigned char* buffer = const_cast< unsigned char* >( mappedFile->GetData() + offset );
+  PixelBufferPtr pixelBuffer = new PixelBuffer( buffer, bufferSize, width, height, pixelFormat );
+  pixelBuffer->mMappedFile = std::move( mappedFile );
+  return pixelBuffer;
+}
+
 Dali::PixelData PixelBuffer::Convert( PixelBuffer& pixelBuffer )
 {
-  Dali::PixelData pixelData = Dali::PixelData::New( pixelBuffer.mBuffer,
-                                                    pixelBuffer.mBufferSize,
-                                                    pixelBuffer.mWidth,
-                                                    pixelBuffer.mHeight,
-                                                    pixelBuffer.mPixelFormat,
-                                                    Dali::PixelData::FREE );
+  Dali::PixelData pixelData = pixelBuffer.CreatePixelData();
+  pixelBuffer.mSharedPixelData.Reset();
+  pixelBuffer.mMappedFile.reset();
   pixelBuffer.mBuffer = NULL;
   pixelBuffer.mWidth = 0;
   pixelBuffer.mHeight = 0;
@@ -115,8 +160,23 @@ Dali::Pixel::Format PixelBuffer::GetPixelFormat() const
   return mPixelFormat;
 }
 
-unsigned char* PixelBuffer::GetBuffer() const
+unsigned char* PixelBuffer::GetBuffer()
 {
+  if( mSharedPixelData && mSharedPixelData.GetBaseObject().ReferenceCount() > 1 )
+  {
+    // Copy on write, so the PixelData handed out keeps the pixels it was made with:
+    unsigned char* buffer = Platform::BufferPool::Get().Allocate( mBufferSize );
+    memcpy( buffer, mBuffer, mBufferSize );
+    mSharedPixelData.Reset();
+    mBuffer = buffer;
+  }
+  else if( mMappedFile )
+  {
+    unsigned char* buffer = Platform::BufferPool::Get().Allocate( mBufferSize );
+    memcpy( buffer, mBuffer, mBufferSize );
+    mMappedFile.reset();
+    mBuffer = buffer;
+  }
   return mBuffer;
 }
 
@@ -132,19 +192,28 @@ unsigned int PixelBuffer::GetBufferSize() const
 
 Dali::PixelData PixelBuffer::CreatePixelData() const
 {
-  unsigned char* destBuffer = NULL;
-
-  if( mBufferSize > 0 )
+  if( mMappedFile )
   {
-    destBuffer = static_cast<unsigned char*>( malloc( mBufferSize ) );
-    memcpy( destBuffer, mBuffer, mBufferSize );
+    // A PixelData can only free its buffer, so it gets a copy of the pixels in the mapping:
+    unsigned char* buffer = Platform::BufferPool::Get().Allocate( mBufferSize );
+    memcpy( buffer, mBuffer, mBufferSize );
+    Platform::BufferPool::Get().Detach( buffer );
+    return Dali::PixelData::New( buffer, mBufferSize,
+                                 mWidth, mHeight,
+                                 mPixelFormat,
+                                 Dali::PixelData::FREE );
   }
 
-  Dali::PixelData pixelData = Dali::PixelData::New( destBuffer, mBufferSize,
-                                                    mWidth, mHeight,
-                                                    mPixelFormat,
-                                                    Dali::PixelData::FREE );
-  return pixelData;
+  if( !mSharedPixelData )
+  {
+    // The PixelData frees the buffer itself, once both it and this object are done with it:
+    Platform::BufferPool::Get().Detach( mBuffer );
+    mSharedPixelData = Dali::PixelData::New( mBuffer, mBufferSize,
+                                             mWidth, mHeight,
+                                             mPixelFormat,
+                                             Dali::PixelData::FREE );
+  }
+  return mSharedPixelData;
 }
 
 void PixelBuffer::ApplyMask( const PixelBuffer& inMask, float contentScale, bool cropToMask )
@@ -200,6 +269,9 @@ void PixelBuffer::TakeOwnershipOfBuffer( PixelBuffer& pixelBuffer )
   // Take ownership of new buffer
   mBuffer = pixelBuffer.mBuffer;
   pixelBuffer.mBuffer = NULL;
+  mSharedPixelData = pixelBuffer.mSharedPixelData;
+  pixelBuffer.mSharedPixelData.Reset();
+  mMappedFile = std::move( pixelBuffer.mMappedFile );
   mBufferSize = pixelBuffer.mBufferSize;
   mWidth = pixelBuffer.mWidth;
   mHeight = pixelBuffer.mHeight;
@@ -208,16 +280,26 @@ void PixelBuffer::TakeOwnershipOfBuffer( PixelBuffer& pixelBuffer )
 
 void PixelBuffer::ReleaseBuffer()
 {
-  if( mBuffer )
+  if( mSharedPixelData )
+  {
+    // The PixelData frees the buffer when the last handle to it goes:
+    mSharedPixelData.Reset();
+  }
+  else if( mMappedFile )
   {
-    free( mBuffer );
+    // The file is unmapped when the last buffer in it goes:
+    mMappedFile.reset();
+  }
+  else
+  {
+    Platform::BufferPool::Get().Release( mBuffer );
   }
 }
 
 void PixelBuffer::AllocateFixedSize( uint32_t size )
 {
   ReleaseBuffer();
-  mBuffer = reinterpret_cast<unsigned char*>(malloc( size ));
+  mBuffer = Platform::BufferPool::Get().Allocate( size );
   mBufferSize = size;
 }
 
@@ -269,6 +351,16 @@ bool PixelBuffer::Rotate( Degree angle )
 
   const unsigned int pixelSize = Pixel::GetBytesPerPixel( mPixelFormat );
 
+  // Turning a square image by quarter turns, or any image upside down, doesn't need a second buffer.
+  // The size is checked first so a shared buffer is only copied when it will be written to:
+  Platform::PixelTransform quarterTurn;
+  if( GetQuarterTurn( radians, quarterTurn ) &&
+      ( mWidth == mHeight || quarterTurn == Platform::PixelTransformRotate180 ) &&
+      Platform::TransformPixelsInPlace( GetBuffer(), mWidth, mHeight, pixelSize, quarterTurn ) )
+  {
+    return true;
+  }
+
   uint8_t* pixelsOut = nullptr;
   Platform::RotateByShear( mBuffer,
                            mWidth,
@@ -361,10 +453,16 @@ PixelBufferPtr PixelBuffer::NewCrop( const PixelBuffer& inBuffer, uint16_t x, ui
 void PixelBuffer::SetMetadata( const Property::Map& map )
 {
   mMetadata.reset(new Property::Map(map));
+  mMetadataLoader = nullptr;
 }
 
 bool PixelBuffer::GetMetadata(Property::Map& outMetadata) const
 {
+  if( !mMetadata && mMetadataLoader )
+  {
+    mMetadata = mMetadataLoader();
+    mMetadataLoader = nullptr;
+  }
   if( !mMetadata )
   {
     return false;
@@ -376,6 +474,13 @@ bool PixelBuffer::GetMetadata(Property::Map& outMetadata) const
 void PixelBuffer::SetMetadata(std::unique_ptr<Property::Map> metadata)
 {
   mMetadata = std::move(metadata);
+  mMetadataLoader = nullptr;
+}
+
+void PixelBuffer::SetMetadataLoader( MetadataLoader loader )
+{
+  mMetadata.reset();
+  mMetadataLoader = std::move( loader );
 }
 
 void PixelBuffer::Resize( ImageDimensions outDimensions )
@@ -440,32 +545,29 @@ void PixelBuffer::ApplyGaussianBlur( const float blurRadius )
   }
 }
 
-void PixelBuffer::MultiplyColorByAlpha()
+void PixelBuffer::ApplyApproximateGaussianBlur( const float blurRadius )
 {
-  auto bytesPerPixel = Pixel::GetBytesPerPixel( mPixelFormat );
+  // This method only works for pixel buffer in RGBA format.
+  if( mWidth > 0 && mHeight > 0 && mPixelFormat == Pixel::RGBA8888 )
+  {
+    if ( blurRadius > Math::MACHINE_EPSILON_1 )
+    {
+      PerformApproximateGaussianBlurRGBA( *this, blurRadius );
+    }
+  }
+  else
+  {
+    DALI_LOG_ERROR( "Trying to apply gaussian blur to an empty pixel buffer or a pixel buffer not in RGBA format" );
+  }
+}
 
+void PixelBuffer::MultiplyColorByAlpha()
+{
   // Compressed textures have unknown size of the pixel. Alpha premultiplication
   // must be skipped in such case
   if( Pixel::GetBytesPerPixel(mPixelFormat) && Pixel::HasAlpha(mPixelFormat) )
   {
-    unsigned char* pixel = mBuffer;
-    const unsigned int bufferSize = mWidth * mHeight;
-
-    for( unsigned int i=0; i<bufferSize; ++i )
-    {
-      unsigned int alpha = ReadChannel( pixel, mPixelFormat, Adaptor::ALPHA );
-      {
-        auto red       = ReadChannel( pixel, mPixelFormat, Adaptor::RED);
-        auto green     = ReadChannel( pixel, mPixelFormat, Adaptor::GREEN);
-        auto blue      = ReadChannel( pixel, mPixelFormat, Adaptor::BLUE);
-        auto luminance = ReadChannel( pixel, mPixelFormat, Adaptor::LUMINANCE);
-        WriteChannel( pixel, mPixelFormat, Adaptor::RED, red*alpha / 255 );
-        WriteChannel( pixel, mPixelFormat, Adaptor::GREEN, green*alpha/255 );
-        WriteChannel( pixel, mPixelFormat, Adaptor::BLUE, blue*alpha/255 );
-        WriteChannel( pixel, mPixelFormat, Adaptor::LUMINANCE, luminance*alpha/255 );
-      }
-      pixel += bytesPerPixel;
-    }
+    Adaptor::MultiplyColorByAlpha( GetBuffer(), mPixelFormat, mWidth * mHeight );
   }
   mPreMultiplied = true;
 }
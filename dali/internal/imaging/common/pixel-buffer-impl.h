@@ -26,6 +26,7 @@
 #include <dali/public-api/object/property-map.h>
 
 // EXTERNAL INCLUDES
+#include <functional>
 #include <memory>
 
 namespace Dali
@@ -34,6 +35,11 @@ namespace Dali
 namespace Internal
 {
 
+namespace Platform
+{
+class MappedFile;
+}
+
 namespace Adaptor
 {
 
@@ -73,10 +79,33 @@ public:
                              unsigned int height,
                              Pixel::Format pixelFormat );
 
+  /**
+   * @brief Create a PixelBuffer object whose pixels are part of a mapped file.
+   *
+   * Compressed textures are uploaded as they are stored, so they needn't be read
+   * into a buffer of their own. The pixels stay in the page cache, and the file is
+   * kept mapped until this object is done with them. They are copied the first
+   * time they are written to, or converted to a PixelData, which must own its buffer.
+   *
+   * @param [in] mappedFile       The file the pixels are in
+   * @param [in] offset           The offset of the pixels from the start of the file in bytes
+   * @param [in] bufferSize       The size of the pixels in bytes
+   * @param [in] width            Buffer width in pixels
+   * @param [in] height           Buffer height in pixels
+   * @param [in] pixelFormat      The pixel format
+   */
+  static PixelBufferPtr New( std::shared_ptr<const Platform::MappedFile> mappedFile,
+                             std::size_t offset,
+                             unsigned int bufferSize,
+                             unsigned int width,
+                             unsigned int height,
+                             Pixel::Format pixelFormat );
+
   /**
    * Convert a pixelBuffer object into a PixelData object.
    * The new object takes ownership of the buffer data, and the
-   * mBuffer pointer is reset to NULL.
+   * mBuffer pointer is reset to NULL. If the buffer is already shared
+   * by CreatePixelData(), that PixelData is returned.
    * @param[in] pixelBuffer The buffer to convert
    * @return the pixelData
    */
@@ -127,10 +156,15 @@ public:
   Pixel::Format GetPixelFormat() const;
 
   /**
-   * Get the pixel buffer if it's present.
+   * Get the pixel buffer to write to, if it's present.
+   *
+   * If the buffer is shared with a PixelData from CreatePixelData() which is
+   * still in use elsewhere, it is copied first so the PixelData doesn't change.
+   * Pixels in a mapped file are copied first too.
+   * Use GetConstBuffer() to read the pixels without copying them.
    * @return The buffer if exists, or NULL if there is no pixel buffer.
    */
-  unsigned char* GetBuffer() const;
+  unsigned char* GetBuffer();
 
   /**
    * @copydoc Devel::PixelBuffer::GetBuffer()
@@ -144,7 +178,11 @@ public:
   unsigned int GetBufferSize() const;
 
   /**
-   * Copy the buffer into a new PixelData
+   * Share the buffer with a PixelData, without copying it.
+   *
+   * The PixelData takes over freeing the buffer. The same PixelData is returned
+   * until the buffer is replaced, or written to while the PixelData is in use.
+   * Pixels in a mapped file are copied into a new PixelData each time instead.
    */
   Dali::PixelData CreatePixelData() const;
 
@@ -168,6 +206,13 @@ public:
    */
   void ApplyGaussianBlur( const float blurRadius );
 
+  /**
+   * @brief Apply an approximation of a Gaussian blur to the current buffer with the given radius.
+   *
+   * @param[in] blurRadius The radius for Gaussian blur
+   */
+  void ApplyApproximateGaussianBlur( const float blurRadius );
+
   /**
    * Crops this buffer to the given crop rectangle. Assumes the crop rectangle
    * is within the bounds of this size.
@@ -211,6 +256,21 @@ public:
    */
   void SetMetadata(std::unique_ptr<Property::Map> metadata);
 
+  /**
+   * @brief A function which builds the metadata property map.
+   */
+  using MetadataLoader = std::function< std::unique_ptr<Property::Map>() >;
+
+  /**
+   * @brief Sets a function to build the metadata the first time it is asked for
+   *
+   * Few callers ever look at the metadata, so loaders keep what they need to
+   * build it instead of parsing it while decoding. Replaces any metadata
+   * already set.
+   * @param[in] loader The function, called at most once, from GetMetadata()
+   */
+  void SetMetadataLoader( MetadataLoader loader );
+
   /**
    * Allocates fixed amount of memory for the pixel data. Used by compressed formats.
    * @param[in] size Size of memory to be allocated
@@ -249,7 +309,7 @@ private:
   void TakeOwnershipOfBuffer( PixelBuffer& pixelBuffer );
 
   /**
-   * Release the buffer
+   * Release the buffer, or this object's handle to it if it is shared or mapped
    */
   void ReleaseBuffer();
 
@@ -282,13 +342,18 @@ private:
 
 private:
 
-  std::unique_ptr<Property::Map>  mMetadata;         ///< Metadata fields
-  unsigned char*                  mBuffer;           ///< The raw pixel data
-  unsigned int                    mBufferSize;       ///< Buffer sized in bytes
-  unsigned int                    mWidth;            ///< Buffer width in pixels
-  unsigned int                    mHeight;           ///< Buffer height in pixels
-  Pixel::Format                   mPixelFormat;      ///< Pixel format
-  bool                            mPreMultiplied; ///< PreMultiplied
+  friend class PixelBufferPipeline; ///< Runs the post-processing steps on the buffer directly
+
+  mutable std::unique_ptr<Property::Map>      mMetadata;        ///< Metadata fields
+  mutable MetadataLoader                      mMetadataLoader;  ///< Builds mMetadata when it is first asked for, or empty
+  unsigned char*                              mBuffer;          ///< The raw pixel data
+  mutable Dali::PixelData                     mSharedPixelData; ///< The PixelData which owns mBuffer once it is shared, or empty
+  std::shared_ptr<const Platform::MappedFile> mMappedFile;      ///< The file mBuffer points into, or empty if mBuffer is owned
+  unsigned int                                mBufferSize;      ///< Buffer sized in bytes
+  unsigned int                                mWidth;           ///< Buffer width in pixels
+  unsigned int                                mHeight;          ///< Buffer height in pixels
+  Pixel::Format                               mPixelFormat;     ///< Pixel format
+  bool                                        mPreMultiplied;   ///< PreMultiplied
 };
 
 } // namespace Adaptor
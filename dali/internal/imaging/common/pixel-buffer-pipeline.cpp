@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/common/pixel-buffer-pipeline.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#include <dali/integration-api/debug.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/imaging/common/alpha-mask.h>
+#include <dali/internal/imaging/common/image-operations.h>
+#include <dali/internal/imaging/common/pixel-manipulation.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+
+/**
+ * @brief The most bytes of one stage of the pipeline to keep in a tile of scanlines.
+ *
+ * Small enough that a tile of input and a tile of output stay in the cache between the steps.
+ */
+const unsigned int TILE_BYTES = 64u * 1024u;
+
+/**
+ * @brief Whether a mask can be applied to the alpha channel of a buffer in place.
+ * @param[in] pixelFormat The pixel format of the buffer.
+ * @return true if the format has an 8 bit alpha channel, false if masking makes a new RGBA8888 buffer.
+ */
+bool CanMaskInPlace( Pixel::Format pixelFormat )
+{
+  int byteOffset = 0;
+  int bitMask = 0;
+  Dali::Pixel::GetAlphaOffsetAndMask( pixelFormat, byteOffset, bitMask );
+  return Dali::Pixel::HasAlpha( pixelFormat ) && bitMask == 255;
+}
+
+} // unnamed namespace
+
+PixelBufferPipeline::PixelBufferPipeline()
+: mMask(),
+  mDimensions(),
+  mFittingMode( FittingMode::DEFAULT ),
+  mSamplingMode( SamplingMode::DEFAULT ),
+  mOutputFormat( Pixel::RGBA8888 ),
+  mApplyAttributes( false ),
+  mMultiplyColorByAlpha( false ),
+  mConvertFormat( false )
+{
+}
+
+void PixelBufferPipeline::SetAttributes( ImageDimensions dimensions, FittingMode::Type fittingMode, SamplingMode::Type samplingMode )
+{
+  mDimensions = dimensions;
+  mFittingMode = fittingMode;
+  mSamplingMode = samplingMode;
+  mApplyAttributes = true;
+}
+
+void PixelBufferPipeline::SetMask( PixelBufferPtr mask )
+{
+  mMask = mask;
+}
+
+void PixelBufferPipeline::SetMultiplyColorByAlpha()
+{
+  mMultiplyColorByAlpha = true;
+}
+
+void PixelBufferPipeline::SetOutputFormat( Pixel::Format pixelFormat )
+{
+  mOutputFormat = pixelFormat;
+  mConvertFormat = true;
+}
+
+PixelBufferPtr PixelBufferPipeline::Process( PixelBufferPtr buffer ) const
+{
+  if( !buffer )
+  {
+    return buffer;
+  }
+
+  PixelBufferPtr input = buffer;
+
+  // The downscale is done in passes of its own. The crop and pad that follow it are fused with the other steps.
+  Platform::FittingModeCrop crop;
+  bool cropping = false;
+  if( mApplyAttributes )
+  {
+    const ImageDimensions desiredDimensions = Platform::CalculateDesiredDimensions( ImageDimensions( input->GetWidth(), input->GetHeight() ), mDimensions );
+
+    Dali::Devel::PixelBuffer bitmap( input.Get() );
+    bitmap = Platform::DownscaleBitmap( bitmap, desiredDimensions, mFittingMode, mSamplingMode );
+    if( !bitmap )
+    {
+      return PixelBufferPtr();
+    }
+    input = &GetImplementation( bitmap );
+
+    cropping = Platform::CalculateCropForFittingMode( ImageDimensions( input->GetWidth(), input->GetHeight() ), desiredDimensions, mFittingMode, crop );
+  }
+
+  const Pixel::Format inputFormat = input->GetPixelFormat();
+  const unsigned int inputBytesPerPixel = Pixel::GetBytesPerPixel( inputFormat );
+  if( inputBytesPerPixel == 0u )
+  {
+    DALI_LOG_ERROR( "Pixel buffer pipeline can't process compressed pixel format %d\n", static_cast<int>( inputFormat ) );
+    return input;
+  }
+
+  const unsigned int width = cropping ? crop.outputDimensions.GetWidth() : input->GetWidth();
+  const unsigned int height = cropping ? crop.outputDimensions.GetHeight() : input->GetHeight();
+
+  // Work out the pixel format after each step:
+  PixelBufferPtr mask = mMask;
+  const bool maskInPlace = CanMaskInPlace( inputFormat );
+  const Pixel::Format maskedFormat = ( mask && !maskInPlace ) ? Pixel::RGBA8888 : inputFormat;
+  Pixel::Format outputFormat = mConvertFormat ? mOutputFormat : maskedFormat;
+  if( ( outputFormat != maskedFormat ) && !ConvertPixels( nullptr, maskedFormat, nullptr, outputFormat, 0u ) )
+  {
+    DALI_LOG_ERROR( "Pixel buffer pipeline can't convert pixel format %d to %d\n", static_cast<int>( maskedFormat ), static_cast<int>( outputFormat ) );
+    outputFormat = maskedFormat;
+  }
+
+  const bool multiplyColorByAlpha = mMultiplyColorByAlpha && Pixel::HasAlpha( maskedFormat );
+  if( !cropping && !mask && !multiplyColorByAlpha && ( outputFormat == inputFormat ) )
+  {
+    if( mMultiplyColorByAlpha )
+    {
+      input->mPreMultiplied = true;
+    }
+    return input;
+  }
+
+  if( mask && ( ( mask->GetWidth() != width ) || ( mask->GetHeight() != height ) ) )
+  {
+    mask = PixelBuffer::NewResize( *mask, ImageDimensions( width, height ) );
+  }
+
+  // Without a crop or a change of format every step can be done in place:
+  const bool inPlace = !cropping && ( maskedFormat == inputFormat ) && ( outputFormat == inputFormat );
+  PixelBufferPtr output = inPlace ? input : PixelBuffer::New( width, height, outputFormat );
+
+  const unsigned int maskedBytesPerPixel = Pixel::GetBytesPerPixel( maskedFormat );
+  const unsigned int outputBytesPerPixel = Pixel::GetBytesPerPixel( outputFormat );
+  const unsigned int maskBytesPerPixel = mask ? Pixel::GetBytesPerPixel( mask->GetPixelFormat() ) : 0u;
+  const unsigned int widestScanline = width * std::max( std::max( inputBytesPerPixel, maskedBytesPerPixel ), outputBytesPerPixel );
+  const unsigned int scanlinesPerTile = std::max( 1u, TILE_BYTES / std::max( 1u, widestScanline ) );
+
+  // Tiles for the cropped and the masked scanlines, when they can't be written straight to the output:
+  const bool cropToOutput = ( inputFormat == outputFormat ) && ( maskedFormat == outputFormat );
+  const bool maskToOutput = ( maskedFormat == outputFormat );
+  std::vector<uint8_t> croppedTile( ( cropping && !cropToOutput ) ? scanlinesPerTile * width * inputBytesPerPixel : 0u );
+  std::vector<uint8_t> maskedTile( ( mask && !maskInPlace && !maskToOutput ) ? scanlinesPerTile * width * maskedBytesPerPixel : 0u );
+
+  for( unsigned int firstScanline = 0u; firstScanline < height; firstScanline += scanlinesPerTile )
+  {
+    const unsigned int endScanline = std::min( firstScanline + scanlinesPerTile, height );
+    const unsigned int numPixels = ( endScanline - firstScanline ) * width;
+    uint8_t* const outputPixels = output->GetBuffer() + firstScanline * width * outputBytesPerPixel;
+
+    // The scanlines of the input, cropped and padded if needed:
+    uint8_t* pixels = nullptr;
+    if( cropping )
+    {
+      uint8_t* const croppedPixels = cropToOutput ? outputPixels : &croppedTile[0];
+      Platform::CropAndPadScanlines( input->GetConstBuffer(), input->GetWidth(), inputBytesPerPixel, crop, firstScanline, endScanline, croppedPixels );
+      pixels = croppedPixels;
+    }
+    else
+    {
+      pixels = input->GetBuffer() + firstScanline * width * inputBytesPerPixel;
+    }
+
+    if( mask )
+    {
+      const uint8_t* const maskPixels = mask->GetConstBuffer() + firstScanline * width * maskBytesPerPixel;
+      if( maskInPlace )
+      {
+        ApplyMaskToAlphaChannel( pixels, inputFormat, input->IsAlphaPreMultiplied(), maskPixels, mask->GetPixelFormat(), numPixels );
+      }
+      else
+      {
+        uint8_t* const maskedPixels = maskToOutput ? outputPixels : &maskedTile[0];
+        CreateMaskedPixels( pixels, inputFormat, maskPixels, mask->GetPixelFormat(), maskedPixels, numPixels );
+        pixels = maskedPixels;
+      }
+    }
+
+    if( multiplyColorByAlpha )
+    {
+      MultiplyColorByAlpha( pixels, maskedFormat, numPixels );
+    }
+
+    if( pixels != outputPixels )
+    {
+      if( maskedFormat == outputFormat )
+      {
+        memcpy( outputPixels, pixels, numPixels * outputBytesPerPixel );
+      }
+      else
+      {
+        ConvertPixels( pixels, maskedFormat, outputPixels, outputFormat, numPixels );
+      }
+    }
+  }
+
+  output->mPreMultiplied = input->mPreMultiplied || mMultiplyColorByAlpha;
+  if( output != input )
+  {
+    if( input->mMetadata )
+    {
+      output->mMetadata.reset( new Property::Map( *input->mMetadata ) );
+    }
+    output->mMetadataLoader = input->mMetadataLoader;
+  }
+
+  return output;
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,113 @@
+#ifndef DALI_INTERNAL_ADAPTOR_PIXEL_BUFFER_PIPELINE_H
+#define DALI_INTERNAL_ADAPTOR_PIXEL_BUFFER_PIPELINE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/internal/imaging/common/pixel-buffer-impl.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * @brief Post-processes a loaded image in a single traversal of its pixels.
+ *
+ * The steps to run are collected first, then Process() works through the image
+ * a few scanlines at a time, running every step on those scanlines while they
+ * are still in the cache. The steps run in this order, each only if it has been
+ * asked for:
+ *  - downscale, crop and pad for a fitting mode, as ApplyAttributesToBitmap() does,
+ *  - apply a mask, as PixelBuffer::ApplyMask() does without cropping to the mask,
+ *  - multiply the color channels by alpha, as PixelBuffer::MultiplyColorByAlpha() does,
+ *  - convert to another pixel format.
+ *
+ * The result is the same as running the steps one after the other. The downscale
+ * changes the size of the image in several passes of its own, so it runs before
+ * the rest are fused. When no step changes the size or the format of the pixels
+ * they are processed in place, and no second buffer is allocated.
+ */
+class PixelBufferPipeline
+{
+public:
+
+  /**
+   * @brief Create a pipeline with no steps.
+   */
+  PixelBufferPipeline();
+
+  /**
+   * @brief Downscale, crop and pad the image for a fitting mode.
+   * @param[in] dimensions The requested size of the image. Either may be zero.
+   * @param[in] fittingMode The fitting mode to use.
+   * @param[in] samplingMode The filtering to use when downscaling.
+   */
+  void SetAttributes( ImageDimensions dimensions, FittingMode::Type fittingMode, SamplingMode::Type samplingMode );
+
+  /**
+   * @brief Apply a mask to the image.
+   *
+   * Images with an 8 bit alpha channel are masked in place, others become RGBA8888.
+   * @param[in] mask The mask. It is resized to fit the image if their sizes differ.
+   */
+  void SetMask( PixelBufferPtr mask );
+
+  /**
+   * @brief Multiply the color channels of the image by its alpha once it has been masked.
+   */
+  void SetMultiplyColorByAlpha();
+
+  /**
+   * @brief Convert the image to another pixel format at the end of the pipeline.
+   * @param[in] pixelFormat The pixel format to convert to.
+   */
+  void SetOutputFormat( Pixel::Format pixelFormat );
+
+  /**
+   * @brief Run the steps on an image.
+   *
+   * @note The input pixel buffer may be modified and used as scratch working space, so it must be discarded.
+   * @param[in] buffer The image to process.
+   * @return The processed image. This is @p buffer itself if it was processed in place.
+   */
+  PixelBufferPtr Process( PixelBufferPtr buffer ) const;
+
+private:
+
+  PixelBufferPtr     mMask;                  ///< The mask to apply, if any.
+  ImageDimensions    mDimensions;            ///< The requested size for the fitting mode.
+  FittingMode::Type  mFittingMode;           ///< The fitting mode.
+  SamplingMode::Type mSamplingMode;          ///< The filtering for the downscale.
+  Pixel::Format      mOutputFormat;          ///< The pixel format to convert to.
+  bool               mApplyAttributes;       ///< Whether to downscale, crop and pad.
+  bool               mMultiplyColorByAlpha;  ///< Whether to premultiply the colors.
+  bool               mConvertFormat;         ///< Whether to convert to mOutputFormat.
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ADAPTOR_PIXEL_BUFFER_PIPELINE_H
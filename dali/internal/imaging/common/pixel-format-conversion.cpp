@@ -0,0 +1,573 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/common/pixel-format-conversion.h>
+
+// EXTERNAL INCLUDES
+#include <utility>
+
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+#define DALI_PIXEL_FORMAT_CONVERSION_X86_SIMD
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define DALI_PIXEL_FORMAT_CONVERSION_NEON
+#include <arm_neon.h>
+#endif
+
+// INTERNAL INCLUDES
+#include <dali/internal/imaging/common/cpu-features.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+
+/**
+ * @brief A vectorised function which changes a run of pixels in place.
+ * @return The number of pixels done, from the start of the run
+ */
+typedef unsigned int (*InPlaceKernel)( uint8_t* pixels, unsigned int numPixels );
+
+/**
+ * @brief An entry in the table of conversion kernels.
+ */
+struct ConvertPixelsKernelEntry
+{
+  Pixel::Format srcFormat;
+  Pixel::Format destFormat;
+  Platform::CpuFeature feature; ///< The instruction set the kernel needs
+  ConvertPixelsKernel kernel;
+};
+
+/**
+ * @brief Scaling a five bit channel to eight bits, c * 255 / 31, is the same as
+ * ( c * RGB555_SCALE_MULTIPLIER ) >> RGB555_SCALE_SHIFT, which fits in 16 bits.
+ */
+const uint16_t RGB555_SCALE_MULTIPLIER = 1053u;
+const int      RGB555_SCALE_SHIFT = 7;
+
+#if defined(DALI_PIXEL_FORMAT_CONVERSION_X86_SIMD)
+
+__attribute__((target("sse2"))) inline __m128i Load( const uint8_t* buffer )
+{
+  return _mm_loadu_si128( reinterpret_cast<const __m128i*>( buffer ) );
+}
+
+__attribute__((target("sse2"))) inline void Store( uint8_t* buffer, __m128i pixels )
+{
+  _mm_storeu_si128( reinterpret_cast<__m128i*>( buffer ), pixels );
+}
+
+/** @brief Swap the first and third bytes of 32 bit pixels, e.g. RGBA8888 to BGRA8888. */
+__attribute__((target("sse2"))) unsigned int SwapRedAndBlue4Sse2( const uint8_t* srcBuffer, uint8_t* destBuffer, unsigned int numPixels )
+{
+  const __m128i greenAndAlpha = _mm_set1_epi32( static_cast<int>( 0xFF00FF00u ) );
+  const __m128i redAndBlue = _mm_set1_epi32( 0x00FF00FF );
+
+  unsigned int i = 0u;
+  for( ; i + 4u <= numPixels; i += 4u )
+  {
+    const __m128i in = Load( srcBuffer + i * 4u );
+    const __m128i swapped = _mm_and_si128( in, redAndBlue );
+    Store( destBuffer + i * 4u, _mm_or_si128( _mm_and_si128( in, greenAndAlpha ),
+                                              _mm_or_si128( _mm_slli_epi32( swapped, 16 ), _mm_srli_epi32( swapped, 16 ) ) ) );
+  }
+  return i;
+}
+
+/** @brief Expand L8 to RGBA8888. */
+__attribute__((target("sse2"))) unsigned int ConvertL8ToRGBA8888Sse2( const uint8_t* srcBuffer, uint8_t* destBuffer, unsigned int numPixels )
+{
+  const __m128i opaque = _mm_set1_epi8( static_cast<char>( 0xFF ) );
+
+  unsigned int i = 0u;
+  for( ; i + 16u <= numPixels; i += 16u )
+  {
+    const __m128i luminance = Load( srcBuffer + i );
+    const __m128i luminanceLuminanceLow = _mm_unpacklo_epi8( luminance, luminance );
+    const __m128i luminanceAlphaLow = _mm_unpacklo_epi8( luminance, opaque );
+    const __m128i luminanceLuminanceHigh = _mm_unpackhi_epi8( luminance, luminance );
+    const __m128i luminanceAlphaHigh = _mm_unpackhi_epi8( luminance, opaque );
+    uint8_t* const out = destBuffer + i * 4u;
+    Store( out,       _mm_unpacklo_epi16( luminanceLuminanceLow, luminanceAlphaLow ) );
+    Store( out + 16u, _mm_unpackhi_epi16( luminanceLuminanceLow, luminanceAlphaLow ) );
+    Store( out + 32u, _mm_unpacklo_epi16( luminanceLuminanceHigh, luminanceAlphaHigh ) );
+    Store( out + 48u, _mm_unpackhi_epi16( luminanceLuminanceHigh, luminanceAlphaHigh ) );
+  }
+  return i;
+}
+
+/** @brief Expand LA88 to RGBA8888. */
+__attribute__((target("sse2"))) unsigned int ConvertLA88ToRGBA8888Sse2( const uint8_t* srcBuffer, uint8_t* destBuffer, unsigned int numPixels )
+{
+  const __m128i lowBytes = _mm_set1_epi16( 0xFF );
+
+  unsigned int i = 0u;
+  for( ; i + 8u <= numPixels; i += 8u )
+  {
+    // Each 16 bit lane holds a pixel's luminance in its low byte and alpha in its high byte:
+    const __m128i luminanceAlpha = Load( srcBuffer + i * 2u );
+    const __m128i luminance = _mm_and_si128( luminanceAlpha, lowBytes );
+    const __m128i luminanceLuminance = _mm_or_si128( luminance, _mm_slli_epi16( luminance, 8 ) );
+    Store( destBuffer + i * 4u,       _mm_unpacklo_epi16( luminanceLuminance, luminanceAlpha ) );
+    Store( destBuffer + i * 4u + 16u, _mm_unpackhi_epi16( luminanceLuminance, luminanceAlpha ) );
+  }
+  return i;
+}
+
+/** @brief Pack RGBA8888 to RGB565, which is stored with its red byte first. */
+__attribute__((target("sse2"))) unsigned int ConvertRGBA8888ToRGB565Sse2( const uint8_t* srcBuffer, uint8_t* destBuffer, unsigned int numPixels )
+{
+  const __m128i redMask = _mm_set1_epi32( 0xF8 );
+  const __m128i greenMask = _mm_set1_epi32( 0x7E0 );
+  const __m128i blueMask = _mm_set1_epi32( 0x1F );
+  const __m128i highByte = _mm_set1_epi32( 0xFF00 );
+
+  unsigned int i = 0u;
+  for( ; i + 8u <= numPixels; i += 8u )
+  {
+    __m128i packed[2];
+    for( unsigned int j = 0u; j < 2u; ++j )
+    {
+      const __m128i in = Load( srcBuffer + ( i + j * 4u ) * 4u );
+      const __m128i value = _mm_or_si128( _mm_or_si128( _mm_slli_epi32( _mm_and_si128( in, redMask ), 8 ),
+                                                        _mm_and_si128( _mm_srli_epi32( in, 5 ), greenMask ) ),
+                                          _mm_and_si128( _mm_srli_epi32( in, 19 ), blueMask ) );
+      const __m128i swapped = _mm_or_si128( _mm_srli_epi32( value, 8 ), _mm_and_si128( _mm_slli_epi32( value, 8 ), highByte ) );
+
+      // Sign extend so the saturating pack below keeps all 16 bits:
+      packed[j] = _mm_srai_epi32( _mm_slli_epi32( swapped, 16 ), 16 );
+    }
+    Store( destBuffer + i * 2u, _mm_packs_epi32( packed[0], packed[1] ) );
+  }
+  return i;
+}
+
+/** @brief Pack RGBA8888 to RGBA4444. */
+__attribute__((target("sse2"))) unsigned int ConvertRGBA8888ToRGBA4444Sse2( const uint8_t* srcBuffer, uint8_t* destBuffer, unsigned int numPixels )
+{
+  const __m128i highNibble = _mm_set1_epi16( 0xF0 );
+
+  unsigned int i = 0u;
+  for( ; i + 8u <= numPixels; i += 8u )
+  {
+    // Each pair of channels, red and green or blue and alpha, becomes a byte:
+    const __m128i in0 = Load( srcBuffer + i * 4u );
+    const __m128i in1 = Load( srcBuffer + i * 4u + 16u );
+    const __m128i out0 = _mm_or_si128( _mm_and_si128( in0, highNibble ), _mm_srli_epi16( in0, 12 ) );
+    const __m128i out1 = _mm_or_si128( _mm_and_si128( in1, highNibble ), _mm_srli_epi16( in1, 12 ) );
+    Store( destBuffer + i * 2u, _mm_packus_epi16( out0, out1 ) );
+  }
+  return i;
+}
+
+/** @brief Expand RGB888 to RGBA8888. */
+__attribute__((target("ssse3"))) unsigned int ConvertRGB888ToRGBA8888Ssse3( const uint8_t* srcBuffer, uint8_t* destBuffer, unsigned int numPixels )
+{
+  // Indices with the top bit set zero the destination byte, which the alpha is ORed into.
+  const __m128i spread = _mm_setr_epi8( 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1 );
+  const __m128i opaque = _mm_set1_epi32( static_cast<int>( 0xFF000000u ) );
+
+  unsigned int i = 0u;
+  for( ; i + 16u <= numPixels; i += 16u )
+  {
+    const __m128i in0 = Load( srcBuffer + i * 3u );
+    const __m128i in1 = Load( srcBuffer + i * 3u + 16u );
+    const __m128i in2 = Load( srcBuffer + i * 3u + 32u );
+    uint8_t* const out = destBuffer + i * 4u;
+    Store( out,       _mm_or_si128( _mm_shuffle_epi8( in0, spread ), opaque ) );
+    Store( out + 16u, _mm_or_si128( _mm_shuffle_epi8( _mm_alignr_epi8( in1, in0, 12 ), spread ), opaque ) );
+    Store( out + 32u, _mm_or_si128( _mm_shuffle_epi8( _mm_alignr_epi8( in2, in1, 8 ), spread ), opaque ) );
+    Store( out + 48u, _mm_or_si128( _mm_shuffle_epi8( _mm_srli_si128( in2, 4 ), spread ), opaque ) );
+  }
+  return i;
+}
+
+/**
+ * @brief Drop the fourth byte of 32 bit pixels, gathering the other three in the given order.
+ */
+__attribute__((target("ssse3"))) inline unsigned int Pack32BitTo24BitSsse3( const uint8_t* srcBuffer, uint8_t* destBuffer, unsigned int numPixels, __m128i gather )
+{
+  unsigned int i = 0u;
+  for( ; i + 16u <= numPixels; i += 16u )
+  {
+    const __m128i packed0 = _mm_shuffle_epi8( Load( srcBuffer + i * 4u ), gather );
+    const __m128i packed1 = _mm_shuffle_epi8( Load( srcBuffer + i * 4u + 16u ), gather );
+    const __m128i packed2 = _mm_shuffle_epi8( Load( srcBuffer + i * 4u + 32u ), gather );
+    const __m128i packed3 = _mm_shuffle_epi8( Load( srcBuffer + i * 4u + 48u ), gather );
+    uint8_t* const out = destBuffer + i * 3u;
+    Store( out,       _mm_or_si128( packed0, _mm_slli_si128( packed1, 12 ) ) );
+    Store( out + 16u, _mm_or_si128( _mm_srli_si128( packed1, 4 ), _mm_slli_si128( packed2, 8 ) ) );
+    Store( out + 32u, _mm_or_si128( _mm_srli_si128( packed2, 8 ), _mm_slli_si128( packed3, 4 ) ) );
+  }
+  return i;
+}
+
+/** @brief Drop the alpha of RGBA8888, or the padding of RGB8888. */
+__attribute__((target("ssse3"))) unsigned int ConvertRGBA8888ToRGB888Ssse3( const uint8_t* srcBuffer, uint8_t* destBuffer, unsigned int numPixels )
+{
+  return Pack32BitTo24BitSsse3( srcBuffer, destBuffer, numPixels, _mm_setr_epi8( 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1 ) );
+}
+
+/** @brief Convert BGRA8888 or BGR8888 to RGB888. */
+__attribute__((target("ssse3"))) unsigned int ConvertBGRA8888ToRGB888Ssse3( const uint8_t* srcBuffer, uint8_t* destBuffer, unsigned int numPixels )
+{
+  return Pack32BitTo24BitSsse3( srcBuffer, destBuffer, numPixels, _mm_setr_epi8( 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1 ) );
+}
+
+/** @brief Expand 16 bit X1R5G5B5, as stored in BMP files, to RGB888. */
+__attribute__((target("ssse3"))) unsigned int ConvertRGB555ToRGB888Ssse3( const uint8_t* srcBuffer, uint8_t* destBuffer, unsigned int numPixels )
+{
+  const __m128i fiveBits = _mm_set1_epi16( 0x1F );
+  const __m128i scale = _mm_set1_epi16( RGB555_SCALE_MULTIPLIER );
+  const __m128i gather = _mm_setr_epi8( 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1 );
+
+  unsigned int i = 0u;
+  for( ; i + 8u <= numPixels; i += 8u )
+  {
+    const __m128i in = Load( srcBuffer + i * 2u );
+    const __m128i red = _mm_srli_epi16( _mm_mullo_epi16( _mm_and_si128( _mm_srli_epi16( in, 10 ), fiveBits ), scale ), RGB555_SCALE_SHIFT );
+    const __m128i green = _mm_srli_epi16( _mm_mullo_epi16( _mm_and_si128( _mm_srli_epi16( in, 5 ), fiveBits ), scale ), RGB555_SCALE_SHIFT );
+    const __m128i blue = _mm_srli_epi16( _mm_mullo_epi16( _mm_and_si128( in, fiveBits ), scale ), RGB555_SCALE_SHIFT );
+
+    // Make four byte pixels, then gather their first three bytes:
+    const __m128i redGreen = _mm_or_si128( red, _mm_slli_epi16( green, 8 ) );
+    const __m128i packed0 = _mm_shuffle_epi8( _mm_unpacklo_epi16( redGreen, blue ), gather );
+    const __m128i packed1 = _mm_shuffle_epi8( _mm_unpackhi_epi16( redGreen, blue ), gather );
+    uint8_t* const out = destBuffer + i * 3u;
+    Store( out, _mm_or_si128( packed0, _mm_slli_si128( packed1, 12 ) ) );
+    _mm_storel_epi64( reinterpret_cast<__m128i*>( out + 16u ), _mm_srli_si128( packed1, 4 ) );
+  }
+  return i;
+}
+
+/** @brief Swap the first and third bytes of 24 bit pixels in place. */
+__attribute__((target("ssse3"))) unsigned int SwapRedAndBlue3Ssse3( uint8_t* pixels, unsigned int numPixels )
+{
+  // Four pixels are swapped and the four bytes after them written back unchanged,
+  // so a whole vector can be loaded and stored without running off the end:
+  const __m128i swap = _mm_setr_epi8( 2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 12, 13, 14, 15 );
+
+  unsigned int i = 0u;
+  for( ; i + 6u <= numPixels; i += 4u )
+  {
+    Store( pixels + i * 3u, _mm_shuffle_epi8( Load( pixels + i * 3u ), swap ) );
+  }
+  return i;
+}
+
+const ConvertPixelsKernelEntry CONVERT_PIXELS_KERNELS[] =
+{
+  { Pixel::RGB888,   Pixel::RGBA8888, Platform::CPU_FEATURE_SSSE3, &ConvertRGB888ToRGBA8888Ssse3 },
+  { Pixel::RGBA8888, Pixel::RGB888,   Platform::CPU_FEATURE_SSSE3, &ConvertRGBA8888ToRGB888Ssse3 },
+  { Pixel::RGB8888,  Pixel::RGB888,   Platform::CPU_FEATURE_SSSE3, &ConvertRGBA8888ToRGB888Ssse3 },
+  { Pixel::BGRA8888, Pixel::RGB888,   Platform::CPU_FEATURE_SSSE3, &ConvertBGRA8888ToRGB888Ssse3 },
+  { Pixel::BGR8888,  Pixel::RGB888,   Platform::CPU_FEATURE_SSSE3, &ConvertBGRA8888ToRGB888Ssse3 },
+  { Pixel::RGBA8888, Pixel::BGRA8888, Platform::CPU_FEATURE_SSE2,  &SwapRedAndBlue4Sse2 },
+  { Pixel::BGRA8888, Pixel::RGBA8888, Platform::CPU_FEATURE_SSE2,  &SwapRedAndBlue4Sse2 },
+  { Pixel::L8,       Pixel::RGBA8888, Platform::CPU_FEATURE_SSE2,  &ConvertL8ToRGBA8888Sse2 },
+  { Pixel::LA88,     Pixel::RGBA8888, Platform::CPU_FEATURE_SSE2,  &ConvertLA88ToRGBA8888Sse2 },
+  { Pixel::RGBA8888, Pixel::RGB565,   Platform::CPU_FEATURE_SSE2,  &ConvertRGBA8888ToRGB565Sse2 },
+  { Pixel::RGBA8888, Pixel::RGBA4444, Platform::CPU_FEATURE_SSE2,  &ConvertRGBA8888ToRGBA4444Sse2 },
+};
+
+#elif defined(DALI_PIXEL_FORMAT_CONVERSION_NEON)
+
+/** @brief Swap the first and third bytes of 32 bit pixels, e.g. RGBA8888 to BGRA8888. */
+unsigned int SwapRedAndBlue4Neon( const uint8_t* srcBuffer, uint8_t* destBuffer, unsigned int numPixels )
+{
+  unsigned int i = 0u;
+  for( ; i + 16u <= numPixels; i += 16u )
+  {
+    uint8x16x4_t pixels = vld4q_u8( srcBuffer + i * 4u );
+    std::swap( pixels.val[0], pixels.val[2] );
+    vst4q_u8( destBuffer + i * 4u, pixels );
+  }
+  return i;
+}
+
+/** @brief Expand L8 to RGBA8888. */
+unsigned int ConvertL8ToRGBA8888Neon( const uint8_t* srcBuffer, uint8_t* destBuffer, unsigned int numPixels )
+{
+  unsigned int i = 0u;
+  for( ; i + 16u <= numPixels; i += 16u )
+  {
+    const uint8x16_t luminance = vld1q_u8( srcBuffer + i );
+    uint8x16x4_t out;
+    out.val[0] = out.val[1] = out.val[2] = luminance;
+    out.val[3] = vdupq_n_u8( 0xFF );
+    vst4q_u8( destBuffer + i * 4u, out );
+  }
+  return i;
+}
+
+/** @brief Expand LA88 to RGBA8888. */
+unsigned int ConvertLA88ToRGBA8888Neon( const uint8_t* srcBuffer, uint8_t* destBuffer, unsigned int numPixels )
+{
+  unsigned int i = 0u;
+  for( ; i + 16u <= numPixels; i += 16u )
+  {
+    const uint8x16x2_t in = vld2q_u8( srcBuffer + i * 2u );
+    uint8x16x4_t out;
+    out.val[0] = out.val[1] = out.val[2] = in.val[0];
+    out.val[3] = in.val[1];
+    vst4q_u8( destBuffer + i * 4u, out );
+  }
+  return i;
+}
+
+/** @brief Pack RGBA8888 to RGB565, which is stored with its red byte first. */
+unsigned int ConvertRGBA8888ToRGB565Neon( const uint8_t* srcBuffer, uint8_t* destBuffer, unsigned int numPixels )
+{
+  unsigned int i = 0u;
+  for( ; i + 8u <= numPixels; i += 8u )
+  {
+    const uint8x8x4_t in = vld4_u8( srcBuffer + i * 4u );
+
+    // Insert the top bits of green and blue below the top five bits of red:
+    uint16x8_t packed = vshll_n_u8( in.val[0], 8 );
+    packed = vsriq_n_u16( packed, vshll_n_u8( in.val[1], 8 ), 5 );
+    packed = vsriq_n_u16( packed, vshll_n_u8( in.val[2], 8 ), 11 );
+
+    uint8x8x2_t out;
+    out.val[0] = vshrn_n_u16( packed, 8 );
+    out.val[1] = vmovn_u16( packed );
+    vst2_u8( destBuffer + i * 2u, out );
+  }
+  return i;
+}
+
+/** @brief Pack RGBA8888 to RGBA4444. */
+unsigned int ConvertRGBA8888ToRGBA4444Neon( const uint8_t* srcBuffer, uint8_t* destBuffer, unsigned int numPixels )
+{
+  unsigned int i = 0u;
+  for( ; i + 8u <= numPixels; i += 8u )
+  {
+    const uint8x8x4_t in = vld4_u8( srcBuffer + i * 4u );
+    uint8x8x2_t out;
+    out.val[0] = vsri_n_u8( in.val[0], in.val[1], 4 );
+    out.val[1] = vsri_n_u8( in.val[2], in.val[3], 4 );
+    vst2_u8( destBuffer + i * 2u, out );
+  }
+  return i;
+}
+
+/** @brief Expand RGB888 to RGBA8888. */
+unsigned int ConvertRGB888ToRGBA8888Neon( const uint8_t* srcBuffer, uint8_t* destBuffer, unsigned int numPixels )
+{
+  unsigned int i = 0u;
+  for( ; i + 16u <= numPixels; i += 16u )
+  {
+    const uint8x16x3_t in = vld3q_u8( srcBuffer + i * 3u );
+    uint8x16x4_t out;
+    out.val[0] = in.val[0];
+    out.val[1] = in.val[1];
+    out.val[2] = in.val[2];
+    out.val[3] = vdupq_n_u8( 0xFF );
+    vst4q_u8( destBuffer + i * 4u, out );
+  }
+  return i;
+}
+
+/** @brief Drop the alpha of RGBA8888, or the padding of RGB8888. */
+unsigned int ConvertRGBA8888ToRGB888Neon( const uint8_t* srcBuffer, uint8_t* destBuffer, unsigned int numPixels )
+{
+  unsigned int i = 0u;
+  for( ; i + 16u <= numPixels; i += 16u )
+  {
+    const uint8x16x4_t in = vld4q_u8( srcBuffer + i * 4u );
+    uint8x16x3_t out;
+    out.val[0] = in.val[0];
+    out.val[1] = in.val[1];
+    out.val[2] = in.val[2];
+    vst3q_u8( destBuffer + i * 3u, out );
+  }
+  return i;
+}
+
+/** @brief Convert BGRA8888 or BGR8888 to RGB888. */
+unsigned int ConvertBGRA8888ToRGB888Neon( const uint8_t* srcBuffer, uint8_t* destBuffer, unsigned int numPixels )
+{
+  unsigned int i = 0u;
+  for( ; i + 16u <= numPixels; i += 16u )
+  {
+    const uint8x16x4_t in = vld4q_u8( srcBuffer + i * 4u );
+    uint8x16x3_t out;
+    out.val[0] = in.val[2];
+    out.val[1] = in.val[1];
+    out.val[2] = in.val[0];
+    vst3q_u8( destBuffer + i * 3u, out );
+  }
+  return i;
+}
+
+/** @brief Expand 16 bit X1R5G5B5, as stored in BMP files, to RGB888. */
+unsigned int ConvertRGB555ToRGB888Neon( const uint8_t* srcBuffer, uint8_t* destBuffer, unsigned int numPixels )
+{
+  const uint16x8_t fiveBits = vdupq_n_u16( 0x1F );
+
+  unsigned int i = 0u;
+  for( ; i + 8u <= numPixels; i += 8u )
+  {
+    const uint16x8_t in = vld1q_u16( reinterpret_cast<const uint16_t*>( srcBuffer + i * 2u ) );
+    uint8x8x3_t out;
+    out.val[0] = vmovn_u16( vshrq_n_u16( vmulq_n_u16( vandq_u16( vshrq_n_u16( in, 10 ), fiveBits ), RGB555_SCALE_MULTIPLIER ), RGB555_SCALE_SHIFT ) );
+    out.val[1] = vmovn_u16( vshrq_n_u16( vmulq_n_u16( vandq_u16( vshrq_n_u16( in, 5 ), fiveBits ), RGB555_SCALE_MULTIPLIER ), RGB555_SCALE_SHIFT ) );
+    out.val[2] = vmovn_u16( vshrq_n_u16( vmulq_n_u16( vandq_u16( in, fiveBits ), RGB555_SCALE_MULTIPLIER ), RGB555_SCALE_SHIFT ) );
+    vst3_u8( destBuffer + i * 3u, out );
+  }
+  return i;
+}
+
+/** @brief Swap the first and third bytes of 24 bit pixels in place. */
+unsigned int SwapRedAndBlue3Neon( uint8_t* pixels, unsigned int numPixels )
+{
+  unsigned int i = 0u;
+  for( ; i + 16u <= numPixels; i += 16u )
+  {
+    uint8x16x3_t rgb = vld3q_u8( pixels + i * 3u );
+    std::swap( rgb.val[0], rgb.val[2] );
+    vst3q_u8( pixels + i * 3u, rgb );
+  }
+  return i;
+}
+
+const ConvertPixelsKernelEntry CONVERT_PIXELS_KERNELS[] =
+{
+  { Pixel::RGB888,   Pixel::RGBA8888, Platform::CPU_FEATURE_NEON, &ConvertRGB888ToRGBA8888Neon },
+  { Pixel::RGBA8888, Pixel::RGB888,   Platform::CPU_FEATURE_NEON, &ConvertRGBA8888ToRGB888Neon },
+  { Pixel::RGB8888,  Pixel::RGB888,   Platform::CPU_FEATURE_NEON, &ConvertRGBA8888ToRGB888Neon },
+  { Pixel::BGRA8888, Pixel::RGB888,   Platform::CPU_FEATURE_NEON, &ConvertBGRA8888ToRGB888Neon },
+  { Pixel::BGR8888,  Pixel::RGB888,   Platform::CPU_FEATURE_NEON, &ConvertBGRA8888ToRGB888Neon },
+  { Pixel::RGBA8888, Pixel::BGRA8888, Platform::CPU_FEATURE_NEON, &SwapRedAndBlue4Neon },
+  { Pixel::BGRA8888, Pixel::RGBA8888, Platform::CPU_FEATURE_NEON, &SwapRedAndBlue4Neon },
+  { Pixel::L8,       Pixel::RGBA8888, Platform::CPU_FEATURE_NEON, &ConvertL8ToRGBA8888Neon },
+  { Pixel::LA88,     Pixel::RGBA8888, Platform::CPU_FEATURE_NEON, &ConvertLA88ToRGBA8888Neon },
+  { Pixel::RGBA8888, Pixel::RGB565,   Platform::CPU_FEATURE_NEON, &ConvertRGBA8888ToRGB565Neon },
+  { Pixel::RGBA8888, Pixel::RGBA4444, Platform::CPU_FEATURE_NEON, &ConvertRGBA8888ToRGBA4444Neon },
+};
+
+#endif
+
+/**
+ * @brief Pick the vectorised swap of red and blue for 24 bit pixels, if there is one.
+ * @return The kernel to use, or nullptr to swap every pixel with the scalar code.
+ */
+InPlaceKernel GetSwapRedAndBlue3Kernel()
+{
+#if defined(DALI_PIXEL_FORMAT_CONVERSION_X86_SIMD)
+  if( Platform::HasCpuFeature( Platform::CPU_FEATURE_SSSE3 ) )
+  {
+    return &SwapRedAndBlue3Ssse3;
+  }
+#elif defined(DALI_PIXEL_FORMAT_CONVERSION_NEON)
+  if( Platform::HasCpuFeature( Platform::CPU_FEATURE_NEON ) )
+  {
+    return &SwapRedAndBlue3Neon;
+  }
+#endif
+  return nullptr;
+}
+
+/**
+ * @brief Pick the vectorised expansion of 16 bit X1R5G5B5 to RGB888, if there is one.
+ * @return The kernel to use, or nullptr to expand every pixel with the scalar code.
+ */
+ConvertPixelsKernel GetConvertRGB555ToRGB888Kernel()
+{
+#if defined(DALI_PIXEL_FORMAT_CONVERSION_X86_SIMD)
+  if( Platform::HasCpuFeature( Platform::CPU_FEATURE_SSSE3 ) )
+  {
+    return &ConvertRGB555ToRGB888Ssse3;
+  }
+#elif defined(DALI_PIXEL_FORMAT_CONVERSION_NEON)
+  if( Platform::HasCpuFeature( Platform::CPU_FEATURE_NEON ) )
+  {
+    return &ConvertRGB555ToRGB888Neon;
+  }
+#endif
+  return nullptr;
+}
+
+} // unnamed namespace
+
+ConvertPixelsKernel GetConvertPixelsKernel( Pixel::Format srcFormat, Pixel::Format destFormat )
+{
+#if defined(DALI_PIXEL_FORMAT_CONVERSION_X86_SIMD) || defined(DALI_PIXEL_FORMAT_CONVERSION_NEON)
+  for( const ConvertPixelsKernelEntry& entry : CONVERT_PIXELS_KERNELS )
+  {
+    if( entry.srcFormat == srcFormat && entry.destFormat == destFormat && Platform::HasCpuFeature( entry.feature ) )
+    {
+      return entry.kernel;
+    }
+  }
+#endif
+  return nullptr;
+}
+
+void SwapRedAndBlue( uint8_t* pixels, unsigned int bytesPerPixel, unsigned int numPixels )
+{
+  unsigned int i = 0u;
+  if( bytesPerPixel == 4u )
+  {
+    const ConvertPixelsKernel kernel = GetConvertPixelsKernel( Pixel::BGRA8888, Pixel::RGBA8888 );
+    i = kernel ? kernel( pixels, pixels, numPixels ) : 0u;
+  }
+  else if( bytesPerPixel == 3u )
+  {
+    const InPlaceKernel kernel = GetSwapRedAndBlue3Kernel();
+    i = kernel ? kernel( pixels, numPixels ) : 0u;
+  }
+  else
+  {
+    return;
+  }
+
+  for( uint8_t* pixel = pixels + i * bytesPerPixel; i < numPixels; ++i, pixel += bytesPerPixel )
+  {
+    std::swap( pixel[0], pixel[2] );
+  }
+}
+
+void ConvertRGB555ToRGB888( const uint8_t* srcBuffer, uint8_t* destBuffer, unsigned int numPixels )
+{
+  const ConvertPixelsKernel kernel = GetConvertRGB555ToRGB888Kernel();
+  unsigned int i = kernel ? kernel( srcBuffer, destBuffer, numPixels ) : 0u;
+
+  for( ; i < numPixels; ++i )
+  {
+    const unsigned int pixel = srcBuffer[i * 2u] | ( srcBuffer[i * 2u + 1u] << 8u );
+    destBuffer[i * 3u]      = static_cast<uint8_t>( ( ( pixel >> 10u ) & 0x1Fu ) * 0xFFu / 0x1Fu );
+    destBuffer[i * 3u + 1u] = static_cast<uint8_t>( ( ( pixel >> 5u ) & 0x1Fu ) * 0xFFu / 0x1Fu );
+    destBuffer[i * 3u + 2u] = static_cast<uint8_t>( ( pixel & 0x1Fu ) * 0xFFu / 0x1Fu );
+  }
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,89 @@
+#ifndef DALI_INTERNAL_ADAPTOR_PIXEL_FORMAT_CONVERSION_H
+#define DALI_INTERNAL_ADAPTOR_PIXEL_FORMAT_CONVERSION_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <dali/public-api/images/pixel.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * @brief A vectorised conversion of a run of pixels from one format to another.
+ *
+ * Kernels convert whole vectors of pixels only, and leave the rest of the run
+ * to the caller. They give exactly the same result as ConvertRow() in
+ * pixel-format-traits.h. When the two formats have the same size of pixel the
+ * source and destination may be the same buffer.
+ * @param[in] srcBuffer The pixels to convert
+ * @param[out] destBuffer Where to write the converted pixels
+ * @param[in] numPixels The number of pixels in the run
+ * @return The number of pixels converted, from the start of the run
+ */
+typedef unsigned int (*ConvertPixelsKernel)( const uint8_t* srcBuffer, uint8_t* destBuffer, unsigned int numPixels );
+
+/**
+ * @brief Look up the vectorised conversion between two pixel formats for this CPU.
+ *
+ * The conversions the loaders and texture uploads use most are covered: RGB888
+ * to and from RGBA8888, swapping red and blue in 32 bit formats, expanding L8
+ * and LA88, and packing RGBA8888 to RGB565 or RGBA4444.
+ * ConvertPixels() looks the kernel up itself, so this is only needed to
+ * convert many short runs between the same two formats.
+ * @param[in] srcFormat The pixel format of the source
+ * @param[in] destFormat The pixel format to convert to
+ * @return The kernel, or nullptr if the conversion has to be done a pixel at a time
+ */
+ConvertPixelsKernel GetConvertPixelsKernel( Pixel::Format srcFormat, Pixel::Format destFormat );
+
+/**
+ * @brief Swap the red and blue channels of a run of pixels in place.
+ *
+ * For BGR and BGRA data read from files, such as BMP and ICO. There is no
+ * 24 bit BGR pixel format to convert from with ConvertPixels().
+ * @param[in,out] pixels The pixels, with red and blue in the first and third bytes
+ * @param[in] bytesPerPixel The size of the pixel: 3 or 4. Other sizes are left alone.
+ * @param[in] numPixels The number of pixels
+ */
+void SwapRedAndBlue( uint8_t* pixels, unsigned int bytesPerPixel, unsigned int numPixels );
+
+/**
+ * @brief Expand a run of 16 bit X1R5G5B5 pixels to RGB888.
+ *
+ * For 16 bit BMP files. Each pixel is stored little endian, with its top bit
+ * unused, and there is no pixel format for it to convert from with ConvertPixels().
+ * @param[in] srcBuffer The 16 bit pixels
+ * @param[out] destBuffer Where to write the RGB888 pixels
+ * @param[in] numPixels The number of pixels
+ */
+void ConvertRGB555ToRGB888( const uint8_t* srcBuffer, uint8_t* destBuffer, unsigned int numPixels );
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ADAPTOR_PIXEL_FORMAT_CONVERSION_H
@@ -0,0 +1,313 @@
+#ifndef DALI_INTERNAL_ADAPTOR_PIXEL_FORMAT_TRAITS_H
+#define DALI_INTERNAL_ADAPTOR_PIXEL_FORMAT_TRAITS_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <dali/public-api/images/pixel.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/imaging/common/pixel-manipulation.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * @brief Describes where the channels of an uncompressed pixel format live.
+ *
+ * The bytes of a pixel are read as one big-endian number, which is how all of
+ * the packed formats lay out their channels: e.g. the red channel of RGB565 is
+ * the top five bits of the first byte and the green channel straddles both bytes.
+ * A channel the format doesn't have is zero bits wide.
+ *
+ * Everything is constexpr, so code templated on a format compiles down to the
+ * shifts and masks for that format with no branching on the format at runtime.
+ */
+template< unsigned int BYTES,
+          unsigned int LUMINANCE_BITS, unsigned int LUMINANCE_SHIFT,
+          unsigned int RED_BITS,       unsigned int RED_SHIFT,
+          unsigned int GREEN_BITS,     unsigned int GREEN_SHIFT,
+          unsigned int BLUE_BITS,      unsigned int BLUE_SHIFT,
+          unsigned int ALPHA_BITS,     unsigned int ALPHA_SHIFT >
+struct PackedPixelFormat
+{
+  static constexpr unsigned int BYTES_PER_PIXEL = BYTES;
+
+  /**
+   * @brief The width of a channel in bits.
+   * @param[in] channel The channel
+   * @return The number of bits, or zero if the format doesn't have the channel
+   */
+  static constexpr unsigned int Bits( Channel channel )
+  {
+    return channel == LUMINANCE ? LUMINANCE_BITS :
+           channel == RED       ? RED_BITS :
+           channel == GREEN     ? GREEN_BITS :
+           channel == BLUE      ? BLUE_BITS :
+           channel == ALPHA     ? ALPHA_BITS : 0u;
+  }
+
+  /**
+   * @brief The position of a channel's lowest bit in the pixel read as a big-endian number.
+   * @param[in] channel The channel
+   * @return The shift
+   */
+  static constexpr unsigned int Shift( Channel channel )
+  {
+    return channel == LUMINANCE ? LUMINANCE_SHIFT :
+           channel == RED       ? RED_SHIFT :
+           channel == GREEN     ? GREEN_SHIFT :
+           channel == BLUE      ? BLUE_SHIFT :
+           channel == ALPHA     ? ALPHA_SHIFT : 0u;
+  }
+
+  /**
+   * @brief The mask for a channel's value once it has been shifted down.
+   * @param[in] channel The channel
+   * @return The mask, or zero if the format doesn't have the channel
+   */
+  static constexpr uint32_t Mask( Channel channel )
+  {
+    return ( 1u << Bits( channel ) ) - 1u;
+  }
+
+  /**
+   * @brief Whether the format has a channel.
+   * @param[in] channel The channel
+   * @return true if the channel exists
+   */
+  static constexpr bool Has( Channel channel )
+  {
+    return Bits( channel ) != 0u;
+  }
+};
+
+template< unsigned int BYTES, unsigned int LB, unsigned int LS, unsigned int RB, unsigned int RS, unsigned int GB, unsigned int GS, unsigned int BB, unsigned int BS, unsigned int AB, unsigned int AS >
+constexpr unsigned int PackedPixelFormat< BYTES, LB, LS, RB, RS, GB, GS, BB, BS, AB, AS >::BYTES_PER_PIXEL;
+
+/**
+ * @brief The layout of each uncompressed 8-bit-per-channel-or-less pixel format.
+ *
+ * Only formats with a specialisation here can be used with the templated
+ * pixel access and row conversion functions below.
+ */
+template< Pixel::Format FORMAT >
+struct PixelFormatTraits;
+
+//                                                                        bytes  luminance  red     green   blue    alpha
+template<> struct PixelFormatTraits< Pixel::A8 >       : PackedPixelFormat< 1u,  0u, 0u,    0u, 0u,  0u, 0u,  0u, 0u,  8u, 0u  > {};
+template<> struct PixelFormatTraits< Pixel::L8 >       : PackedPixelFormat< 1u,  8u, 0u,    0u, 0u,  0u, 0u,  0u, 0u,  0u, 0u  > {};
+template<> struct PixelFormatTraits< Pixel::LA88 >     : PackedPixelFormat< 2u,  8u, 8u,    0u, 0u,  0u, 0u,  0u, 0u,  8u, 0u  > {};
+template<> struct PixelFormatTraits< Pixel::RGB565 >   : PackedPixelFormat< 2u,  0u, 0u,    5u, 11u, 6u, 5u,  5u, 0u,  0u, 0u  > {};
+template<> struct PixelFormatTraits< Pixel::BGR565 >   : PackedPixelFormat< 2u,  0u, 0u,    5u, 0u,  6u, 5u,  5u, 11u, 0u, 0u  > {};
+template<> struct PixelFormatTraits< Pixel::RGBA4444 > : PackedPixelFormat< 2u,  0u, 0u,    4u, 12u, 4u, 8u,  4u, 4u,  4u, 0u  > {};
+template<> struct PixelFormatTraits< Pixel::BGRA4444 > : PackedPixelFormat< 2u,  0u, 0u,    4u, 4u,  4u, 8u,  4u, 12u, 4u, 0u  > {};
+template<> struct PixelFormatTraits< Pixel::RGBA5551 > : PackedPixelFormat< 2u,  0u, 0u,    5u, 11u, 5u, 6u,  5u, 1u,  1u, 0u  > {};
+template<> struct PixelFormatTraits< Pixel::BGRA5551 > : PackedPixelFormat< 2u,  0u, 0u,    5u, 1u,  5u, 6u,  5u, 11u, 1u, 0u  > {};
+template<> struct PixelFormatTraits< Pixel::RGB888 >   : PackedPixelFormat< 3u,  0u, 0u,    8u, 16u, 8u, 8u,  8u, 0u,  0u, 0u  > {};
+template<> struct PixelFormatTraits< Pixel::RGB8888 >  : PackedPixelFormat< 4u,  0u, 0u,    8u, 24u, 8u, 16u, 8u, 8u,  0u, 0u  > {};
+template<> struct PixelFormatTraits< Pixel::BGR8888 >  : PackedPixelFormat< 4u,  0u, 0u,    8u, 8u,  8u, 16u, 8u, 24u, 0u, 0u  > {};
+template<> struct PixelFormatTraits< Pixel::RGBA8888 > : PackedPixelFormat< 4u,  0u, 0u,    8u, 24u, 8u, 16u, 8u, 8u,  8u, 0u  > {};
+template<> struct PixelFormatTraits< Pixel::BGRA8888 > : PackedPixelFormat< 4u,  0u, 0u,    8u, 8u,  8u, 16u, 8u, 24u, 8u, 0u  > {};
+
+/**
+ * @brief Call visitor.Visit< Traits >() with the traits of a runtime pixel format.
+ *
+ * This is the one place that switches on the format; the visitor's loop is
+ * instantiated once per format.
+ * @param[in] format The pixel format
+ * @param[in,out] visitor An object with a member function template Visit< typename Traits >()
+ * @return false if the format has no traits (compressed, floating point and depth formats)
+ */
+template< typename Visitor >
+bool VisitPixelFormat( Pixel::Format format, Visitor& visitor )
+{
+  switch( format )
+  {
+    case Pixel::A8:       visitor.template Visit< PixelFormatTraits< Pixel::A8 > >();       return true;
+    case Pixel::L8:       visitor.template Visit< PixelFormatTraits< Pixel::L8 > >();       return true;
+    case Pixel::LA88:     visitor.template Visit< PixelFormatTraits< Pixel::LA88 > >();     return true;
+    case Pixel::RGB565:   visitor.template Visit< PixelFormatTraits< Pixel::RGB565 > >();   return true;
+    case Pixel::BGR565:   visitor.template Visit< PixelFormatTraits< Pixel::BGR565 > >();   return true;
+    case Pixel::RGBA4444: visitor.template Visit< PixelFormatTraits< Pixel::RGBA4444 > >(); return true;
+    case Pixel::BGRA4444: visitor.template Visit< PixelFormatTraits< Pixel::BGRA4444 > >(); return true;
+    case Pixel::RGBA5551: visitor.template Visit< PixelFormatTraits< Pixel::RGBA5551 > >(); return true;
+    case Pixel::BGRA5551: visitor.template Visit< PixelFormatTraits< Pixel::BGRA5551 > >(); return true;
+    case Pixel::RGB888:   visitor.template Visit< PixelFormatTraits< Pixel::RGB888 > >();   return true;
+    case Pixel::RGB8888:  visitor.template Visit< PixelFormatTraits< Pixel::RGB8888 > >();  return true;
+    case Pixel::BGR8888:  visitor.template Visit< PixelFormatTraits< Pixel::BGR8888 > >();  return true;
+    case Pixel::RGBA8888: visitor.template Visit< PixelFormatTraits< Pixel::RGBA8888 > >(); return true;
+    case Pixel::BGRA8888: visitor.template Visit< PixelFormatTraits< Pixel::BGRA8888 > >(); return true;
+    default:
+    {
+      return false;
+    }
+  }
+}
+
+/**
+ * @brief Read a pixel's bytes as one big-endian number.
+ */
+template< typename Format >
+inline uint32_t LoadPackedPixel( const unsigned char* pixel )
+{
+  uint32_t value = 0u;
+  for( unsigned int i = 0; i < Format::BYTES_PER_PIXEL; ++i )
+  {
+    value = ( value << 8u ) | pixel[i];
+  }
+  return value;
+}
+
+/**
+ * @brief Write a pixel from one big-endian number.
+ */
+template< typename Format >
+inline void StorePackedPixel( unsigned char* pixel, uint32_t value )
+{
+  for( unsigned int i = Format::BYTES_PER_PIXEL; i > 0u; --i )
+  {
+    pixel[i - 1u] = static_cast<unsigned char>( value & 0xFFu );
+    value >>= 8u;
+  }
+}
+
+/**
+ * @brief Read the raw value of a channel from a pixel.
+ * @return The value, at the channel's own bit depth, or zero if the format doesn't have the channel
+ */
+template< typename Format >
+inline unsigned int GetChannel( const unsigned char* pixel, Channel channel )
+{
+  return ( LoadPackedPixel< Format >( pixel ) >> Format::Shift( channel ) ) & Format::Mask( channel );
+}
+
+/**
+ * @brief Write the raw value of a channel to a pixel, leaving its other channels alone.
+ *
+ * Nothing is written if the format doesn't have the channel.
+ */
+template< typename Format >
+inline void SetChannel( unsigned char* pixel, Channel channel, unsigned int value )
+{
+  if( Format::Has( channel ) )
+  {
+    const uint32_t mask = Format::Mask( channel ) << Format::Shift( channel );
+    const uint32_t packed = ( LoadPackedPixel< Format >( pixel ) & ~mask ) | ( ( value << Format::Shift( channel ) ) & mask );
+    StorePackedPixel< Format >( pixel, packed );
+  }
+}
+
+/**
+ * @brief Widen a channel value to 8 bits.
+ *
+ * The low bits are filled with a copy of the value's low bits, and a 1 bit value
+ * becomes either 0 or 255, as ConvertColorChannelsToRGBA8888() and
+ * ConvertAlphaChannelToA8() always have.
+ * @param[in] value The channel value
+ * @param[in] bits The width of the channel value
+ * @return The 8 bit value
+ */
+inline constexpr unsigned int ExpandTo8Bits( unsigned int value, unsigned int bits )
+{
+  return bits == 8u ? value :
+         bits == 0u ? 0u :
+         bits == 1u ? ( value ? 255u : 0u ) :
+         ( value << ( 8u - bits ) ) | ( value & ( ( 1u << ( 8u - bits ) ) - 1u ) );
+}
+
+/**
+ * @brief Read a channel from a packed pixel, widened to 8 bits.
+ */
+template< typename Format >
+inline unsigned int GetChannel8( uint32_t packedPixel, Channel channel )
+{
+  return ExpandTo8Bits( ( packedPixel >> Format::Shift( channel ) ) & Format::Mask( channel ), Format::Bits( channel ) );
+}
+
+/**
+ * @brief Narrow an 8 bit value to a channel and shift it into place in a packed pixel.
+ * @return The bits to OR into the packed pixel, or zero if the format doesn't have the channel
+ */
+template< typename Format >
+inline uint32_t PackChannel8( unsigned int value, Channel channel )
+{
+  return Format::Has( channel ) ? ( value >> ( 8u - Format::Bits( channel ) ) ) << Format::Shift( channel ) : 0u;
+}
+
+/**
+ * @brief Convert a row of pixels from one format to another.
+ *
+ * Channels are carried over at 8 bit precision. Where the destination has a
+ * channel the source lacks:
+ *  - color channels are filled from luminance, or the other way round using Rec.601 weights,
+ *  - alpha is opaque,
+ *  - anything else is zero.
+ * Bits of the destination pixel which belong to no channel are zeroed.
+ * @param[in] srcBuffer The pixels to convert
+ * @param[out] destBuffer The converted pixels. May be the source itself if both formats
+ * have the same size of pixel, as each pixel is read before it is written, but must
+ * not otherwise overlap it.
+ * @param[in] numPixels The number of pixels to convert
+ */
+template< typename SrcFormat, typename DestFormat >
+void ConvertRow( const unsigned char* srcBuffer, unsigned char* destBuffer, unsigned int numPixels )
+{
+  for( unsigned int i = 0; i < numPixels; ++i, srcBuffer += SrcFormat::BYTES_PER_PIXEL, destBuffer += DestFormat::BYTES_PER_PIXEL )
+  {
+    const uint32_t in = LoadPackedPixel< SrcFormat >( srcBuffer );
+
+    unsigned int red = 0u, green = 0u, blue = 0u, luminance = 0u;
+    if( SrcFormat::Has( RED ) )
+    {
+      red = GetChannel8< SrcFormat >( in, RED );
+      green = GetChannel8< SrcFormat >( in, GREEN );
+      blue = GetChannel8< SrcFormat >( in, BLUE );
+      if( DestFormat::Has( LUMINANCE ) )
+      {
+        luminance = ( red * 77u + green * 150u + blue * 29u + 128u ) >> 8u;
+      }
+    }
+    else if( SrcFormat::Has( LUMINANCE ) )
+    {
+      luminance = GetChannel8< SrcFormat >( in, LUMINANCE );
+      red = green = blue = luminance;
+    }
+    const unsigned int alpha = SrcFormat::Has( ALPHA ) ? GetChannel8< SrcFormat >( in, ALPHA ) : 255u;
+
+    StorePackedPixel< DestFormat >( destBuffer, PackChannel8< DestFormat >( luminance, LUMINANCE ) |
+                                                PackChannel8< DestFormat >( red, RED ) |
+                                                PackChannel8< DestFormat >( green, GREEN ) |
+                                                PackChannel8< DestFormat >( blue, BLUE ) |
+                                                PackChannel8< DestFormat >( alpha, ALPHA ) );
+  }
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ADAPTOR_PIXEL_FORMAT_TRAITS_H
@@ -20,6 +20,8 @@
 // INTERNAL HEADERS
 #include <dali/public-api/images/pixel.h>
 #include <dali/integration-api/debug.h>
+#include <dali/internal/imaging/common/pixel-format-conversion.h>
+#include <dali/internal/imaging/common/pixel-format-traits.h>
 
 namespace Dali
 {
@@ -28,368 +30,212 @@ namespace Internal
 namespace Adaptor
 {
 
-struct Location
+namespace
 {
-  unsigned int bitShift;
-  unsigned int bitMask;
-  bool available;
+
+/**
+ * @brief Finds out whether a pixel format has a channel.
+ */
+struct HasChannelVisitor
+{
+  template< typename Format >
+  void Visit()
+  {
+    result = Format::Has( channel );
+  }
+
+  Channel channel;
+  bool result;
 };
 
-struct Locations
+/**
+ * @brief Reads a channel from a pixel.
+ */
+struct ReadChannelVisitor
 {
-  Location luminance;
-  Location alpha;
-  Location red;
-  Location green;
-  Location blue;
+  template< typename Format >
+  void Visit()
+  {
+    result = GetChannel< Format >( pixelData, channel );
+  }
+
+  const unsigned char* pixelData;
+  Channel channel;
+  unsigned int result;
 };
 
+/**
+ * @brief Writes a channel to a pixel.
+ */
+struct WriteChannelVisitor
+{
+  template< typename Format >
+  void Visit()
+  {
+    SetChannel< Format >( pixelData, channel, channelValue );
+  }
+
+  unsigned char* pixelData;
+  Channel channel;
+  unsigned int channelValue;
+};
 
-bool HasChannel( Dali::Pixel::Format pixelFormat, Channel channel )
+/**
+ * @brief Widens the color channels of a pixel to RGBA8888, leaving the destination's alpha alone.
+ */
+struct ConvertColorToRGBA8888Visitor
 {
-  switch (pixelFormat)
+  template< typename Format >
+  void Visit()
   {
-    case Dali::Pixel::A8:
-    {
-      return (channel == ALPHA);
-    }
-    case Dali::Pixel::L8:
-    {
-      return (channel == LUMINANCE);
-    }
-    case Dali::Pixel::LA88:
-    {
-      return ( channel == LUMINANCE || channel == ALPHA );
-    }
-    case Dali::Pixel::RGB565:
-    case Dali::Pixel::BGR565:
-    case Dali::Pixel::RGB888:
-    case Dali::Pixel::RGB8888:
-    case Dali::Pixel::BGR8888:
-    case Dali::Pixel::RGB16F:
-    case Dali::Pixel::RGB32F:
-    {
-      return ( channel == RED || channel == GREEN || channel == BLUE );
-    }
+    const uint32_t packedPixel = LoadPackedPixel< Format >( srcPixel );
+    destPixel[0] = static_cast<unsigned char>( GetChannel8< Format >( packedPixel, RED ) );
+    destPixel[1] = static_cast<unsigned char>( GetChannel8< Format >( packedPixel, GREEN ) );
+    destPixel[2] = static_cast<unsigned char>( GetChannel8< Format >( packedPixel, BLUE ) );
+  }
 
-    case Dali::Pixel::RGBA8888:
-    case Dali::Pixel::BGRA8888:
-    case Dali::Pixel::RGBA4444:
-    case Dali::Pixel::BGRA4444:
-    case Dali::Pixel::RGBA5551:
-    case Dali::Pixel::BGRA5551:
-    {
-      return ( channel == RED || channel == GREEN || channel == BLUE || channel == ALPHA );
-    }
+  const unsigned char* srcPixel;
+  unsigned char* destPixel;
+};
 
-    case Dali::Pixel::DEPTH_UNSIGNED_INT:
-    case Dali::Pixel::DEPTH_FLOAT:
-    {
-      return ( channel == DEPTH );
-    }
+/**
+ * @brief Widens the alpha channel of a pixel to 8 bits.
+ */
+struct ConvertAlphaToA8Visitor
+{
+  template< typename Format >
+  void Visit()
+  {
+    result = GetChannel8< Format >( LoadPackedPixel< Format >( srcPixel ), ALPHA );
+  }
 
-    case Dali::Pixel::DEPTH_STENCIL:
-    {
-      return ( channel == DEPTH || channel == STENCIL );
-    }
+  const unsigned char* srcPixel;
+  unsigned int result;
+};
 
-    case Dali::Pixel::INVALID:
-    case Dali::Pixel::COMPRESSED_R11_EAC:
-    case Dali::Pixel::COMPRESSED_SIGNED_R11_EAC:
-    case Dali::Pixel::COMPRESSED_RG11_EAC:
-    case Dali::Pixel::COMPRESSED_SIGNED_RG11_EAC:
-    case Dali::Pixel::COMPRESSED_RGB8_ETC2:
-    case Dali::Pixel::COMPRESSED_SRGB8_ETC2:
-    case Dali::Pixel::COMPRESSED_RGB8_ETC1:
-    case Dali::Pixel::COMPRESSED_RGB_PVRTC_4BPPV1:
-    case Dali::Pixel::COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2:
-    case Dali::Pixel::COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2:
-    case Dali::Pixel::COMPRESSED_RGBA8_ETC2_EAC:
-    case Dali::Pixel::COMPRESSED_SRGB8_ALPHA8_ETC2_EAC:
-    case Dali::Pixel::COMPRESSED_RGBA_ASTC_4x4_KHR:
-    case Dali::Pixel::COMPRESSED_RGBA_ASTC_5x4_KHR:
-    case Dali::Pixel::COMPRESSED_RGBA_ASTC_5x5_KHR:
-    case Dali::Pixel::COMPRESSED_RGBA_ASTC_6x5_KHR:
-    case Dali::Pixel::COMPRESSED_RGBA_ASTC_6x6_KHR:
-    case Dali::Pixel::COMPRESSED_RGBA_ASTC_8x5_KHR:
-    case Dali::Pixel::COMPRESSED_RGBA_ASTC_8x6_KHR:
-    case Dali::Pixel::COMPRESSED_RGBA_ASTC_8x8_KHR:
-    case Dali::Pixel::COMPRESSED_RGBA_ASTC_10x5_KHR:
-    case Dali::Pixel::COMPRESSED_RGBA_ASTC_10x6_KHR:
-    case Dali::Pixel::COMPRESSED_RGBA_ASTC_10x8_KHR:
-    case Dali::Pixel::COMPRESSED_RGBA_ASTC_10x10_KHR:
-    case Dali::Pixel::COMPRESSED_RGBA_ASTC_12x10_KHR:
-    case Dali::Pixel::COMPRESSED_RGBA_ASTC_12x12_KHR:
-    case Dali::Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR:
-    case Dali::Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR:
-    case Dali::Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR:
-    case Dali::Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR:
-    case Dali::Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR:
-    case Dali::Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR:
-    case Dali::Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR:
-    case Dali::Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR:
-    case Dali::Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR:
-    case Dali::Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR:
-    case Dali::Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR:
-    case Dali::Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR:
-    case Dali::Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR:
-    case Dali::Pixel::COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR:
-    {
-      DALI_LOG_ERROR("Pixel formats for compressed images are not compatible with simple channels.\n");
-      break;
-    }
+/**
+ * @brief Converts a row of pixels once both formats are known.
+ */
+template< typename SrcFormat >
+struct ConvertToVisitor
+{
+  template< typename DestFormat >
+  void Visit()
+  {
+    ConvertRow< SrcFormat, DestFormat >( srcBuffer, destBuffer, numPixels );
   }
 
-  return false;
-}
+  const unsigned char* srcBuffer;
+  unsigned char* destBuffer;
+  unsigned int numPixels;
+};
 
-unsigned int ReadChannel( unsigned char* pixelData,
-                          Dali::Pixel::Format pixelFormat,
-                          Channel channel )
+/**
+ * @brief Picks the destination format of a row conversion once the source format is known.
+ */
+struct ConvertFromVisitor
 {
-  switch (pixelFormat)
+  template< typename SrcFormat >
+  void Visit()
   {
-    case Dali::Pixel::A8:
-    {
-      if( channel == ALPHA )
-      {
-        return static_cast<unsigned int>(*pixelData);
-      }
-      else return 0u;
-    }
-    case Dali::Pixel::L8:
-    {
-      if( channel == LUMINANCE )
-      {
-        return static_cast<unsigned int>(*pixelData);
-      }
-      else return 0u;
-    }
-    case Dali::Pixel::LA88:
-    {
-      if( channel == LUMINANCE )
-      {
-        return static_cast<unsigned int>(*pixelData);
-      }
-      else if( channel == ALPHA )
-      {
-        return static_cast<unsigned int>(*(pixelData+1));
-      }
-      else return 0u;
-    }
-    case Dali::Pixel::RGB565:
-    {
-      if( channel == RED )
-      {
-        return (static_cast<unsigned int>(*pixelData) & 0xF8) >> 3;
-      }
-      else if( channel == GREEN )
-      {
-        return ((static_cast<unsigned int>(*pixelData) & 0x07) << 3) |
-          ((static_cast<unsigned int>(*(pixelData+1)) & 0xE0) >> 5);
-      }
-      else if( channel == BLUE )
-      {
-        return static_cast<unsigned int>(*(pixelData+1)) & 0x1F;
-      }
-      else return 0u;
-    }
+    ConvertToVisitor< SrcFormat > visitor = { srcBuffer, destBuffer, numPixels };
+    result = VisitPixelFormat( destFormat, visitor );
+  }
 
-    case Dali::Pixel::BGR565:
-    {
-      if( channel == BLUE )
-      {
-        return (static_cast<unsigned int>(*pixelData) & 0xF8) >> 3;
-      }
-      else if( channel == GREEN )
-      {
-        return ((static_cast<unsigned int>(*pixelData) & 0x07) << 3) |
-          ((static_cast<unsigned int>(*(pixelData+1)) & 0xE0) >> 5);
-      }
-      else if( channel == RED )
-      {
-        return (static_cast<unsigned int>(*(pixelData+1) & 0x1F) );
-      }
-      else return 0u;
-    }
+  const unsigned char* srcBuffer;
+  unsigned char* destBuffer;
+  Dali::Pixel::Format destFormat;
+  unsigned int numPixels;
+  bool result;
+};
 
-    case Dali::Pixel::RGB888:
-    case Dali::Pixel::RGB8888:
+/**
+ * @brief Multiplies the color channels of a run of pixels by their alpha.
+ */
+struct MultiplyColorByAlphaVisitor
+{
+  template< typename Format >
+  static uint32_t MultiplyChannel( uint32_t packedPixel, Channel channel, unsigned int alpha )
+  {
+    if( ! Format::Has( channel ) )
     {
-      if( channel == RED )
-      {
-        return static_cast<unsigned int>(*pixelData);
-      }
-      else if( channel == GREEN )
-      {
-        return static_cast<unsigned int>(*(pixelData+1));
-      }
-      else if( channel == BLUE )
-      {
-        return static_cast<unsigned int>(*(pixelData+2));
-      }
-      else return 0u;
+      return packedPixel;
     }
+    const unsigned int value = ( packedPixel >> Format::Shift( channel ) ) & Format::Mask( channel );
+    return ( packedPixel & ~( Format::Mask( channel ) << Format::Shift( channel ) ) ) | ( ( value * alpha / 255u ) << Format::Shift( channel ) );
+  }
 
-    case Dali::Pixel::BGR8888:
+  template< typename Format >
+  void Visit()
+  {
+    if( ! Format::Has( ALPHA ) )
     {
-      if( channel == BLUE )
-      {
-        return static_cast<unsigned int>(*pixelData);
-      }
-      else if( channel == GREEN )
-      {
-        return static_cast<unsigned int>(*(pixelData+1));
-      }
-      else if( channel == RED )
-      {
-        return static_cast<unsigned int>(*(pixelData+2));
-      }
-      else return 0u;
+      return;
     }
-
-    case Dali::Pixel::RGBA8888:
+    unsigned char* pixel = pixels;
+    for( unsigned int i = 0; i < numPixels; ++i, pixel += Format::BYTES_PER_PIXEL )
     {
-      if( channel == RED )
-      {
-        return static_cast<unsigned int>(*pixelData);
-      }
-      else if( channel == GREEN )
-      {
-        return static_cast<unsigned int>(*(pixelData+1));
-      }
-      else if( channel == BLUE )
-      {
-        return static_cast<unsigned int>(*(pixelData+2));
-      }
-      else if( channel == ALPHA )
-      {
-        return static_cast<unsigned int>(*(pixelData+3));
-      }
-      else return 0u;
+      uint32_t packedPixel = LoadPackedPixel< Format >( pixel );
+      const unsigned int alpha = ( packedPixel >> Format::Shift( ALPHA ) ) & Format::Mask( ALPHA );
+      packedPixel = MultiplyChannel< Format >( packedPixel, RED, alpha );
+      packedPixel = MultiplyChannel< Format >( packedPixel, GREEN, alpha );
+      packedPixel = MultiplyChannel< Format >( packedPixel, BLUE, alpha );
+      packedPixel = MultiplyChannel< Format >( packedPixel, LUMINANCE, alpha );
+      StorePackedPixel< Format >( pixel, packedPixel );
     }
+  }
 
-    case Dali::Pixel::BGRA8888:
-    {
-      if( channel == BLUE )
-      {
-        return static_cast<unsigned int>(*pixelData);
-      }
-      else if( channel == GREEN )
-      {
-        return static_cast<unsigned int>(*(pixelData+1));
-      }
-      else if( channel == RED )
-      {
-        return static_cast<unsigned int>(*(pixelData+2));
-      }
-      else if( channel == ALPHA )
-      {
-        return static_cast<unsigned int>(*(pixelData+3));
-      }
-      else return 0u;
-    }
+  unsigned char* pixels;
+  unsigned int numPixels;
+};
 
-    case Dali::Pixel::RGBA4444:
-    {
-      if( channel == RED )
-      {
-        return (static_cast<unsigned int>(*pixelData) & 0xF0) >> 4;
-      }
-      else if( channel == GREEN )
-      {
-        return (static_cast<unsigned int>(*pixelData) & 0x0F);
-      }
-      else if( channel == BLUE )
-      {
-        return (static_cast<unsigned int>(*(pixelData+1)) & 0xF0) >> 4;
-      }
-      else if( channel == ALPHA )
-      {
-        return (static_cast<unsigned int>(*(pixelData+1)) & 0x0F);
-      }
-      else return 0u;
-    }
+} // unnamed namespace
 
-    case Dali::Pixel::BGRA4444:
-    {
-      if( channel == BLUE )
-      {
-        return (static_cast<unsigned int>(*pixelData) & 0xF0) >> 4;
-      }
-      else if( channel == GREEN )
-      {
-        return (static_cast<unsigned int>(*pixelData) & 0x0F);
-      }
-      else if( channel == RED )
-      {
-        return (static_cast<unsigned int>(*(pixelData+1)) & 0xF0) >> 4;
-      }
-      else if( channel == ALPHA )
-      {
-        return (static_cast<unsigned int>(*(pixelData+1)) & 0x0F);
-      }
-      else return 0u;
-    }
+bool HasChannel( Dali::Pixel::Format pixelFormat, Channel channel )
+{
+  HasChannelVisitor visitor = { channel, false };
+  if( VisitPixelFormat( pixelFormat, visitor ) )
+  {
+    return visitor.result;
+  }
 
-    case Dali::Pixel::RGBA5551:
+  switch (pixelFormat)
+  {
+    case Dali::Pixel::RGB16F:
+    case Dali::Pixel::RGB32F:
     {
-      if( channel == RED )
-      {
-        return (static_cast<unsigned int>(*pixelData) & 0xF8) >> 3;
-      }
-      else if( channel == GREEN )
-      {
-        return ((static_cast<unsigned int>(*pixelData) & 0x07) << 2) |
-          ((static_cast<unsigned int>(*(pixelData+1)) & 0xC0) >> 6);
-      }
-      else if( channel == BLUE )
-      {
-        return (static_cast<unsigned int>(*(pixelData+1)) & 0x3E) >> 1;
-      }
-      else if( channel == ALPHA )
-      {
-        return static_cast<unsigned int>(*(pixelData+1)) & 0x01;
-      }
-
-      else return 0u;
+      return ( channel == RED || channel == GREEN || channel == BLUE );
     }
 
-    case Dali::Pixel::BGRA5551:
+    case Dali::Pixel::DEPTH_UNSIGNED_INT:
+    case Dali::Pixel::DEPTH_FLOAT:
     {
-      if( channel == BLUE )
-      {
-        return (static_cast<unsigned int>(*pixelData) & 0xF8) >> 3;
-      }
-      else if( channel == GREEN )
-      {
-        return ((static_cast<unsigned int>(*pixelData) & 0x07) << 2) |
-          ((static_cast<unsigned int>(*(pixelData+1)) & 0xC0) >> 6);
-      }
-      else if( channel == RED )
-      {
-        return ( static_cast<unsigned int>(*(pixelData+1)) & 0x3E) >> 1;
-      }
-      else if( channel == ALPHA )
-      {
-        return static_cast<unsigned int>(*(pixelData+1)) & 0x01;
-      }
-
-      else return 0u;
+      return ( channel == DEPTH );
     }
 
-    case Dali::Pixel::DEPTH_UNSIGNED_INT:
-    case Dali::Pixel::DEPTH_FLOAT:
     case Dali::Pixel::DEPTH_STENCIL:
     {
-      return 0u;
+      return ( channel == DEPTH || channel == STENCIL );
     }
 
     default:
     {
-      return 0u;
+      DALI_LOG_ERROR("Pixel formats for compressed images are not compatible with simple channels.\n");
+      break;
     }
   }
+
+  return false;
+}
+
+unsigned int ReadChannel( unsigned char* pixelData,
+                          Dali::Pixel::Format pixelFormat,
+                          Channel channel )
+{
+  // Floating point, depth and compressed formats have no channels that can be read this way
+  ReadChannelVisitor visitor = { pixelData, channel, 0u };
+  VisitPixelFormat( pixelFormat, visitor );
+  return visitor.result;
 }
 
 void WriteChannel( unsigned char* pixelData,
@@ -397,343 +243,51 @@ void WriteChannel( unsigned char* pixelData,
                    Channel channel,
                    unsigned int channelValue )
 {
-  switch (pixelFormat)
-  {
-    case Dali::Pixel::A8:
-    {
-      if( channel == ALPHA )
-      {
-        *pixelData = static_cast<unsigned char>( channelValue & 0xFF );
-      }
-      break;
-    }
-    case Dali::Pixel::L8:
-    {
-      if( channel == LUMINANCE )
-      {
-        *pixelData = static_cast<unsigned char>( channelValue & 0xFF );
-      }
-      break;
-    }
-    case Dali::Pixel::LA88:
-    {
-      if( channel == LUMINANCE )
-      {
-        *pixelData = static_cast<unsigned char>( channelValue & 0xFF );
-      }
-      else if( channel == ALPHA )
-      {
-        *(pixelData+1) = static_cast<unsigned char>( channelValue & 0xFF );
-      }
-      break;
-    }
-    case Dali::Pixel::RGB565:
-    {
-      if( channel == RED )
-      {
-        *pixelData &= static_cast<unsigned char>( ~0xF8 );
-        *pixelData |= static_cast<unsigned char>( (channelValue << 3) & 0xF8 );
-      }
-      else if( channel == GREEN )
-      {
-        *pixelData &= static_cast<unsigned char>( ~0x07 );
-        *pixelData |= static_cast<unsigned char>( (channelValue >> 3) & 0x07 );
-
-        *(pixelData+1) &= static_cast<unsigned char>( ~0xE0 );
-        *(pixelData+1) |= static_cast<unsigned char>( (channelValue << 5) & 0xE0 );
-      }
-      else if( channel == BLUE )
-      {
-        *(pixelData+1) &= static_cast<unsigned char>( ~0x1F );
-        *(pixelData+1) |= static_cast<unsigned char>( channelValue & 0x1F );
-      }
-      break;
-    }
-
-    case Dali::Pixel::BGR565:
-    {
-      if( channel == BLUE )
-      {
-        *pixelData &= static_cast<unsigned char>( ~0xF8 );
-        *pixelData |= static_cast<unsigned char>( (channelValue << 3) & 0xF8 );
-      }
-      else if( channel == GREEN )
-      {
-        *pixelData &= static_cast<unsigned char>( ~0x07 );
-        *pixelData |= static_cast<unsigned char>( (channelValue >> 3) & 0x07 );
-
-        *(pixelData+1) &= static_cast<unsigned char>( ~0xE0 );
-        *(pixelData+1) |= static_cast<unsigned char>( (channelValue << 5) & 0xE0 );
-      }
-      else if( channel == RED )
-      {
-        *(pixelData+1) &= static_cast<unsigned char>( ~0x1F );
-        *(pixelData+1) |= static_cast<unsigned char>( channelValue & 0x1F );
-      }
-      break;
-    }
-
-    case Dali::Pixel::RGB888:
-    case Dali::Pixel::RGB8888:
-    {
-      if( channel == RED )
-      {
-        *pixelData = static_cast<unsigned char>( channelValue & 0xFF );
-      }
-      else if( channel == GREEN )
-      {
-        *(pixelData+1) = static_cast<unsigned char>( channelValue & 0xFF );
-      }
-      else if( channel == BLUE )
-      {
-        *(pixelData+2) = static_cast<unsigned char>( channelValue & 0xFF );
-      }
-      break;
-    }
-
-    case Dali::Pixel::BGR8888:
-    {
-      if( channel == BLUE )
-      {
-        *pixelData = static_cast<unsigned char>( channelValue & 0xFF );
-      }
-      else if( channel == GREEN )
-      {
-        *(pixelData+1) = static_cast<unsigned char>( channelValue & 0xFF );
-      }
-      else if( channel == RED )
-      {
-        *(pixelData+2) = static_cast<unsigned char>( channelValue & 0xFF );
-      }
-      break;
-    }
-
-    case Dali::Pixel::RGBA8888:
-    {
-      if( channel == RED )
-      {
-        *pixelData = static_cast<unsigned char>( channelValue & 0xFF );
-      }
-      else if( channel == GREEN )
-      {
-        *(pixelData+1) = static_cast<unsigned char>( channelValue & 0xFF );
-      }
-      else if( channel == BLUE )
-      {
-        *(pixelData+2) = static_cast<unsigned char>( channelValue & 0xFF );
-      }
-      else if( channel == ALPHA )
-      {
-        *(pixelData+3) = static_cast<unsigned char>( channelValue & 0xFF );
-      }
-      break;
-    }
-
-    case Dali::Pixel::BGRA8888:
-    {
-      if( channel == BLUE )
-      {
-        *pixelData = static_cast<unsigned char>( channelValue & 0xFF );
-      }
-      else if( channel == GREEN )
-      {
-        *(pixelData+1) = static_cast<unsigned char>( channelValue & 0xFF );
-      }
-      else if( channel == RED )
-      {
-        *(pixelData+2) = static_cast<unsigned char>( channelValue & 0xFF );
-      }
-      else if( channel == ALPHA )
-      {
-        *(pixelData+3) = static_cast<unsigned char>( channelValue & 0xFF );
-      }
-      break;
-    }
-
-    case Dali::Pixel::RGBA4444:
-    {
-      if( channel == RED )
-      {
-        *pixelData &= static_cast<unsigned char>( ~0xF0 );
-        *pixelData |= static_cast<unsigned char>( (channelValue << 4) & 0xF0 );
-      }
-      else if( channel == GREEN )
-      {
-        *pixelData &= static_cast<unsigned char>( ~0x0F );
-        *pixelData |= static_cast<unsigned char>( channelValue & 0x0F );
-      }
-      else if( channel == BLUE )
-      {
-        *(pixelData+1) &= static_cast<unsigned char>( ~0xF0 );
-        *(pixelData+1) |= static_cast<unsigned char>( (channelValue << 4) & 0xF0 );
-      }
-      else if( channel == ALPHA )
-      {
-        *(pixelData+1) &= static_cast<unsigned char>( ~0x0F );
-        *(pixelData+1) |= static_cast<unsigned char>( channelValue & 0x0F );
-      }
-      break;
-    }
-
-    case Dali::Pixel::BGRA4444:
-    {
-      if( channel == BLUE )
-      {
-        *pixelData &= static_cast<unsigned char>( ~0xF0 );
-        *pixelData |= static_cast<unsigned char>( (channelValue << 4) & 0xF0 );
-      }
-      else if( channel == GREEN )
-      {
-        *pixelData &= static_cast<unsigned char>( ~0x0F );
-        *pixelData |= static_cast<unsigned char>( channelValue & 0x0F );
-      }
-      else if( channel == RED )
-      {
-        *(pixelData+1) &= static_cast<unsigned char>( ~0xF0 );
-        *(pixelData+1) |= static_cast<unsigned char>( (channelValue << 4) & 0xF0 );
-      }
-      else if( channel == ALPHA )
-      {
-        *(pixelData+1) &= static_cast<unsigned char>( ~0x0F );
-        *(pixelData+1) |= static_cast<unsigned char>( channelValue & 0x0F );
-      }
-      break;
-    }
-
-    case Dali::Pixel::RGBA5551:
-    {
-      // rrrrrggg ggbbbbba
-      //    F8  7 C0  3E 1
-      if( channel == RED )
-      {
-        *pixelData &= static_cast<unsigned char>( ~0xF8 );
-        *pixelData |= static_cast<unsigned char>( (channelValue << 3) & 0xF8 );
-      }
-      else if( channel == GREEN )
-      {
-        *pixelData &= static_cast<unsigned char>( ~0x07 );
-        *pixelData |= static_cast<unsigned char>( (channelValue >> 2) & 0x07 );
-
-        *(pixelData+1) &= static_cast<unsigned char>( ~0xC0 );
-        *(pixelData+1) |= static_cast<unsigned char>( (channelValue << 6) & 0xC0 );
-      }
-      else if( channel == BLUE )
-      {
-        *(pixelData+1) &= static_cast<unsigned char>( ~0x3E );
-        *(pixelData+1) |= static_cast<unsigned char>( (channelValue << 1) & 0x3E );
-      }
-      else if( channel == ALPHA )
-      {
-        *(pixelData+1) &= static_cast<unsigned char>( ~0x01 );
-        *(pixelData+1) |= static_cast<unsigned char>( channelValue & 0x01 );
-      }
-      break;
-    }
-
-    case Dali::Pixel::BGRA5551:
-    {
-      if( channel == BLUE )
-      {
-        *pixelData &= static_cast<unsigned char>( ~0xF8 );
-        *pixelData |= static_cast<unsigned char>( (channelValue << 3) & 0xF8 );
-      }
-      else if( channel == GREEN )
-      {
-        *pixelData &= static_cast<unsigned char>( ~0x07 );
-        *pixelData |= static_cast<unsigned char>( (channelValue >> 2) & 0x07 );
-
-        *(pixelData+1) &= static_cast<unsigned char>( ~0xC0 );
-        *(pixelData+1) |= static_cast<unsigned char>( (channelValue << 6) & 0xC0 );
-      }
-      else if( channel == RED )
-      {
-        *(pixelData+1) &= static_cast<unsigned char>( ~0x3E );
-        *(pixelData+1) |= static_cast<unsigned char>( (channelValue << 1 ) & 0x3E );
-      }
-      else if( channel == ALPHA )
-      {
-        *(pixelData+1) &= static_cast<unsigned char>( ~0x01 );
-        *(pixelData+1) |= static_cast<unsigned char>( channelValue & 0x01 );
-      }
-      break;
-    }
-
-    case Dali::Pixel::DEPTH_UNSIGNED_INT:
-    case Dali::Pixel::DEPTH_FLOAT:
-    case Dali::Pixel::DEPTH_STENCIL:
-    {
-      break;
-    }
-
-    default:
-      break;
-  }
+  WriteChannelVisitor visitor = { pixelData, channel, channelValue };
+  VisitPixelFormat( pixelFormat, visitor );
 }
 
 void ConvertColorChannelsToRGBA8888(
   unsigned char* srcPixel,  int srcOffset,  Dali::Pixel::Format srcFormat,
   unsigned char* destPixel, int destOffset )
 {
-  int red   = ReadChannel(srcPixel+srcOffset, srcFormat, RED );
-  int green = ReadChannel(srcPixel+srcOffset, srcFormat, GREEN );
-  int blue  = ReadChannel(srcPixel+srcOffset, srcFormat, BLUE );
-  switch( srcFormat )
+  ConvertColorToRGBA8888Visitor visitor = { srcPixel + srcOffset, destPixel + destOffset };
+  if( ! VisitPixelFormat( srcFormat, visitor ) )
   {
-    case Dali::Pixel::RGB565:
-    case Dali::Pixel::BGR565:
-    {
-      red = (red<<3) | (red & 0x07);
-      green = (green << 2) | (green & 0x03);
-      blue = (blue<<3) | (blue & 0x07);
-      break;
-    }
-    case Dali::Pixel::RGBA4444:
-    case Dali::Pixel::BGRA4444:
-    {
-      red = (red<<4) | (red&0x0F);
-      green = (green<<4) | (green&0x0F);
-      blue = (blue<<4) | (blue&0x0F);
-      break;
-    }
-    case Dali::Pixel::RGBA5551:
-    case Dali::Pixel::BGRA5551:
-    {
-      red = (red<<3) | (red&0x07);
-      green = (green<<3) | (green&0x07);
-      blue = (blue<<3) | (blue&0x07);
-      break;
-    }
-    default:
-      break;
+    destPixel[destOffset] = destPixel[destOffset + 1] = destPixel[destOffset + 2] = 0u;
   }
-  WriteChannel(destPixel+destOffset, Dali::Pixel::RGBA8888, RED, red);
-  WriteChannel(destPixel+destOffset, Dali::Pixel::RGBA8888, GREEN, green);
-  WriteChannel(destPixel+destOffset, Dali::Pixel::RGBA8888, BLUE, blue);
 }
 
-
 int ConvertAlphaChannelToA8( unsigned char* srcPixel, int srcOffset, Dali::Pixel::Format srcFormat )
 {
-  int alpha = ReadChannel(srcPixel+srcOffset, srcFormat, ALPHA );
-  int destAlpha = alpha;
-  switch( srcFormat )
+  ConvertAlphaToA8Visitor visitor = { srcPixel + srcOffset, 0u };
+  VisitPixelFormat( srcFormat, visitor );
+  return static_cast<int>( visitor.result );
+}
+
+bool ConvertPixels( const unsigned char* srcBuffer, Dali::Pixel::Format srcFormat,
+                    unsigned char* destBuffer, Dali::Pixel::Format destFormat,
+                    unsigned int numPixels )
+{
+  // The common conversions have vectorised kernels, which leave the last few pixels to the generic loop:
+  unsigned int numConverted = 0u;
+  const ConvertPixelsKernel kernel = GetConvertPixelsKernel( srcFormat, destFormat );
+  if( kernel )
   {
-    case Pixel::RGBA5551:
-    case Pixel::BGRA5551:
-    {
-      destAlpha = (alpha==0)?0:255;
-      break;
-    }
-    case Pixel::RGBA4444:
-    case Pixel::BGRA4444:
-    {
-      destAlpha = (alpha<<4) | (alpha&0x0F);
-      break;
-    }
-    default:
-      break;
+    numConverted = kernel( srcBuffer, destBuffer, numPixels );
   }
-  return destAlpha;
+
+  ConvertFromVisitor visitor = { srcBuffer + numConverted * Dali::Pixel::GetBytesPerPixel( srcFormat ),
+                                 destBuffer + numConverted * Dali::Pixel::GetBytesPerPixel( destFormat ),
+                                 destFormat, numPixels - numConverted, false };
+  return VisitPixelFormat( srcFormat, visitor ) && visitor.result;
+}
+
+void MultiplyColorByAlpha( unsigned char* pixels, Dali::Pixel::Format pixelFormat, unsigned int numPixels )
+{
+  // Compressed, floating point and depth formats are skipped
+  MultiplyColorByAlphaVisitor visitor = { pixels, numPixels };
+  VisitPixelFormat( pixelFormat, visitor );
 }
 
 } // Adaptor
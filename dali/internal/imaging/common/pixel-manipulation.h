@@ -94,6 +94,38 @@ void ConvertColorChannelsToRGBA8888(
  */
 int ConvertAlphaChannelToA8( unsigned char* srcPixel, int srcOffset, Dali::Pixel::Format srcFormat );
 
+/**
+ * Convert a run of pixels from one format to another.
+ *
+ * The conversion loop is instantiated for each pair of formats, so there is no
+ * per-pixel branching on the formats. The most common pairs are converted with
+ * the vectorised kernels of GetConvertPixelsKernel() in pixel-format-conversion.h.
+ * See ConvertRow() in pixel-format-traits.h for how channels missing from the
+ * source are filled in. Code which knows its formats at compile time can call
+ * ConvertRow() directly.
+ * @param[in] srcBuffer The pixels to convert
+ * @param[in] srcFormat The pixel format of the source
+ * @param[out] destBuffer Where to write the converted pixels. May be the source itself if both
+ * formats have the same size of pixel, but must not otherwise overlap it.
+ * @param[in] destFormat The pixel format to convert to
+ * @param[in] numPixels The number of pixels to convert
+ * @return false, and nothing is written, if either format is compressed, floating point or depth
+ */
+bool ConvertPixels( const unsigned char* srcBuffer, Dali::Pixel::Format srcFormat,
+                    unsigned char* destBuffer, Dali::Pixel::Format destFormat,
+                    unsigned int numPixels );
+
+/**
+ * Multiply the color channels of a run of pixels by their alpha.
+ *
+ * Each channel is multiplied by the alpha value at the bit depth the format stores them,
+ * as PixelBuffer::MultiplyColorByAlpha() always has. Formats without alpha are left alone.
+ * @param[in,out] pixels The pixels to premultiply
+ * @param[in] pixelFormat The pixel format of the pixels
+ * @param[in] numPixels The number of pixels
+ */
+void MultiplyColorByAlpha( unsigned char* pixels, Dali::Pixel::Format pixelFormat, unsigned int numPixels );
+
 
 } // Adaptor
 } // Internal
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/common/worker-pool.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+namespace
+{
+
+const unsigned int MAXIMUM_WORKER_THREADS = 7u; ///< Image operations are memory bound well before this many cores are busy.
+
+} // unnamed namespace
+
+/**
+ * @brief The shared state of one ParallelFor() call.
+ */
+struct WorkerPool::Job
+{
+  Job( unsigned int count, unsigned int numBands, const RangeTask& task )
+  : task( task ),
+    count( count ),
+    numBands( numBands ),
+    nextBand( 0u ),
+    bandsRemaining( numBands )
+  {
+  }
+
+  const RangeTask&          task;           ///< Owned by the caller, which outlives all calls to it.
+  const unsigned int        count;          ///< The number of items in the range.
+  const unsigned int        numBands;       ///< The number of bands the range is split into.
+  std::atomic<unsigned int> nextBand;       ///< The next band to be claimed.
+  std::atomic<unsigned int> bandsRemaining; ///< The number of bands not yet finished.
+  std::mutex                mutex;          ///< Protects the wait for bandsRemaining to reach zero.
+  std::condition_variable   finished;       ///< Signalled when the last band has been processed.
+};
+
+WorkerPool& WorkerPool::Get()
+{
+  static WorkerPool pool( std::min( std::max( std::thread::hardware_concurrency(), 1u ) - 1u, MAXIMUM_WORKER_THREADS ) );
+  return pool;
+}
+
+WorkerPool::WorkerPool( unsigned int numWorkers )
+: mThreads(),
+  mQueue(),
+  mMutex(),
+  mCondition(),
+  mTerminate( false )
+{
+  mThreads.reserve( numWorkers );
+  for( unsigned int i = 0; i < numWorkers; ++i )
+  {
+    mThreads.push_back( std::thread( &WorkerPool::Run, this ) );
+  }
+}
+
+WorkerPool::~WorkerPool()
+{
+  {
+    std::lock_guard< std::mutex > lock( mMutex );
+    mTerminate = true;
+  }
+  mCondition.notify_all();
+
+  for( auto& thread : mThreads )
+  {
+    thread.join();
+  }
+}
+
+unsigned int WorkerPool::GetConcurrency() const
+{
+  return static_cast<unsigned int>( mThreads.size() ) + 1u;
+}
+
+void WorkerPool::ParallelFor( unsigned int count, unsigned int numBands, const RangeTask& task )
+{
+  numBands = std::min( numBands, count );
+  if( numBands <= 1u || mThreads.empty() )
+  {
+    if( count > 0u )
+    {
+      task( 0u, count );
+    }
+    return;
+  }
+
+  JobPtr job( new Job( count, numBands, task ) );
+
+  // Ask for as many helpers as there are bands the calling thread won't get to first:
+  const unsigned int numHelpers = std::min( numBands - 1u, static_cast<unsigned int>( mThreads.size() ) );
+  {
+    std::lock_guard< std::mutex > lock( mMutex );
+    for( unsigned int i = 0; i < numHelpers; ++i )
+    {
+      mQueue.push_back( job );
+    }
+  }
+  if( numHelpers == 1u )
+  {
+    mCondition.notify_one();
+  }
+  else
+  {
+    mCondition.notify_all();
+  }
+
+  ProcessBands( *job );
+
+  std::unique_lock< std::mutex > lock( job->mutex );
+  job->finished.wait( lock, [&job]{ return job->bandsRemaining.load() == 0u; } );
+}
+
+void WorkerPool::Run()
+{
+  for(;;)
+  {
+    JobPtr job;
+    {
+      std::unique_lock< std::mutex > lock( mMutex );
+      mCondition.wait( lock, [this]{ return mTerminate || !mQueue.empty(); } );
+      if( mTerminate )
+      {
+        return;
+      }
+      job = mQueue.front();
+      mQueue.pop_front();
+    }
+
+    ProcessBands( *job );
+  }
+}
+
+void WorkerPool::ProcessBands( Job& job )
+{
+  for( unsigned int band = job.nextBand++; band < job.numBands; band = job.nextBand++ )
+  {
+    // Split the range evenly so no band is more than one item bigger than another:
+    const unsigned int begin = static_cast<unsigned int>( ( static_cast<uint64_t>( job.count ) * band ) / job.numBands );
+    const unsigned int end = static_cast<unsigned int>( ( static_cast<uint64_t>( job.count ) * ( band + 1u ) ) / job.numBands );
+    job.task( begin, end );
+
+    if( --job.bandsRemaining == 0u )
+    {
+      // Take the lock so the notification can't slip in between the caller's check and its wait:
+      std::lock_guard< std::mutex > lock( job.mutex );
+      job.finished.notify_all();
+    }
+  }
+}
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Dali
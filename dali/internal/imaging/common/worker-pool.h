@@ -0,0 +1,126 @@
+#ifndef DALI_INTERNAL_PLATFORM_WORKER_POOL_H
+#define DALI_INTERNAL_PLATFORM_WORKER_POOL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+
+/**
+ * @brief A process-wide pool of threads used to split image processing work across cores.
+ *
+ * Work is submitted as a range of items (e.g. the scanlines of an output image)
+ * which is cut into contiguous bands. The bands are claimed by the pool's
+ * workers and by the calling thread, which takes part in the work and only
+ * returns once every band has been processed.
+ *
+ * Because the caller always helps with its own bands, the pool can be used
+ * from several threads at once (e.g. from the image loading threads) and
+ * can't deadlock if a band itself uses the pool.
+ */
+class WorkerPool
+{
+public:
+
+  /**
+   * @brief The work done on one band: process items [begin, end).
+   */
+  typedef std::function< void( unsigned int begin, unsigned int end ) > RangeTask;
+
+  /**
+   * @brief Get the process-wide pool, starting its threads on first use.
+   * @return The worker pool.
+   */
+  static WorkerPool& Get();
+
+  /**
+   * @brief The number of threads which can work on a range at once, including the caller.
+   * @return The number of worker threads plus one.
+   */
+  unsigned int GetConcurrency() const;
+
+  /**
+   * @brief Process a range of items in parallel, blocking until all are done.
+   *
+   * The range [0, count) is split into at most numBands contiguous bands of
+   * near-equal size. The task is called once per band, on an arbitrary thread.
+   * Bands must be independent of each other.
+   * @param[in] count The number of items in the range.
+   * @param[in] numBands The number of bands to split the range into. 1 runs the whole range on the calling thread.
+   * @param[in] task The function to apply to each band.
+   */
+  void ParallelFor( unsigned int count, unsigned int numBands, const RangeTask& task );
+
+private:
+
+  struct Job;
+  typedef std::shared_ptr< Job > JobPtr;
+
+  /**
+   * @brief Constructor.
+   * @param[in] numWorkers The number of threads to start.
+   */
+  explicit WorkerPool( unsigned int numWorkers );
+
+  /**
+   * @brief Destructor. Stops and joins the worker threads.
+   */
+  ~WorkerPool();
+
+  /**
+   * @brief The main loop of each worker thread.
+   */
+  void Run();
+
+  /**
+   * @brief Claim and process bands of a job until none are left.
+   * @param[in] job The job to work on.
+   */
+  static void ProcessBands( Job& job );
+
+  // Undefined
+  WorkerPool( const WorkerPool& );
+  WorkerPool& operator=( const WorkerPool& );
+
+private:
+
+  std::vector< std::thread > mThreads;  ///< The worker threads.
+  std::deque< JobPtr >       mQueue;    ///< Jobs waiting for a worker. A job is queued once per worker wanted on it.
+  std::mutex                 mMutex;    ///< Protects mQueue and mTerminate.
+  std::condition_variable    mCondition;///< Signalled when a job is queued or the pool is stopping.
+  bool                       mTerminate;///< Set to stop the worker threads.
+};
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Dali
+
+#endif // DALI_INTERNAL_PLATFORM_WORKER_POOL_H
@@ -28,6 +28,7 @@
 #include <dali/internal/graphics/common/egl-image-extensions.h>
 #include <dali/internal/graphics/gles/egl-graphics.h>
 #include <dali/internal/adaptor/common/adaptor-impl.h>
+#include <dali/internal/imaging/common/pixel-manipulation.h>
 #include <dali/devel-api/adaptor-framework/bitmap-saver.h>
 #include <dali/integration-api/adaptor-framework/render-surface-interface.h>
 
@@ -187,20 +188,32 @@ bool NativeImageSourceX::GetPixels(std::vector<unsigned char>& pixbuf, unsigned&
         pixbuf.resize(width*height*3);
         unsigned char* bufPtr = &pixbuf[0];
 
-        for(unsigned y = height-1; y < height; --y)
+        if( pXImage->data && pXImage->bits_per_pixel == 32 && pXImage->byte_order == LSBFirst )
         {
-          for(unsigned x = 0; x < width; ++x, bufPtr+=3)
+          // Each pixel is stored as the bytes B, G, R and padding, so whole scanlines can be converted at once:
+          for(unsigned y = height-1; y < height; --y, bufPtr += width * 3)
           {
-            const unsigned pixel = XGetPixel(pXImage,x,y);
-
-            // store as RGB
-            const unsigned blue  =  pixel & 0xFFU;
-            const unsigned green = (pixel >> 8)  & 0xFFU;
-            const unsigned red   = (pixel >> 16) & 0xFFU;
-
-            *bufPtr = red;
-            *(bufPtr+1) = green;
-            *(bufPtr+2) = blue;
+            const unsigned char* const in = reinterpret_cast< const unsigned char* >( pXImage->data + pXImage->bytes_per_line * y );
+            ConvertPixels( in, Pixel::BGR8888, bufPtr, Pixel::RGB888, width );
+          }
+        }
+        else
+        {
+          for(unsigned y = height-1; y < height; --y)
+          {
+            for(unsigned x = 0; x < width; ++x, bufPtr+=3)
+            {
+              const unsigned pixel = XGetPixel(pXImage,x,y);
+
+              // store as RGB
+              const unsigned blue  =  pixel & 0xFFU;
+              const unsigned green = (pixel >> 8)  & 0xFFU;
+              const unsigned red   = (pixel >> 16) & 0xFFU;
+
+              *bufPtr = red;
+              *(bufPtr+1) = green;
+              *(bufPtr+2) = blue;
+            }
           }
         }
         success = true;
@@ -111,7 +111,8 @@ Integration::BitmapPtr TizenPlatformAbstraction::DecodeBuffer( const Integration
   FILE * const fp = fileReader.GetFile();
   if( fp )
   {
-    bool result = ImageLoader::ConvertStreamToBitmap( resource, "", fp, bitmap );
+    // The Bitmap has nowhere to keep metadata:
+    bool result = ImageLoader::ConvertStreamToBitmap( resource, "", fp, bitmap, false );
     if ( !result || !bitmap )
     {
       bitmap.Reset();
@@ -134,7 +135,7 @@ Integration::BitmapPtr TizenPlatformAbstraction::DecodeBuffer( const Integration
 
       auto& impl = Dali::GetImplementation(bitmap);
 
-      std::copy( impl.GetBuffer(), impl.GetBuffer()+impl.GetBufferSize(), retval->GetBuffer());
+      std::copy( impl.GetConstBuffer(), impl.GetConstBuffer()+impl.GetBufferSize(), retval->GetBuffer());
       resultBitmap.Reset(retval);
     }
   }
@@ -28,6 +28,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/integration-api/adaptor-framework/adaptor.h>
+#include <dali/devel-api/adaptor-framework/bitmap-saver.h>
 
 namespace
 {
@@ -306,7 +307,16 @@ bool Capture::SaveFile()
 {
   DALI_ASSERT_ALWAYS(mNativeImageSourcePtr && "mNativeImageSourcePtr is NULL");
 
-  return mNativeImageSourcePtr->EncodeToFile( mPath );
+  std::vector< unsigned char > buffer;
+  unsigned int width( 0 ), height( 0 );
+  Pixel::Format pixelFormat;
+  if( !mNativeImageSourcePtr->GetPixels( buffer, width, height, pixelFormat ) )
+  {
+    return false;
+  }
+
+  // Captures are usually the size of the screen, so compress a PNG in strips on several threads:
+  return Dali::EncodeToFile( &buffer[0], mPath, pixelFormat, width, height, true );
 }
 
 }  // End of namespace Adaptor
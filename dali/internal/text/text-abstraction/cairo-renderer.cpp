@@ -35,6 +35,7 @@
 #include <dali/devel-api/text-abstraction/font-client.h>
 #include <dali/devel-api/text-abstraction/text-renderer-layout-helper.h>
 #include <dali/integration-api/debug.h>
+#include <dali/internal/imaging/common/buffer-pool.h>
 #include <dali/internal/imaging/common/image-operations.h>
 #include <dali/internal/text/text-abstraction/font-client-impl.h>
 
@@ -78,18 +79,19 @@ struct GlyphRun
  *
  * The font client allocates a bitmap's buffer with the new operator.
  * However, the PixelBuffer class allocates the buffer with the
- * malloc() function and the Rotate() function which is intended
- * for the PixelBuffer as well allocates memory with malloc().
+ * malloc() function and the RotateByShear() function allocates it
+ * from the image buffer pool.
  *
  * This struct keeps the type of allocation and uses the delete[]
- * operator or the free() function to deallocate resources.
+ * operator, the free() function or the buffer pool to deallocate resources.
  */
 struct GlyphBuffer
 {
   enum DestructorType
   {
     FREE,
-    DELETE
+    DELETE,
+    POOLED
   };
 
   GlyphBuffer( Dali::TextAbstraction::FontClient::GlyphBufferData& data, DestructorType type )
@@ -110,6 +112,12 @@ struct GlyphBuffer
       case DELETE:
       {
         delete[] data.buffer;
+        break;
+      }
+      case POOLED:
+      {
+        Dali::Internal::Platform::BufferPool::Get().Release( data.buffer );
+        break;
       }
     }
   }
@@ -570,7 +578,7 @@ Devel::PixelBuffer RenderTextCairo( const TextAbstraction::TextRenderer::Paramet
             {
               delete[] data.buffer;
               data.buffer = pixelsOut;
-              glyphBufferPtr.get()->type = GlyphBuffer::FREE;
+              glyphBufferPtr.get()->type = GlyphBuffer::POOLED;
               data.width = widthOut;
               data.height = heightOut;
             }
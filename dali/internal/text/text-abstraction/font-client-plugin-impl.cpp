@@ -26,6 +26,7 @@
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/platform-abstraction.h>
 #include <dali/internal/text/text-abstraction/font-client-helper.h>
+#include <dali/internal/imaging/common/buffer-pool.h>
 #include <dali/internal/imaging/common/image-operations.h>
 #include <dali/internal/adaptor/common/adaptor-impl.h>
 #include <dali/devel-api/adaptor-framework/image-loading.h>
@@ -2293,7 +2294,8 @@ void FontClient::Plugin::ConvertBitmap( TextAbstraction::FontClient::GlyphBuffer
           unsigned int width = srcBitmap.width;
           unsigned height = srcBitmap.rows;
 
-          std::unique_ptr<uint8_t, void(*)(void*)> pixelsOutPtr( nullptr, free );
+          // The sheared bitmap comes from the image buffer pool, so it is given back to it:
+          std::unique_ptr<uint8_t, void(*)(uint8_t*)> pixelsOutPtr( nullptr, []( uint8_t* buffer ) { Dali::Internal::Platform::BufferPool::Get().Release( buffer ); } );
 
           if( isShearRequired )
           {
@@ -1008,6 +1008,37 @@ void Resampler::restart()
    }
 }
 
+Resampler::Contrib_List* Resampler::create_clist(
+   int src_x, int dst_x,
+   Boundary_Op boundary_op,
+   Resampler::Filter filter,
+   Resample_Real filter_scale,
+   Resample_Real src_ofs)
+{
+   int i;
+
+   resampler_assert(src_x > 0);
+   resampler_assert(dst_x > 0);
+
+   for (i = 0; i < NUM_FILTERS; i++)
+      if ( filter ==  g_filters[i].name )
+         break;
+
+   if (i == NUM_FILTERS)
+      return NULL;
+
+   return make_clist(src_x, dst_x, boundary_op, g_filters[i].func, g_filters[i].support, filter_scale, src_ofs);
+}
+
+void Resampler::free_clist(Contrib_List* Pclist)
+{
+   if (Pclist)
+   {
+      free(Pclist->p);
+      free(Pclist);
+   }
+}
+
 Resampler::Resampler(int src_x, int src_y,
                      int dst_x, int dst_y,
                      Boundary_Op boundary_op,
@@ -103,6 +103,19 @@ public:
    Contrib_List* get_clist_x() const {	return m_Pclist_x; }
    Contrib_List* get_clist_y() const {	return m_Pclist_y; }
 
+   // Creates contributor lists for one axis without a Resampler, so they can be kept and passed
+   // to any number of Resamplers with the same source and destination size on that axis.
+   // NULL on out of memory or an unknown filter. Free with free_clist().
+   static Contrib_List* create_clist(
+      int src_x, int dst_x,
+      Boundary_Op boundary_op,
+      Resampler::Filter filter,
+      Resample_Real filter_scale = 1.0f,
+      Resample_Real src_ofs = 0.0f);
+
+   // Frees contributor lists returned by create_clist().
+   static void free_clist(Contrib_List* Pclist);
+
 private:
    Resampler();
    Resampler(const Resampler& o);
@@ -157,9 +170,9 @@ private:
    void clamp(Sample* Pdst, int n);
    void resample_y(Sample* Pdst);
 
-   int reflect(const int j, const int src_x, const Boundary_Op boundary_op);
+   static int reflect(const int j, const int src_x, const Boundary_Op boundary_op);
 
-   Contrib_List* make_clist(
+   static Contrib_List* make_clist(
       int src_x, int dst_x, Boundary_Op boundary_op,
       Resample_Real (*Pfilter)(Resample_Real),
       Resample_Real filter_support,